@@ -0,0 +1,61 @@
+/**
+ * @brief HTTP Server Example (keep-alive, pipelining, sharded)
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/http_server.hpp"
+#include "net/sharded_listener.hpp"
+#include "printer.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+#if RICKY_LINUX
+
+using namespace my;
+using namespace my::net::http;
+
+int main() {
+    io::println("=== HTTP Server Demo ===");
+
+    Router router;
+    router.get("/"_sv, [](const Request&, Response& res) {
+        res.content_type("text/plain"_sv).body("Welcome to ricky_cpp HTTP server"_sv);
+    });
+    router.get("/hello"_sv, [](const Request& req, Response& res) {
+        str::String<> body{"Hello, "};
+        body.push_str(req.query_param("name"_sv).unwrap_or("world"_sv));
+        res.content_type("text/plain"_sv).body(std::move(body));
+    });
+    router.post("/submit"_sv, [](const Request& req, Response& res) {
+        io::println("Received ", req.body.len(), " bytes: ", req.body);
+        res.status(201).content_type("text/plain"_sv).body(req.body);
+    });
+    router.get("/static/*"_sv, [](const Request& req, Response& res) {
+        res.content_type("text/plain"_sv).body(req.path);
+    });
+    router.get("/old"_sv, [](const Request&, Response& res) {
+        res.status(301).header("Location"_sv, "/"_sv);
+    });
+
+    HttpServer server(router);
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 8080).nodelay(true).build_sharded();
+    listener->start([&server](std::unique_ptr<net::AsyncTcpStream> s) { return server.serve_connection(std::move(s)); });
+    io::println("Listening on http://127.0.0.1:", listener->local_port(), " with ", listener->num_shards(), " shards, Ctrl+C to quit");
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::unique_lock lock(mtx);
+    cv.wait(lock, [] { return false; });
+    return 0;
+}
+
+#else
+
+int main() {
+    my::io::println("The event loop is only supported on Linux");
+    return 0;
+}
+
+#endif // RICKY_LINUX
@@ -313,6 +313,9 @@ void trace_str_string() {
 }
 
 int main() {
+    // 记录每一次分配，精确检测泄漏
+    mem::MemoryTracer::instance().set_sample_interval(0);
+
 #if TRACE_OBJECT == 1
     trace_cstring();
 #elif TRACE_OBJECT == 2
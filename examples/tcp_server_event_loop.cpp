@@ -0,0 +1,55 @@
+/**
+ * @brief TCP Server Example (event loop)
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/async_tcp.hpp"
+#include "printer.hpp"
+
+#if RICKY_LINUX
+
+using namespace my;
+
+coro::Task<> echo(std::unique_ptr<net::AsyncTcpStream> client, const usize id) {
+    client->set_idle_timeout(30'000);
+    try {
+        loop {
+            auto data = co_await client->read(1024);
+            if (data.len() == 0) break;
+            io::println("Client #", id, ": ", data.as_str());
+            co_await client->write(data.as_str());
+        }
+        io::println("Client #", id, " disconnected");
+    } catch (const Exception& e) {
+        io::println("Client #", id, " closed: ", e.what());
+    }
+}
+
+coro::Task<> serve(net::EventLoop& event_loop, net::AsyncTcpListener& listener) {
+    for (usize id = 1;; ++id) {
+        event_loop.spawn(echo(co_await listener.accept(), id));
+    }
+}
+
+int main() {
+    io::println("=== TCP Server Demo (event loop) ===");
+
+    net::EventLoop event_loop;
+    net::AsyncTcpListener listener(event_loop, "127.0.0.1"_sv, 8080);
+    io::println("Server listening on port: ", listener.local_port());
+    io::println("Serving any number of clients on a single thread, Ctrl+C to quit");
+
+    event_loop.spawn(serve(event_loop, listener));
+    event_loop.run();
+    return 0;
+}
+
+#else
+
+int main() {
+    my::io::println("The event loop is only supported on Linux");
+    return 0;
+}
+
+#endif // RICKY_LINUX
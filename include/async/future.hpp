@@ -0,0 +1,310 @@
+/**
+ * @brief 轻量 Future/Promise，共享状态来自 SlabPool
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef ASYNC_FUTURE_HPP
+#define ASYNC_FUTURE_HPP
+
+#include "my_exception.hpp"
+#include "slab_pool.hpp"
+
+#include <atomic>
+#include <exception>
+#include <type_traits>
+
+namespace my::async {
+
+namespace detail {
+
+/**
+ * @brief void 结果的占位类型
+ */
+struct Unit {};
+
+/**
+ * @brief Future 与 Promise 之间的共享状态，引用计数管理生命周期
+ */
+template <typename T>
+class SharedState : public NoCopyMove {
+public:
+    using value_t = std::conditional_t<std::is_void_v<T>, Unit, T>;
+    using Self = SharedState<T>;
+
+    static constexpr u32 PENDING = 0;
+    static constexpr u32 VALUE = 1;
+    static constexpr u32 ERROR = 2;
+
+    static Self* create() {
+        void* p = pool().allocate();
+        return ::new (p) Self();
+    }
+
+    void retain() noexcept {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            this->~Self();
+            pool().deallocate(this);
+        }
+    }
+
+    template <typename... Args>
+    void set_value(Args&&... args) {
+        ensure_pending();
+        ::new (static_cast<void*>(&value_)) value_t(std::forward<Args>(args)...);
+        publish(VALUE);
+    }
+
+    void set_exception(std::exception_ptr e) {
+        ensure_pending();
+        error_ = std::move(e);
+        publish(ERROR);
+    }
+
+    [[nodiscard]] bool is_ready() const noexcept {
+        return status_.load(std::memory_order_acquire) != PENDING;
+    }
+
+    void wait() const noexcept {
+        for (u32 s = status_.load(std::memory_order_acquire); s == PENDING; s = status_.load(std::memory_order_acquire)) {
+            status_.wait(PENDING, std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief 取出结果，仅可调用一次
+     */
+    value_t take() {
+        wait();
+        if (status_.load(std::memory_order_relaxed) == ERROR) {
+            std::rethrow_exception(error_);
+        }
+        return std::move(value_);
+    }
+
+    [[nodiscard]] bool satisfied() const noexcept {
+        return satisfied_;
+    }
+
+private:
+    SharedState() noexcept {}
+
+    static auto& pool() {
+        return SlabPool<sizeof(Self), alignof(Self)>::instance();
+    }
+
+    ~SharedState() {
+        if (status_.load(std::memory_order_relaxed) == VALUE) {
+            value_.~value_t();
+        }
+    }
+
+    void ensure_pending() const {
+        if (satisfied_) {
+            throw state_exception("Promise already satisfied");
+        }
+    }
+
+    void publish(const u32 status) noexcept {
+        satisfied_ = true;
+        status_.store(status, std::memory_order_release);
+        status_.notify_all();
+    }
+
+private:
+    std::atomic<u32> status_{PENDING};
+    std::atomic<u32> refs_{1};
+    bool satisfied_{false}; // 仅 Promise 一侧访问
+    std::exception_ptr error_;
+    union {
+        value_t value_;
+    };
+};
+
+} // namespace detail
+
+template <typename T>
+class Promise;
+
+/**
+ * @class Future
+ * @brief 只移动的异步结果句柄
+ * @details 与 std::future 相比不需要堆上的共享状态，也不持有互斥量，等待基于 std::atomic::wait
+ */
+template <typename T>
+class Future : public NoCopy {
+public:
+    using Self = Future<T>;
+    using State = detail::SharedState<T>;
+
+    Future() noexcept = default;
+
+    Future(Self&& other) noexcept :
+            state_(other.state_) {
+        other.state_ = nullptr;
+    }
+
+    Self& operator=(Self&& other) noexcept {
+        if (this == &other) return *this;
+
+        reset();
+        state_ = other.state_;
+        other.state_ = nullptr;
+        return *this;
+    }
+
+    ~Future() {
+        reset();
+    }
+
+    /**
+     * @brief 是否关联共享状态
+     */
+    [[nodiscard]] bool is_valid() const noexcept {
+        return state_ != nullptr;
+    }
+
+    /**
+     * @brief 结果是否已就绪（不阻塞）
+     */
+    [[nodiscard]] bool is_ready() const noexcept {
+        return state_ != nullptr && state_->is_ready();
+    }
+
+    /**
+     * @brief 阻塞直到结果就绪
+     */
+    void wait() const {
+        check();
+        state_->wait();
+    }
+
+    /**
+     * @brief 阻塞获取结果，调用后 Future 失效
+     * @exception 重新抛出任务中抛出的异常
+     */
+    T get() {
+        check();
+        State* state = state_;
+        state_ = nullptr;
+        struct Guard {
+            State* s;
+            ~Guard() { s->release(); }
+        } guard{state};
+
+        if constexpr (std::is_void_v<T>) {
+            state->take();
+        } else {
+            return state->take();
+        }
+    }
+
+private:
+    friend class Promise<T>;
+
+    explicit Future(State* state) noexcept :
+            state_(state) {}
+
+    void check() const {
+        if (state_ == nullptr) {
+            throw state_exception("Future has no associated state");
+        }
+    }
+
+    void reset() noexcept {
+        if (state_) {
+            state_->release();
+            state_ = nullptr;
+        }
+    }
+
+private:
+    State* state_{nullptr};
+};
+
+/**
+ * @class Promise
+ * @brief Future 的写入端
+ * @note 未设置结果即析构时，Future 会收到 state_exception("Broken promise")
+ */
+template <typename T>
+class Promise : public NoCopy {
+public:
+    using Self = Promise<T>;
+    using State = detail::SharedState<T>;
+
+    Promise() :
+            state_(State::create()) {}
+
+    Promise(Self&& other) noexcept :
+            state_(other.state_), future_taken_(other.future_taken_) {
+        other.state_ = nullptr;
+    }
+
+    Self& operator=(Self&& other) noexcept {
+        if (this == &other) return *this;
+
+        abandon();
+        state_ = other.state_;
+        future_taken_ = other.future_taken_;
+        other.state_ = nullptr;
+        return *this;
+    }
+
+    ~Promise() {
+        abandon();
+    }
+
+    /**
+     * @brief 获取关联的 Future，仅可调用一次
+     */
+    Future<T> get_future() {
+        check();
+        if (future_taken_) {
+            throw state_exception("Future already retrieved");
+        }
+        future_taken_ = true;
+        state_->retain();
+        return Future<T>(state_);
+    }
+
+    template <typename... Args>
+    void set_value(Args&&... args) {
+        check();
+        state_->set_value(std::forward<Args>(args)...);
+    }
+
+    void set_exception(std::exception_ptr e) {
+        check();
+        state_->set_exception(std::move(e));
+    }
+
+private:
+    void check() const {
+        if (state_ == nullptr) {
+            throw state_exception("Promise has no associated state");
+        }
+    }
+
+    void abandon() noexcept {
+        if (state_ == nullptr) return;
+
+        if (!state_->satisfied()) {
+            state_->set_exception(std::make_exception_ptr(state_exception("Broken promise")));
+        }
+        state_->release();
+        state_ = nullptr;
+    }
+
+private:
+    State* state_{nullptr};
+    bool future_taken_{false};
+};
+
+} // namespace my::async
+
+#endif // ASYNC_FUTURE_HPP
@@ -0,0 +1,394 @@
+/**
+ * @brief 基于线程池的数据并行算法
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef ASYNC_PARALLEL_HPP
+#define ASYNC_PARALLEL_HPP
+
+#include "thread_pool.hpp"
+#include "vec.hpp"
+#include "option.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <memory>
+
+namespace my::async {
+
+namespace par {
+
+/**
+ * @brief 可按下标随机访问的序列，如 util::Vec、util::Array、util::DynArray
+ */
+template <typename S>
+concept IndexedSeq = requires(S& s, usize i) {
+    { s.len() } -> std::convertible_to<usize>;
+    s.at(i);
+};
+
+/**
+ * @brief 元素连续存放的序列
+ */
+template <typename S>
+concept ContiguousSeq = IndexedSeq<S> && requires(S& s) {
+    { s.data() } -> std::convertible_to<const void*>;
+};
+
+template <IndexedSeq S>
+using seq_value_t = std::remove_cvref_t<decltype(std::declval<S&>().at(0))>;
+
+namespace detail {
+
+/**
+ * @brief 每个线程期望分到的块数，多切几块以便负载均衡
+ */
+inline constexpr usize CHUNKS_PER_THREAD = 8;
+
+/**
+ * @brief 自动粒度：按线程数切块，粒度至少为 1
+ */
+inline usize auto_grain(const ThreadPool& pool, const usize n) {
+    const usize target = std::max<usize>(1, pool.num_threads()) * CHUNKS_PER_THREAD;
+    return std::max<usize>(1, (n + target - 1) / target);
+}
+
+/**
+ * @brief 一次并行调用的共享状态
+ * @details 块按原子下标动态认领，调用线程本身也参与执行，因此即使线程池繁忙、
+ *          已停止或在工作线程内嵌套调用也不会死锁。调用线程只等待已认领块全部完成；
+ *          迟到的辅助任务认领不到块即退出，共享状态由 shared_ptr 保活，不会访问调用方栈上的 body。
+ */
+template <typename Body>
+struct Job {
+    Body* body;
+    usize first;
+    usize last;
+    usize grain;
+    usize chunks;
+    std::atomic<usize> next{0};
+    std::atomic<usize> done{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+
+    Job(Body* body, const usize first, const usize last, const usize grain) :
+            body(body), first(first), last(last), grain(grain), chunks((last - first + grain - 1) / grain) {}
+
+    void work() {
+        loop {
+            const usize c = next.fetch_add(1, std::memory_order_relaxed);
+            if (c >= chunks) {
+                return;
+            }
+            if (!failed.load(std::memory_order_relaxed)) {
+                const usize lo = first + c * grain;
+                try {
+                    (*body)(c, lo, std::min(lo + grain, last));
+                } catch (...) {
+                    if (!failed.exchange(true, std::memory_order_relaxed)) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+            if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == chunks) {
+                done.notify_all();
+            }
+        }
+    }
+
+    void wait() const {
+        for (usize d = done.load(std::memory_order_acquire); d != chunks; d = done.load(std::memory_order_acquire)) {
+            done.wait(d, std::memory_order_acquire);
+        }
+    }
+};
+
+/**
+ * @brief 将 [first, last) 按 grain 切块并行执行 body(chunk_index, lo, hi)
+ * @note 块的划分只取决于 first/last/grain，与调度无关，归约结果因此是确定的
+ * @exception 重新抛出第一个块抛出的异常，其余块跳过执行
+ */
+template <typename Body>
+void for_each_chunk(ThreadPool& pool, const usize first, const usize last, const usize grain, Body&& body) {
+    if (first >= last) return;
+
+    const usize chunks = (last - first + grain - 1) / grain;
+    const usize helpers = std::min(pool.num_threads(), chunks - 1);
+    if (helpers == 0) {
+        for (usize c = 0; c < chunks; ++c) {
+            const usize lo = first + c * grain;
+            body(c, lo, std::min(lo + grain, last));
+        }
+        return;
+    }
+
+    using B = std::remove_reference_t<Body>;
+    auto job = std::make_shared<Job<B>>(&body, first, last, grain);
+    for (usize i = 0; i < helpers; ++i) {
+        pool.execute([job]() { job->work(); });
+    }
+    job->work();
+    job->wait();
+    if (job->failed.load(std::memory_order_relaxed)) {
+        std::rethrow_exception(job->error);
+    }
+}
+
+/**
+ * @brief 在已排序的 a[0..na) 与 b[0..nb) 合并结果的第 diag 个位置，求取自 a 的元素个数
+ * @details merge path 划分，相等时 a 优先，保证合并稳定
+ */
+template <typename T, typename Comp>
+usize merge_path(const T* a, const usize na, const T* b, const usize nb, const usize diag, Comp& comp) {
+    usize lo = diag > nb ? diag - nb : 0;
+    usize hi = std::min(diag, na);
+    while (lo < hi) {
+        const usize mid = lo + (hi - lo) / 2;
+        if (!comp(b[diag - mid - 1], a[mid])) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief 在连续缓冲区上做并行归并排序，结果写回 data
+ */
+template <typename T, typename Comp>
+void merge_sort(ThreadPool& pool, T* data, const usize n, Comp& comp) {
+    const usize grain = std::max<usize>(auto_grain(pool, n), 1024);
+    const usize runs = (n + grain - 1) / grain;
+
+    // 1. 各块独立稳定排序
+    for_each_chunk(pool, 0, n, grain, [&](usize, usize lo, usize hi) {
+        std::stable_sort(data + lo, data + hi, comp);
+    });
+    if (runs <= 1) return;
+
+    // 2. 逐轮两两归并，每轮把所有输出按 grain 切片并行，最后一轮也能吃满线程
+    auto scratch = std::make_unique<T[]>(n);
+    T* src = data;
+    T* dst = scratch.get();
+    for (usize width = grain; width < n; width <<= 1) {
+        for_each_chunk(pool, 0, n, grain, [&](usize, usize lo, usize hi) {
+            while (lo < hi) {
+                const usize base = lo / (width << 1) * (width << 1);
+                const usize mid = std::min(base + width, n);
+                const usize end = std::min(base + (width << 1), n);
+                const usize stop = std::min(hi, end);
+                T* a = src + base;
+                T* b = src + mid;
+                const usize na = mid - base, nb = end - mid;
+                const usize i0 = merge_path(a, na, b, nb, lo - base, comp);
+                const usize i1 = merge_path(a, na, b, nb, stop - base, comp);
+                std::merge(std::make_move_iterator(a + i0),
+                           std::make_move_iterator(a + i1),
+                           std::make_move_iterator(b + (lo - base - i0)),
+                           std::make_move_iterator(b + (stop - base - i1)),
+                           dst + lo, comp);
+                lo = stop;
+            }
+        });
+        std::swap(src, dst);
+    }
+
+    if (src != data) {
+        for_each_chunk(pool, 0, n, grain, [&](usize, usize lo, usize hi) {
+            std::move(src + lo, src + hi, data + lo);
+        });
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief 并行执行 fn(i)，i 取遍 [first, last)
+ * @param grain 每块的下标个数，为 0 时自动选取
+ * @exception 重新抛出 fn 抛出的第一个异常
+ */
+template <typename F>
+void parallel_for(ThreadPool& pool, const usize first, const usize last, F&& fn, usize grain = 0) {
+    if (first >= last) return;
+    if (grain == 0) {
+        grain = detail::auto_grain(pool, last - first);
+    }
+    detail::for_each_chunk(pool, first, last, grain, [&fn](usize, usize lo, usize hi) {
+        for (usize i = lo; i < hi; ++i) {
+            fn(i);
+        }
+    });
+}
+
+template <typename F>
+void parallel_for(const usize first, const usize last, F&& fn, usize grain = 0) {
+    parallel_for(global_pool(), first, last, std::forward<F>(fn), grain);
+}
+
+/**
+ * @brief 并行映射归约：init ⊕ transform(seq[0]) ⊕ ... ⊕ transform(seq[n-1])
+ * @note reduce 需满足结合律，不要求交换律；块内顺序及块间合并顺序均与下标顺序一致
+ */
+template <IndexedSeq S, typename T, typename Reduce, typename Transform>
+T parallel_transform_reduce(ThreadPool& pool, const S& seq, T init, Reduce reduce, Transform transform) {
+    const usize n = seq.len();
+    if (n == 0) return init;
+
+    const usize grain = detail::auto_grain(pool, n);
+    util::Vec<Option<T>> partials((n + grain - 1) / grain, Option<T>::None());
+    detail::for_each_chunk(pool, 0, n, grain, [&](usize c, usize lo, usize hi) {
+        T acc = transform(seq.at(lo));
+        for (usize i = lo + 1; i < hi; ++i) {
+            acc = reduce(std::move(acc), transform(seq.at(i)));
+        }
+        partials.at(c) = Option<T>::Some(std::move(acc));
+    });
+
+    for (auto& partial : partials) {
+        init = reduce(std::move(init), std::move(partial.unwrap()));
+    }
+    return init;
+}
+
+template <IndexedSeq S, typename T, typename Reduce, typename Transform>
+T parallel_transform_reduce(const S& seq, T init, Reduce reduce, Transform transform) {
+    return parallel_transform_reduce(global_pool(), seq, std::move(init), std::move(reduce), std::move(transform));
+}
+
+/**
+ * @brief 并行归约：init ⊕ seq[0] ⊕ ... ⊕ seq[n-1]
+ */
+template <IndexedSeq S, typename T, typename Reduce = std::plus<>>
+T parallel_reduce(ThreadPool& pool, const S& seq, T init, Reduce reduce = {}) {
+    return parallel_transform_reduce(pool, seq, std::move(init), std::move(reduce), [](const auto& x) -> T { return x; });
+}
+
+template <IndexedSeq S, typename T, typename Reduce = std::plus<>>
+T parallel_reduce(const S& seq, T init, Reduce reduce = {}) {
+    return parallel_reduce(global_pool(), seq, std::move(init), std::move(reduce));
+}
+
+namespace detail {
+
+/**
+ * @brief 三趟并行扫描：块内归约、块间串行前缀、带进位的块内扫描
+ * @note in 与 out 可以是同一个序列
+ */
+template <bool Inclusive, typename In, typename Out, typename T, typename Op>
+void scan(ThreadPool& pool, const In& in, Out& out, Option<T> init, Op& op) {
+    const usize n = in.len();
+    if (out.len() < n) {
+        throw argument_exception("Scan output length {} is less than input length {}", out.len(), n);
+    }
+    if (n == 0) return;
+
+    const usize grain = auto_grain(pool, n);
+    const usize chunks = (n + grain - 1) / grain;
+    util::Vec<Option<T>> carries(chunks, Option<T>::None());
+
+    // 1. 块内归约，最后一块的结果用不到
+    for_each_chunk(pool, 0, (chunks - 1) * grain, grain, [&](usize c, usize lo, usize hi) {
+        T acc = in.at(lo);
+        for (usize i = lo + 1; i < hi; ++i) {
+            acc = op(std::move(acc), in.at(i));
+        }
+        carries.at(c) = Option<T>::Some(std::move(acc));
+    });
+
+    // 2. 串行前缀：carries[c] 变为第 c 块之前全部元素（含 init）的归约
+    Option<T> carry = std::move(init);
+    for (usize c = 0; c < chunks; ++c) {
+        Option<T> sum = std::move(carries.at(c));
+        carries.at(c) = carry;
+        if (sum.is_some()) {
+            carry = carry.is_some() ? Option<T>::Some(op(std::move(carry.unwrap()), std::move(sum.unwrap())))
+                                    : std::move(sum);
+        }
+    }
+
+    // 3. 带进位扫描
+    for_each_chunk(pool, 0, n, grain, [&](usize c, usize lo, usize hi) {
+        Option<T> acc = std::move(carries.at(c));
+        for (usize i = lo; i < hi; ++i) {
+            T x = in.at(i);
+            if constexpr (Inclusive) {
+                acc = acc.is_some() ? Option<T>::Some(op(std::move(acc.unwrap()), std::move(x))) : Option<T>::Some(std::move(x));
+                out.at(i) = acc.unwrap();
+            } else {
+                out.at(i) = acc.unwrap();
+                acc = Option<T>::Some(op(std::move(acc.unwrap()), std::move(x)));
+            }
+        }
+    });
+}
+
+} // namespace detail
+
+/**
+ * @brief 并行包含式前缀扫描：out[i] = in[0] ⊕ ... ⊕ in[i]
+ * @exception Exception 若 out 长度小于 in，则抛出 argument_exception
+ */
+template <IndexedSeq In, IndexedSeq Out, typename Op = std::plus<>>
+void parallel_inclusive_scan(ThreadPool& pool, const In& in, Out& out, Op op = {}) {
+    using T = seq_value_t<const In>;
+    detail::scan<true>(pool, in, out, Option<T>::None(), op);
+}
+
+template <IndexedSeq In, IndexedSeq Out, typename Op = std::plus<>>
+void parallel_inclusive_scan(const In& in, Out& out, Op op = {}) {
+    parallel_inclusive_scan(global_pool(), in, out, std::move(op));
+}
+
+/**
+ * @brief 并行排他式前缀扫描：out[0] = init，out[i] = init ⊕ in[0] ⊕ ... ⊕ in[i-1]
+ * @exception Exception 若 out 长度小于 in，则抛出 argument_exception
+ */
+template <IndexedSeq In, IndexedSeq Out, typename T, typename Op = std::plus<>>
+void parallel_exclusive_scan(ThreadPool& pool, const In& in, Out& out, T init, Op op = {}) {
+    detail::scan<false>(pool, in, out, Option<T>::Some(std::move(init)), op);
+}
+
+template <IndexedSeq In, IndexedSeq Out, typename T, typename Op = std::plus<>>
+void parallel_exclusive_scan(const In& in, Out& out, T init, Op op = {}) {
+    parallel_exclusive_scan(global_pool(), in, out, std::move(init), std::move(op));
+}
+
+/**
+ * @brief 并行稳定归并排序
+ * @details 先按块并行排序，再逐轮用 merge path 切分归并区间并行合并。
+ *          连续序列（如 util::Vec）原地排序；非连续序列（如 util::DynArray）先并行搬入临时缓冲区
+ * @note 元素需可默认构造与移动
+ */
+template <IndexedSeq S, typename Comp = std::less<>>
+    requires std::default_initializable<seq_value_t<S>> && std::movable<seq_value_t<S>>
+void parallel_sort(ThreadPool& pool, S& seq, Comp comp = {}) {
+    using T = seq_value_t<S>;
+    const usize n = seq.len();
+    if (n <= 1) return;
+
+    if constexpr (ContiguousSeq<S>) {
+        detail::merge_sort(pool, seq.data(), n, comp);
+    } else {
+        auto buf = std::make_unique<T[]>(n);
+        parallel_for(pool, 0, n, [&](usize i) { buf[i] = std::move(seq.at(i)); });
+        detail::merge_sort(pool, buf.get(), n, comp);
+        parallel_for(pool, 0, n, [&](usize i) { seq.at(i) = std::move(buf[i]); });
+    }
+}
+
+template <IndexedSeq S, typename Comp = std::less<>>
+    requires std::default_initializable<seq_value_t<S>> && std::movable<seq_value_t<S>>
+void parallel_sort(S& seq, Comp comp = {}) {
+    parallel_sort(global_pool(), seq, std::move(comp));
+}
+
+} // namespace par
+
+} // namespace my::async
+
+#endif // ASYNC_PARALLEL_HPP
@@ -0,0 +1,162 @@
+/**
+ * @brief 定长块对象池，线程本地缓存 + 全局空闲链表
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef SLAB_POOL_HPP
+#define SLAB_POOL_HPP
+
+#include "marker.hpp"
+#include "my_types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace my::async {
+
+/**
+ * @class SlabPool
+ * @brief 定长内存块池
+ * @details 每次向系统申请一整块 slab 并切分为等长块。每个线程持有一个小缓存（magazine），
+ *          分配/释放通常只操作线程本地链表；缓存耗尽或溢出时与全局链表批量交换。
+ *          适合在线程间生产-消费的短生命周期对象（任务节点、Future 共享状态）。
+ * @note slab 在进程生命周期内不归还系统，池本身为有意泄漏的单例，避免线程退出与静态析构的顺序问题
+ * @tparam BlockSize 块大小（字节）
+ * @tparam BlockAlign 块对齐
+ */
+template <usize BlockSize, usize BlockAlign = alignof(std::max_align_t)>
+class SlabPool : public NoCopyMove {
+    static_assert((BlockAlign & (BlockAlign - 1)) == 0, "BlockAlign must be power of two");
+
+public:
+    using Self = SlabPool<BlockSize, BlockAlign>;
+
+    static constexpr usize BLOCK_SIZE = (std::max(BlockSize, sizeof(void*)) + BlockAlign - 1) & ~(BlockAlign - 1);
+    static constexpr usize SLAB_SIZE = std::max<usize>(64 * 1024, BLOCK_SIZE * 16);
+    static constexpr usize BATCH = 32;
+
+    static Self& instance() {
+        static auto* pool = new Self();
+        return *pool;
+    }
+
+    /**
+     * @brief 分配一个块
+     */
+    [[nodiscard]] void* allocate() {
+        auto& cache = local();
+        if (cache.head == nullptr) {
+            refill(cache);
+        }
+        auto* block = cache.head;
+        cache.head = block->next;
+        --cache.count;
+        return block;
+    }
+
+    /**
+     * @brief 归还一个块，可由任意线程调用
+     */
+    void deallocate(void* p) noexcept {
+        if (p == nullptr) return;
+
+        auto& cache = local();
+        auto* block = static_cast<FreeBlock*>(p);
+        block->next = cache.head;
+        cache.head = block;
+        if (++cache.count > BATCH * 2) {
+            flush(cache, BATCH);
+        }
+    }
+
+    /**
+     * @brief 已向系统申请的 slab 数量
+     */
+    [[nodiscard]] usize slab_count() const {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return slabs_;
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    /**
+     * @brief 线程本地缓存，线程退出时归还全部块
+     */
+    struct Magazine {
+        FreeBlock* head{nullptr};
+        usize count{0};
+
+        ~Magazine() {
+            Self::instance().flush(*this, count);
+        }
+    };
+
+    SlabPool() = default;
+
+    static Magazine& local() {
+        static thread_local Magazine cache{};
+        return cache;
+    }
+
+    /**
+     * @brief 从全局链表取一批块，不足则切分新的 slab
+     */
+    void refill(Magazine& cache) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (global_count_ < BATCH) {
+            carve();
+        }
+        for (usize i = 0; i < BATCH && global_head_ != nullptr; ++i) {
+            auto* block = global_head_;
+            global_head_ = block->next;
+            --global_count_;
+            block->next = cache.head;
+            cache.head = block;
+            ++cache.count;
+        }
+    }
+
+    void flush(Magazine& cache, usize n) noexcept {
+        if (n == 0) return;
+
+        std::lock_guard<std::mutex> lock(mtx_);
+        for (; n > 0 && cache.head != nullptr; --n) {
+            auto* block = cache.head;
+            cache.head = block->next;
+            --cache.count;
+            block->next = global_head_;
+            global_head_ = block;
+            ++global_count_;
+        }
+    }
+
+    /**
+     * @brief 申请新 slab 并切分，调用方持有锁
+     */
+    void carve() {
+        auto* slab = static_cast<std::byte*>(::operator new(SLAB_SIZE, std::align_val_t(BlockAlign)));
+        ++slabs_;
+        for (usize off = 0; off + BLOCK_SIZE <= SLAB_SIZE; off += BLOCK_SIZE) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + off);
+            block->next = global_head_;
+            global_head_ = block;
+            ++global_count_;
+        }
+    }
+
+private:
+    mutable std::mutex mtx_;
+    FreeBlock* global_head_{nullptr};
+    usize global_count_{0};
+    usize slabs_{0};
+};
+
+} // namespace my::async
+
+#endif // SLAB_POOL_HPP
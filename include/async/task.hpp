@@ -0,0 +1,142 @@
+/**
+ * @brief 只移动、小对象优化的任务类型
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef ASYNC_TASK_HPP
+#define ASYNC_TASK_HPP
+
+#include "marker.hpp"
+#include "my_types.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace my::async {
+
+/**
+ * @class UniqueTask
+ * @brief 无参无返回值的只移动可调用对象
+ * @details 不超过 INLINE_SIZE 字节且可 noexcept 移动的可调用对象直接存放在内部缓冲区，
+ *          不产生堆分配；超出部分退化为堆上存放。可持有 std::packaged_task 等只移动对象。
+ */
+class UniqueTask : public NoCopy {
+public:
+    using Self = UniqueTask;
+
+    static constexpr usize INLINE_SIZE = 48;
+    static constexpr usize INLINE_ALIGN = alignof(std::max_align_t);
+
+    UniqueTask() noexcept = default;
+
+    template <typename F>
+        requires(!std::same_as<std::remove_cvref_t<F>, UniqueTask>) && std::invocable<std::decay_t<F>&>
+    UniqueTask(F&& fn) {
+        using Fn = std::decay_t<F>;
+        if constexpr (fits_inline<Fn>()) {
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(fn));
+            vtable_ = &INLINE_VTABLE<Fn>;
+        } else {
+            ::new (static_cast<void*>(storage_)) Fn*(new Fn(std::forward<F>(fn)));
+            vtable_ = &HEAP_VTABLE<Fn>;
+        }
+    }
+
+    UniqueTask(Self&& other) noexcept {
+        take(other);
+    }
+
+    Self& operator=(Self&& other) noexcept {
+        if (this == &other) return *this;
+
+        reset();
+        take(other);
+        return *this;
+    }
+
+    ~UniqueTask() {
+        reset();
+    }
+
+    /**
+     * @brief 执行任务
+     */
+    void operator()() {
+        vtable_->invoke(storage_);
+    }
+
+    explicit operator bool() const noexcept {
+        return vtable_ != nullptr;
+    }
+
+    /**
+     * @brief 是否内联存放（未发生堆分配）
+     */
+    [[nodiscard]] bool is_inline() const noexcept {
+        return vtable_ != nullptr && vtable_->is_inline;
+    }
+
+    /**
+     * @brief 销毁持有的可调用对象
+     */
+    void reset() noexcept {
+        if (vtable_) {
+            vtable_->destroy(storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+private:
+    struct VTable {
+        void (*invoke)(void*);
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void*) noexcept;
+        bool is_inline;
+    };
+
+    template <typename Fn>
+    static constexpr bool fits_inline() {
+        return sizeof(Fn) <= INLINE_SIZE && alignof(Fn) <= INLINE_ALIGN && std::is_nothrow_move_constructible_v<Fn>;
+    }
+
+    template <typename Fn>
+    static constexpr VTable INLINE_VTABLE{
+        [](void* p) { std::invoke(*static_cast<Fn*>(p)); },
+        [](void* dst, void* src) noexcept {
+            auto* from = static_cast<Fn*>(src);
+            ::new (dst) Fn(std::move(*from));
+            from->~Fn();
+        },
+        [](void* p) noexcept { static_cast<Fn*>(p)->~Fn(); },
+        true,
+    };
+
+    template <typename Fn>
+    static constexpr VTable HEAP_VTABLE{
+        [](void* p) { std::invoke(**static_cast<Fn**>(p)); },
+        [](void* dst, void* src) noexcept { ::new (dst) Fn*(*static_cast<Fn**>(src)); },
+        [](void* p) noexcept { delete *static_cast<Fn**>(p); },
+        false,
+    };
+
+    void take(Self& other) noexcept {
+        if (other.vtable_) {
+            other.vtable_->relocate(storage_, other.storage_);
+            vtable_ = other.vtable_;
+            other.vtable_ = nullptr;
+        }
+    }
+
+private:
+    alignas(INLINE_ALIGN) std::byte storage_[INLINE_SIZE];
+    const VTable* vtable_{nullptr};
+};
+
+} // namespace my::async
+
+#endif // ASYNC_TASK_HPP
@@ -0,0 +1,395 @@
+/**
+ * @brief 基于依赖关系的任务图执行器
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef TASK_GRAPH_HPP
+#define TASK_GRAPH_HPP
+
+#include "thread_pool.hpp"
+#include "vec.hpp"
+#include "vec_deque.hpp"
+#include "my_exception.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <format>
+#include <limits>
+#include <memory>
+#include <sstream>
+
+namespace my::async {
+
+/**
+ * @class TaskGraph
+ * @brief 有向无环任务图
+ * @details 节点为可调用对象，边为依赖关系。节点完成后递减后继的入度计数，降为 0 的后继立即调度：
+ *          其中一个在当前线程继续执行，其余通过 ThreadPool::execute 投递，工作线程从不阻塞等待依赖。
+ *          图构建一次即可多次运行，每次运行都会记录各节点的起止时间，用于计算关键路径。
+ * @note 同一时刻只允许一次运行；运行期间不可修改图
+ */
+class TaskGraph : public Object<TaskGraph>, public NoCopyMove {
+public:
+    using Self = TaskGraph;
+
+    static constexpr usize npos = std::numeric_limits<usize>::max();
+
+    /**
+     * @brief 节点句柄，用于声明依赖
+     */
+    class Node {
+    public:
+        /**
+         * @brief 声明本节点先于 other 执行
+         */
+        Node& precede(const Node other) {
+            graph_->add_edge(id_, other.id_);
+            return *this;
+        }
+
+        /**
+         * @brief 声明本节点在 other 之后执行
+         */
+        Node& succeed(const Node other) {
+            graph_->add_edge(other.id_, id_);
+            return *this;
+        }
+
+        [[nodiscard]] usize id() const noexcept {
+            return id_;
+        }
+
+    private:
+        friend class TaskGraph;
+
+        Node(TaskGraph* graph, const usize id) :
+                graph_(graph), id_(id) {}
+
+        TaskGraph* graph_;
+        usize id_;
+    };
+
+    TaskGraph() = default;
+
+    ~TaskGraph() = default;
+
+    /**
+     * @brief 添加节点
+     * @param name 节点名，用于耗时报告
+     * @param fn 无参可调用对象，每次运行都会调用一次
+     */
+    template <typename F>
+    Node emplace(CString name, F&& fn) {
+        ensure_idle();
+        auto node = std::make_unique<NodeData>();
+        node->name = std::move(name);
+        node->task = UniqueTask(std::forward<F>(fn));
+        nodes_.push(std::move(node));
+        validated_ = false;
+        return Node{this, nodes_.len() - 1};
+    }
+
+    template <typename F>
+    Node emplace(F&& fn) {
+        return emplace(CString{std::format("node-{}", nodes_.len())}, std::forward<F>(fn));
+    }
+
+    [[nodiscard]] usize len() const noexcept {
+        return nodes_.len();
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept {
+        return nodes_.is_empty();
+    }
+
+    [[nodiscard]] bool is_running() const noexcept {
+        return running_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 在线程池上运行一次整张图
+     * @return 全部节点完成后就绪的 Future；若某个节点抛出异常，其后未开始的节点被跳过，异常经 Future 传出
+     * @exception Exception 若图中存在环，则抛出 argument_exception；若图正在运行，则抛出 state_exception
+     */
+    Future<void> run(ThreadPool& pool) {
+        if (running_.exchange(true, std::memory_order_acq_rel)) {
+            throw state_exception("TaskGraph is already running");
+        }
+        try {
+            validate();
+        } catch (...) {
+            running_.store(false, std::memory_order_release);
+            throw;
+        }
+
+        promise_ = Promise<void>{};
+        auto future = promise_.get_future();
+        if (nodes_.is_empty()) {
+            finish();
+            return future;
+        }
+
+        pool_ = &pool;
+        failed_.store(false, std::memory_order_relaxed);
+        error_ = nullptr;
+        remaining_.store(nodes_.len(), std::memory_order_relaxed);
+        for (auto& node : nodes_) {
+            node->pending.store(node->in_degree, std::memory_order_relaxed);
+        }
+        epoch_ = Clock::now();
+
+        for (const usize id : roots_) {
+            pool.execute([this, id]() { run_from(id); });
+        }
+        return future;
+    }
+
+    /**
+     * @brief 运行并阻塞等待完成
+     * @note 不要在同一线程池的工作线程中调用
+     */
+    void run_and_wait(ThreadPool& pool) {
+        run(pool).get();
+    }
+
+    /**
+     * @brief 最近一次运行中节点的耗时（纳秒）
+     */
+    [[nodiscard]] u64 duration_ns(const Node node) const {
+        const auto& data = *nodes_.at(node.id_);
+        return data.end_ns - data.start_ns;
+    }
+
+    /**
+     * @brief 最近一次运行的总耗时（纳秒），即最后一个节点的结束时刻
+     */
+    [[nodiscard]] u64 makespan_ns() const {
+        u64 res = 0;
+        for (const auto& node : nodes_) {
+            res = std::max(res, node->end_ns);
+        }
+        return res;
+    }
+
+    /**
+     * @brief 最近一次运行的关键路径
+     * @details 以节点实测耗时为权重，沿拓扑序求从源点到汇点的最长路径
+     * @return 路径上的节点下标，按执行顺序排列
+     */
+    [[nodiscard]] util::Vec<usize> critical_path() const {
+        util::Vec<usize> path;
+        if (nodes_.is_empty() || !validated_) return path;
+
+        // best_in[v]: 所有前驱中最大的完成距离；prev[v]: 取到该距离的前驱
+        const usize n = nodes_.len();
+        util::Vec<u64> best_in(n, 0);
+        util::Vec<usize> prev(n, npos);
+        u64 longest = 0;
+        usize tail = npos;
+        for (const usize u : order_) {
+            const auto& node = *nodes_.at(u);
+            const u64 finish = best_in.at(u) + (node.end_ns - node.start_ns);
+            if (tail == npos || finish > longest) {
+                tail = u, longest = finish;
+            }
+            for (const usize v : node.successors) {
+                if (prev.at(v) == npos || finish > best_in.at(v)) {
+                    best_in.at(v) = finish;
+                    prev.at(v) = u;
+                }
+            }
+        }
+
+        util::Vec<usize> reversed;
+        for (usize u = tail; u != npos; u = prev.at(u)) {
+            reversed.push(u);
+        }
+        for (usize i = reversed.len(); i > 0; --i) {
+            path.push(reversed.at(i - 1));
+        }
+        return path;
+    }
+
+    /**
+     * @brief 最近一次运行的耗时报告：各节点起止时间、关键路径及占比最大的阶段
+     */
+    [[nodiscard]] CString timing_report() const {
+        std::stringstream stream;
+        const f64 total_ms = static_cast<f64>(makespan_ns()) / 1e6;
+        stream << std::format("TaskGraph: {} nodes, makespan {:.3f} ms\n", nodes_.len(), total_ms);
+        for (const auto& node : nodes_) {
+            stream << std::format("  {:<24} start {:>10.3f} ms  cost {:>10.3f} ms\n",
+                                  node->name.data(),
+                                  static_cast<f64>(node->start_ns) / 1e6,
+                                  static_cast<f64>(node->end_ns - node->start_ns) / 1e6);
+        }
+
+        const auto path = critical_path();
+        u64 path_ns = 0, dominant_ns = 0;
+        usize dominant = npos;
+        stream << "  critical path:";
+        for (usize i = 0; i < path.len(); ++i) {
+            const auto& node = *nodes_.at(path.at(i));
+            const u64 cost = node.end_ns - node.start_ns;
+            path_ns += cost;
+            if (dominant == npos || cost > dominant_ns) {
+                dominant = path.at(i), dominant_ns = cost;
+            }
+            stream << (i ? " -> " : " ") << node.name.data();
+        }
+        stream << std::format(" ({:.3f} ms)\n", static_cast<f64>(path_ns) / 1e6);
+        if (dominant != npos) {
+            stream << std::format("  dominant stage: {} ({:.1f}% of critical path)\n",
+                                  nodes_.at(dominant)->name.data(),
+                                  path_ns == 0 ? 0.0 : 100.0 * static_cast<f64>(dominant_ns) / static_cast<f64>(path_ns));
+        }
+        return CString{stream.str()};
+    }
+
+    [[nodiscard]] CString to_string() const {
+        return CString{std::format("TaskGraph({} nodes)", nodes_.len())};
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct NodeData {
+        CString name;
+        UniqueTask task;
+        util::Vec<usize> successors;
+        usize in_degree{0};
+        std::atomic<usize> pending{0};
+        u64 start_ns{0};
+        u64 end_ns{0};
+    };
+
+    void ensure_idle() const {
+        if (is_running()) {
+            throw state_exception("TaskGraph is running");
+        }
+    }
+
+    void add_edge(const usize from, const usize to) {
+        ensure_idle();
+        if (from >= nodes_.len() || to >= nodes_.len()) {
+            throw index_out_of_bounds_exception("Node {} -> {} out of bounds [0..{}]", from, to, nodes_.len());
+        }
+        nodes_.at(from)->successors.push(to);
+        ++nodes_.at(to)->in_degree;
+        validated_ = false;
+    }
+
+    /**
+     * @brief Kahn 拓扑排序，缓存根节点与拓扑序；图未变化时跳过
+     */
+    void validate() {
+        if (validated_) return;
+
+        const usize n = nodes_.len();
+        util::Vec<usize> degree(n, 0);
+        util::VecDeque<usize> ready;
+        order_.clear();
+        roots_.clear();
+        for (usize i = 0; i < n; ++i) {
+            degree.at(i) = nodes_.at(i)->in_degree;
+            if (degree.at(i) == 0) {
+                ready.push_back(i);
+                roots_.push(i);
+            }
+        }
+        for (auto u = ready.pop_front(); u.is_some(); u = ready.pop_front()) {
+            order_.push(u.unwrap());
+            for (const usize v : nodes_.at(u.unwrap())->successors) {
+                if (--degree.at(v) == 0) {
+                    ready.push_back(v);
+                }
+            }
+        }
+        if (order_.len() != n) {
+            throw argument_exception("TaskGraph contains a cycle");
+        }
+        validated_ = true;
+    }
+
+    [[nodiscard]] u64 elapsed_ns() const {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count());
+    }
+
+    /**
+     * @brief 执行节点及其就绪的后继链
+     * @details 就绪后继中的第一个在当前线程继续执行，省去一次入队；其余投递到线程池
+     */
+    void run_from(usize id) {
+        loop {
+            auto& node = *nodes_.at(id);
+            node.start_ns = elapsed_ns();
+            if (!failed_.load(std::memory_order_relaxed)) {
+                try {
+                    node.task();
+                } catch (...) {
+                    if (!failed_.exchange(true, std::memory_order_relaxed)) {
+                        error_ = std::current_exception();
+                    }
+                }
+            }
+            node.end_ns = elapsed_ns();
+
+            usize next = npos;
+            for (const usize succ : node.successors) {
+                if (nodes_.at(succ)->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    if (next == npos) {
+                        next = succ;
+                    } else {
+                        pool_->execute([this, succ]() { run_from(succ); });
+                    }
+                }
+            }
+
+            if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                finish();
+                return;
+            }
+            if (next == npos) {
+                return;
+            }
+            id = next;
+        }
+    }
+
+    /**
+     * @brief 本次运行结束，完成 Future
+     * @note 先把 Promise 移到局部变量，set_value 之后不再访问 this，调用方可以立即销毁或重新运行图
+     */
+    void finish() {
+        auto promise = std::move(promise_);
+        const bool failed = failed_.load(std::memory_order_relaxed);
+        auto error = std::move(error_);
+        running_.store(false, std::memory_order_release);
+        if (failed) {
+            promise.set_exception(std::move(error));
+        } else {
+            promise.set_value();
+        }
+    }
+
+private:
+    util::Vec<std::unique_ptr<NodeData>> nodes_;
+    util::Vec<usize> roots_;
+    util::Vec<usize> order_;
+    bool validated_{false};
+
+    // 单次运行状态
+    ThreadPool* pool_{nullptr};
+    Promise<void> promise_;
+    std::atomic<bool> running_{false};
+    std::atomic<usize> remaining_{0};
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+    Clock::time_point epoch_;
+};
+
+} // namespace my::async
+
+#endif // TASK_GRAPH_HPP
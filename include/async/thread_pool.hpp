@@ -2,19 +2,27 @@
  * @brief 线程池
  * @author Ricky
  * @date 2025/1/1
- * @version 1.0
+ * @version 1.1
  */
 #ifndef THREAD_POOL_HPP
 #define THREAD_POOL_HPP
 
 #include "array.hpp"
 #include "marker.hpp"
-#include "link_list_queue.hpp"
+#include "vec_deque.hpp"
+#include "task.hpp"
+#include "future.hpp"
+#include "slab_pool.hpp"
+#include "work_stealing_deque.hpp"
 
+#include <algorithm>
 #include <thread>
+#include <coroutine>
 #include <mutex>
 #include <condition_variable>
 #include <future>
+#include <atomic>
+#include <memory>
 
 namespace my::async {
 
@@ -27,17 +35,40 @@ struct StopFlag {
     static constexpr i8 STOP_FINISHED = 1; // 等待所有任务完成后停止
 };
 
+/**
+ * @brief 调度模式
+ */
+enum class ScheduleMode : u8 {
+    Shared,       // 所有线程共享一个全局队列
+    WorkStealing, // 每个线程独立双端队列，空闲时随机窃取
+};
+
 /**
  * @brief 线程池
+ * @details Shared 模式下所有任务进入同一把锁保护的队列；
+ *          WorkStealing 模式下工作线程优先 LIFO 弹出本地队列，其次从注入队列取任务，
+ *          最后随机选择受害者 FIFO 窃取，均失败时挂起。工作线程内提交的任务进入本地队列。
+ *          任务以 UniqueTask 存放，小闭包不产生堆分配；execute/submit 路径在稳态下不调用 operator new。
  */
 class ThreadPool : public Object<ThreadPool>, public NoCopyMove {
     using Self = ThreadPool;
 
 public:
-    using Task = Runnable;
+    using Task = UniqueTask;
+
+    ThreadPool(usize num_of_threads, ScheduleMode mode = ScheduleMode::Shared) :
+            threads_(num_of_threads), mode_(mode), stop_flag_(StopFlag::WAIT_FOREVER),
+            locals_(mode == ScheduleMode::WorkStealing ? num_of_threads : 0) {
+        if (mode_ == ScheduleMode::WorkStealing) {
+            for (auto& local : locals_) {
+                local = std::make_unique<WorkStealingDeque<Task*>>();
+            }
+            for (usize i = 0; i < threads_.len(); ++i) {
+                threads_[i] = std::thread([this, i]() { steal_loop(i); });
+            }
+            return;
+        }
 
-    ThreadPool(usize num_of_threads) :
-            threads_(num_of_threads), stop_flag_(StopFlag::WAIT_FOREVER) {
         auto worker = [this]() {
             loop {
                 std::unique_lock<std::mutex> lock(mtx_);
@@ -49,8 +80,7 @@ public:
                     return;
                 }
 
-                Task task = std::move(tasks_.front());
-                tasks_.pop();
+                Task task = tasks_.pop_front().unwrap();
 
                 lock.unlock();
                 task();
@@ -63,6 +93,7 @@ public:
 
     ~ThreadPool() {
         stop();
+        drain();
     }
 
     template <typename F, typename... Args>
@@ -72,13 +103,68 @@ public:
         auto task_ptr = std::make_shared<std::packaged_task<return_type()>>(std::bind(std::forward<F>(task), std::forward<Args>(args)...));
         std::future<return_type> res = task_ptr->get_future();
 
-        {
-            std::lock_guard<std::mutex> lock(mtx_);
-            tasks_.push([task_ptr]() { (*task_ptr)(); });
+        enqueue([task_ptr]() { (*task_ptr)(); });
+        return res;
+    }
+
+    /**
+     * @brief 提交任务，不关心结果
+     * @note 小闭包内联存放于 UniqueTask，稳态下无堆分配；任务抛出的异常会导致 std::terminate
+     */
+    template <typename F, typename... Args>
+    void execute(F&& task, Args&&... args) {
+        if constexpr (sizeof...(Args) == 0) {
+            enqueue(Task(std::forward<F>(task)));
+        } else {
+            enqueue(Task([fn = std::forward<F>(task), ... args = std::forward<Args>(args)]() mutable {
+                std::invoke(fn, args...);
+            }));
         }
+    }
 
-        condition_.notify_one();
-        return res;
+    /**
+     * @brief 提交任务并返回轻量 Future，共享状态来自 SlabPool
+     */
+    template <typename F, typename... Args>
+    auto submit(F&& task, Args&&... args) -> Future<std::invoke_result_t<std::decay_t<F>&, std::decay_t<Args>&...>> {
+        using return_type = std::invoke_result_t<std::decay_t<F>&, std::decay_t<Args>&...>;
+
+        Promise<return_type> promise;
+        auto future = promise.get_future();
+        enqueue(Task([promise = std::move(promise), fn = std::forward<F>(task), ... args = std::forward<Args>(args)]() mutable {
+            try {
+                if constexpr (std::is_void_v<return_type>) {
+                    std::invoke(fn, args...);
+                    promise.set_value();
+                } else {
+                    promise.set_value(std::invoke(fn, args...));
+                }
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        }));
+        return future;
+    }
+
+    /**
+     * @brief 协程切换到线程池执行：co_await pool.schedule()
+     * @note 恢复闭包只捕获协程句柄，走 execute 的无分配路径；线程池停止后不再恢复协程
+     */
+    auto schedule() noexcept {
+        struct Awaiter {
+            Self* pool;
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(const std::coroutine_handle<> coro) const {
+                pool->execute([coro]() { coro.resume(); });
+            }
+
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this};
     }
 
     /**
@@ -97,7 +183,183 @@ public:
         join();
     }
 
+    /**
+     * @brief 获取调度模式
+     */
+    [[nodiscard]] ScheduleMode mode() const noexcept {
+        return mode_;
+    }
+
+    /**
+     * @brief 获取工作线程数
+     */
+    [[nodiscard]] usize num_threads() const noexcept {
+        return threads_.len();
+    }
+
 private:
+    /**
+     * @brief 当前线程所属的线程池及工作线程下标
+     */
+    struct WorkerContext {
+        const Self* pool{nullptr};
+        usize index{0};
+    };
+
+    static WorkerContext& current_worker() {
+        static thread_local WorkerContext ctx{};
+        return ctx;
+    }
+
+    using NodePool = SlabPool<sizeof(Task), alignof(Task)>;
+
+    static Task* box(Task&& task) {
+        return ::new (NodePool::instance().allocate()) Task(std::move(task));
+    }
+
+    static void unbox(Task* task) noexcept {
+        task->~Task();
+        NodePool::instance().deallocate(task);
+    }
+
+    void enqueue(Task&& task) {
+        if (mode_ == ScheduleMode::Shared) {
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                tasks_.push_back(std::move(task));
+            }
+            condition_.notify_one();
+            return;
+        }
+
+        auto* boxed = box(std::move(task));
+        const auto& ctx = current_worker();
+        if (ctx.pool == this) {
+            locals_[ctx.index]->push(boxed);
+        } else {
+            std::lock_guard<std::mutex> lock(mtx_);
+            injector_.push_back(boxed);
+            injected_.fetch_add(1, std::memory_order_release);
+        }
+        wake_one();
+    }
+
+    /**
+     * @brief 工作窃取模式的线程主循环
+     */
+    void steal_loop(const usize index) {
+        current_worker() = {this, index};
+        u64 seed = 0x9E3779B97F4A7C15ULL * (index + 1);
+
+        loop {
+            if (is_stop_now()) {
+                return;
+            }
+
+            if (Task* task = find_task(index, seed)) {
+                struct Guard {
+                    Task* t;
+                    ~Guard() { unbox(t); }
+                } guard{task};
+                (*task)();
+                continue;
+            }
+
+            if (stop_flag_.load(std::memory_order_acquire) == StopFlag::STOP_FINISHED) {
+                // 本地队列仅由自身填充，此处为空即可退出
+                return;
+            }
+
+            park();
+        }
+    }
+
+    /**
+     * @brief 依次尝试本地弹出、注入队列、随机窃取
+     */
+    Task* find_task(const usize index, u64& seed) {
+        if (auto task = locals_[index]->pop(); task.is_some()) {
+            return task.unwrap();
+        }
+        if (injected_.load(std::memory_order_acquire) > 0) {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (auto task = injector_.pop_front(); task.is_some()) {
+                injected_.fetch_sub(1, std::memory_order_release);
+                return task.unwrap();
+            }
+        }
+        return steal(index, seed);
+    }
+
+    Task* steal(const usize index, u64& seed) {
+        const usize n = locals_.len();
+        if (n <= 1) {
+            return nullptr;
+        }
+        // xorshift64 选取随机起点，遍历其余所有受害者
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        const usize start = static_cast<usize>(seed % n);
+        for (usize i = 0; i < n; ++i) {
+            const usize victim = (start + i) % n;
+            if (victim == index) continue;
+            if (auto task = locals_[victim]->steal(); task.is_some()) {
+                return task.unwrap();
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] bool any_task_visible() const {
+        if (injected_.load(std::memory_order_acquire) > 0) {
+            return true;
+        }
+        for (const auto& local : locals_) {
+            if (!local->is_empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 挂起工作线程
+     * @details 先登记空闲再复查队列，与 wake_one 中“先发布任务再读空闲数”构成 Dekker 式握手，
+     *          避免丢失唤醒；wake_epoch_ 在登记前读取，之后的任何唤醒都会使其变化
+     */
+    void park() {
+        const u64 epoch = wake_epoch_.load(std::memory_order_acquire);
+        idle_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (any_task_visible() || stop_flag_.load(std::memory_order_seq_cst) != StopFlag::WAIT_FOREVER) {
+            idle_.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(park_mtx_);
+            park_cv_.wait(lock, [&]() {
+                return wake_epoch_.load(std::memory_order_relaxed) != epoch
+                       || stop_flag_.load(std::memory_order_relaxed) != StopFlag::WAIT_FOREVER;
+            });
+        }
+        idle_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void wake_one() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (idle_.load(std::memory_order_seq_cst) == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(park_mtx_);
+            wake_epoch_.fetch_add(1, std::memory_order_release);
+        }
+        park_cv_.notify_one();
+    }
+
     void join() {
         for (auto&& thread : threads_) {
             if (thread.joinable()) {
@@ -106,12 +368,31 @@ private:
         }
     }
 
+    /**
+     * @brief 释放工作窃取模式下未执行的任务
+     */
+    void drain() {
+        for (auto task = injector_.pop_front(); task.is_some(); task = injector_.pop_front()) {
+            unbox(task.unwrap());
+        }
+        for (auto& local : locals_) {
+            for (auto task = local->steal(); task.is_some(); task = local->steal()) {
+                unbox(task.unwrap());
+            }
+        }
+    }
+
     void set_stop_flag(i8 flag) {
         {
             std::lock_guard<std::mutex> lock(mtx_);
-            stop_flag_ = flag;
+            stop_flag_.store(flag, std::memory_order_seq_cst);
         }
         condition_.notify_all();
+        {
+            std::lock_guard<std::mutex> lock(park_mtx_);
+            wake_epoch_.fetch_add(1, std::memory_order_release);
+        }
+        park_cv_.notify_all();
     }
 
     /**
@@ -119,7 +400,7 @@ private:
      * @return true=是 false=否
      */
     bool is_stop_now() const {
-        return stop_flag_ == StopFlag::STOP_NOW;
+        return stop_flag_.load(std::memory_order_acquire) == StopFlag::STOP_NOW;
     }
 
     /**
@@ -127,7 +408,7 @@ private:
      * @return true=是 false=否
      */
     bool is_task_finished() const {
-        return stop_flag_ == StopFlag::STOP_FINISHED && tasks_.empty();
+        return stop_flag_.load(std::memory_order_acquire) == StopFlag::STOP_FINISHED && tasks_.is_empty();
     }
 
     /**
@@ -135,17 +416,36 @@ private:
      * @return true=是 false=否
      */
     bool has_task() const {
-        return !tasks_.empty();
+        return !tasks_.is_empty();
     }
 
 private:
     util::Array<std::thread> threads_;
-    util::Queue<Task> tasks_;
+    util::VecDeque<Task> tasks_;
     std::mutex mtx_;
     std::condition_variable condition_;
-    i8 stop_flag_;
+    ScheduleMode mode_;
+    std::atomic<i8> stop_flag_;
+
+    // 工作窃取模式
+    util::Array<std::unique_ptr<WorkStealingDeque<Task*>>> locals_;
+    util::VecDeque<Task*> injector_;
+    std::atomic<usize> injected_{0};
+    std::mutex park_mtx_;
+    std::condition_variable park_cv_;
+    std::atomic<u64> wake_epoch_{0};
+    std::atomic<usize> idle_{0};
 };
 
+/**
+ * @brief 默认全局线程池，工作窃取模式，线程数为硬件并发数
+ * @note 首次使用时创建，进程退出时销毁
+ */
+inline ThreadPool& global_pool() {
+    static ThreadPool pool{std::max<usize>(1, std::thread::hardware_concurrency()), ScheduleMode::WorkStealing};
+    return pool;
+}
+
 } // namespace my::async
 
-#endif // THREAD_POOL_HPP
\ No newline at end of file
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,172 @@
+/**
+ * @brief 工作窃取双端队列（Chase-Lev）
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include "marker.hpp"
+#include "option.hpp"
+#include "vec.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+namespace my::async {
+
+/**
+ * @class WorkStealingDeque
+ * @brief 无锁工作窃取双端队列
+ * @details 所有者线程在底部 push/pop（LIFO），其他线程从顶部 steal（FIFO）。
+ *          实现参考 Lê et al. "Correct and Efficient Work-Stealing for Weak Memory Models"。
+ * @note push/pop 只能由所有者线程调用，steal 可由任意线程调用
+ * @tparam T 元素类型，要求可平凡拷贝（通常为指针）
+ */
+template <typename T>
+class WorkStealingDeque : public NoCopyMove {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque requires trivially copyable elements");
+
+public:
+    using value_t = T;
+    using Self = WorkStealingDeque<value_t>;
+
+    explicit WorkStealingDeque(const i64 capacity = DEFAULT_CAPACITY) :
+            ring_(new Ring(capacity)) {}
+
+    ~WorkStealingDeque() {
+        for (auto* ring : retired_) {
+            delete ring;
+        }
+        delete ring_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 压入底部，仅所有者线程调用
+     */
+    void push(const value_t& item) {
+        const i64 b = bottom_.load(std::memory_order_relaxed);
+        const i64 t = top_.load(std::memory_order_acquire);
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        if (b - t > ring->capacity - 1) {
+            ring = grow(ring, b, t);
+        }
+        ring->put(b, item);
+        // 与 steal 中 bottom_ 的 acquire 配对，发布槽位及其指向的对象
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief 从底部弹出（LIFO），仅所有者线程调用
+     */
+    Option<value_t> pop() {
+        const i64 b = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        i64 t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // 队列为空
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return Option<value_t>::None();
+        }
+
+        value_t item = ring->get(b);
+        if (t == b) {
+            // 仅剩最后一个元素，与窃取者竞争
+            const bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            if (!won) {
+                return Option<value_t>::None();
+            }
+        }
+        return Option<value_t>::Some(item);
+    }
+
+    /**
+     * @brief 从顶部窃取（FIFO），任意线程可调用
+     * @return 竞争失败或队列为空时返回 None
+     */
+    Option<value_t> steal() {
+        i64 t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const i64 b = bottom_.load(std::memory_order_acquire);
+
+        if (t >= b) {
+            return Option<value_t>::None();
+        }
+
+        Ring* ring = ring_.load(std::memory_order_acquire);
+        value_t item = ring->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return Option<value_t>::None();
+        }
+        return Option<value_t>::Some(item);
+    }
+
+    /**
+     * @brief 近似长度，并发场景下仅作参考
+     */
+    [[nodiscard]] usize len() const {
+        const i64 b = bottom_.load(std::memory_order_relaxed);
+        const i64 t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<usize>(b - t) : 0;
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return len() == 0;
+    }
+
+private:
+    /**
+     * @brief 环形缓冲区，容量为 2 的幂
+     */
+    struct Ring {
+        i64 capacity;
+        i64 mask;
+        std::atomic<value_t>* slots;
+
+        explicit Ring(const i64 cap) :
+                capacity(cap), mask(cap - 1), slots(new std::atomic<value_t>[static_cast<usize>(cap)]) {}
+
+        ~Ring() {
+            delete[] slots;
+        }
+
+        value_t get(const i64 idx) const {
+            return slots[idx & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(const i64 idx, const value_t& item) {
+            slots[idx & mask].store(item, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief 扩容为两倍，旧缓冲区延迟到析构时释放（窃取者可能仍在读取）
+     */
+    Ring* grow(Ring* old, const i64 b, const i64 t) {
+        auto* ring = new Ring(old->capacity << 1);
+        for (i64 i = t; i < b; ++i) {
+            ring->put(i, old->get(i));
+        }
+        retired_.push(old);
+        ring_.store(ring, std::memory_order_release);
+        return ring;
+    }
+
+private:
+    static constexpr i64 DEFAULT_CAPACITY = 256;
+    static constexpr usize CACHE_LINE = 64;
+
+    alignas(CACHE_LINE) std::atomic<i64> top_{0};
+    alignas(CACHE_LINE) std::atomic<i64> bottom_{0};
+    alignas(CACHE_LINE) std::atomic<Ring*> ring_;
+    util::Vec<Ring*> retired_; // 仅所有者线程访问
+};
+
+} // namespace my::async
+
+#endif // WORK_STEALING_DEQUE_HPP
@@ -0,0 +1,246 @@
+/**
+ * @brief 惰性启动的协程任务
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef CO_TASK_HPP
+#define CO_TASK_HPP
+
+#include "co_utils.hpp"
+#include "frame_pool.hpp"
+#include "marker.hpp"
+#include "my_exception.hpp"
+#include "option.hpp"
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace my::coro {
+
+template <typename T = void>
+class Task;
+
+/**
+ * @brief void 结果的占位类型，用于 when_all 等组合子
+ */
+struct Unit {};
+
+template <typename T>
+using unit_t = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
+namespace detail {
+
+/**
+ * @brief Task promise 的公共部分：惰性启动、完成时对称转移到等待者
+ */
+struct TaskPromiseBase : PooledFrame {
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename P>
+        Coroutine await_suspend(std::coroutine_handle<P> coro) const noexcept {
+            const Coroutine next = coro.promise().continuation_;
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception() noexcept {
+        error_ = std::current_exception();
+    }
+
+    void rethrow_if_failed() const {
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+    Coroutine continuation_ = nullptr; // 等待本任务完成的协程
+    std::exception_ptr error_;
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+        requires std::convertible_to<U&&, T>
+    void return_value(U&& value) {
+        value_ = Option<T>::Some(static_cast<T>(std::forward<U>(value)));
+    }
+
+    T result() {
+        rethrow_if_failed();
+        return std::move(value_).unwrap();
+    }
+
+    Option<T> value_ = Option<T>::None();
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void result() const {
+        rethrow_if_failed();
+    }
+};
+
+} // namespace detail
+
+/**
+ * @class Task
+ * @brief 惰性启动、只移动的协程任务
+ * @details 创建时不执行，首次被 co_await 时才开始运行；完成时通过对称转移直接恢复等待者，
+ *          优化构建下同步完成的长 co_await 链不会增长调用栈（-O0 或 sanitizer 构建时 GCC 不保证尾调用）。
+ *          协程帧从 FramePool 分配。
+ *          与 ThreadPool::schedule() 配合可将协程切换到线程池上运行。
+ * @tparam T 结果类型
+ */
+template <typename T>
+class Task : public NoCopy {
+public:
+    using Self = Task<T>;
+    using promise_type = detail::TaskPromise<T>;
+    using co_handle = std::coroutine_handle<promise_type>;
+
+    Task() noexcept = default;
+
+    explicit Task(const co_handle handle) noexcept :
+            handle_(handle) {}
+
+    Task(Self&& other) noexcept :
+            handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Self& operator=(Self&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+    [[nodiscard]] bool is_valid() const noexcept {
+        return handle_ != nullptr;
+    }
+
+    [[nodiscard]] bool is_done() const noexcept {
+        return handle_ && handle_.done();
+    }
+
+    /**
+     * @brief 等待任务完成并取得结果，结果只能取一次
+     * @exception 重新抛出协程中未捕获的异常
+     */
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            co_handle handle;
+
+            bool await_ready() const noexcept {
+                return !handle || handle.done();
+            }
+
+            Coroutine await_suspend(const Coroutine awaiting) const noexcept {
+                handle.promise().continuation_ = awaiting;
+                return handle;
+            }
+
+            T await_resume() {
+                if (!handle) {
+                    throw state_exception("Task has no associated coroutine");
+                }
+                return handle.promise().result();
+            }
+        };
+        return Awaiter{handle_};
+    }
+
+    auto operator co_await() & noexcept {
+        return std::move(*this).operator co_await();
+    }
+
+private:
+    co_handle handle_ = nullptr;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept {
+    return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+/**
+ * @brief 自行销毁的驱动协程，供 sync_wait/when_all/when_any 启动子任务
+ * @details 协程体以 co_return 返回下一个要恢复的协程（可为空），结束时先销毁自身帧再对称转移过去
+ */
+class Detached {
+public:
+    struct promise_type : PooledFrame {
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+
+            Coroutine await_suspend(std::coroutine_handle<promise_type> coro) const noexcept {
+                const Coroutine next = coro.promise().next_;
+                coro.destroy();
+                return next ? next : std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        Detached get_return_object() noexcept {
+            return Detached{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+
+        void return_value(const Coroutine next) noexcept {
+            next_ = next;
+        }
+
+        [[noreturn]] void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+
+        Coroutine next_ = nullptr;
+    };
+
+    /**
+     * @brief 启动驱动协程，启动后帧的生命周期由协程自身管理
+     */
+    void start() noexcept {
+        std::exchange(handle_, nullptr).resume();
+    }
+
+private:
+    explicit Detached(const std::coroutine_handle<promise_type> handle) noexcept :
+            handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+} // namespace detail
+
+} // namespace my::coro
+
+#endif // CO_TASK_HPP
@@ -0,0 +1,61 @@
+/**
+ * @brief 协程帧分配器
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef FRAME_POOL_HPP
+#define FRAME_POOL_HPP
+
+#include "slab_pool.hpp"
+
+#include <new>
+
+namespace my::coro {
+
+/**
+ * @class FramePool
+ * @brief 按大小分级的协程帧池
+ * @details 帧大小向上取整到 128/256/512/1024/2048 字节，分别由对应的 async::SlabPool 提供，
+ *          稳态下创建/销毁协程不调用 operator new；超过 2048 字节的帧退化为全局 operator new。
+ *          协程 promise 的 operator delete 会收到与分配时相同的大小，据此找回所属的池。
+ */
+class FramePool {
+public:
+    static constexpr usize MAX_POOLED_SIZE = 2048;
+
+    static void* allocate(const usize size) {
+        if (size <= 128) return async::SlabPool<128>::instance().allocate();
+        if (size <= 256) return async::SlabPool<256>::instance().allocate();
+        if (size <= 512) return async::SlabPool<512>::instance().allocate();
+        if (size <= 1024) return async::SlabPool<1024>::instance().allocate();
+        if (size <= 2048) return async::SlabPool<2048>::instance().allocate();
+        return ::operator new(size);
+    }
+
+    static void deallocate(void* p, const usize size) noexcept {
+        if (size <= 128) return async::SlabPool<128>::instance().deallocate(p);
+        if (size <= 256) return async::SlabPool<256>::instance().deallocate(p);
+        if (size <= 512) return async::SlabPool<512>::instance().deallocate(p);
+        if (size <= 1024) return async::SlabPool<1024>::instance().deallocate(p);
+        if (size <= 2048) return async::SlabPool<2048>::instance().deallocate(p);
+        ::operator delete(p, size);
+    }
+};
+
+/**
+ * @brief 混入 promise_type，使协程帧从 FramePool 分配
+ */
+struct PooledFrame {
+    static void* operator new(const std::size_t size) {
+        return FramePool::allocate(size);
+    }
+
+    static void operator delete(void* p, const std::size_t size) noexcept {
+        FramePool::deallocate(p, size);
+    }
+};
+
+} // namespace my::coro
+
+#endif // FRAME_POOL_HPP
@@ -0,0 +1,75 @@
+/**
+ * @brief 在普通函数中阻塞等待协程任务
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef SYNC_WAIT_HPP
+#define SYNC_WAIT_HPP
+
+#include "co_task.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace my::coro {
+
+namespace detail {
+
+/**
+ * @brief sync_wait 的等待点，驱动协程在持锁状态下通知，等待方醒来后即可安全销毁
+ */
+template <typename T>
+struct SyncState {
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool done{false};
+    Option<unit_t<T>> value = Option<unit_t<T>>::None();
+    std::exception_ptr error;
+};
+
+template <typename T>
+Detached sync_driver(Task<T> task, SyncState<T>* state) {
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            state->value = Option<Unit>::Some(Unit{});
+        } else {
+            state->value = Option<T>::Some(co_await std::move(task));
+        }
+    } catch (...) {
+        state->error = std::current_exception();
+    }
+    {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        state->done = true;
+        state->cv.notify_one();
+    }
+    co_return nullptr;
+}
+
+} // namespace detail
+
+/**
+ * @brief 启动任务并阻塞当前线程直到完成
+ * @note 任务可在其他线程（如 co_await pool.schedule() 之后）完成；不要在该任务依赖的线程池工作线程中调用
+ * @exception 重新抛出任务中未捕获的异常
+ */
+template <typename T>
+T sync_wait(Task<T> task) {
+    detail::SyncState<T> state;
+    detail::sync_driver(std::move(task), &state).start();
+
+    std::unique_lock<std::mutex> lock(state.mtx);
+    state.cv.wait(lock, [&]() { return state.done; });
+    if (state.error) {
+        std::rethrow_exception(state.error);
+    }
+    if constexpr (!std::is_void_v<T>) {
+        return std::move(state.value).unwrap();
+    }
+}
+
+} // namespace my::coro
+
+#endif // SYNC_WAIT_HPP
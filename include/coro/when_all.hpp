@@ -0,0 +1,204 @@
+/**
+ * @brief 协程任务组合子 when_all / when_any
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef WHEN_ALL_HPP
+#define WHEN_ALL_HPP
+
+#include "co_task.hpp"
+#include "vec.hpp"
+
+#include <atomic>
+#include <memory>
+#include <tuple>
+
+namespace my::coro {
+
+namespace detail {
+
+/**
+ * @brief 计数为 n + 1 的协程闩：n 个子任务与等待者各到达一次，最后到达者负责恢复等待者
+ */
+class Latch {
+public:
+    explicit Latch(const usize n) :
+            count_(n + 1) {}
+
+    /**
+     * @brief 子任务到达
+     * @return 若为最后到达者，返回需要恢复的等待者，否则返回空
+     */
+    Coroutine arrive() noexcept {
+        return count_.fetch_sub(1, std::memory_order_acq_rel) == 1 ? awaiting_ : nullptr;
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    bool await_suspend(const Coroutine awaiting) noexcept {
+        awaiting_ = awaiting;
+        return count_.fetch_sub(1, std::memory_order_acq_rel) != 1;
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    std::atomic<usize> count_;
+    Coroutine awaiting_ = nullptr;
+};
+
+struct AllState {
+    Latch latch;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+
+    explicit AllState(const usize n) :
+            latch(n) {}
+
+    void fail(std::exception_ptr e) noexcept {
+        if (!failed.exchange(true, std::memory_order_relaxed)) {
+            error = std::move(e);
+        }
+    }
+
+    void rethrow_if_failed() const {
+        if (failed.load(std::memory_order_relaxed)) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+template <typename T>
+Detached all_driver(Task<T> task, Option<unit_t<T>>* slot, AllState* state) {
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            *slot = Option<Unit>::Some(Unit{});
+        } else {
+            *slot = Option<T>::Some(co_await std::move(task));
+        }
+    } catch (...) {
+        state->fail(std::current_exception());
+    }
+    co_return state->latch.arrive();
+}
+
+template <typename T>
+struct AnyState {
+    Latch latch{1};
+    std::atomic<bool> decided{false};
+    usize index{0};
+    Option<unit_t<T>> value = Option<unit_t<T>>::None();
+    std::exception_ptr error;
+};
+
+template <typename T>
+Detached any_driver(Task<T> task, std::shared_ptr<AnyState<T>> state, const usize index) {
+    auto value = Option<unit_t<T>>::None();
+    std::exception_ptr error;
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            value = Option<Unit>::Some(Unit{});
+        } else {
+            value = Option<T>::Some(co_await std::move(task));
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+    if (state->decided.exchange(true, std::memory_order_acq_rel)) {
+        co_return nullptr;
+    }
+    state->index = index;
+    state->value = std::move(value);
+    state->error = std::move(error);
+    co_return state->latch.arrive();
+}
+
+} // namespace detail
+
+/**
+ * @brief 并发等待全部任务完成
+ * @details 依次启动每个子任务，子任务挂起（如切换到线程池）后即启动下一个；全部完成后由最后完成者恢复等待者
+ * @return 按参数顺序排列的结果，void 任务对应 Unit
+ * @exception 全部任务结束后重新抛出第一个异常
+ */
+template <typename... Ts>
+Task<std::tuple<unit_t<Ts>...>> when_all(Task<Ts>... tasks) {
+    std::tuple<Option<unit_t<Ts>>...> slots{Option<unit_t<Ts>>::None()...};
+    detail::AllState state{sizeof...(Ts)};
+    [&]<usize... I>(std::index_sequence<I...>) {
+        (detail::all_driver(std::move(tasks), &std::get<I>(slots), &state).start(), ...);
+    }(std::index_sequence_for<Ts...>{});
+
+    co_await state.latch;
+    state.rethrow_if_failed();
+    co_return std::apply([](auto&... slot) { return std::tuple<unit_t<Ts>...>{std::move(slot).unwrap()...}; }, slots);
+}
+
+/**
+ * @brief 并发等待一组同类型任务全部完成
+ * @return 与输入顺序一致的结果；T 为 void 时返回 Task<void>
+ */
+template <typename T>
+auto when_all(util::Vec<Task<T>> tasks) -> Task<std::conditional_t<std::is_void_v<T>, void, util::Vec<unit_t<T>>>> {
+    const usize n = tasks.len();
+    util::Vec<Option<unit_t<T>>> slots;
+    for (usize i = 0; i < n; ++i) {
+        slots.push(Option<unit_t<T>>::None());
+    }
+    detail::AllState state{n};
+    for (usize i = 0; i < n; ++i) {
+        detail::all_driver(std::move(tasks.at(i)), &slots.at(i), &state).start();
+    }
+
+    co_await state.latch;
+    state.rethrow_if_failed();
+    if constexpr (!std::is_void_v<T>) {
+        util::Vec<T> res;
+        for (usize i = 0; i < n; ++i) {
+            res.push(std::move(slots.at(i)).unwrap());
+        }
+        co_return res;
+    }
+}
+
+/**
+ * @brief when_any 的结果：最先完成的任务下标及其结果
+ */
+template <typename T>
+struct WhenAnyResult {
+    usize index;
+    unit_t<T> value;
+};
+
+/**
+ * @brief 等待一组任务中最先完成的一个
+ * @details 其余任务不会被取消，会在后台继续运行至结束，其结果被丢弃；共享状态由引用计数保活
+ * @note 其余任务引用的外部对象需要活得比它们更久
+ * @exception Exception 若任务列表为空，则抛出 argument_exception；若最先完成的任务抛出异常，则重新抛出
+ */
+template <typename T>
+Task<WhenAnyResult<T>> when_any(util::Vec<Task<T>> tasks) {
+    if (tasks.is_empty()) {
+        throw argument_exception("when_any requires at least one task");
+    }
+
+    auto state = std::make_shared<detail::AnyState<T>>();
+    for (usize i = 0; i < tasks.len(); ++i) {
+        detail::any_driver(std::move(tasks.at(i)), state, i).start();
+    }
+
+    co_await state->latch;
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+    co_return WhenAnyResult<T>{state->index, std::move(state->value).unwrap()};
+}
+
+} // namespace my::coro
+
+#endif // WHEN_ALL_HPP
@@ -0,0 +1,177 @@
+/**
+ * @brief 带缓冲的流式文件读写
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef BUF_FILE_HPP
+#define BUF_FILE_HPP
+
+#include "buf_io.hpp"
+#include "file.hpp"
+
+namespace my::fs {
+
+/**
+ * @class BufReader
+ * @brief 持有文件与一块可复用缓冲区的流式读取器，逐行遍历时不为每行分配内存
+ * @details 基于 io::BufReader：缓冲区在构造时一次分配，之后每次从文件读满一块再在其中扫描换行符。
+ *          read_line/lines 返回指向内部缓冲区的视图，在下一次读操作之前有效，需要保留时应自行拷贝。
+ * @note 单行长度不能超过缓冲区容量，否则抛出 io_exception
+ */
+class BufReader : public NoCopyMove {
+public:
+    static constexpr usize DEFAULT_CAPACITY = 64 * 1024;
+
+    /**
+     * @brief 逐行读取的输入迭代序列，行尾的 \n 与 \r\n 被去掉
+     */
+    class Lines {
+    public:
+        class Iter {
+        public:
+            explicit Iter(BufReader* reader) : reader_(reader) {
+                advance();
+            }
+
+            str::StringView operator*() const noexcept {
+                return line_;
+            }
+
+            Iter& operator++() {
+                advance();
+                return *this;
+            }
+
+            bool operator==(const Iter& other) const noexcept {
+                return reader_ == other.reader_;
+            }
+
+        private:
+            void advance() {
+                if (reader_ == nullptr) return;
+                auto line = reader_->read_line();
+                if (line.is_none()) {
+                    reader_ = nullptr;
+                    return;
+                }
+                line_ = line.unwrap();
+            }
+
+        private:
+            BufReader* reader_;
+            str::StringView line_;
+        };
+
+        explicit Lines(BufReader* reader) : reader_(reader) {}
+
+        Iter begin() const {
+            return Iter(reader_);
+        }
+
+        Iter end() const {
+            return Iter(nullptr);
+        }
+
+    private:
+        BufReader* reader_;
+    };
+
+    explicit BufReader(const char* path, usize capacity = DEFAULT_CAPACITY);
+    explicit BufReader(const PathBuf& path, usize capacity = DEFAULT_CAPACITY);
+
+    usize capacity() const {
+        return reader_.capacity();
+    }
+
+    /**
+     * @brief 读取下一行，不含行尾的 \n 或 \r\n
+     * @return 文件结束时返回 None
+     */
+    Option<str::StringView> read_line();
+
+    Lines lines() {
+        return Lines(this);
+    }
+
+    /**
+     * @brief 读取最多 out.size() 个字节
+     * @return 读取的字节数，0 表示已到文件末尾
+     */
+    usize read(std::span<char> out) {
+        return reader_.read(out);
+    }
+
+    /**
+     * @brief 读取恰好 out.size() 个字节
+     * @exception Exception 若数据不足，则抛出 io_exception
+     */
+    void read_exact(std::span<char> out) {
+        reader_.read_exact(out);
+    }
+
+private:
+    File file_;
+    util::Vec<char> buf_;
+    io::BufReader<File> reader_;
+};
+
+/**
+ * @class BufWriter
+ * @brief 持有文件与一块缓冲区的流式写入器，把大量小记录合并成少数几次写系统调用
+ * @details 基于 io::BufWriter：小块数据拷贝进缓冲区，放不下时把缓冲区与新数据一次 writev 写出。
+ *          析构时尽力 flush 并忽略错误，需要感知写入错误时应显式调用 flush。
+ */
+class BufWriter : public NoCopyMove {
+public:
+    static constexpr usize DEFAULT_CAPACITY = 64 * 1024;
+
+    /**
+     * @brief 创建或截断文件
+     */
+    explicit BufWriter(const char* path, usize capacity = DEFAULT_CAPACITY);
+    explicit BufWriter(const PathBuf& path, usize capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief 以指定模式打开文件，例如 OpenMode::AppendBinary 追加写入
+     */
+    BufWriter(const char* path, File::OpenMode mode, usize capacity = DEFAULT_CAPACITY);
+
+    usize capacity() const {
+        return writer_.capacity();
+    }
+
+    /**
+     * @brief 已缓冲未写出的字节数
+     */
+    usize buffered() const {
+        return writer_.buffered();
+    }
+
+    void write(const char* data, const usize size) {
+        writer_.write(data, size);
+    }
+
+    void write(const str::StringView data) {
+        writer_.write(data);
+    }
+
+    /**
+     * @brief 写入 line 并追加 \n
+     */
+    void write_line(str::StringView line);
+
+    /**
+     * @brief 把已缓冲的数据写入文件
+     */
+    void flush();
+
+private:
+    File file_;
+    util::Vec<char> buf_;
+    io::BufWriter<File> writer_;
+};
+
+} // namespace my::fs
+
+#endif // BUF_FILE_HPP
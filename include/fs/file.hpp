@@ -39,6 +39,18 @@ public:
     usize write(const char* data, usize size);
     usize write(const CString& data);
 
+    /**
+     * @brief 从当前位置读取最多 size 字节，满足 io::ByteSource
+     * @return 读取的字节数，0 表示已到文件末尾
+     */
+    usize read_into(char* buf, usize size);
+
+    /**
+     * @brief 聚集写出多段数据，满足 io::ByteSink
+     * @return 写入的字节数
+     */
+    usize write_vectored(const plat::IoSlice* slices, usize n);
+
     void flush();
 
     Handle* handle() const { return handle_; }
@@ -47,6 +59,14 @@ private:
     Handle* handle_{nullptr};
 };
 
+/**
+ * @brief 把 from 的内容复制到 to，to 不存在时创建、已存在时截断
+ * @details 数据尽量留在内核内：支持 reflink 的文件系统上共享数据块，否则使用 copy_file_range，见 plat::fs::copy_file
+ * @return 复制的字节数
+ */
+u64 copy(const char* from, const char* to);
+u64 copy(const PathBuf& from, const PathBuf& to);
+
 } // namespace my::fs
 
 #endif // FILE_HPP
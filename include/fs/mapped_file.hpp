@@ -0,0 +1,189 @@
+/**
+ * @brief 内存映射文件
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include "marker.hpp"
+#include "fs.hpp"
+#include "path_buf.hpp"
+
+#include <cstring>
+#include <limits>
+#include <span>
+
+namespace my::fs {
+
+/**
+ * @class MappedFile
+ * @brief 把整个文件映射进地址空间，按 StringView 或字节区间直接访问，省去 read_all 的拷贝
+ * @details 只读映射适合大文件的解析与扫描，例如直接把 as_str() 交给 JsonParser，
+ *          或用 lines() 逐行遍历；可写映射为共享映射，修改经 flush 写回文件。
+ *          advise 把访问模式告知内核以调整预读与大页，提示不被支持时返回 false，不影响正确性。
+ * @note as_str()/as_bytes() 返回的视图在 close 或析构之后失效；映射期间其他进程截断文件会导致访问越界的页时收到 SIGBUS
+ */
+class MappedFile : public NoCopy {
+public:
+    using Handle = plat::fs::MapHandle;
+    using Advice = plat::fs::MapAdvice;
+
+    static constexpr usize ALL = std::numeric_limits<usize>::max();
+
+    /**
+     * @brief lines() 返回的惰性行序列，行尾的 \n 与 \r\n 被去掉
+     */
+    class Lines {
+    public:
+        class Iter {
+        public:
+            Iter(const u8* pos, const u8* end) : pos_(pos), end_(end) {
+                advance();
+            }
+
+            str::StringView operator*() const noexcept {
+                return line_;
+            }
+
+            Iter& operator++() {
+                advance();
+                return *this;
+            }
+
+            bool operator==(const Iter& other) const noexcept {
+                return done_ == other.done_ && (done_ || pos_ == other.pos_);
+            }
+
+        private:
+            void advance() {
+                if (pos_ == end_) {
+                    done_ = true;
+                    return;
+                }
+                const auto* nl = static_cast<const u8*>(std::memchr(pos_, '\n', static_cast<usize>(end_ - pos_)));
+                if (nl == nullptr) {
+                    line_ = str::StringView(pos_, static_cast<usize>(end_ - pos_));
+                    pos_ = end_;
+                    return;
+                }
+                const u8* line_end = (nl > pos_ && nl[-1] == '\r') ? nl - 1 : nl;
+                line_ = str::StringView(pos_, static_cast<usize>(line_end - pos_));
+                pos_ = nl + 1;
+            }
+
+        private:
+            const u8* pos_;
+            const u8* end_;
+            str::StringView line_;
+            bool done_{false};
+        };
+
+        Lines(const u8* data, const usize len) : data_(data), len_(len) {}
+
+        Iter begin() const {
+            return Iter(data_, data_ + len_);
+        }
+
+        Iter end() const {
+            return Iter(data_ + len_, data_ + len_);
+        }
+
+    private:
+        const u8* data_;
+        usize len_;
+    };
+
+    /**
+     * @brief 只读映射已有文件
+     */
+    static MappedFile open(const char* path);
+    static MappedFile open(const PathBuf& path);
+
+    /**
+     * @brief 读写映射已有文件
+     */
+    static MappedFile open_rw(const char* path);
+    static MappedFile open_rw(const PathBuf& path);
+
+    /**
+     * @brief 创建或截断文件到 len 字节并读写映射
+     */
+    static MappedFile create(const char* path, u64 len);
+    static MappedFile create(const PathBuf& path, u64 len);
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    ~MappedFile();
+
+    bool is_open() const {
+        return handle_ != nullptr;
+    }
+
+    bool is_writable() const {
+        return writable_;
+    }
+
+    usize len() const {
+        return len_;
+    }
+
+    bool is_empty() const {
+        return len_ == 0;
+    }
+
+    str::StringView as_str() const {
+        return str::StringView(data_, len_);
+    }
+
+    std::span<const u8> as_bytes() const {
+        return {data_, len_};
+    }
+
+    /**
+     * @exception Exception 若为只读映射，则抛出 runtime_exception
+     */
+    std::span<u8> as_mut_bytes();
+
+    Lines lines() const {
+        return Lines(data_, len_);
+    }
+
+    /**
+     * @brief 对 [offset, offset + len) 给出访问提示
+     * @return 平台不支持该提示时返回 false
+     */
+    bool advise(Advice advice, usize offset = 0, usize len = ALL);
+
+    /**
+     * @brief 把整个映射的修改写回文件
+     * @param async 为 true 时只发起写回，不等待完成
+     */
+    void flush(bool async = false);
+
+    /**
+     * @brief 把 [offset, offset + len) 的修改写回文件
+     */
+    void flush_range(usize offset, usize len, bool async = false);
+
+    void close();
+
+    Handle* handle() const { return handle_; }
+
+private:
+    MappedFile(str::StringView path, plat::fs::MapMode mode, u64 len);
+
+    void check_open() const;
+
+private:
+    Handle* handle_{nullptr};
+    u8* data_{nullptr};
+    usize len_{0};
+    bool writable_{false};
+};
+
+} // namespace my::fs
+
+#endif // MAPPED_FILE_HPP
@@ -0,0 +1,142 @@
+/**
+ * @brief 按偏移读写的无缓冲文件
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef RAW_FILE_HPP
+#define RAW_FILE_HPP
+
+#include "marker.hpp"
+#include "fs.hpp"
+#include "path_buf.hpp"
+
+#include <span>
+
+namespace my::fs {
+
+/**
+ * @class RawFile
+ * @brief 直接持有文件描述符的文件，所有读写都带偏移（pread/pwrite/preadv/pwritev）
+ * @details 与 File 不同，RawFile 没有 FILE* 缓冲，也不依赖共享的文件位置，
+ *          读写方法都是 const 的：多个线程可以不加锁地在同一个 RawFile 上读写互不重叠的区间，
+ *          适合在 ThreadPool 上把大文件切块并行处理。
+ */
+class RawFile : public NoCopy {
+public:
+    using Handle = plat::fs::RawHandle;
+    using Advice = plat::fs::FileAdvice;
+
+    /**
+     * @brief 只读打开已有文件
+     */
+    static RawFile open(const char* path);
+    static RawFile open(const PathBuf& path);
+
+    /**
+     * @brief 读写打开已有文件
+     */
+    static RawFile open_rw(const char* path);
+    static RawFile open_rw(const PathBuf& path);
+
+    /**
+     * @brief 读写打开，不存在时创建，已存在时保留内容
+     */
+    static RawFile create(const char* path);
+    static RawFile create(const PathBuf& path);
+
+    /**
+     * @brief 读写打开，不存在时创建，已存在时截断
+     */
+    static RawFile truncate(const char* path);
+    static RawFile truncate(const PathBuf& path);
+
+    RawFile(RawFile&& other) noexcept;
+    RawFile& operator=(RawFile&& other) noexcept;
+
+    ~RawFile();
+
+    bool is_open() const {
+        return handle_ != nullptr;
+    }
+
+    void close();
+
+    /**
+     * @brief 从 offset 读取最多 size 字节
+     * @return 读取的字节数，0 表示已到文件末尾
+     */
+    usize read_at(char* buf, usize size, u64 offset) const;
+
+    /**
+     * @brief 从 offset 读取恰好 out.size() 个字节，处理短读
+     * @exception Exception 若文件在读满之前结束，则抛出 io_exception
+     */
+    void read_exact_at(std::span<char> out, u64 offset) const;
+
+    /**
+     * @brief 写入到 offset
+     * @return 写入的字节数
+     */
+    usize write_at(const char* data, usize size, u64 offset) const;
+
+    /**
+     * @brief 把 size 字节全部写入到 offset，处理短写
+     */
+    void write_all_at(const char* data, usize size, u64 offset) const;
+
+    /**
+     * @brief 从 offset 起依次读入多段缓冲区
+     * @return 读取的总字节数，可能少于各段之和
+     */
+    usize read_vectored_at(const plat::IoSliceMut* slices, usize n, u64 offset) const;
+
+    /**
+     * @brief 从 offset 起依次写出多段数据
+     * @return 写入的总字节数，可能少于各段之和
+     */
+    usize write_vectored_at(const plat::IoSlice* slices, usize n, u64 offset) const;
+
+    /**
+     * @brief 对 [offset, offset + len) 给出访问提示，len 为 0 表示到文件末尾
+     * @return 平台不支持该提示时返回 false
+     */
+    bool advise(Advice advice, u64 offset = 0, u64 len = 0) const;
+
+    u64 len() const;
+
+    /**
+     * @brief 截断或扩展文件到 len 字节
+     */
+    void set_len(u64 len) const;
+
+    /**
+     * @brief 为 [offset, offset + len) 预先分配磁盘块并扩展文件长度，新区域读出为 0
+     * @return 平台或文件系统不支持时返回 false
+     */
+    bool allocate(u64 offset, u64 len) const;
+
+    /**
+     * @brief 把数据落盘（fdatasync），不强制刷新与读取无关的元数据
+     */
+    void sync_data() const;
+
+    /**
+     * @brief 把数据与全部元数据落盘（fsync）
+     */
+    void sync_all() const;
+
+    Handle* handle() const { return handle_; }
+
+private:
+    RawFile(str::StringView path, plat::fs::RawMode mode);
+
+    Handle* checked() const;
+
+private:
+    Handle* handle_{nullptr};
+};
+
+} // namespace my::fs
+
+#endif // RAW_FILE_HPP
@@ -0,0 +1,170 @@
+/**
+ * @brief 组提交的追加写预写日志
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef WAL_HPP
+#define WAL_HPP
+
+#include "marker.hpp"
+#include "option.hpp"
+#include "raw_file.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace my::fs {
+
+/**
+ * @brief CRC-32C（Castagnoli），支持 SSE4.2 时使用 crc32 指令，否则按 8 字节查表
+ * @param crc 上一段的结果，用于分段计算
+ */
+u32 crc32c(const void* data, usize len, u32 crc = 0) noexcept;
+
+/**
+ * @brief append 返回时记录达到的持久化程度
+ */
+enum class Durability {
+    Buffered, // 只进入内存批次，批次攒满或有更高要求的提交时才写出；进程崩溃会丢失
+    Written,  // 已写入页缓存；进程崩溃不丢失，掉电可能丢失
+    Synced,   // 已 fdatasync 落盘
+};
+
+struct WalConfig {
+    u64 segment_size = 64 * 1024 * 1024;  // 单个段文件的大小，记录不跨段；超过段大小的记录独占一段
+    bool preallocate = true;              // 新段一次性 fallocate 到 segment_size
+    Durability durability = Durability::Synced;
+    usize buffer_bytes = 1024 * 1024;     // Buffered 模式下攒满该字节数即写出
+};
+
+/**
+ * @class Wal
+ * @brief 由若干段文件组成的追加写日志，每条记录带长度与 CRC-32C，编号（LSN）从 1 开始连续递增
+ * @details 段文件名为首条记录的 LSN（20 位十进制）加 ".wal"，写满后轮转到新段。
+ *          组提交：append 先在锁内把记录编码进共享批次，再等待其达到要求的持久化程度；
+ *          若当前没有写线程，它就成为 leader，取走整个批次在锁外一次 pwrite（需要时再一次 fdatasync），
+ *          其间到达的记录进入下一批，由下一个 leader 提交。并发追加的线程因此共享同一次 fdatasync。
+ *          段文件预分配后尾部全为 0，记录头为全 0 即日志结尾。
+ *          打开时顺序扫描全部段：最后一段中第一条残缺或校验失败的记录及其后内容视为崩溃时未写完，被截掉；
+ *          其他段损坏则抛出异常。写入或落盘失败后日志进入失败状态，之后的操作都抛出异常。
+ */
+class Wal : public NoCopyMove {
+public:
+    using Replay = std::function<void(u64 lsn, str::StringView record)>;
+
+    /**
+     * @brief 每条记录前的首部：u32 长度与 u32 CRC-32C（覆盖长度字段与负载），均为小端
+     */
+    static constexpr usize HEADER_SIZE = 8;
+
+    /**
+     * @brief 打开或创建 dir 下的日志，按 LSN 顺序把已有记录交给 replay
+     * @exception Exception 若非最后一段损坏或段之间 LSN 不连续，则抛出 io_exception
+     */
+    static std::unique_ptr<Wal> open(str::StringView dir, WalConfig config = {}, const Replay& replay = {});
+
+    /**
+     * @brief 按 dir 中的日志只读回放，不截断、不创建
+     * @return 最后一条有效记录的 LSN，没有记录时为 0
+     */
+    static u64 replay(str::StringView dir, const Replay& replay);
+
+    /**
+     * @brief 关闭前把已缓冲的记录写出并按配置的持久化程度落盘，错误被忽略
+     */
+    ~Wal();
+
+    /**
+     * @brief 按配置的持久化程度追加一条记录
+     * @return 记录的 LSN
+     */
+    u64 append(str::StringView record);
+
+    /**
+     * @brief 按指定的持久化程度追加一条记录
+     * @exception Exception 若写入或落盘失败，则抛出 io_exception
+     */
+    u64 append(str::StringView record, Durability durability);
+
+    /**
+     * @brief 把目前为止追加的全部记录写出并落盘
+     */
+    void sync();
+
+    /**
+     * @brief 删除所有记录都早于 lsn 的段，当前正在写的段不删除
+     * @return 删除的段数
+     */
+    usize truncate_before(u64 lsn);
+
+    /**
+     * @brief 最后追加的记录的 LSN
+     */
+    u64 last_lsn() const;
+
+    /**
+     * @brief 已落盘的最大 LSN
+     */
+    u64 synced_lsn() const;
+
+    /**
+     * @brief 写出批次的次数，与 append 次数之比即平均每批记录数
+     */
+    u64 groups() const;
+
+    /**
+     * @brief fdatasync 的次数
+     */
+    u64 syncs() const;
+
+    usize segment_count() const;
+
+private:
+    Wal(str::StringView dir, WalConfig config);
+
+    void wait_for(std::unique_lock<std::mutex>& lock, u64 lsn, bool need_sync);
+
+    void lead(std::unique_lock<std::mutex>& lock);
+
+    void write_batch(const char* data, usize len);
+
+    void rotate();
+
+    str::String<> segment_path(u64 first_lsn) const;
+
+    void check_failed() const;
+
+private:
+    str::String<> dir_;
+    WalConfig config_;
+
+    mutable std::mutex mtx_; // 保护以下到 failed_ 为止的字段
+    std::condition_variable cv_;
+    util::Vec<char> pending_; // 已编码、待写出的记录，有效部分为前 pending_len_ 字节
+    usize pending_len_{0};
+    u64 last_lsn_{0};
+    u64 written_lsn_{0};
+    u64 synced_lsn_{0};
+    u64 sync_lsn_{0};         // 要求落盘的最大 LSN
+    u64 groups_{0};
+    u64 syncs_{0};
+    bool leading_{false};
+    std::exception_ptr failed_;
+
+    // 以下只由当前 leader 访问
+    util::Vec<char> batch_;
+    Option<RawFile> active_ = Option<RawFile>::None();
+    u64 active_offset_{0};
+    u64 next_write_lsn_{1};
+
+    mutable std::mutex seg_mtx_;
+    util::Vec<u64> segments_; // 各段首条记录的 LSN，升序
+};
+
+} // namespace my::fs
+
+#endif // WAL_HPP
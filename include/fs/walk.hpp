@@ -0,0 +1,117 @@
+/**
+ * @brief 并行递归目录遍历
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef WALK_HPP
+#define WALK_HPP
+
+#include "fs.hpp"
+#include "path_buf.hpp"
+#include "thread_pool.hpp"
+
+#include <functional>
+#include <limits>
+
+namespace my::fs {
+
+using FileType = plat::fs::FileType;
+
+/**
+ * @brief 遍历到的一个目录项，视图只在回调期间有效
+ */
+struct WalkEntry {
+    str::StringView path; // root 与各级目录名拼接而成
+    str::StringView name;
+    FileType type;
+    usize depth; // root 的直接子项为 1
+};
+
+/**
+ * @brief 一次遍历的统计
+ */
+struct WalkStats {
+    u64 entries{0}; // 交给回调的目录项数
+    u64 dirs{0};    // 读取过的目录数（含 root）
+    u64 errors{0};  // 无法读取的子目录数，如权限不足或遍历期间被删除
+};
+
+/**
+ * @class Walker
+ * @brief 递归遍历目录树，把子目录分发到线程池并行读取
+ * @details 每个目录只做一次 scan_dir，目录项类型取自 d_type，不对每个文件 stat。
+ *          待读目录放在共享栈中，调用线程与至多 num_threads 个线程池任务一起取目录处理，
+ *          因此即使线程池繁忙或在工作线程内调用也不会死锁。不跟随符号链接。
+ *          filter 决定目录项是否交给回调，prune 决定是否进入某个子目录，两者相互独立。
+ * @note 回调、filter 与 prune 会在多个线程上并发调用，需自行保证线程安全；
+ *       目录项的先后顺序不确定
+ */
+class Walker {
+public:
+    using Predicate = std::function<bool(const WalkEntry&)>;
+    using Visitor = std::function<void(const WalkEntry&)>;
+
+    static constexpr usize UNLIMITED = std::numeric_limits<usize>::max();
+
+    explicit Walker(str::StringView root);
+    explicit Walker(const PathBuf& root);
+
+    /**
+     * @brief 最大深度，1 表示只列出 root 的直接子项
+     */
+    Walker& max_depth(usize depth);
+
+    /**
+     * @brief 只把 pred 返回 true 的目录项交给回调，不影响是否进入子目录
+     */
+    Walker& filter(Predicate pred);
+
+    /**
+     * @brief pred 返回 true 的子目录不再进入，该目录项本身仍按 filter 交给回调
+     */
+    Walker& prune(Predicate pred);
+
+    /**
+     * @brief 使用指定线程池，默认为 async::global_pool()
+     */
+    Walker& pool(async::ThreadPool& pool);
+
+    /**
+     * @brief 参与遍历的线程数上限（含调用线程），1 表示在调用线程上串行遍历，默认为线程池线程数 + 1
+     */
+    Walker& threads(usize n);
+
+    /**
+     * @brief 遍历并对每个目录项调用 visit，全部完成后返回
+     * @exception Exception 若 root 无法读取，则抛出 system_exception；回调抛出的第一个异常在遍历停止后重新抛出
+     */
+    WalkStats for_each(const Visitor& visit) const;
+
+    /**
+     * @brief 收集全部通过 filter 的目录项路径
+     */
+    util::Vec<str::String<>> collect() const;
+
+private:
+    struct Job;
+
+private:
+    str::String<> root_;
+    usize max_depth_{UNLIMITED};
+    Predicate filter_;
+    Predicate prune_;
+    async::ThreadPool* pool_{nullptr};
+    usize threads_{0};
+};
+
+/**
+ * @brief 以默认选项遍历 root
+ */
+inline WalkStats walk(const str::StringView root, const Walker::Visitor& visit) {
+    return Walker(root).for_each(visit);
+}
+
+} // namespace my::fs
+
+#endif // WALK_HPP
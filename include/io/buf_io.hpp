@@ -0,0 +1,291 @@
+/**
+ * @brief 复用调用方缓冲区的带缓冲读写
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef BUF_IO_HPP
+#define BUF_IO_HPP
+
+#include "io_slice.hpp"
+#include "marker.hpp"
+#include "my_exception.hpp"
+#include "option.hpp"
+#include "string_view.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstring>
+#include <span>
+
+namespace my::io {
+
+/**
+ * @brief 可读取到调用方缓冲区的字节源，返回 0 表示结束
+ */
+template <typename S>
+concept ByteSource = requires(S& s, char* buf, usize n) {
+    { s.read_into(buf, n) } -> std::convertible_to<usize>;
+};
+
+/**
+ * @brief 可聚集写出多段数据的字节汇，返回实际写出的字节数
+ */
+template <typename S>
+concept ByteSink = requires(S& s, const plat::IoSlice* slices, usize n) {
+    { s.write_vectored(slices, n) } -> std::convertible_to<usize>;
+};
+
+/**
+ * @class BufReader
+ * @brief 在调用方提供的缓冲区上做带缓冲读取
+ * @details 有效数据位于 [begin_, end_)；尾部空间不足时把剩余数据搬到缓冲区开头再读，
+ *          因此返回的视图总是连续的。peek/read_until 返回指向内部缓冲区的视图，不拷贝、不分配，
+ *          视图在下一次读操作前有效。
+ * @tparam S 字节源，如 net::TcpStream
+ */
+template <ByteSource S>
+class BufReader : public NoCopy {
+public:
+    BufReader(S& source, std::span<char> buffer) :
+            source_(&source), buf_(buffer) {
+        if (buf_.empty()) {
+            throw argument_exception("BufReader requires a non-empty buffer");
+        }
+    }
+
+    [[nodiscard]] usize capacity() const noexcept {
+        return buf_.size();
+    }
+
+    /**
+     * @brief 已缓冲未消费的字节数
+     */
+    [[nodiscard]] usize buffered() const noexcept {
+        return end_ - begin_;
+    }
+
+    /**
+     * @brief 返回已缓冲的数据，缓冲为空时先读取一次
+     * @return 空视图表示字节源已结束
+     */
+    str::StringView fill_buf() {
+        if (buffered() == 0) {
+            fill();
+        }
+        return view(buffered());
+    }
+
+    /**
+     * @brief 标记前 n 个已缓冲字节为已消费
+     */
+    void consume(const usize n) {
+        begin_ += std::min(n, buffered());
+        if (begin_ == end_) {
+            begin_ = end_ = 0;
+        }
+    }
+
+    /**
+     * @brief 查看接下来的 n 个字节而不消费
+     * @return 不足 n 字节时说明字节源已结束，返回剩余全部
+     * @exception Exception 若 n 超过缓冲区容量，则抛出 argument_exception
+     */
+    str::StringView peek(const usize n) {
+        if (n > capacity()) {
+            throw argument_exception("Peek size {} exceeds buffer capacity {}", n, capacity());
+        }
+        while (buffered() < n && fill() > 0) {}
+        return view(std::min(n, buffered()));
+    }
+
+    /**
+     * @brief 读取直到 delimiter（含）并消费
+     * @return 含分隔符的视图；字节源结束时返回剩余数据（不含分隔符），无剩余数据返回 None
+     * @exception Exception 若一行超过缓冲区容量，则抛出 io_exception
+     */
+    Option<str::StringView> read_until(const char delimiter) {
+        usize scanned = 0;
+        loop {
+            const char* base = buf_.data() + begin_;
+            if (const void* hit = std::memchr(base + scanned, delimiter, buffered() - scanned)) {
+                const usize n = static_cast<const char*>(hit) - base + 1;
+                return Option<str::StringView>::Some(take(n));
+            }
+            scanned = buffered();
+            if (scanned == capacity()) {
+                throw io_exception("Line exceeds buffer capacity {}", capacity());
+            }
+            if (fill() == 0) {
+                return scanned == 0 ? Option<str::StringView>::None() : Option<str::StringView>::Some(take(scanned));
+            }
+        }
+    }
+
+    /**
+     * @brief 读取恰好 out.size() 个字节
+     * @details 先拷贝已缓冲的数据，剩余部分较大时直接读入 out，跳过内部缓冲区
+     * @exception Exception 若数据不足，则抛出 io_exception
+     */
+    void read_exact(std::span<char> out) {
+        usize done = copy_buffered(out);
+        while (done < out.size()) {
+            const usize rest = out.size() - done;
+            if (rest >= capacity()) {
+                const usize n = source_->read_into(out.data() + done, rest);
+                if (n == 0) break;
+                done += n;
+            } else {
+                if (fill() == 0) break;
+                done += copy_buffered(out.subspan(done));
+            }
+        }
+        if (done < out.size()) {
+            throw io_exception("Unexpected end of stream: expected {} bytes, got {}", out.size(), done);
+        }
+    }
+
+    /**
+     * @brief 读取最多 out.size() 个字节
+     * @return 读取的字节数，0 表示字节源已结束
+     */
+    usize read(std::span<char> out) {
+        if (buffered() == 0 && out.size() >= capacity()) {
+            return source_->read_into(out.data(), out.size());
+        }
+        fill_buf();
+        return copy_buffered(out);
+    }
+
+private:
+    /**
+     * @brief 从字节源读取一次到缓冲区尾部，必要时先整理
+     * @return 新读取的字节数
+     */
+    usize fill() {
+        if (end_ == capacity() && begin_ > 0) {
+            const usize n = buffered();
+            std::memmove(buf_.data(), buf_.data() + begin_, n);
+            begin_ = 0, end_ = n;
+        }
+        if (end_ == capacity()) return 0;
+        const usize n = source_->read_into(buf_.data() + end_, capacity() - end_);
+        end_ += n;
+        return n;
+    }
+
+    str::StringView view(const usize n) const {
+        return str::StringView(reinterpret_cast<const u8*>(buf_.data() + begin_), n);
+    }
+
+    str::StringView take(const usize n) {
+        auto res = view(n);
+        begin_ += n; // 不复位到 0，保证视图在下一次读之前有效
+        return res;
+    }
+
+    usize copy_buffered(std::span<char> out) {
+        const usize n = std::min(out.size(), buffered());
+        std::memcpy(out.data(), buf_.data() + begin_, n);
+        consume(n);
+        return n;
+    }
+
+private:
+    S* source_;
+    std::span<char> buf_;
+    usize begin_{0};
+    usize end_{0};
+};
+
+/**
+ * @class BufWriter
+ * @brief 在调用方提供的缓冲区上合并小块写出
+ * @details 小块数据先拷贝进缓冲区；放不下时把缓冲区与新数据作为两段一次 write_vectored 写出，
+ *          大块数据不经过拷贝。析构时尽力 flush，错误被忽略，需要感知错误时应显式调用 flush。
+ * @tparam S 字节汇，如 net::TcpStream
+ */
+template <ByteSink S>
+class BufWriter : public NoCopy {
+public:
+    BufWriter(S& sink, std::span<char> buffer) :
+            sink_(&sink), buf_(buffer) {
+        if (buf_.empty()) {
+            throw argument_exception("BufWriter requires a non-empty buffer");
+        }
+    }
+
+    ~BufWriter() {
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+
+    [[nodiscard]] usize capacity() const noexcept {
+        return buf_.size();
+    }
+
+    [[nodiscard]] usize buffered() const noexcept {
+        return len_;
+    }
+
+    void write(const char* data, const usize size) {
+        if (size <= capacity() - len_) {
+            std::memcpy(buf_.data() + len_, data, size);
+            len_ += size;
+            return;
+        }
+        plat::IoSlice slices[2] = {{buf_.data(), len_}, {data, size}};
+        write_all(slices, 2);
+        len_ = 0;
+    }
+
+    void write(const str::StringView data) {
+        write(reinterpret_cast<const char*>(data.as_bytes()), data.len());
+    }
+
+    /**
+     * @brief 写出全部已缓冲的数据
+     */
+    void flush() {
+        if (len_ == 0) return;
+        plat::IoSlice slice{buf_.data(), len_};
+        write_all(&slice, 1);
+        len_ = 0;
+    }
+
+private:
+    /**
+     * @brief 写出全部分段，处理部分写
+     */
+    void write_all(plat::IoSlice* slices, usize n) {
+        while (n > 0) {
+            if (slices->size == 0) {
+                ++slices, --n;
+                continue;
+            }
+            usize written = sink_->write_vectored(slices, n);
+            if (written == 0) {
+                throw io_exception("Failed to write whole buffer");
+            }
+            while (n > 0 && written >= slices->size) {
+                written -= slices->size;
+                ++slices, --n;
+            }
+            if (n > 0) {
+                slices->data += written;
+                slices->size -= written;
+            }
+        }
+    }
+
+private:
+    S* sink_;
+    std::span<char> buf_;
+    usize len_{0};
+};
+
+} // namespace my::io
+
+#endif // BUF_IO_HPP
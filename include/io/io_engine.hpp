@@ -0,0 +1,165 @@
+/**
+ * @brief 批量提交/完成式 I/O 引擎，Linux 上可选 io_uring
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef IO_ENGINE_HPP
+#define IO_ENGINE_HPP
+
+#include "uring.hpp"
+#include "marker.hpp"
+#include "vec.hpp"
+#include "vec_deque.hpp"
+
+namespace my::io {
+
+/**
+ * @brief I/O 后端
+ */
+enum class IoBackend : u8 {
+    Auto,     // io_uring 可用时使用，否则退回 Blocking
+    Blocking, // 现有的阻塞式 plat::net/plat::fs 路径，submit 时逐个同步执行
+    IoUring,  // 强制 io_uring，不可用时构造抛出异常
+};
+
+/**
+ * @brief 已完成的操作
+ */
+struct Completion {
+    u64 token{0};
+    i64 result{0};                               // 字节数；负数表示失败（io_uring 下为 -errno）
+    plat::net::SocketHandle* socket{nullptr};    // accept 成功时的新连接，由调用方 plat::net::close
+};
+
+/**
+ * @class IoEngine
+ * @brief 提交/完成式 I/O：先排队任意多个 accept/recv/send/read/write，再一次 submit
+ * @details io_uring 后端下一次 submit 只有一次 io_uring_enter 系统调用，完成事件从共享内存的完成队列读取；
+ *          提交队列满时自动提交已排队的部分。Blocking 后端在 submit 时按排队顺序逐个调用阻塞接口，
+ *          接口与语义相同，便于在不支持 io_uring 的内核或平台上运行同一份代码。
+ *          每个操作带有调用方的 token，完成事件按完成顺序返回（不保证与提交顺序一致）。
+ * @note 缓冲区需保持有效直到对应的完成事件返回；非线程安全
+ */
+class IoEngine : public NoCopyMove {
+public:
+    static constexpr u32 DEFAULT_ENTRIES = 256;
+
+    explicit IoEngine(IoBackend backend = IoBackend::Auto, u32 entries = DEFAULT_ENTRIES);
+
+    ~IoEngine();
+
+    /**
+     * @brief 实际使用的后端（不会是 Auto）
+     */
+    [[nodiscard]] IoBackend backend() const noexcept {
+        return backend_;
+    }
+
+    /**
+     * @brief 当前内核是否支持 io_uring
+     */
+    static bool io_uring_available();
+
+    /**
+     * @brief 已排队或已提交但尚未取回完成事件的操作数
+     */
+    [[nodiscard]] usize in_flight() const noexcept {
+        return in_flight_;
+    }
+
+    /**
+     * @brief 注册固定缓冲区，供 *_fixed 操作使用
+     * @note 只能注册一次
+     */
+    void register_buffers(const util::Vec<plat::uring::FixedBuffer>& buffers);
+
+    void accept(plat::net::SocketHandle* listener, u64 token);
+
+    void recv(plat::net::SocketHandle* socket, char* buf, usize size, u64 token);
+
+    void send(plat::net::SocketHandle* socket, const char* data, usize size, u64 token);
+
+    void read(plat::fs::FileHandle* file, char* buf, usize size, u64 offset, u64 token);
+
+    void write(plat::fs::FileHandle* file, const char* data, usize size, u64 offset, u64 token);
+
+    /**
+     * @brief 使用第 buf_index 个固定缓冲区的前 size 字节
+     */
+    void recv_fixed(plat::net::SocketHandle* socket, u32 buf_index, usize size, u64 token);
+
+    void send_fixed(plat::net::SocketHandle* socket, u32 buf_index, usize size, u64 token);
+
+    void read_fixed(plat::fs::FileHandle* file, u32 buf_index, usize size, u64 offset, u64 token);
+
+    void write_fixed(plat::fs::FileHandle* file, u32 buf_index, usize size, u64 offset, u64 token);
+
+    /**
+     * @brief 提交全部已排队的操作
+     * @return 提交的操作数
+     */
+    usize submit();
+
+    /**
+     * @brief 提交已排队的操作并等待至少 min_complete 个完成，完成事件追加到 out
+     * @return 追加的个数
+     */
+    usize wait(util::Vec<Completion>& out, usize min_complete = 1);
+
+private:
+    enum class OpKind : u8 {
+        Accept,
+        Recv,
+        Send,
+        Read,
+        Write,
+        ReadFixed,
+        WriteFixed,
+    };
+
+    /**
+     * @brief 排队中的操作；io_uring 后端下只用到 token 与 kind，下标作为 user_data
+     */
+    struct Op {
+        OpKind kind{OpKind::Read};
+        u64 token{0};
+        plat::net::SocketHandle* socket{nullptr};
+        plat::fs::FileHandle* file{nullptr};
+        char* buf{nullptr};
+        usize size{0};
+        u64 offset{0};
+        u32 buf_index{0};
+    };
+
+    char* fixed_buffer(u32 buf_index, usize size) const;
+
+    void enqueue(const Op& op);
+
+    bool prep(const Op& op, u64 user_data);
+
+    u32 acquire_slot(const Op& op);
+
+    Completion complete(u32 slot, i64 result);
+
+    Completion run_blocking(const Op& op) const;
+
+private:
+    IoBackend backend_;
+    plat::uring::RingHandle* ring_{nullptr};
+    util::Vec<plat::uring::FixedBuffer> buffers_;
+    usize in_flight_{0};
+
+    // io_uring：在途操作槽位
+    util::Vec<Op> slots_;
+    util::Vec<u32> free_slots_;
+    util::Vec<plat::uring::Cqe> cqes_;
+
+    // Blocking：待执行队列与已完成事件
+    util::Vec<Op> queued_;
+    util::VecDeque<Completion> done_;
+};
+
+} // namespace my::io
+
+#endif // IO_ENGINE_HPP
@@ -0,0 +1,302 @@
+/**
+ * @brief 单调增长的内存池与对应的分配器
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include "alloc.hpp"
+#include "marker.hpp"
+#include "my_types.hpp"
+
+namespace my::mem {
+
+/**
+ * @class Arena
+ * @brief 按块申请内存、在块内移动指针分配的内存池
+ * @details 分配只是对齐后移动块内指针；释放是空操作（恰好是最后一次分配时回退指针，便于容器原地扩容）。
+ *          reset 把指针拨回第一个块，已申请的块全部保留供下一轮复用，耗时与块数无关；
+ *          块不够用时按几何级数申请新块，超大的请求单独占一块。
+ *          Arena 不是线程安全的，每个线程使用自己的 Arena。
+ */
+class Arena : public NoCopyMove {
+public:
+    static constexpr usize DEFAULT_CHUNK_SIZE = 64 * 1024;
+    static constexpr usize MAX_CHUNK_SIZE = 4 * 1024 * 1024;
+
+    explicit Arena(usize chunk_size = DEFAULT_CHUNK_SIZE) noexcept;
+
+    /**
+     * @brief 释放所有块
+     */
+    ~Arena();
+
+    /**
+     * @brief 分配 bytes 字节，按 align 对齐
+     * @param align 2 的幂
+     * @exception std::bad_alloc 若申请新块失败
+     */
+    [[nodiscard]] void* allocate(const usize bytes, const usize align = alignof(std::max_align_t)) {
+        const usize aligned = (cur_ + align - 1) & ~(align - 1);
+        if (aligned + bytes <= end_) [[likely]] {
+            cur_ = aligned + bytes;
+            used_ += bytes;
+            return reinterpret_cast<void*>(aligned);
+        }
+        return allocate_slow(bytes, align);
+    }
+
+    /**
+     * @brief 释放内存；只有 p 是最后一次分配时才回收，否则为空操作
+     */
+    void deallocate(void* p, const usize bytes) noexcept {
+        if (reinterpret_cast<usize>(p) + bytes == cur_) {
+            cur_ -= bytes;
+            used_ -= bytes;
+        }
+    }
+
+    /**
+     * @brief 作废所有分配，保留已申请的块
+     * @note 之前分配的对象不会被析构，调用方需保证不再访问它们
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief 作废所有分配并把块归还给系统
+     */
+    void release() noexcept;
+
+    /**
+     * @brief 自上次 reset 以来分配的字节数，不含对齐填充
+     */
+    usize used() const noexcept { return used_; }
+
+    /**
+     * @brief 已向系统申请的字节数
+     */
+    usize reserved() const noexcept { return reserved_; }
+
+    usize chunk_count() const noexcept { return chunks_; }
+
+    /**
+     * @brief 当前线程由 ArenaScope 指定的 Arena，没有时为 nullptr
+     */
+    static Arena* current() noexcept { return current_; }
+
+private:
+    struct Chunk {
+        Chunk* next;
+        usize size; // 数据区字节数，数据区紧跟在 Chunk 之后
+    };
+
+    void* allocate_slow(usize bytes, usize align);
+
+    void enter(Chunk* chunk) noexcept;
+
+private:
+    friend class ArenaScope;
+
+    static inline thread_local Arena* current_ = nullptr;
+
+    usize chunk_size_;
+    usize next_size_;
+    Chunk* head_{nullptr};    // 第一个块
+    Chunk* active_{nullptr};  // 正在分配的块，之后的块在 reset 之后按顺序复用
+    usize cur_{0};            // 块内下一个空闲地址
+    usize end_{0};            // 块数据区末尾
+    usize used_{0};
+    usize reserved_{0};
+    usize chunks_{0};
+};
+
+/**
+ * @class ArenaScope
+ * @brief 在作用域内把当前线程默认构造的 ArenaAllocator 绑定到 arena，析构时恢复之前的绑定
+ * @details 容器内部默认构造的分配器（节点、桶、键数组等）因此也落在同一个 Arena 中
+ */
+class ArenaScope : public NoCopyMove {
+public:
+    explicit ArenaScope(Arena& arena) noexcept : prev_(Arena::current_) {
+        Arena::current_ = &arena;
+    }
+
+    ~ArenaScope() {
+        Arena::current_ = prev_;
+    }
+
+private:
+    Arena* prev_;
+};
+
+/**
+ * @class ArenaAllocator
+ * @brief 从 Arena 分配的有状态分配器，接口与 Allocator 相同，可以直接作为各容器的 Alloc 参数
+ * @details 分配器持有 Arena 指针，rebind 与拷贝都保留该指针，容器按分配器随内存一起传播的约定使用它。
+ *          默认构造时绑定到当前线程的 ArenaScope；没有时退回 ::operator new / delete，与 Allocator 行为一致。
+ *          容器及其中的对象必须在 Arena reset 或销毁之前析构或被丢弃。
+ * @tparam T 分配的元素类型
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using Self = ArenaAllocator<T>;
+    using value_type = T;
+
+    using is_always_equal = std::false_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept : arena_(Arena::current()) {}
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    template <typename U>
+    struct rebind {
+        using other = ArenaAllocator<U>;
+    };
+
+    /**
+     * @brief 绑定的 Arena，为 nullptr 时使用全局堆
+     */
+    Arena* arena() const noexcept { return arena_; }
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T* {
+        if (n == 0) return nullptr;
+        if (n > max_size()) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        if (arena_ != nullptr) {
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    auto deallocate(T* p, std::size_t n) noexcept -> void {
+        if (!p) return;
+        if (arena_ != nullptr) {
+            arena_->deallocate(p, n * sizeof(T));
+            return;
+        }
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(p, n * sizeof(T), std::align_val_t(alignof(T)));
+        } else {
+            ::operator delete(p, n * sizeof(T));
+        }
+    }
+
+    /**
+     * @brief 超额分配内存，与 Allocator 一样向上取 2 的幂
+     */
+    [[nodiscard]] auto allocate_at_least(std::size_t n) -> AllocationResult<T*> {
+        if (n == 0) return {nullptr, 0};
+        std::size_t count = std::bit_ceil(n);
+        return {allocate(count), count};
+    }
+
+    template <std::size_t Alignment>
+    [[nodiscard]] auto allocate_aligned(std::size_t n) -> T* {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be power of two");
+        static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+
+        if (arena_ != nullptr) {
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), Alignment));
+        }
+        if constexpr (Alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return allocate(n);
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    template <typename U, typename... Args>
+    auto construct(U* p, Args&&... args) -> void {
+        std::construct_at(p, std::forward<Args>(args)...);
+    }
+
+    template <typename U, typename... Args>
+    auto construct_n(U* p, std::size_t n, Args&&... args) -> void {
+        std::size_t constructed = 0;
+        try {
+            for (; constructed < n; ++constructed) {
+                std::construct_at(p + constructed, std::forward<Args>(args)...);
+            }
+        } catch (...) {
+            if constexpr (!std::is_trivially_destructible_v<U>) {
+                for (std::size_t i = 0; i < constructed; ++i) {
+                    std::destroy_at(p + i);
+                }
+            }
+            throw;
+        }
+    }
+
+    template <typename U>
+    auto destroy(U* p) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_at(p);
+        }
+    }
+
+    template <typename U>
+    auto destroy_n(U* p, std::size_t n) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_n(p, n);
+        }
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create(Args&&... args) noexcept -> T* {
+        T* p = nullptr;
+        try {
+            p = allocate(1);
+            construct(p, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, 1);
+            return nullptr;
+        }
+        return p;
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create_array(std::size_t n, Args&&... args) noexcept -> T* {
+        if (n == 0) return nullptr;
+
+        T* p = nullptr;
+        try {
+            p = allocate(n);
+            construct_n(p, n, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, n);
+            return nullptr;
+        }
+        return p;
+    }
+
+    static constexpr auto max_size() noexcept -> std::size_t {
+        return static_cast<std::size_t>(-1) / sizeof(T);
+    }
+
+private:
+    Arena* arena_;
+};
+
+/**
+ * @brief 绑定同一个 Arena（或都使用全局堆）的分配器相等，可以互相释放对方分配的内存
+ */
+template <typename T, typename U>
+auto operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept -> bool {
+    return lhs.arena() == rhs.arena();
+}
+
+} // namespace my::mem
+
+#endif // ARENA_HPP
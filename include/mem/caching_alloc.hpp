@@ -0,0 +1,271 @@
+/**
+ * @brief 带线程缓存的通用内存分配器
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef CACHING_ALLOC_HPP
+#define CACHING_ALLOC_HPP
+
+#include "alloc.hpp"
+#include "vec.hpp"
+
+namespace my::mem {
+
+/**
+ * @brief 某一级小对象的统计
+ */
+struct SizeClassStats {
+    usize size;          // 对象大小
+    usize span_pages;    // 每个 span 的页数
+    usize spans;         // 该级持有的 span 数
+    usize objects;       // 这些 span 切出的对象总数
+    usize central_free;  // 中心空闲链表中的对象数
+    usize transfer_free; // 转移缓存中的对象数
+    usize thread_free;   // 各线程缓存中的对象数
+    u64 allocs;          // 经线程缓存分配的次数
+    u64 frees;           // 经线程缓存释放的次数
+
+    /**
+     * @brief 正在被使用的对象数
+     */
+    usize in_use() const noexcept {
+        return objects - central_free - transfer_free - thread_free;
+    }
+};
+
+/**
+ * @brief 页堆统计
+ */
+struct PageHeapStats {
+    usize system_bytes; // 向系统申请的总字节数
+    usize free_pages;   // 空闲 span 的页数
+    usize large_spans;  // 大对象占用的 span 数
+};
+
+/**
+ * @class CachingHeap
+ * @brief 仿 tcmalloc 的三层分配器：线程缓存、每级一个的中心空闲链表与转移缓存、按页管理的 span 页堆
+ * @details 不超过 MAX_SMALL_SIZE 的请求按大小分为 CLASS_COUNT 级（8、16 至 128 每 16 字节一级，之后每翻一倍分 4 级）。
+ *          每个线程每级持有一条空闲链表，分配与释放通常不加锁；链表为空时从转移缓存取一整批，
+ *          转移缓存为空时由中心空闲链表从各 span 中摘取；链表超过上限时把一批还回去。
+ *          线程缓存的上限从 1 开始，每次取批时增长（慢启动），偶尔分配的级别不会囤积对象。
+ *          中心空闲链表按 span 记账，span 的对象全部归还后整个 span 交还页堆。
+ *          页堆以 8KiB 为页、按页数组织空闲 span，分配时切分、归还时与相邻的空闲 span 合并，
+ *          用三级基数树由页号找到所属 span；大对象直接占用整数页的 span。
+ *          向系统申请的内存不归还，由页堆复用。所有全局状态都是有意泄漏的单例，线程退出与静态析构时仍可使用。
+ */
+class CachingHeap {
+public:
+    static constexpr usize PAGE_SHIFT = 13;
+    static constexpr usize PAGE_SIZE = usize{1} << PAGE_SHIFT;
+    static constexpr usize MAX_SMALL_SIZE = 256 * 1024;
+    static constexpr usize CLASS_COUNT = 53;
+
+    /**
+     * @brief 大于 8 字节的对象至少按该值对齐，大对象按页对齐
+     */
+    static constexpr usize ALIGNMENT = 16;
+
+    /**
+     * @brief bytes 所属的级别，bytes 须不超过 MAX_SMALL_SIZE
+     */
+    static constexpr usize size_class(const usize bytes) noexcept {
+        if (bytes <= 8) return 0;
+        if (bytes <= 128) return (bytes + 15) / 16;
+        const usize p = std::bit_width(bytes - 1); // 2^(p-1) < bytes <= 2^p
+        const usize base = usize{1} << (p - 1);
+        const usize step = base / 4;
+        return 8 + (p - 8) * 4 + (bytes - base + step - 1) / step;
+    }
+
+    /**
+     * @brief 第 cls 级的对象大小
+     */
+    static constexpr usize class_size(const usize cls) noexcept {
+        if (cls == 0) return 8;
+        if (cls <= 8) return cls * 16;
+        const usize j = cls - 9;
+        const usize base = usize{128} << (j / 4);
+        return base + (j % 4 + 1) * (base / 4);
+    }
+
+    /**
+     * @brief 请求 bytes 字节时实际得到的可用字节数
+     */
+    static constexpr usize good_size(const usize bytes) noexcept {
+        if (bytes <= MAX_SMALL_SIZE) return class_size(size_class(bytes));
+        return (bytes + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    }
+
+    /**
+     * @brief 分配 bytes 字节
+     * @exception std::bad_alloc 若向系统申请内存失败
+     */
+    [[nodiscard]] static void* allocate(usize bytes);
+
+    /**
+     * @brief 释放 allocate(bytes) 得到的内存，bytes 须与分配时相同
+     */
+    static void deallocate(void* p, usize bytes) noexcept;
+
+    /**
+     * @brief 释放由 allocate 得到的内存，大小由页号反查
+     */
+    static void deallocate(void* p) noexcept;
+
+    /**
+     * @brief 把当前线程缓存的对象全部还给中心空闲链表
+     */
+    static void flush_thread_cache() noexcept;
+
+    /**
+     * @brief 各级的统计，按级别顺序排列
+     * @note 各项分别加锁读取，并发分配时只是近似值
+     */
+    static util::Vec<SizeClassStats> stats();
+
+    static PageHeapStats page_heap_stats();
+};
+
+/**
+ * @class CachingAllocator
+ * @brief 从 CachingHeap 分配的分配器，接口与 Allocator 相同，可以作为任意容器的 Alloc 参数
+ * @details 分配器无状态，任意两个实例相等；对齐要求超过 CachingHeap::ALIGNMENT 的类型转交 Allocator。
+ * @tparam T 分配的元素类型
+ */
+template <typename T>
+class CachingAllocator {
+public:
+    using Self = CachingAllocator<T>;
+    using value_type = T;
+
+    using is_always_equal = std::true_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    constexpr CachingAllocator() noexcept = default;
+
+    template <typename U>
+    constexpr CachingAllocator(const CachingAllocator<U>&) noexcept {}
+
+    template <typename U>
+    struct rebind {
+        using other = CachingAllocator<U>;
+    };
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T* {
+        if (n == 0) return nullptr;
+        if (n > max_size()) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        if constexpr (alignof(T) > CachingHeap::ALIGNMENT) {
+            return fallback_.allocate(n);
+        }
+        return static_cast<T*>(CachingHeap::allocate(n * sizeof(T)));
+    }
+
+    auto deallocate(T* p, std::size_t n) noexcept -> void {
+        if (!p) return;
+        if constexpr (alignof(T) > CachingHeap::ALIGNMENT) {
+            fallback_.deallocate(p, n);
+        } else {
+            CachingHeap::deallocate(p, n * sizeof(T));
+        }
+    }
+
+    /**
+     * @brief 超额分配内存，返回所在级别实际能容纳的元素数量
+     */
+    [[nodiscard]] auto allocate_at_least(std::size_t n) -> AllocationResult<T*> {
+        if (n == 0) return {nullptr, 0};
+        if constexpr (alignof(T) > CachingHeap::ALIGNMENT) {
+            return fallback_.allocate_at_least(n);
+        }
+        if (n > max_size()) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        const std::size_t count = CachingHeap::good_size(n * sizeof(T)) / sizeof(T);
+        return {allocate(count), count};
+    }
+
+    /**
+     * @brief 对齐分配内存，小对象最多按 CachingHeap::ALIGNMENT 对齐
+     */
+    template <std::size_t Alignment>
+    [[nodiscard]] auto allocate_aligned(std::size_t n) -> T* {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be power of two");
+        static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+        static_assert(Alignment <= CachingHeap::ALIGNMENT, "Objects are aligned to at most CachingHeap::ALIGNMENT");
+        return allocate(n);
+    }
+
+    template <typename U, typename... Args>
+    auto construct(U* p, Args&&... args) -> void {
+        std::construct_at(p, std::forward<Args>(args)...);
+    }
+
+    template <typename U, typename... Args>
+    auto construct_n(U* p, std::size_t n, Args&&... args) -> void {
+        fallback_.construct_n(p, n, std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    auto destroy(U* p) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_at(p);
+        }
+    }
+
+    template <typename U>
+    auto destroy_n(U* p, std::size_t n) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_n(p, n);
+        }
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create(Args&&... args) noexcept -> T* {
+        T* p = nullptr;
+        try {
+            p = allocate(1);
+            construct(p, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, 1);
+            return nullptr;
+        }
+        return p;
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create_array(std::size_t n, Args&&... args) noexcept -> T* {
+        if (n == 0) return nullptr;
+
+        T* p = nullptr;
+        try {
+            p = allocate(n);
+            construct_n(p, n, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, n);
+            return nullptr;
+        }
+        return p;
+    }
+
+    static constexpr auto max_size() noexcept -> std::size_t {
+        return static_cast<std::size_t>(-1) / sizeof(T);
+    }
+
+private:
+    [[no_unique_address]] Allocator<T> fallback_;
+};
+
+template <typename T, typename U>
+constexpr auto operator==(const CachingAllocator<T>&, const CachingAllocator<U>&) noexcept -> bool {
+    return true;
+}
+
+} // namespace my::mem
+
+#endif // CACHING_ALLOC_HPP
@@ -0,0 +1,295 @@
+/**
+ * @brief 按大小分级的 slab 内存池与节点分配器
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef POOL_ALLOC_HPP
+#define POOL_ALLOC_HPP
+
+#include "alloc.hpp"
+#include "marker.hpp"
+#include "my_types.hpp"
+
+#include <mutex>
+
+namespace my::mem {
+
+/**
+ * @class SizeClassSlab
+ * @brief 只分配一种大小的块的内存池
+ * @details 以 SLAB_SIZE 字节、按 SLAB_SIZE 对齐的 slab 为单位向系统申请内存，slab 首部之后切成等长的块，
+ *          块地址向下取整即得所属 slab。每个 slab 维护自己的空闲链表与在用块数，
+ *          有空闲块的 slab 挂在可用链表上，部分使用的 slab 在前，空 slab 在后，分配总是取表头，让内存集中在少数 slab 上。
+ *          slab 的块全部归还后保留一个空 slab 备用，更多的空 slab 立即归还系统；trim 归还全部空 slab。
+ *          所有操作由互斥锁保护，可以跨线程分配与释放。
+ */
+class SizeClassSlab : public NoCopyMove {
+public:
+    static constexpr usize SLAB_SIZE = 64 * 1024;
+
+    /**
+     * @param block_size 块大小，向上取整到 16 字节
+     */
+    explicit SizeClassSlab(usize block_size);
+
+    /**
+     * @brief 归还所有 slab，须在池中分配的块全部归还之后析构
+     */
+    ~SizeClassSlab();
+
+    /**
+     * @brief 分配一块
+     * @exception std::bad_alloc 若申请新 slab 失败
+     */
+    [[nodiscard]] void* allocate();
+
+    /**
+     * @brief 归还一块，p 必须来自本池
+     */
+    void deallocate(void* p) noexcept;
+
+    /**
+     * @brief 在一次加锁内分配 n 块，以块首字存放的指针串成单链表
+     * @return 链表头
+     */
+    [[nodiscard]] void* allocate_batch(usize n);
+
+    /**
+     * @brief 在一次加锁内归还由块首字串起的 n 块
+     */
+    void deallocate_batch(void* head, usize n) noexcept;
+
+    /**
+     * @brief 把所有空 slab 归还系统
+     * @return 归还的 slab 数
+     */
+    usize trim() noexcept;
+
+    usize block_size() const noexcept { return block_size_; }
+
+    /**
+     * @brief 持有的 slab 数
+     */
+    usize slab_count() const;
+
+    /**
+     * @brief 已分配且未归还的块数
+     */
+    usize in_use() const;
+
+private:
+    struct Slab;
+
+    void* allocate_locked();
+
+    void deallocate_locked(void* p) noexcept;
+
+    Slab* new_slab();
+
+    void free_slab(Slab* slab) noexcept;
+
+    void link_front(Slab* slab) noexcept;
+
+    void link_back(Slab* slab) noexcept;
+
+    void unlink(Slab* slab) noexcept;
+
+private:
+    usize block_size_;
+    usize blocks_per_slab_;
+
+    mutable std::mutex mtx_;
+    Slab* head_{nullptr}; // 可用链表
+    Slab* tail_{nullptr};
+    usize slabs_{0};
+    usize empty_{0};      // 可用链表中在用块数为 0 的 slab 数
+    usize in_use_{0};
+};
+
+/**
+ * @class NodePool
+ * @brief PoolAllocator 共享的各级 SizeClassSlab，以及每个线程的块缓存
+ * @details 块大小按 GRANULE 分级，共 CLASS_COUNT 级，每级一个进程内共享的 SizeClassSlab。
+ *          使用线程缓存时，每个线程每级持有一条最多 CACHE_CAPACITY 块的空闲链表，
+ *          分配与释放只在缓存为空或已满时才加锁与共享池成批交换 CACHE_BATCH 块；线程退出时缓存归还共享池。
+ *          块可以在一个线程分配、在另一个线程释放。
+ */
+class NodePool {
+public:
+    static constexpr usize GRANULE = 16;
+    static constexpr usize MAX_BLOCK_SIZE = 1024;
+    static constexpr usize CLASS_COUNT = MAX_BLOCK_SIZE / GRANULE;
+    static constexpr usize CACHE_CAPACITY = 64;
+    static constexpr usize CACHE_BATCH = 32;
+
+    /**
+     * @brief bytes 字节所属的级别，bytes 须在 [1, MAX_BLOCK_SIZE] 内
+     */
+    static constexpr usize size_class(const usize bytes) noexcept {
+        return (bytes + GRANULE - 1) / GRANULE - 1;
+    }
+
+    /**
+     * @brief 第 cls 级共享池，在首次使用时创建且永不销毁，以便线程缓存在任何时刻都能归还
+     */
+    static SizeClassSlab& shared(usize cls) noexcept;
+
+    [[nodiscard]] static void* allocate(usize cls, bool cached);
+
+    static void deallocate(void* p, usize cls, bool cached) noexcept;
+
+    /**
+     * @brief 把当前线程缓存的块全部归还共享池
+     */
+    static void flush_thread_cache() noexcept;
+
+    /**
+     * @brief 归还当前线程的缓存，再把各级共享池的空 slab 归还系统
+     * @return 归还的 slab 数
+     * @note 其他线程缓存中的块仍占着各自的 slab
+     */
+    static usize trim() noexcept;
+};
+
+/**
+ * @class PoolAllocator
+ * @brief 从 NodePool 按大小分级分配单个对象的分配器，接口与 Allocator 相同，适合节点式容器的 Alloc 参数
+ * @details 单个对象（n == 1）且大小不超过 NodePool::MAX_BLOCK_SIZE、对齐不超过 NodePool::GRANULE 时从池中分配，
+ *          其余请求转交 ::operator new / delete。分配器无状态，任意两个实例相等。
+ * @tparam T 分配的元素类型
+ * @tparam ThreadCache 是否经过线程缓存；为 false 时每次分配与释放都直接加锁访问共享池
+ */
+template <typename T, bool ThreadCache = true>
+class PoolAllocator {
+public:
+    using Self = PoolAllocator<T, ThreadCache>;
+    using value_type = T;
+
+    using is_always_equal = std::true_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    constexpr PoolAllocator() noexcept = default;
+
+    template <typename U>
+    constexpr PoolAllocator(const PoolAllocator<U, ThreadCache>&) noexcept {}
+
+    template <typename U>
+    struct rebind {
+        using other = PoolAllocator<U, ThreadCache>;
+    };
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T* {
+        if (n == 0) return nullptr;
+        if constexpr (POOLED) {
+            if (n == 1) {
+                return static_cast<T*>(NodePool::allocate(CLASS, ThreadCache));
+            }
+        }
+        return fallback_.allocate(n);
+    }
+
+    auto deallocate(T* p, std::size_t n) noexcept -> void {
+        if (!p) return;
+        if constexpr (POOLED) {
+            if (n == 1) {
+                NodePool::deallocate(p, CLASS, ThreadCache);
+                return;
+            }
+        }
+        fallback_.deallocate(p, n);
+    }
+
+    /**
+     * @brief 超额分配内存，单个对象不超额，其余与 Allocator 一样向上取 2 的幂
+     */
+    [[nodiscard]] auto allocate_at_least(std::size_t n) -> AllocationResult<T*> {
+        if (n == 0) return {nullptr, 0};
+        std::size_t count = std::bit_ceil(n);
+        return {allocate(count), count};
+    }
+
+    /**
+     * @brief 对齐分配内存，池中的块最多按 NodePool::GRANULE 对齐
+     */
+    template <std::size_t Alignment>
+    [[nodiscard]] auto allocate_aligned(std::size_t n) -> T* {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be power of two");
+        static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+        static_assert(Alignment <= NodePool::GRANULE, "Pool blocks are aligned to at most NodePool::GRANULE");
+        return allocate(n);
+    }
+
+    template <typename U, typename... Args>
+    auto construct(U* p, Args&&... args) -> void {
+        std::construct_at(p, std::forward<Args>(args)...);
+    }
+
+    template <typename U, typename... Args>
+    auto construct_n(U* p, std::size_t n, Args&&... args) -> void {
+        fallback_.construct_n(p, n, std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    auto destroy(U* p) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_at(p);
+        }
+    }
+
+    template <typename U>
+    auto destroy_n(U* p, std::size_t n) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_n(p, n);
+        }
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create(Args&&... args) noexcept -> T* {
+        T* p = nullptr;
+        try {
+            p = allocate(1);
+            construct(p, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, 1);
+            return nullptr;
+        }
+        return p;
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create_array(std::size_t n, Args&&... args) noexcept -> T* {
+        if (n == 0) return nullptr;
+
+        T* p = nullptr;
+        try {
+            p = allocate(n);
+            construct_n(p, n, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, n);
+            return nullptr;
+        }
+        return p;
+    }
+
+    static constexpr auto max_size() noexcept -> std::size_t {
+        return static_cast<std::size_t>(-1) / sizeof(T);
+    }
+
+private:
+    static constexpr bool POOLED = sizeof(T) <= NodePool::MAX_BLOCK_SIZE && alignof(T) <= NodePool::GRANULE;
+    static constexpr usize CLASS = NodePool::size_class(sizeof(T));
+
+    [[no_unique_address]] Allocator<T> fallback_;
+};
+
+template <typename T, typename U, bool ThreadCache>
+constexpr auto operator==(const PoolAllocator<T, ThreadCache>&, const PoolAllocator<U, ThreadCache>&) noexcept -> bool {
+    return true;
+}
+
+} // namespace my::mem
+
+#endif // POOL_ALLOC_HPP
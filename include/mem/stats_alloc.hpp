@@ -0,0 +1,346 @@
+/**
+ * @brief 按容器类型统计分配次数、字节数、大小分布与生命周期的分配器适配器
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef STATS_ALLOC_HPP
+#define STATS_ALLOC_HPP
+
+#include "alloc.hpp"
+#include "vec.hpp"
+
+#include <array>
+#include <chrono>
+
+namespace my::mem {
+
+/**
+ * @brief 统计所归属的容器类型
+ */
+enum class AllocTag : u8 {
+    Other,
+    Vec,
+    VecDeque,
+    LinkedList,
+    HashMap,
+    RBTreeMap,
+    BTreeMap,
+    String,
+    Json,
+};
+
+inline constexpr usize ALLOC_TAG_COUNT = static_cast<usize>(AllocTag::Json) + 1;
+
+constexpr auto alloc_tag_name(const AllocTag tag) noexcept -> const char* {
+    switch (tag) {
+    case AllocTag::Vec: return "Vec";
+    case AllocTag::VecDeque: return "VecDeque";
+    case AllocTag::LinkedList: return "LinkedList";
+    case AllocTag::HashMap: return "HashMap";
+    case AllocTag::RBTreeMap: return "RBTreeMap";
+    case AllocTag::BTreeMap: return "BTreeMap";
+    case AllocTag::String: return "String";
+    case AllocTag::Json: return "Json";
+    default: return "Other";
+    }
+}
+
+/**
+ * @brief 一个标签的统计快照
+ */
+struct AllocStats {
+    /**
+     * @brief 第 i 桶统计大小在 (2^(i-1), 2^i] 字节的分配，最后一桶包括更大的
+     */
+    static constexpr usize SIZE_BUCKETS = 32;
+
+    /**
+     * @brief 第 i 桶统计生命周期在 [2^(i-1), 2^i) 纳秒的分配，最后一桶包括更长的
+     */
+    static constexpr usize LIFETIME_BUCKETS = 40;
+
+    AllocTag tag;
+    u64 allocs;          // 分配次数
+    u64 frees;           // 释放次数
+    u64 bytes_allocated; // 分配的总字节数
+    u64 bytes_freed;     // 释放的总字节数
+    u64 timed_frees;     // 记录了生命周期的释放次数
+    u64 lifetime_ns;     // 这些释放的生命周期之和
+    std::array<u64, SIZE_BUCKETS> sizes;
+    std::array<u64, LIFETIME_BUCKETS> lifetimes;
+
+    static constexpr usize size_bucket(const usize bytes) noexcept {
+        return std::min<usize>(std::bit_width(bytes - (bytes != 0)), SIZE_BUCKETS - 1);
+    }
+
+    static constexpr usize lifetime_bucket(const u64 ns) noexcept {
+        return std::min<usize>(std::bit_width(ns), LIFETIME_BUCKETS - 1);
+    }
+
+    u64 live_allocs() const noexcept { return allocs - frees; }
+
+    u64 live_bytes() const noexcept { return bytes_allocated - bytes_freed; }
+
+    f64 mean_size() const noexcept {
+        return allocs == 0 ? 0.0 : static_cast<f64>(bytes_allocated) / static_cast<f64>(allocs);
+    }
+
+    f64 mean_lifetime_ns() const noexcept {
+        return timed_frees == 0 ? 0.0 : static_cast<f64>(lifetime_ns) / static_cast<f64>(timed_frees);
+    }
+
+    /**
+     * @brief 平均每次操作的分配次数，用于基准测试
+     */
+    f64 allocs_per_op(const u64 ops) const noexcept {
+        return ops == 0 ? 0.0 : static_cast<f64>(allocs) / static_cast<f64>(ops);
+    }
+
+    /**
+     * @brief 两次快照之差，即期间发生的分配
+     */
+    AllocStats operator-(const AllocStats& before) const noexcept {
+        AllocStats d = *this;
+        d.allocs -= before.allocs;
+        d.frees -= before.frees;
+        d.bytes_allocated -= before.bytes_allocated;
+        d.bytes_freed -= before.bytes_freed;
+        d.timed_frees -= before.timed_frees;
+        d.lifetime_ns -= before.lifetime_ns;
+        for (usize i = 0; i < SIZE_BUCKETS; ++i) d.sizes[i] -= before.sizes[i];
+        for (usize i = 0; i < LIFETIME_BUCKETS; ++i) d.lifetimes[i] -= before.lifetimes[i];
+        return d;
+    }
+};
+
+/**
+ * @class AllocStatistics
+ * @brief StatsAllocator 共享的计数器
+ * @details 每个线程每个标签持有一组计数器，只由所属线程以 relaxed 的读后写更新，不加锁也不用原子读改写指令；
+ *          快照时加锁遍历存活线程的计数器并加上已退出线程累计的值，并发分配时只是近似值。
+ *          计数器是有意泄漏的单例，线程退出与静态析构期间仍可使用。
+ */
+class AllocStatistics {
+public:
+    static void record_alloc(AllocTag tag, usize bytes) noexcept;
+
+    static void record_free(AllocTag tag, usize bytes) noexcept;
+
+    /**
+     * @brief 记录释放，并记录分配于 born（now() 的返回值）的对象的生命周期
+     */
+    static void record_free(AllocTag tag, usize bytes, u64 born) noexcept;
+
+    /**
+     * @brief 单调时钟，单位纳秒
+     */
+    static u64 now() noexcept {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count());
+    }
+
+    static AllocStats snapshot(AllocTag tag);
+
+    /**
+     * @brief 所有标签的快照，按标签顺序排列
+     */
+    static util::Vec<AllocStats> snapshot();
+};
+
+/**
+ * @class StatsAllocator
+ * @brief 包装任意分配器 Alloc，把经过它的分配按 Tag 计入 AllocStatistics
+ * @details 按需替换容器的 Alloc 参数即可开启统计，rebind 后保持同一个 Tag，容器内部的节点、桶等分配也计入该标签。
+ *          TrackLifetime 为 true 时，每块内存前加一个 max(alignof(T), 16) 字节的头部保存分配时刻，
+ *          释放时据此记录生命周期；这会改变交给 Alloc 的请求大小，为 false 时请求原样转交 Alloc，只记录次数与大小。
+ * @tparam T 分配的元素类型
+ * @tparam Tag 统计标签
+ * @tparam Alloc 实际分配内存的分配器
+ * @tparam TrackLifetime 是否记录生命周期
+ */
+template <typename T, AllocTag Tag = AllocTag::Other, typename Alloc = Allocator<T>, bool TrackLifetime = true>
+class StatsAllocator {
+public:
+    using Self = StatsAllocator<T, Tag, Alloc, TrackLifetime>;
+    using value_type = T;
+    using inner_type = Alloc;
+
+    using is_always_equal = typename std::allocator_traits<Alloc>::is_always_equal;
+    using propagate_on_container_copy_assignment = typename std::allocator_traits<Alloc>::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename std::allocator_traits<Alloc>::propagate_on_container_move_assignment;
+    using propagate_on_container_swap = typename std::allocator_traits<Alloc>::propagate_on_container_swap;
+
+    StatsAllocator() = default;
+
+    explicit StatsAllocator(const Alloc& inner) noexcept : inner_(inner) {}
+
+    template <typename U, typename A>
+    StatsAllocator(const StatsAllocator<U, Tag, A, TrackLifetime>& other) noexcept : inner_(other.inner()) {}
+
+    template <typename U>
+    struct rebind {
+        using other = StatsAllocator<U, Tag, typename Alloc::template rebind<U>::other, TrackLifetime>;
+    };
+
+    const Alloc& inner() const noexcept { return inner_; }
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T* {
+        if (n == 0) return nullptr;
+        if (n > max_size()) [[unlikely]] {
+            throw std::bad_alloc();
+        }
+        T* p;
+        if constexpr (TrackLifetime) {
+            CellAlloc cells(inner_);
+            Cell* c = cells.allocate(cells_for(n));
+            *reinterpret_cast<u64*>(c) = AllocStatistics::now();
+            p = reinterpret_cast<T*>(c + 1);
+        } else {
+            p = inner_.allocate(n);
+        }
+        AllocStatistics::record_alloc(Tag, n * sizeof(T));
+        return p;
+    }
+
+    auto deallocate(T* p, std::size_t n) noexcept -> void {
+        if (!p) return;
+        if constexpr (TrackLifetime) {
+            Cell* c = reinterpret_cast<Cell*>(p) - 1;
+            AllocStatistics::record_free(Tag, n * sizeof(T), *reinterpret_cast<u64*>(c));
+            CellAlloc cells(inner_);
+            cells.deallocate(c, cells_for(n));
+        } else {
+            AllocStatistics::record_free(Tag, n * sizeof(T));
+            inner_.deallocate(p, n);
+        }
+    }
+
+    /**
+     * @brief 超额分配内存；不记录生命周期时沿用 Alloc 的策略，否则向上取 2 的幂
+     */
+    [[nodiscard]] auto allocate_at_least(std::size_t n) -> AllocationResult<T*> {
+        if (n == 0) return {nullptr, 0};
+        if constexpr (TrackLifetime) {
+            std::size_t count = std::bit_ceil(n);
+            return {allocate(count), count};
+        } else {
+            auto result = inner_.allocate_at_least(n);
+            AllocStatistics::record_alloc(Tag, result.count * sizeof(T));
+            return result;
+        }
+    }
+
+    /**
+     * @brief 对齐分配内存，记录生命周期时最多按头部大小对齐
+     */
+    template <std::size_t Alignment>
+    [[nodiscard]] auto allocate_aligned(std::size_t n) -> T* {
+        static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be power of two");
+        static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+        if constexpr (TrackLifetime) {
+            static_assert(Alignment <= HEADER_SIZE, "Blocks are aligned to at most the header size");
+            return allocate(n);
+        } else {
+            T* p = inner_.template allocate_aligned<Alignment>(n);
+            AllocStatistics::record_alloc(Tag, n * sizeof(T));
+            return p;
+        }
+    }
+
+    template <typename U, typename... Args>
+    auto construct(U* p, Args&&... args) -> void {
+        std::construct_at(p, std::forward<Args>(args)...);
+    }
+
+    template <typename U, typename... Args>
+    auto construct_n(U* p, std::size_t n, Args&&... args) -> void {
+        std::size_t constructed = 0;
+        try {
+            for (; constructed < n; ++constructed) {
+                std::construct_at(p + constructed, std::forward<Args>(args)...);
+            }
+        } catch (...) {
+            if constexpr (!std::is_trivially_destructible_v<U>) {
+                for (std::size_t i = 0; i < constructed; ++i) {
+                    std::destroy_at(p + i);
+                }
+            }
+            throw;
+        }
+    }
+
+    template <typename U>
+    auto destroy(U* p) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_at(p);
+        }
+    }
+
+    template <typename U>
+    auto destroy_n(U* p, std::size_t n) noexcept -> void {
+        if constexpr (!std::is_trivially_destructible_v<U>) {
+            std::destroy_n(p, n);
+        }
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create(Args&&... args) noexcept -> T* {
+        T* p = nullptr;
+        try {
+            p = allocate(1);
+            construct(p, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, 1);
+            return nullptr;
+        }
+        return p;
+    }
+
+    template <typename... Args>
+    [[nodiscard]] auto create_array(std::size_t n, Args&&... args) noexcept -> T* {
+        if (n == 0) return nullptr;
+
+        T* p = nullptr;
+        try {
+            p = allocate(n);
+            construct_n(p, n, std::forward<Args>(args)...);
+        } catch (...) {
+            if (p) deallocate(p, n);
+            return nullptr;
+        }
+        return p;
+    }
+
+    static constexpr auto max_size() noexcept -> std::size_t {
+        return (static_cast<std::size_t>(-1) - HEADER_SIZE) / sizeof(T);
+    }
+
+private:
+    static constexpr usize HEADER_SIZE = std::max<usize>(alignof(T), 16);
+
+    /**
+     * @brief 头部与数据都以 Cell 为单位向 Alloc 申请，保证数据按 alignof(T) 对齐
+     */
+    struct alignas(HEADER_SIZE) Cell {
+        std::byte bytes[HEADER_SIZE];
+    };
+
+    using CellAlloc = typename Alloc::template rebind<Cell>::other;
+
+    static constexpr usize cells_for(const usize n) noexcept {
+        return 1 + (n * sizeof(T) + HEADER_SIZE - 1) / HEADER_SIZE;
+    }
+
+    [[no_unique_address]] Alloc inner_;
+};
+
+template <typename T, typename U, AllocTag Tag, typename A, typename B, bool TrackLifetime>
+auto operator==(const StatsAllocator<T, Tag, A, TrackLifetime>& lhs, const StatsAllocator<U, Tag, B, TrackLifetime>& rhs) noexcept -> bool {
+    return lhs.inner() == rhs.inner();
+}
+
+} // namespace my::mem
+
+#endif // STATS_ALLOC_HPP
@@ -3,22 +3,24 @@
  * @note 由于需要追踪内存泄露，原则上不使用自定义的数据结构
  * @author Ricky
  * @date 2025/7/13
- * @version 2.0
+ * @version 3.0
  */
 #ifndef TRACKING_ALLOCATOR_HPP
 #define TRACKING_ALLOCATOR_HPP
 
 #include "alloc.hpp"
+#include "my_types.hpp"
 #include "time.hpp"
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <ctime>
+#include <mutex>
 #include <new>
 #include <string>
 #include <unordered_map>
-#include <format>
-#include <iostream>
+#include <vector>
 
 namespace my::mem {
 
@@ -35,171 +37,147 @@ inline auto format_time(const std::tm& tm, const char* fmt) -> std::string {
 }
 
 /**
- * @brief 分配信息记录
+ * @brief 一次被采样的分配
  */
 struct AllocationRecord {
-    usize id;                                   // 分配的唯一ID
+    usize id;                                   // 采样序号
     usize size;                                 // 分配的字节数
+    usize weight;                               // 该样本代表的字节数（无偏估计）
     std::chrono::system_clock::time_point time; // 分配时间
-    std::string stack;                          // 调用栈信息
+    u64 stack;                                  // 调用栈在栈表中的键
+};
+
+/**
+ * @brief 堆剖面的输出格式
+ */
+enum class ProfileFormat {
+    Pprof,  // gperftools 文本堆格式（heap_v2），可直接交给 pprof
+    Folded, // 折叠栈格式，每行 "最外层;...;最内层 字节数"，可交给 flamegraph.pl
+};
+
+/**
+ * @brief 追踪器统计
+ */
+struct TracerStats {
+    usize current;           // 当前使用量，没有并发分配时为精确值
+    usize peak;              // 峰值，只在采样点与查询时更新，为近似值
+    usize total_allocated;   // 总分配内存量
+    usize total_deallocated; // 总释放内存量
+    usize allocs;            // 分配次数
+    usize samples;           // 被采样的分配次数
+    usize live_samples;      // 仍未释放的样本数
+    usize live_estimate;     // 仍未释放的样本折算的字节数，是对当前使用量的估计
 };
 
 /**
  * @brief 内存追踪器，单例类
+ * @details 字节数与次数按线程分条累加，每次分配都计入；调用栈与逐个记录只针对被采样的分配。
+ *          每个线程独立地按字节做泊松采样：相邻两次采样之间的字节数服从均值为采样间隔的指数分布，
+ *          大分配几乎必然被采到，小分配按大小成比例地被采到，每个样本按 size / (1 - e^(-size/间隔)) 折算字节数。
+ *          样本按地址分片存放，每片一把锁；释放时先查一个计数布隆过滤器，未被采样的指针绝大多数不必加锁。
+ *          采样间隔为 0 时记录每一次分配，用于精确的泄漏检测。
+ *          追踪器是有意泄漏的单例，静态析构期间仍可使用。
  */
 class MemoryTracer {
 public:
-    MemoryTracer() {
-        // 注册退出时报告函数
-        std::atexit([]() {
-            instance().report_on_exit();
-        });
-    }
+    static constexpr usize DEFAULT_SAMPLE_INTERVAL = 512 * 1024;
+    static constexpr usize MAX_FRAMES = 32;
 
-    static MemoryTracer& instance() {
-        static MemoryTracer tracker;
-        return tracker;
-    }
+    static MemoryTracer& instance();
 
     /**
      * @brief 追踪内存申请
      */
-    void trace_alloc(void* ptr, const usize size, const std::string& stack = "") {
-        // std::lock_guard lock(mutex_);
-
-        // 生成分配记录
-        const auto now = std::chrono::system_clock::now();
-        const AllocationRecord record{++alloc_count_, size, now, stack};
-
-        // 更新内存统计
-        current_memory_ += size;
-        peak_memory_.store(std::max(peak_memory_.load(), current_memory_.load()));
-        total_allocated_ += size;
-
-        // 存储记录
-        alloc_map_[ptr] = record;
-
-        // 输出详细日志
-        if (verbose_) {
-            const auto t = std::chrono::system_clock::to_time_t(now);
-            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-
-            auto time_str = format_time(time_conv(t), "%T");
-            std::cout << std::format(
-                "[ALLOC] {} ID: {} Size: {} bytes Time: {}.{:03d} Current: {} bytes Peak: {} bytes\n",
-                ptr,
-                record.id,
-                size,
-                time_str,
-                static_cast<int>(ms.count()),
-                current_memory_.load(),
-                peak_memory_.load());
-        }
-    }
+    void trace_alloc(void* ptr, usize size);
 
     /**
-     * @brief 追踪内存释放
+     * @brief 追踪内存释放，size 须与申请时相同
      */
-    void trace_dealloc(void* ptr) {
-        // std::lock_guard lock(mutex_);
+    void trace_dealloc(void* ptr, usize size);
 
-        const auto it = alloc_map_.find(ptr);
-        if (it == alloc_map_.end()) {
-            if (verbose_) {
-                std::cout << "[DEALLOC] " << ptr << " not found!\n";
-            }
-            return;
-        }
+    /**
+     * @brief 设置平均采样间隔（字节），0 表示记录每一次分配
+     * @note 各线程在下一次采样后才按新的间隔抽样
+     */
+    void set_sample_interval(usize bytes) noexcept;
 
-        // 更新内存统计
-        const usize size = it->second.size;
-        current_memory_ -= size;
-        total_deallocated_ += size;
-
-        // 输出详细日志
-        if (verbose_) {
-            const auto now = std::chrono::system_clock::now();
-            const auto t = std::chrono::system_clock::to_time_t(now);
-            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-
-            auto time_str = format_time(time_conv(t), "%T");
-            std::cout << std::format(
-                "[FREE] {} ID: {} Size: {} bytes Time: {}.{:03d} Current: {} bytes\n",
-                ptr,
-                it->second.id,
-                size,
-                time_str,
-                static_cast<int>(ms.count()),
-                current_memory_.load());
-        }
+    usize sample_interval() const noexcept;
 
-        // 移除记录
-        alloc_map_.erase(it);
-    }
+    TracerStats stats() const;
 
     /**
-     * @brief 报告内存泄露
+     * @brief 按调用栈汇总仍未释放的样本，生成堆剖面
      */
-    void report_leaks() const {
-        // std::lock_guard lock(mutex_);
+    std::string heap_profile(ProfileFormat format = ProfileFormat::Pprof) const;
 
-        if (alloc_map_.empty()) {
-            std::cout << "\n[TRACKER] No memory leaks detected\n";
-        } else {
-            std::cout << "\n[TRACKER] Memory leaks detected: "
-                      << alloc_map_.size() << " allocations\n";
-
-            for (const auto& [ptr, record] : alloc_map_) {
-                const auto t = std::chrono::system_clock::to_time_t(record.time);
-                auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(record.time.time_since_epoch()) % 1000;
-
-                auto time_str = format_time(time_conv(t), "%T");
-                std::cout << std::format(
-                    "  Leak #{} at {} - Size: {} bytes Allocated at: {}.{:03d}\n",
-                    record.id,
-                    ptr,
-                    record.size,
-                    time_str,
-                    static_cast<int>(ms.count()));
-            }
-        }
+    /**
+     * @brief 把 heap_profile 写入文件
+     * @return 写入失败时返回 false
+     */
+    bool dump_heap_profile(const char* path, ProfileFormat format = ProfileFormat::Pprof) const;
 
-        // 打印内存统计摘要
-        std::cout << std::format(
-            "\n[TRACKER] Memory usage summary:\n"
-            "  Current memory:   {} bytes\n"
-            "  Peak memory:      {} bytes\n"
-            "  Total allocated:  {} bytes\n"
-            "  Total deallocated:{} bytes\n"
-            "  Net memory:       {} bytes\n",
-            current_memory_.load(),
-            peak_memory_.load(),
-            total_allocated_.load(),
-            total_deallocated_.load(),
-            total_allocated_.load() - total_deallocated_.load());
-    }
+    /**
+     * @brief 报告仍未释放的样本与统计摘要；采样间隔为 0 时即全部泄漏
+     */
+    void report_leaks() const;
 
-    void set_verbose(const bool verbose) noexcept {
-        verbose_ = verbose;
-    }
+    /**
+     * @brief 详细模式下打印每个样本的申请与释放，并在进程退出时报告泄漏
+     */
+    void set_verbose(bool verbose) noexcept;
 
 private:
-    void report_on_exit() const {
-        if (!reported_) {
-            report_leaks();
-            reported_ = true;
-        }
-    }
+    MemoryTracer();
+
+    void record_sample(void* ptr, usize size);
+
+    void update_peak() const noexcept;
+
+    usize current() const noexcept;
 
 private:
-    // mutable std::mutex mutex_;
-    std::unordered_map<void*, AllocationRecord> alloc_map_;
+    static constexpr usize SHARD_COUNT = 64;
+    static constexpr usize STRIPE_COUNT = 16;
+    static constexpr usize FILTER_SIZE = 1 << 16;
 
-    std::atomic<usize> current_memory_{0};    // 当前内存使用量
-    std::atomic<usize> peak_memory_{0};       // 峰值内存使用量
-    std::atomic<usize> total_allocated_{0};   // 总分配内存量
-    std::atomic<usize> total_deallocated_{0}; // 总释放内存量
-    std::atomic<usize> alloc_count_{0};       // 分配操作计数器
+    /**
+     * @brief 一组计数，按线程分散到不同的缓存行
+     */
+    struct alignas(64) Stripe {
+        std::atomic<usize> allocated{0};
+        std::atomic<usize> deallocated{0};
+        std::atomic<usize> allocs{0};
+    };
+
+    struct alignas(64) SampleShard {
+        mutable std::mutex mtx;
+        std::unordered_map<void*, AllocationRecord> live;
+    };
+
+    /**
+     * @brief 一条调用栈及其累计的样本
+     */
+    struct StackTrace {
+        std::vector<void*> frames; // 最内层在前
+        usize samples{0};
+        usize bytes{0};
+    };
+
+    struct alignas(64) StackShard {
+        mutable std::mutex mtx;
+        std::unordered_map<u64, StackTrace> traces;
+    };
+
+    std::array<Stripe, STRIPE_COUNT> stripes_;
+    std::array<SampleShard, SHARD_COUNT> samples_;
+    std::array<StackShard, SHARD_COUNT> stacks_;
+    std::array<std::atomic<u16>, FILTER_SIZE> filter_{}; // 按地址散列的存活样本计数
+
+    std::atomic<usize> interval_{DEFAULT_SAMPLE_INTERVAL};
+    std::atomic<usize> sample_count_{0};
+    std::atomic<usize> live_samples_{0};
+    std::atomic<usize> live_estimate_{0};
+    mutable std::atomic<usize> peak_memory_{0};
 
     std::atomic<bool> verbose_{false};          // 详细模式
     mutable std::atomic<bool> reported_{false}; // 是否已报告
@@ -208,7 +186,7 @@ private:
 /**
  * @brief 可追踪内存泄漏的内存分配器
  * @tparam T 分配的对象类型
- * @details 记录每次分配和释放，程序结束时自动报告未释放的内存
+ * @details 每次分配与释放都交给 MemoryTracer 计数，按采样间隔记录调用栈
  */
 template <typename T>
 class TracingAllocator {
@@ -249,8 +227,7 @@ public:
         } else {
             p = static_cast<pointer>(::operator new(bytes));
         }
-        const std::string stack = capture_stack();
-        MemoryTracer::instance().trace_alloc(p, bytes, stack);
+        MemoryTracer::instance().trace_alloc(p, bytes);
         return p;
     }
 
@@ -258,11 +235,10 @@ public:
         if (!p) return;
 
         std::size_t bytes = n * sizeof(T);
+        MemoryTracer::instance().trace_dealloc(p, bytes);
         if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
-            MemoryTracer::instance().trace_dealloc(p);
             ::operator delete(p, bytes, std::align_val_t(alignof(T)));
         } else {
-            MemoryTracer::instance().trace_dealloc(p);
             ::operator delete(p, bytes);
         }
     }
@@ -359,17 +335,19 @@ public:
         MemoryTracer::instance().set_verbose(verbose);
     }
 
+    /**
+     * @brief 设置采样间隔（字节），0 表示记录每一次分配
+     */
+    static void set_sample_interval(const usize bytes) noexcept {
+        MemoryTracer::instance().set_sample_interval(bytes);
+    }
+
     /**
      * @brief 手动报告内存泄漏
      */
     static void report_leaks() {
         MemoryTracer::instance().report_leaks();
     }
-
-private:
-    static std::string capture_stack() {
-        return "Stack capture not implemented";
-    }
 };
 
 // 分配器比较支持
@@ -0,0 +1,141 @@
+/**
+ * @brief 基于事件循环的非阻塞 TCP
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_ASYNC_TCP_HPP
+#define NET_ASYNC_TCP_HPP
+
+#include "event_loop.hpp"
+#include "net.hpp"
+
+#include <memory>
+
+namespace my::net {
+
+class AsyncTcpStream;
+
+/**
+ * @class AsyncTcpListener
+ * @brief 非阻塞监听套接字，accept 在无新连接时挂起当前协程
+ */
+class AsyncTcpListener : public NoCopyMove {
+public:
+    /**
+     * @brief 绑定并开始监听
+     * @param port 0 表示由系统分配，可通过 local_port 查询
+     */
+    AsyncTcpListener(EventLoop& event_loop, str::StringView ip, u16 port, i32 backlog = 1024);
+
+    /**
+     * @brief 接管已在监听的套接字并登记到事件循环
+     */
+    AsyncTcpListener(EventLoop& event_loop, plat::net::SocketHandle* h);
+
+    ~AsyncTcpListener();
+
+    [[nodiscard]] str::String<> local_ip() const;
+    [[nodiscard]] u16 local_port() const;
+
+    /**
+     * @brief 接受一个连接，新连接已登记到同一事件循环
+     * @exception Exception 若监听套接字已关闭，则抛出 network_exception
+     */
+    coro::Task<std::unique_ptr<AsyncTcpStream>> accept();
+
+    /**
+     * @brief 关闭监听套接字，挂起中的 accept 抛出 network_exception
+     */
+    void close();
+
+    [[nodiscard]] bool is_open() const;
+
+private:
+    EventLoop* loop_;
+    IoSource* source_{nullptr};
+    std::unique_ptr<plat::net::SocketHandle, void (*)(plat::net::SocketHandle*)> handle_;
+    str::String<> local_ip_;
+    u16 local_port_{0};
+};
+
+/**
+ * @class AsyncTcpStream
+ * @brief 非阻塞 TCP 连接，读写在内核缓冲区空/满时挂起当前协程而不是阻塞线程
+ * @details 可选的空闲超时：连续 idle_ms 毫秒没有成功的读写时，挂起中及之后的读写抛出
+ *          network_exception("Connection idle timeout")。定时器在每次读写成功时 O(1) 续期。
+ */
+class AsyncTcpStream : public NoCopyMove {
+public:
+    /**
+     * @brief 连接到指定地址
+     * @note 连接建立阶段是阻塞的，建立后切换为非阻塞
+     */
+    static std::unique_ptr<AsyncTcpStream> connect(EventLoop& event_loop, str::StringView ip, u16 port);
+
+    /**
+     * @brief 接管已连接的套接字并登记到事件循环
+     */
+    AsyncTcpStream(EventLoop& event_loop, plat::net::SocketHandle* h);
+
+    ~AsyncTcpStream();
+
+    /**
+     * @brief 读取到调用方缓冲区
+     * @return 读取的字节数，0 表示对端关闭
+     */
+    coro::Task<usize> read_some(char* buf, usize size);
+
+    /**
+     * @brief 最多读取 max_size 字节
+     * @return 读取的数据，空串表示对端关闭
+     */
+    coro::Task<str::String<>> read(usize max_size = 4096);
+
+    /**
+     * @brief 写出全部数据
+     * @return 写出的字节数，等于 data.len()
+     */
+    coro::Task<usize> write(str::StringView data);
+
+    /**
+     * @brief 聚集写出全部分段，每次系统调用最多 64 段
+     * @details 部分写时原地推进 slices，调用方的分段数组在完成前需保持有效
+     * @return 写出的总字节数
+     */
+    coro::Task<usize> write_vectored(plat::IoSlice* slices, usize n);
+
+    /**
+     * @brief 设置空闲超时
+     * @param idle_ms 毫秒数，0 表示关闭
+     */
+    void set_idle_timeout(u64 idle_ms);
+
+    [[nodiscard]] bool is_timed_out() const noexcept {
+        return timed_out_;
+    }
+
+    void close();
+
+    [[nodiscard]] bool is_open() const;
+
+private:
+    void touch();
+
+    void ensure_usable() const;
+
+    void cancel_idle_timer();
+
+private:
+    EventLoop* loop_;
+    IoSource* source_{nullptr};
+    std::unique_ptr<plat::net::SocketHandle, void (*)(plat::net::SocketHandle*)> handle_;
+    u64 idle_ms_{0};
+    EventLoop::TimerId idle_timer_{0};
+    bool has_idle_timer_{false};
+    bool timed_out_{false};
+};
+
+} // namespace my::net
+
+#endif // NET_ASYNC_TCP_HPP
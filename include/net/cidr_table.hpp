@@ -0,0 +1,285 @@
+/**
+ * @brief 最长前缀匹配的 CIDR 路由表
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_CIDR_TABLE_HPP
+#define NET_CIDR_TABLE_HPP
+
+#include "ip_addr.hpp"
+#include "vec.hpp"
+
+#include <bit>
+#include <span>
+
+namespace my::net {
+
+namespace detail {
+
+/**
+ * @class PrefixTrie
+ * @brief poptrie 风格的压缩多路 trie，键为最长 128 位的地址，值为 u32 下标
+ * @details 地址高 16 位直接索引一张 65536 项的表（direct pointing），表项要么就是结果，
+ *          要么指向一个节点。节点每层消耗 6 位，用两个 64 位位图描述 64 个分支：
+ *          vector 标记哪些分支有子节点，leafvec 标记叶子值发生变化的位置。
+ *          子节点与叶子各自连续存放，下标由位图的 popcount 算出，节点只有 24 字节。
+ *          结构只读、整体构建：add 暂存前缀，build 排序去重后一次生成。
+ */
+class PrefixTrie {
+public:
+    /**
+     * @brief 无匹配时 lookup 的返回值，也是值下标的上限
+     */
+    static constexpr u32 NONE = 0x7fffffff;
+
+    /**
+     * @param width 地址位数，32 或 128
+     */
+    explicit PrefixTrie(u32 width);
+
+    /**
+     * @brief 暂存前缀，地址左对齐存放在 (hi, lo) 中，超出 len 的位被忽略；同一前缀后加入的覆盖先加入的
+     */
+    void add(u64 hi, u64 lo, u32 len, u32 value);
+
+    /**
+     * @brief 由全部已暂存的前缀重新生成查找结构
+     */
+    void build();
+
+    /**
+     * @brief 已暂存的前缀数（含重复）
+     */
+    [[nodiscard]] usize prefixes() const noexcept {
+        return staged_.len();
+    }
+
+    /**
+     * @brief 查找结构占用的字节数
+     */
+    [[nodiscard]] usize memory_bytes() const noexcept {
+        return direct_.len() * sizeof(u32) + nodes_.len() * sizeof(Node) + leaves_.len() * sizeof(u32);
+    }
+
+    [[nodiscard]] u32 lookup(const u64 hi, const u64 lo) const noexcept {
+        const u32 entry = direct_.data()[hi >> (64 - DIRECT_BITS)];
+        if (entry & LEAF) {
+            return entry & ~LEAF;
+        }
+        return descend(entry, hi, lo);
+    }
+
+    /**
+     * @brief 批量查找：先为全部地址取直接索引表项，再逐个下降，使各地址的访存相互重叠
+     */
+    void lookup_batch(const u64* his, const u64* los, usize n, u32* out) const noexcept;
+
+private:
+    static constexpr u32 DIRECT_BITS = 16;
+    static constexpr u32 STRIDE = 6;
+    static constexpr u32 LEAF = 0x80000000;
+
+    struct Prefix {
+        u64 hi;
+        u64 lo;
+        u32 len;
+        u32 value;
+    };
+
+    struct Node {
+        u64 vector;  // 有子节点的分支
+        u64 leafvec; // 叶子分支中值发生变化的位置
+        u32 base0;   // 第一个叶子在 leaves_ 中的下标
+        u32 base1;   // 第一个子节点在 nodes_ 中的下标
+    };
+
+    /**
+     * @brief 取从最高位数起第 offset 位开始的 6 位，超出 128 位的部分补零
+     */
+    static u32 chunk(const u64 hi, const u64 lo, const u32 offset) noexcept {
+        if (offset + STRIDE <= 64) {
+            return static_cast<u32>(hi >> (64 - STRIDE - offset)) & 63;
+        }
+        if (offset < 64) {
+            return static_cast<u32>((hi << (offset + STRIDE - 64)) | (lo >> (128 - STRIDE - offset))) & 63;
+        }
+        if (offset + STRIDE <= 128) {
+            return static_cast<u32>(lo >> (128 - STRIDE - offset)) & 63;
+        }
+        return static_cast<u32>(lo << (offset + STRIDE - 128)) & 63;
+    }
+
+    u32 descend(const u32 index, const u64 hi, const u64 lo) const noexcept {
+        const Node* nodes = nodes_.data();
+        const Node* node = nodes + index;
+        u32 offset = DIRECT_BITS;
+        loop {
+            const u64 bit = 1ull << chunk(hi, lo, offset);
+            const u64 upto = bit | (bit - 1);
+            if ((node->vector & bit) == 0) {
+                return leaves_.data()[node->base0 + std::popcount(node->leafvec & upto) - 1];
+            }
+            node = nodes + node->base1 + std::popcount(node->vector & upto) - 1;
+            offset += STRIDE;
+        }
+    }
+
+    void build_node(u32 index, usize first, usize last, u32 depth, u32 inherited);
+
+private:
+    u32 width_;
+    util::Vec<Prefix> staged_;
+    util::Vec<Prefix> sorted_; // 构建期间按地址排序的长前缀
+    util::Vec<u32> direct_;
+    util::Vec<Node> nodes_;
+    util::Vec<u32> leaves_;
+};
+
+/**
+ * @brief 解析 "a.b.c.d/len" 或 "x:y::/len" 形式的前缀
+ */
+struct ParsedCidr {
+    bool v6;
+    u64 hi;
+    u64 lo;
+    u32 len;
+};
+
+/**
+ * @exception Exception 若格式非法或前缀长度越界，则抛出 argument_exception
+ */
+ParsedCidr parse_cidr(str::StringView cidr);
+
+inline void split_ipv6(const Ipv6Addr& addr, u64& hi, u64& lo) noexcept {
+    const u16* seg = addr.segments();
+    hi = static_cast<u64>(seg[0]) << 48 | static_cast<u64>(seg[1]) << 32 | static_cast<u64>(seg[2]) << 16 | seg[3];
+    lo = static_cast<u64>(seg[4]) << 48 | static_cast<u64>(seg[5]) << 32 | static_cast<u64>(seg[6]) << 16 | seg[7];
+}
+
+} // namespace detail
+
+/**
+ * @class CidrTable
+ * @brief 同时容纳 IPv4 与 IPv6 前缀的最长前缀匹配表，用于 ACL、地理位置等大规模前缀分类
+ * @details 先 insert 全部前缀，再 build 一次生成只读的查找结构；build 之后的 insert 要到下一次 build 才生效。
+ *          查找结果是指向值的指针，无匹配时为 nullptr，在下一次 insert 之前有效。
+ *          build 之后的并发只读查找是安全的。
+ */
+template <typename V>
+class CidrTable {
+public:
+    CidrTable() : v4_(32), v6_(128) {}
+
+    /**
+     * @exception Exception 若 len 超过 32，则抛出 argument_exception
+     */
+    CidrTable& insert(const Ipv4Addr addr, const u32 len, V value) {
+        if (len > 32) {
+            throw argument_exception("IPv4 prefix length {} exceeds 32", len);
+        }
+        v4_.add(static_cast<u64>(addr.to_u32()) << 32, 0, len, push_value(std::move(value)));
+        return *this;
+    }
+
+    /**
+     * @exception Exception 若 len 超过 128，则抛出 argument_exception
+     */
+    CidrTable& insert(const Ipv6Addr& addr, const u32 len, V value) {
+        if (len > 128) {
+            throw argument_exception("IPv6 prefix length {} exceeds 128", len);
+        }
+        u64 hi, lo;
+        detail::split_ipv6(addr, hi, lo);
+        v6_.add(hi, lo, len, push_value(std::move(value)));
+        return *this;
+    }
+
+    /**
+     * @brief 插入 "10.0.0.0/8"、"2001:db8::/32" 形式的前缀
+     * @exception Exception 若格式非法，则抛出 argument_exception
+     */
+    CidrTable& insert(const str::StringView cidr, V value) {
+        const auto p = detail::parse_cidr(cidr);
+        (p.v6 ? v6_ : v4_).add(p.hi, p.lo, p.len, push_value(std::move(value)));
+        return *this;
+    }
+
+    /**
+     * @brief 由已插入的全部前缀生成查找结构
+     */
+    void build() {
+        v4_.build();
+        v6_.build();
+    }
+
+    [[nodiscard]] const V* lookup(const Ipv4Addr addr) const noexcept {
+        return value_at(v4_.lookup(static_cast<u64>(addr.to_u32()) << 32, 0));
+    }
+
+    [[nodiscard]] const V* lookup(const Ipv6Addr& addr) const noexcept {
+        u64 hi, lo;
+        detail::split_ipv6(addr, hi, lo);
+        return value_at(v6_.lookup(hi, lo));
+    }
+
+    [[nodiscard]] const V* lookup(const IpAddr& addr) const noexcept {
+        return addr.is_ipv4() ? lookup(addr.as_ipv4()) : lookup(addr.as_ipv6());
+    }
+
+    /**
+     * @brief 批量查找 IPv4 地址，out[i] 对应 addrs[i]
+     * @exception Exception 若 out 短于 addrs，则抛出 argument_exception
+     */
+    void lookup_batch(std::span<const Ipv4Addr> addrs, std::span<const V*> out) const {
+        if (out.size() < addrs.size()) {
+            throw argument_exception("Output span of {} is shorter than input of {}", out.size(), addrs.size());
+        }
+        constexpr usize BATCH = 32;
+        u64 his[BATCH], los[BATCH] = {};
+        u32 idx[BATCH];
+        for (usize i = 0; i < addrs.size(); i += BATCH) {
+            const usize n = std::min(BATCH, addrs.size() - i);
+            for (usize k = 0; k < n; ++k) {
+                his[k] = static_cast<u64>(addrs[i + k].to_u32()) << 32;
+            }
+            v4_.lookup_batch(his, los, n, idx);
+            for (usize k = 0; k < n; ++k) {
+                out[i + k] = value_at(idx[k]);
+            }
+        }
+    }
+
+    /**
+     * @brief 已插入的前缀数（含重复）
+     */
+    [[nodiscard]] usize len() const noexcept {
+        return v4_.prefixes() + v6_.prefixes();
+    }
+
+    [[nodiscard]] usize memory_bytes() const noexcept {
+        return v4_.memory_bytes() + v6_.memory_bytes();
+    }
+
+private:
+    u32 push_value(V&& value) {
+        if (values_.len() >= detail::PrefixTrie::NONE) {
+            throw runtime_exception("CidrTable holds at most {} prefixes", detail::PrefixTrie::NONE);
+        }
+        values_.push(std::move(value));
+        return static_cast<u32>(values_.len() - 1);
+    }
+
+    const V* value_at(const u32 index) const noexcept {
+        return index == detail::PrefixTrie::NONE ? nullptr : values_.data() + index;
+    }
+
+private:
+    detail::PrefixTrie v4_;
+    detail::PrefixTrie v6_;
+    util::Vec<V> values_;
+};
+
+} // namespace my::net
+
+#endif // NET_CIDR_TABLE_HPP
@@ -0,0 +1,152 @@
+/**
+ * @brief 客户端 TCP 连接池
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_CONNECTION_POOL_HPP
+#define NET_CONNECTION_POOL_HPP
+
+#include "marker.hpp"
+#include "tcp.hpp"
+#include "vec_deque.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace my::net {
+
+class ConnectionPool;
+
+/**
+ * @brief 连接池配置，上限均按 (ip, port) 计
+ */
+struct PoolConfig {
+    usize max_idle = 8;          // 保留的空闲连接数
+    usize max_total = 64;        // 空闲与借出的连接总数
+    u32 idle_timeout_ms = 60000; // 空闲超过该时长的连接被淘汰，0 表示不淘汰
+};
+
+/**
+ * @class PooledStream
+ * @brief 从连接池借出的连接，析构时归还
+ * @details 读写出错或协议状态未知时应调用 discard，避免把坏连接还回池中。
+ * @note 不能比所属 ConnectionPool 活得久
+ */
+class PooledStream : public NoCopy {
+public:
+    PooledStream(PooledStream&& other) noexcept;
+    PooledStream& operator=(PooledStream&& other) noexcept;
+
+    ~PooledStream();
+
+    TcpStream& operator*() noexcept {
+        return *stream_;
+    }
+
+    TcpStream* operator->() noexcept {
+        return stream_.get();
+    }
+
+    /**
+     * @brief 是否复用了空闲连接（否则为新建连接）
+     */
+    [[nodiscard]] bool is_reused() const noexcept {
+        return reused_;
+    }
+
+    /**
+     * @brief 关闭连接且不归还
+     */
+    void discard();
+
+private:
+    friend class ConnectionPool;
+
+    struct Endpoint;
+
+    PooledStream(ConnectionPool* pool, Endpoint* endpoint, std::unique_ptr<TcpStream> stream, bool reused) :
+            pool_(pool), endpoint_(endpoint), stream_(std::move(stream)), reused_(reused) {}
+
+    void release();
+
+private:
+    ConnectionPool* pool_;
+    Endpoint* endpoint_;
+    std::unique_ptr<TcpStream> stream_;
+    bool reused_;
+};
+
+/**
+ * @class ConnectionPool
+ * @brief 按 (ip, port) 复用阻塞 TcpStream，省去每次调用的握手
+ * @details 端点按哈希分到若干分片，每个分片一把锁，锁内只做出入队与计数，
+ *          建连与存活检查都在锁外进行，因此访问不同端点的线程互不争用。
+ *          借出时优先取最近归还的连接（LIFO），并用 MSG_PEEK 探测对端是否已关闭；
+ *          已超时或失效的连接被关闭并计入 stale，然后继续尝试下一个。
+ *          归还时顺带淘汰该端点中已超时的空闲连接，也可周期性调用 evict_idle 清理全部端点。
+ */
+class ConnectionPool : public NoCopyMove {
+public:
+    static constexpr usize DEFAULT_SHARDS = 16;
+
+    explicit ConnectionPool(PoolConfig config = {}, usize shards = DEFAULT_SHARDS);
+
+    ~ConnectionPool();
+
+    /**
+     * @brief 借出一个到 (ip, port) 的连接，没有可用空闲连接时新建
+     * @exception Exception 若该端点连接数已达 max_total，则抛出 runtime_exception；建连失败时透传异常
+     */
+    PooledStream acquire(str::StringView ip, u16 port);
+
+    /**
+     * @brief 关闭全部端点中空闲超时的连接
+     * @return 关闭的连接数
+     */
+    usize evict_idle();
+
+    /**
+     * @brief 复用空闲连接的次数
+     */
+    [[nodiscard]] u64 hits() const noexcept;
+
+    /**
+     * @brief 新建连接的次数
+     */
+    [[nodiscard]] u64 misses() const noexcept;
+
+    /**
+     * @brief 借出时发现已超时或失效而关闭的空闲连接数
+     */
+    [[nodiscard]] u64 stale() const noexcept;
+
+    /**
+     * @brief 当前空闲连接数
+     */
+    [[nodiscard]] usize idle_count() const;
+
+private:
+    friend class PooledStream;
+
+    using Endpoint = PooledStream::Endpoint;
+
+    struct Shard;
+
+    Shard& shard_for(str::StringView ip, u16 port);
+
+    void release(Endpoint* endpoint, std::unique_ptr<TcpStream> stream);
+
+    void forget(Endpoint* endpoint);
+
+    [[nodiscard]] bool expired(u64 idle_since_ms, u64 now) const noexcept;
+
+private:
+    PoolConfig config_;
+    util::Vec<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace my::net
+
+#endif // NET_CONNECTION_POOL_HPP
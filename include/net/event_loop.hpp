@@ -0,0 +1,292 @@
+/**
+ * @brief 基于 epoll 的单线程事件循环
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_EVENT_LOOP_HPP
+#define NET_EVENT_LOOP_HPP
+
+#include "poller.hpp"
+#include "task.hpp"
+#include "co_task.hpp"
+#include "binary_heap.hpp"
+#include "vec.hpp"
+#include "vec_deque.hpp"
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+namespace my::net {
+
+/**
+ * @brief 套接字的就绪状态
+ */
+struct Readiness {
+    bool readable{false};
+    bool writable{false};
+    bool hangup{false};
+};
+
+/**
+ * @brief 事件循环中登记的套接字
+ * @details 边缘触发：readable/writable 在收到通知时置位，由使用者在读/写返回 None 时清除。
+ *          等待中的协程在对应方向就绪时被恢复；回调在每次收到通知时调用。
+ */
+struct IoSource {
+    plat::net::SocketHandle* socket{nullptr};
+    Readiness ready;
+    bool closed{false};
+    coro::Coroutine read_waiter = nullptr;
+    coro::Coroutine write_waiter = nullptr;
+    std::function<void(Readiness)> callback;
+};
+
+/**
+ * @class EventLoop
+ * @brief 单线程 reactor：epoll 边缘触发 + 最小堆定时器 + 协程就绪队列
+ * @details 每轮迭代：按最近的定时器计算超时并等待就绪事件，更新 IoSource 状态并把等待者放入就绪队列，
+ *          执行到期定时器和 post 进来的任务，最后依次恢复就绪队列中的协程。
+ *          恢复总是经由就绪队列进行，回调/定时器中唤醒协程不会造成重入。
+ *          单个线程即可承载上万连接；多核时可每个线程各运行一个 EventLoop。
+ * @note 除 post/stop 外，所有成员函数只能在运行循环的线程中调用
+ */
+class EventLoop : public NoCopyMove {
+public:
+    using TimerId = u64;
+
+    static constexpr usize MAX_EVENTS = 256;
+
+    EventLoop();
+
+    ~EventLoop();
+
+    /**
+     * @brief 登记套接字：切换为非阻塞模式并关注读写就绪
+     * @param callback 可选的就绪回调，每次收到通知时以当前就绪状态调用
+     * @return IoSource，在 unwatch 前一直有效
+     */
+    IoSource* watch(plat::net::SocketHandle* socket, std::function<void(Readiness)> callback = {});
+
+    /**
+     * @brief 取消登记，不关闭套接字
+     * @details 正在等待的协程会被唤醒并看到 closed；IoSource 延迟到本轮迭代结束后释放
+     */
+    void unwatch(IoSource* source);
+
+    /**
+     * @brief 唤醒等待该 IoSource 的协程（不改变就绪状态），用于超时等外部取消
+     */
+    void interrupt(IoSource* source);
+
+    /**
+     * @brief 等待可读（或已关闭）
+     */
+    auto readable(IoSource* source) noexcept {
+        return IoAwaiter{source, false};
+    }
+
+    /**
+     * @brief 等待可写（或已关闭）
+     */
+    auto writable(IoSource* source) noexcept {
+        return IoAwaiter{source, true};
+    }
+
+    /**
+     * @brief ms 毫秒后在循环线程调用 fn
+     */
+    TimerId call_after(u64 ms, async::UniqueTask fn);
+
+    /**
+     * @brief 把定时器的到期时间改为从现在起 ms 毫秒后，O(1)
+     * @return 定时器已触发或已取消时返回 false
+     */
+    bool reset_timer(TimerId id, u64 ms);
+
+    /**
+     * @brief 取消定时器
+     * @return 定时器已触发或已取消时返回 false
+     */
+    bool cancel_timer(TimerId id);
+
+    /**
+     * @brief 挂起当前协程 ms 毫秒
+     */
+    auto sleep(const u64 ms) noexcept {
+        struct Awaiter {
+            EventLoop* event_loop;
+            u64 ms;
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(const coro::Coroutine coro) {
+                event_loop->call_after(ms, [event_loop = event_loop, coro]() { event_loop->schedule(coro); });
+            }
+
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{this, ms};
+    }
+
+    /**
+     * @brief 在循环线程上恢复协程（下一次处理就绪队列时）
+     */
+    void schedule(coro::Coroutine coro);
+
+    /**
+     * @brief 启动协程任务，生命周期由循环管理
+     * @details 任务立即运行到第一个挂起点；未捕获的异常在 run/run_once 中重新抛出
+     */
+    void spawn(coro::Task<> task);
+
+    /**
+     * @brief 从任意线程投递任务到循环线程执行
+     */
+    void post(async::UniqueTask fn);
+
+    /**
+     * @brief 运行直到 stop() 被调用
+     */
+    void run();
+
+    /**
+     * @brief 运行一轮迭代
+     * @param timeout_ms 无就绪事件时最多等待的毫秒数，-1 表示等到下一个定时器或事件
+     */
+    void run_once(i32 timeout_ms = -1);
+
+    /**
+     * @brief 运行直到任务完成并返回其结果
+     * @exception 重新抛出任务中未捕获的异常
+     */
+    template <typename T>
+    T block_on(coro::Task<T> task) {
+        auto result = Option<coro::unit_t<T>>::None();
+        bool done = false;
+        std::exception_ptr error;
+        auto driver = [](coro::Task<T> t, Option<coro::unit_t<T>>* out, bool* flag, std::exception_ptr* err) -> coro::Task<> {
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    co_await std::move(t);
+                    *out = Option<coro::Unit>::Some(coro::Unit{});
+                } else {
+                    *out = Option<T>::Some(co_await std::move(t));
+                }
+            } catch (...) {
+                *err = std::current_exception();
+            }
+            *flag = true;
+        };
+        spawn(driver(std::move(task), &result, &done, &error));
+        while (!done) {
+            run_once();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(result).unwrap();
+        }
+    }
+
+    /**
+     * @brief 请求停止，可从任意线程调用
+     */
+    void stop();
+
+    /**
+     * @brief 当前登记的套接字数
+     */
+    [[nodiscard]] usize num_watched() const noexcept {
+        return num_watched_;
+    }
+
+    /**
+     * @brief 当前未触发的定时器数
+     */
+    [[nodiscard]] usize num_timers() const noexcept {
+        return num_timers_;
+    }
+
+private:
+    struct IoAwaiter {
+        IoSource* source;
+        bool write;
+
+        bool await_ready() const noexcept {
+            return source->closed || (write ? source->ready.writable : source->ready.readable);
+        }
+
+        void await_suspend(const coro::Coroutine coro) const noexcept {
+            (write ? source->write_waiter : source->read_waiter) = coro;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief 定时器槽位，按下标复用；generation 区分同一槽位的先后定时器
+     */
+    struct TimerSlot {
+        u64 deadline{0};
+        u32 generation{0};
+        bool active{false};
+        async::UniqueTask fn;
+    };
+
+    /**
+     * @brief 堆中的到期项，可能已过时（定时器被取消或延期），弹出时与槽位比对
+     */
+    struct TimerEntry {
+        u64 deadline;
+        u32 slot;
+        u32 generation;
+
+        bool operator<(const TimerEntry& other) const noexcept {
+            return deadline < other.deadline;
+        }
+    };
+
+    static u64 now_ms();
+
+    TimerSlot* find_timer(TimerId id);
+
+    void handle_events(usize n);
+
+    void run_timers();
+
+    void run_posted();
+
+    void run_ready();
+
+    void rethrow_if_failed();
+
+    friend coro::detail::Detached spawn_driver(coro::Task<> task, EventLoop* event_loop);
+
+private:
+    plat::poller::PollerHandle* poller_;
+    util::Vec<plat::poller::PollEvent> events_;
+    usize num_watched_{0};
+    util::Vec<IoSource*> garbage_;
+
+    util::VecDeque<coro::Coroutine> ready_;
+
+    util::Vec<TimerSlot> timer_slots_;
+    util::Vec<u32> free_slots_;
+    util::BinaryHeap<TimerEntry> timer_heap_;
+    usize num_timers_{0};
+
+    std::mutex posted_mtx_;
+    util::Vec<async::UniqueTask> posted_;
+    std::atomic<bool> has_posted_{false};
+    std::atomic<bool> stop_requested_{false};
+
+    std::exception_ptr error_;
+};
+
+} // namespace my::net
+
+#endif // NET_EVENT_LOOP_HPP
@@ -0,0 +1,199 @@
+/**
+ * @brief 变长整数长度前缀的二进制分帧
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_FRAME_HPP
+#define NET_FRAME_HPP
+
+#include "buf_io.hpp"
+#include "io_slice.hpp"
+#include "option.hpp"
+#include "vec.hpp"
+
+#include <span>
+
+namespace my::net {
+
+/**
+ * @brief 无符号 LEB128 变长整数的最大字节数
+ */
+inline constexpr usize MAX_VARINT_LEN = 10;
+
+/**
+ * @brief 编码为无符号 LEB128：每字节低 7 位为数据，最高位表示后面还有字节
+ * @return 写入 out 的字节数
+ */
+constexpr usize encode_varint(u64 value, u8* out) noexcept {
+    usize n = 0;
+    while (value >= 0x80) {
+        out[n++] = static_cast<u8>(value | 0x80);
+        value >>= 7;
+    }
+    out[n++] = static_cast<u8>(value);
+    return n;
+}
+
+/**
+ * @brief 从 data 开头解码变长整数
+ * @return 消耗的字节数；数据不足返回 0
+ * @exception Exception 若超过 10 字节或溢出 64 位，则抛出 io_exception
+ */
+usize decode_varint(const u8* data, usize len, u64& value);
+
+/**
+ * @class FrameEncoder
+ * @brief 把多帧序列化为分段，供一次聚集写出
+ * @details 长度前缀与较小的负载拷贝进共享缓冲区，较大的负载作为独立分段引用，不拷贝，
+ *          需在写出完成前保持有效。一批帧合并为一次 write_vectored。
+ */
+class FrameEncoder {
+public:
+    /**
+     * @brief 小于该值的负载直接拷贝，省去一个分段
+     */
+    static constexpr usize COPY_THRESHOLD = 1024;
+
+    /**
+     * @brief 追加一帧，负载为 header 与 body 的拼接
+     * @param header 总是拷贝，用于协议自身的小首部
+     */
+    void push(str::StringView header, str::StringView body);
+
+    void push(const str::StringView payload) {
+        push(str::StringView{}, payload);
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept {
+        return chunks_.is_empty();
+    }
+
+    /**
+     * @brief 已追加的帧数
+     */
+    [[nodiscard]] usize frames() const noexcept {
+        return frames_;
+    }
+
+    /**
+     * @brief 生成分段，在下一次 push/clear 之前有效
+     */
+    util::Vec<plat::IoSlice>& slices();
+
+    void clear() noexcept;
+
+    void swap(FrameEncoder& other) noexcept;
+
+private:
+    struct Chunk {
+        const char* ext{nullptr}; // 为空时表示 buf_ 中的 [offset, offset + size)
+        usize offset{0};
+        usize size{0};
+    };
+
+    void put(const char* data, usize size);
+
+private:
+    util::Vec<char> buf_; // [0, len_) 为已序列化的数据，其余为预留容量
+    usize len_{0};
+    util::Vec<Chunk> chunks_;
+    util::Vec<plat::IoSlice> slices_;
+    usize frames_{0};
+};
+
+/**
+ * @class FrameDecoder
+ * @brief 从字节流中切分出完整帧
+ * @details 调用方把数据读入 prepare() 返回的空间并 commit，再反复调用 next 取出帧。
+ *          帧负载是指向内部缓冲区的视图，不拷贝，在下一次 prepare 之前有效。
+ *          缓冲区在尾部空间不足时整理，单帧超过容量时按需扩容，直到 max_frame。
+ */
+class FrameDecoder {
+public:
+    static constexpr usize DEFAULT_MAX_FRAME = 16 << 20;
+
+    explicit FrameDecoder(usize initial_capacity = 16 * 1024, usize max_frame = DEFAULT_MAX_FRAME);
+
+    /**
+     * @brief 返回可写入的尾部空间，必要时先整理或扩容
+     */
+    std::span<char> prepare();
+
+    /**
+     * @brief 标记 prepare 返回的空间中前 n 字节已写入
+     */
+    void commit(usize n) noexcept {
+        end_ += n;
+    }
+
+    /**
+     * @brief 取出下一个完整帧
+     * @return 数据不足时返回 None
+     * @exception Exception 若帧长度超过 max_frame，则抛出 io_exception
+     */
+    Option<str::StringView> next();
+
+    /**
+     * @brief 尚未成帧的字节数
+     */
+    [[nodiscard]] usize buffered() const noexcept {
+        return end_ - begin_;
+    }
+
+private:
+    util::Vec<char> buf_;
+    usize begin_{0};
+    usize end_{0};
+    usize need_{0}; // 当前不完整帧的总长度（含前缀），0 表示未知
+    usize max_frame_;
+};
+
+/**
+ * @brief 通过 BufWriter 写出一帧，多次调用后由 flush 一次写出
+ */
+template <io::ByteSink S>
+void write_frame(io::BufWriter<S>& writer, const str::StringView payload) {
+    u8 prefix[MAX_VARINT_LEN];
+    const usize n = encode_varint(payload.len(), prefix);
+    writer.write(reinterpret_cast<const char*>(prefix), n);
+    writer.write(payload);
+}
+
+/**
+ * @brief 通过 BufReader 读取一帧
+ * @return 负载视图，在下一次读操作前有效；字节源在帧边界结束时返回 None
+ * @exception Exception 若帧超过 BufReader 容量或在帧中间结束，则抛出 io_exception
+ */
+template <io::ByteSource S>
+Option<str::StringView> read_frame(io::BufReader<S>& reader) {
+    // 逐字节查看前缀，只等待已到达的字节，避免短帧在活动连接上阻塞到凑满 MAX_VARINT_LEN
+    u64 len = 0;
+    usize prefix = 0;
+    for (usize i = 1; prefix == 0; ++i) {
+        if (i > MAX_VARINT_LEN || i > reader.capacity()) {
+            throw io_exception("Invalid frame header");
+        }
+        const auto head = reader.peek(i);
+        if (head.len() < i) {
+            if (head.len() == 0) {
+                return Option<str::StringView>::None();
+            }
+            throw io_exception("Unexpected end of stream inside frame header");
+        }
+        prefix = decode_varint(head.as_bytes(), head.len(), len);
+    }
+    if (prefix + len > reader.capacity()) {
+        throw io_exception("Frame of {} bytes exceeds buffer capacity {}", len, reader.capacity());
+    }
+    const auto frame = reader.peek(prefix + len);
+    if (frame.len() < prefix + len) {
+        throw io_exception("Unexpected end of stream: expected {} bytes, got {}", prefix + len, frame.len());
+    }
+    reader.consume(prefix + len); // 数据留在缓冲区中直到下一次读取
+    return Option<str::StringView>::Some(frame.slice(prefix));
+}
+
+} // namespace my::net
+
+#endif // NET_FRAME_HPP
@@ -0,0 +1,282 @@
+/**
+ * @brief HTTP/1.1 请求解析、响应序列化与路由
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_HTTP_HPP
+#define NET_HTTP_HPP
+
+#include "io_slice.hpp"
+#include "option.hpp"
+#include "string.hpp"
+#include "vec.hpp"
+
+#include <functional>
+
+namespace my::net::http {
+
+enum class Method : u8 {
+    Get,
+    Head,
+    Post,
+    Put,
+    Delete,
+    Patch,
+    Options,
+    Other,
+};
+
+struct Header {
+    str::StringView name;
+    str::StringView value;
+};
+
+/**
+ * @brief 已解析的请求
+ * @details 所有视图都指向连接的接收缓冲区，不拷贝；在本批响应写出前有效
+ */
+struct Request {
+    Method method{Method::Other};
+    str::StringView method_name;
+    str::StringView target; // 原始请求目标，如 /hello?name=x
+    str::StringView path;   // ? 之前的部分
+    str::StringView query;  // ? 之后的部分，不含 ?
+    u8 minor_version{1};    // HTTP/1.x 中的 x
+    util::Vec<Header> headers;
+    str::StringView body;
+    bool keep_alive{true};
+
+    /**
+     * @brief 按名称查找首部，不区分大小写
+     */
+    [[nodiscard]] Option<str::StringView> header(str::StringView name) const;
+
+    /**
+     * @brief 查询参数 name 的值（未做百分号解码）
+     */
+    [[nodiscard]] Option<str::StringView> query_param(str::StringView name) const;
+};
+
+enum class ParseStatus : u8 {
+    Complete,   // 得到一个完整请求，consumed() 为其字节数
+    Incomplete, // 需要更多数据
+    Error,      // 请求非法，error_status() 为应答的状态码
+};
+
+/**
+ * @class RequestParser
+ * @brief 增量、零拷贝的请求解析器
+ * @details 每次以缓冲区中从当前请求开头起的全部数据调用 parse。查找头部结束符时从上次扫描到的位置继续，
+ *          因此数据分多次到达时总扫描量与请求长度成正比；头部完整后才解析请求行与首部。
+ *          只支持 Content-Length 请求体，带 Transfer-Encoding 的请求以 501 拒绝。
+ */
+class RequestParser {
+public:
+    static constexpr usize MAX_HEADERS = 64;
+    static constexpr usize DEFAULT_MAX_BODY = 1 << 20;
+
+    explicit RequestParser(usize max_body = DEFAULT_MAX_BODY) :
+            max_body_(max_body) {}
+
+    /**
+     * @param data 当前请求开头起的已接收数据；两次调用之间数据可以被搬移，但前缀内容不能改变
+     * @param req 输出，仅在返回 Complete 时有效
+     */
+    ParseStatus parse(str::StringView data, Request& req);
+
+    /**
+     * @brief 头部是否已完整接收
+     */
+    [[nodiscard]] bool head_complete() const noexcept {
+        return head_len_ > 0;
+    }
+
+    /**
+     * @brief 当前请求的总字节数（头部与请求体）
+     */
+    [[nodiscard]] usize consumed() const noexcept {
+        return head_len_ + body_len_;
+    }
+
+    [[nodiscard]] u16 error_status() const noexcept {
+        return error_;
+    }
+
+    /**
+     * @brief 开始解析下一个请求
+     */
+    void reset() noexcept {
+        scanned_ = head_len_ = body_len_ = 0;
+        error_ = 0;
+    }
+
+private:
+    ParseStatus fail(u16 status) noexcept;
+
+    ParseStatus parse_head(str::StringView head, Request& req);
+
+private:
+    usize max_body_;
+    usize scanned_{0};
+    usize head_len_{0};
+    usize body_len_{0};
+    u16 error_{0};
+};
+
+/**
+ * @brief 状态码对应的原因短语
+ */
+str::StringView reason_phrase(u16 status);
+
+/**
+ * @class Response
+ * @brief 处理函数填写的响应
+ * @details 首部拷贝进内部缓冲区；body(StringView) 不拷贝，视图需在本批响应写出前有效
+ *          （静态数据、请求中的切片都满足），否则使用接管所有权的 body(String)。
+ */
+class Response {
+public:
+    Response& status(u16 code) noexcept {
+        status_ = code;
+        return *this;
+    }
+
+    [[nodiscard]] u16 status() const noexcept {
+        return status_;
+    }
+
+    /**
+     * @brief 追加首部；Content-Length 与 Connection 由服务端生成
+     */
+    Response& header(str::StringView name, str::StringView value);
+
+    Response& content_type(const str::StringView value) {
+        return header(str::StringView("Content-Type"), value);
+    }
+
+    Response& body(str::StringView data) noexcept;
+
+    Response& body(str::String<> data);
+
+    [[nodiscard]] str::StringView body() const noexcept {
+        return body_;
+    }
+
+    /**
+     * @brief 复位以便复用，保留已分配的容量
+     */
+    void clear() noexcept;
+
+private:
+    friend class ResponseWriter;
+
+    u16 status_{200};
+    util::Vec<char> headers_; // [0, headers_len_) 为已写入的首部，其余为预留容量
+    usize headers_len_{0};
+    str::StringView body_;
+    Option<str::String<>> owned_ = Option<str::String<>>::None();
+};
+
+/**
+ * @class ResponseWriter
+ * @brief 把一批响应序列化为分段，供一次聚集写出
+ * @details 状态行与首部写入共享的头部缓冲区；较小的响应体一并拷贝，较大的作为独立分段引用，不拷贝。
+ *          流水线请求的多个响应合并为一次 write_vectored。
+ */
+class ResponseWriter {
+public:
+    /**
+     * @brief 小于该值的响应体直接拷贝到头部缓冲区，省去一个分段
+     */
+    static constexpr usize COPY_THRESHOLD = 1024;
+
+    /**
+     * @brief 追加一个响应，接管其拥有的响应体
+     * @param head_only HEAD 请求只写首部
+     */
+    void append(Response& res, bool keep_alive, u8 minor_version, bool head_only);
+
+    [[nodiscard]] bool is_empty() const noexcept {
+        return chunks_.is_empty();
+    }
+
+    /**
+     * @brief 生成分段，在下一次 append/clear 之前有效
+     */
+    util::Vec<plat::IoSlice>& slices();
+
+    void clear() noexcept;
+
+private:
+    struct Chunk {
+        const char* ext{nullptr}; // 为空时表示 buf_ 中的 [offset, offset + size)
+        usize offset{0};
+        usize size{0};
+    };
+
+    void put(const char* data, usize size);
+
+    void put(str::StringView data) {
+        put(reinterpret_cast<const char*>(data.as_bytes()), data.len());
+    }
+
+private:
+    util::Vec<char> buf_; // [0, len_) 为已序列化的数据，其余为预留容量
+    usize len_{0};
+    util::Vec<Chunk> chunks_;
+    util::Vec<str::String<>> owned_;
+    util::Vec<plat::IoSlice> slices_;
+};
+
+/**
+ * @class Router
+ * @brief 按方法与路径分发请求
+ * @details 模式为精确路径，或以 /\* 结尾表示前缀匹配（如 /static/\*）；按注册顺序匹配第一个。
+ *          路径无匹配返回 404，路径匹配但方法不符返回 405；HEAD 请求回退到 GET 路由。
+ * @note 分片监听下同一个 Router 在多个线程上被调用，处理函数需线程安全
+ */
+class Router {
+public:
+    using Handler = std::function<void(const Request&, Response&)>;
+
+    Router& route(Method method, str::StringView pattern, Handler handler);
+
+    Router& get(const str::StringView pattern, Handler handler) {
+        return route(Method::Get, pattern, std::move(handler));
+    }
+
+    Router& post(const str::StringView pattern, Handler handler) {
+        return route(Method::Post, pattern, std::move(handler));
+    }
+
+    Router& put(const str::StringView pattern, Handler handler) {
+        return route(Method::Put, pattern, std::move(handler));
+    }
+
+    Router& del(const str::StringView pattern, Handler handler) {
+        return route(Method::Delete, pattern, std::move(handler));
+    }
+
+    /**
+     * @brief 调用匹配的处理函数；处理函数抛出的异常转为 500
+     */
+    void dispatch(const Request& req, Response& res) const;
+
+private:
+    struct Route {
+        Method method;
+        str::String<> pattern; // 前缀匹配时不含结尾的 *
+        bool prefix;
+        Handler handler;
+    };
+
+    const Route* find(Method method, str::StringView path, bool& path_matched) const;
+
+private:
+    util::Vec<Route> routes_;
+};
+
+} // namespace my::net::http
+
+#endif // NET_HTTP_HPP
@@ -0,0 +1,72 @@
+/**
+ * @brief 基于事件循环的 HTTP/1.1 服务端，支持长连接与流水线
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_HTTP_SERVER_HPP
+#define NET_HTTP_SERVER_HPP
+
+#include "async_tcp.hpp"
+#include "http.hpp"
+
+#include <atomic>
+
+namespace my::net::http {
+
+struct ServerConfig {
+    usize read_buffer{16 * 1024};                          // 初始接收缓冲区，也是请求头部的上限
+    usize max_body{RequestParser::DEFAULT_MAX_BODY};       // 请求体上限，超过返回 413
+    u64 idle_timeout_ms{30'000};                           // 连接空闲超时，0 表示不限
+};
+
+/**
+ * @class HttpServer
+ * @brief 在事件循环上服务 HTTP/1.1 连接
+ * @details 每个连接一个协程：读入数据后解析缓冲区中全部完整请求，依次路由并把响应追加到同一个
+ *          ResponseWriter，再以一次聚集写出整批响应，流水线请求因此合并为一次系统调用。
+ *          请求视图直接指向接收缓冲区，写出完成前缓冲区不会被搬移。
+ *          serve_connection 可直接作为 ShardedTcpListener 的处理函数，在多个分片线程上运行。
+ */
+class HttpServer : public NoCopyMove {
+public:
+    explicit HttpServer(const Router& router, ServerConfig config = {}) :
+            router_(&router), config_(config) {}
+
+    /**
+     * @brief 在 listener 所在的事件循环上接受并服务连接，直到监听关闭
+     */
+    coro::Task<> serve(EventLoop& event_loop, AsyncTcpListener& listener);
+
+    /**
+     * @brief 服务一个连接，直到对端关闭、请求要求关闭、出错或空闲超时
+     */
+    coro::Task<> serve_connection(std::unique_ptr<AsyncTcpStream> stream);
+
+    /**
+     * @brief 正在服务的连接数
+     */
+    [[nodiscard]] usize active_connections() const noexcept {
+        return active_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 已处理的请求数
+     */
+    [[nodiscard]] u64 requests_served() const noexcept {
+        return served_.load(std::memory_order_relaxed);
+    }
+
+private:
+    coro::Task<> run_connection(AsyncTcpStream& stream);
+
+private:
+    const Router* router_;
+    ServerConfig config_;
+    std::atomic<usize> active_{0};
+    std::atomic<u64> served_{0};
+};
+
+} // namespace my::net::http
+
+#endif // NET_HTTP_SERVER_HPP
@@ -20,7 +20,22 @@ enum class IpAddrKind : u8 {
 
 class Ipv4Addr {
 public:
+    /**
+     * @exception Exception 若不是合法的点分十进制地址，则抛出 argument_exception
+     */
     static Ipv4Addr from_str(str::StringView s);
+
+    /**
+     * @brief 严格解析点分十进制地址，供批量日志导入等热路径使用
+     * @details 逐字节用算术与条件传送累积，不按字符类别分支；拒绝空段、超过 255 的段与前导零
+     * @return 非法输入返回 None，不抛异常
+     */
+    static Option<Ipv4Addr> parse(str::StringView s) noexcept;
+
+    static constexpr Ipv4Addr from_u32(const u32 bits) {
+        return Ipv4Addr(static_cast<u8>(bits >> 24), static_cast<u8>(bits >> 16), static_cast<u8>(bits >> 8), static_cast<u8>(bits));
+    }
+
     static Ipv4Addr any();
     static Ipv4Addr loopback();
     static Ipv4Addr broadcast();
@@ -0,0 +1,111 @@
+/**
+ * @brief 基于分帧的多路复用 RPC
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_RPC_HPP
+#define NET_RPC_HPP
+
+#include "async_tcp.hpp"
+#include "frame.hpp"
+
+#include <atomic>
+
+namespace my::net::rpc {
+
+/**
+ * @brief 帧负载的第一个字节
+ * @details 请求：kind, varint 请求 ID, varint 方法 ID, 参数
+ *          响应：kind, varint 请求 ID, 结果（Error 时为错误信息）
+ */
+enum class FrameKind : u8 {
+    Request = 0,
+    Response = 1,
+    Error = 2,
+};
+
+/**
+ * @class RpcServer
+ * @brief 按方法 ID 分发请求
+ * @details 每个连接一个协程：读入数据后处理全部完整的请求帧，响应合并为一次聚集写出。
+ *          处理函数抛出的异常以 Error 帧返回给调用方。serve_connection 可作为 ShardedTcpListener 的处理函数。
+ * @note 分片监听下同一个 RpcServer 在多个线程上被调用，处理函数需线程安全
+ */
+class RpcServer : public NoCopyMove {
+public:
+    using Handler = std::function<str::String<>(str::StringView)>;
+
+    /**
+     * @brief 注册方法，方法 ID 宜取小整数，按 ID 直接索引
+     */
+    RpcServer& method(u32 method_id, Handler handler);
+
+    coro::Task<> serve(EventLoop& event_loop, AsyncTcpListener& listener);
+
+    /**
+     * @brief 服务一个连接，直到对端关闭或出错
+     */
+    coro::Task<> serve_connection(std::unique_ptr<AsyncTcpStream> stream);
+
+    [[nodiscard]] usize active_connections() const noexcept {
+        return active_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] u64 calls_served() const noexcept {
+        return served_.load(std::memory_order_relaxed);
+    }
+
+private:
+    coro::Task<> run_connection(AsyncTcpStream& stream);
+
+private:
+    util::Vec<Handler> methods_;
+    std::atomic<usize> active_{0};
+    std::atomic<u64> served_{0};
+};
+
+/**
+ * @class RpcClient
+ * @brief 在一个连接上多路复用任意多个并发调用
+ * @details 每个调用分配一个请求 ID（槽位下标 + 代数，与 EventLoop 定时器相同），响应按 ID 匹配，
+ *          可乱序返回。同一轮事件循环中发起的调用由一次 post 的刷新任务合并为一次聚集写出；
+ *          写出期间新发起的调用在本次写完后接着写出。
+ *          连接状态由读协程与刷新协程共享持有，RpcClient 先于它们销毁是安全的。
+ * @note 只能在所属事件循环的线程上使用
+ */
+class RpcClient : public NoCopyMove {
+public:
+    static std::unique_ptr<RpcClient> connect(EventLoop& event_loop, str::StringView ip, u16 port);
+
+    RpcClient(EventLoop& event_loop, std::unique_ptr<AsyncTcpStream> stream);
+
+    ~RpcClient();
+
+    /**
+     * @brief 调用远端方法
+     * @param request 参数，需在调用完成前保持有效
+     * @exception Exception 远端处理函数失败时抛出 runtime_exception（信息为远端错误）；
+     *            连接断开时抛出 network_exception
+     */
+    coro::Task<str::String<>> call(u32 method_id, str::StringView request);
+
+    /**
+     * @brief 已发起但尚未完成的调用数
+     */
+    [[nodiscard]] usize in_flight() const noexcept;
+
+    /**
+     * @brief 关闭连接，未完成的调用抛出 network_exception
+     */
+    void close();
+
+private:
+    struct Connection;
+
+    std::shared_ptr<Connection> conn_;
+};
+
+} // namespace my::net::rpc
+
+#endif // NET_RPC_HPP
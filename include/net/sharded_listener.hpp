@@ -0,0 +1,151 @@
+/**
+ * @brief 可配置的监听套接字构建器与 SO_REUSEPORT 分片监听
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#ifndef NET_SHARDED_LISTENER_HPP
+#define NET_SHARDED_LISTENER_HPP
+
+#include "async_tcp.hpp"
+#include "tcp.hpp"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace my::net {
+
+class ShardedTcpListener;
+
+/**
+ * @class TcpListenerBuilder
+ * @brief 在 listen 之前设置监听套接字选项
+ * @details 未设置的选项保持系统默认值。TCP_NODELAY 与缓冲区大小由 accept 得到的连接继承。
+ */
+class TcpListenerBuilder {
+public:
+    /**
+     * @param port 0 表示由系统分配；分片监听时所有分片共用第一个分片分配到的端口
+     */
+    TcpListenerBuilder(str::StringView ip, u16 port);
+
+    /**
+     * @brief 全连接队列长度，默认 1024
+     */
+    TcpListenerBuilder& backlog(i32 n);
+
+    TcpListenerBuilder& nodelay(bool enable);
+
+    /**
+     * @brief 握手完成后最多等待 seconds 秒的首个数据包才交给 accept，0 表示关闭
+     * @note 仅 Linux 支持，其他平台忽略
+     */
+    TcpListenerBuilder& defer_accept(u32 seconds);
+
+    TcpListenerBuilder& recv_buffer(i32 bytes);
+
+    TcpListenerBuilder& send_buffer(i32 bytes);
+
+    /**
+     * @brief 分片数，默认为硬件线程数
+     */
+    TcpListenerBuilder& shards(usize n);
+
+    /**
+     * @brief 构建单个阻塞监听套接字，忽略分片数
+     */
+    [[nodiscard]] TcpListener build() const;
+
+    /**
+     * @brief 构建分片监听：每个分片一个 SO_REUSEPORT 套接字
+     * @note 平台不支持 SO_REUSEPORT 时退化为单个分片
+     */
+    [[nodiscard]] std::unique_ptr<ShardedTcpListener> build_sharded() const;
+
+private:
+    /**
+     * @brief 创建、设置选项、绑定并开始监听
+     */
+    plat::net::SocketHandle* open(u16 port, bool reuse_port, bool* reuse_port_applied) const;
+
+private:
+    str::String<> ip_;
+    u16 port_;
+    i32 backlog_{1024};
+    bool nodelay_{false};
+    u32 defer_accept_{0};
+    i32 recv_buffer_{0};
+    i32 send_buffer_{0};
+    usize shards_;
+};
+
+/**
+ * @class ShardedTcpListener
+ * @brief N 个绑定同一端口的监听套接字，各自运行在独立线程的事件循环上
+ * @details 内核按连接四元组哈希把新连接分给某个分片的接受队列，accept 不再在一个线程上串行；
+ *          连接在接受它的分片线程上处理，分片之间不共享状态。
+ */
+class ShardedTcpListener : public NoCopyMove {
+public:
+    /**
+     * @brief 连接处理函数，在接受连接的分片事件循环上作为协程运行
+     */
+    using Handler = std::function<coro::Task<>(std::unique_ptr<AsyncTcpStream>)>;
+
+    ~ShardedTcpListener();
+
+    [[nodiscard]] usize num_shards() const noexcept {
+        return shards_.len();
+    }
+
+    [[nodiscard]] u16 local_port() const noexcept {
+        return local_port_;
+    }
+
+    /**
+     * @brief 为每个分片启动线程并开始接受连接
+     * @exception Exception 若已启动，则抛出 state_exception
+     */
+    void start(Handler handler);
+
+    /**
+     * @brief 关闭全部监听套接字并等待分片线程退出
+     * @details 仍挂起在连接上的处理协程不会再被恢复，调用前应先让连接结束
+     * @exception 重新抛出分片线程中的第一个异常
+     */
+    void stop();
+
+    /**
+     * @brief 第 shard 个分片已接受的连接数
+     */
+    [[nodiscard]] u64 accepted(usize shard) const;
+
+    [[nodiscard]] u64 total_accepted() const;
+
+private:
+    friend class TcpListenerBuilder;
+
+    struct Shard {
+        EventLoop event_loop;
+        std::unique_ptr<plat::net::SocketHandle, void (*)(plat::net::SocketHandle*)> socket{nullptr, plat::net::close};
+        std::thread thread;
+        std::atomic<u64> accepted{0};
+        std::exception_ptr error;
+    };
+
+    explicit ShardedTcpListener(u16 port);
+
+    static coro::Task<> accept_loop(AsyncTcpListener& listener, Shard& shard, Handler handler);
+
+    static void run_shard(Shard& shard, const Handler& handler);
+
+private:
+    util::Vec<std::unique_ptr<Shard>> shards_;
+    u16 local_port_;
+    bool started_{false};
+};
+
+} // namespace my::net
+
+#endif // NET_SHARDED_LISTENER_HPP
@@ -7,6 +7,7 @@
 #ifndef NET_TCP_HPP
 #define NET_TCP_HPP
 
+#include "file.hpp"
 #include "net.hpp"
 #include "vec.hpp"
 #include "option.hpp"
@@ -23,6 +24,11 @@ public:
 
     TcpListener(str::StringView ip, u16 port);
 
+    /**
+     * @brief 接管已在监听的套接字，见 TcpListenerBuilder
+     */
+    explicit TcpListener(plat::net::SocketHandle* h);
+
     [[nodiscard]] str::String<> local_ip() const;
     [[nodiscard]] u16 local_port() const;
 
@@ -52,12 +58,36 @@ public:
     usize write(str::StringView data);
     str::String<> read(usize max_size = 4096);
 
+    /**
+     * @brief 读取到调用方缓冲区，不分配内存
+     * @return 读取的字节数，0 表示对端关闭
+     */
+    usize read_into(char* buf, usize size);
+
+    /**
+     * @brief 一次系统调用发送多段数据
+     * @return 写入的总字节数，可能少于各段之和
+     */
+    usize write_vectored(const plat::IoSlice* slices, usize n);
+
+    /**
+     * @brief 把文件 [offset, offset + len) 的内容发送到连接，数据由内核直接从页缓存发出，不复制到用户态
+     * @note 先刷新 file 的用户态缓冲区；不改变 file 的读写位置（Windows 除外）
+     * @return 发送的字节数，文件在 offset + len 之前结束时少于 len
+     */
+    usize send_file(fs::File& file, u64 offset, usize len);
+
     void set_read_timeout(u32 timeout_ms);
     void set_write_timeout(u32 timeout_ms);
 
     void close();
     bool is_open() const;
 
+    /**
+     * @brief 不阻塞地检查连接是否仍可复用：对端未关闭且没有残留未读数据
+     */
+    [[nodiscard]] bool is_alive() const;
+
 private:
     std::unique_ptr<plat::net::SocketHandle, void (*)(plat::net::SocketHandle*)> handle_;
     str::String<> peer_ip_;
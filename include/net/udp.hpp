@@ -11,6 +11,8 @@
 #include "option.hpp"
 #include "memory"
 
+#include <span>
+
 namespace my::net {
 
 class UdpSocket {
@@ -33,6 +35,37 @@ public:
 
     RecvResult recv_from(usize max_size = 4096);
 
+    /**
+     * @brief 批量接收到调用方缓冲区，每个 Datagram 需预先设置 data/capacity
+     * @details Linux 上单次 recvmmsg 最多收取 plat::net::MAX_BATCH 个；阻塞直到至少收到一个
+     * @return 收到的个数，前若干项的 len/addr 被填写
+     */
+    usize recv_batch(std::span<plat::net::Datagram> msgs);
+
+    /**
+     * @brief 批量发送，每个 Datagram 的 addr 为目的地址
+     * @details 超过 plat::net::MAX_BATCH 时分多次 sendmmsg，直到全部发出
+     * @return 发送的个数
+     */
+    usize send_batch(std::span<const plat::net::Datagram> msgs);
+
+    /**
+     * @brief 开启接收端 GRO，合并报文的分段大小见 Datagram::segment_size
+     * @return 不支持时返回 false
+     */
+    bool set_gro(bool enable);
+
+    /**
+     * @brief 设置发送端 GSO 分段大小，单次发送的大缓冲区由内核切分，0 表示关闭
+     * @return 不支持时返回 false
+     */
+    bool set_gso(u16 segment_size);
+
+    /**
+     * @brief 本端二进制地址
+     */
+    [[nodiscard]] plat::net::SockAddr local_addr() const;
+
     void set_read_timeout(u32 timeout_ms);
     void set_write_timeout(u32 timeout_ms);
 
@@ -1,6 +1,7 @@
 #ifndef PLAT_FS_HPP
 #define PLAT_FS_HPP
 
+#include "io_slice.hpp"
 #include "string.hpp"
 #include "vec.hpp"
 
@@ -15,6 +16,25 @@ struct DirEntry {
     bool is_dir{false};
 };
 
+/**
+ * @brief 目录项类型，取自目录项本身，不跟随符号链接
+ */
+enum class FileType : u8 {
+    Unknown,
+    File,
+    Dir,
+    Symlink,
+    Other, // 设备、管道、套接字等
+};
+
+/**
+ * @brief 用于 scan_dir 结果的目录项
+ */
+struct ScanEntry {
+    str::String<> name;
+    FileType type{FileType::Unknown};
+};
+
 /**
  * @brief 不透明文件句柄
  */
@@ -70,6 +90,14 @@ str::String<> join(str::StringView a, str::StringView b);
  */
 util::Vec<DirEntry> listdir(str::StringView path);
 
+/**
+ * @brief 读取目录项到 out（先清空），不含 "." 与 ".."
+ * @details 类型直接取自目录项（Linux 为 getdents64 的 d_type），只有文件系统不提供类型时才 lstat，
+ *          因此遍历大目录树时每个目录只需 open、若干次 getdents64 与 close。
+ * @note out 可在多次调用间复用以避免重新分配
+ */
+void scan_dir(str::StringView path, util::Vec<ScanEntry>& out);
+
 /**
  * @brief 打开文件，返回句柄（由实现分配）
  */
@@ -95,6 +123,18 @@ str::String<> read_all(str::StringView path);
  */
 usize write(FileHandle* file, str::StringView data, usize size);
 
+/**
+ * @brief 从当前位置读取最多 size 字节
+ * @return 读取的字节数，0 表示已到文件末尾
+ */
+usize read(FileHandle* file, char* buf, usize size);
+
+/**
+ * @brief 在当前位置聚集写出多段数据，先刷新 FILE* 缓冲以保持与 write 的先后顺序
+ * @return 写入的字节数
+ */
+usize write_vectored(FileHandle* file, const IoSlice* slices, usize n);
+
 /**
  * @brief 刷新写缓冲
  */
@@ -105,6 +145,187 @@ void flush(FileHandle* file);
  */
 void close(FileHandle* file);
 
+/**
+ * @brief 获取底层文件描述符（Windows 为 HANDLE），供 io_uring 等提交接口使用
+ */
+i64 native_handle(FileHandle* file);
+
+/**
+ * @brief 从指定偏移读取，不移动文件位置
+ * @note 绕过 FILE* 缓冲区，与 read_all/write 混用前需先 flush
+ * @return 读取的字节数，0 表示已到文件末尾
+ */
+usize read_at(FileHandle* file, char* buf, usize size, u64 offset);
+
+/**
+ * @brief 写入到指定偏移，不移动文件位置
+ * @return 写入的字节数
+ */
+usize write_at(FileHandle* file, const char* data, usize size, u64 offset);
+
+/**
+ * @brief 不透明原始文件句柄，直接持有文件描述符（Windows 为 HANDLE）
+ * @details 没有 FILE* 缓冲，也不使用共享的文件位置：所有读写都带偏移，
+ *          因此多个线程可以不加锁地并发读写同一句柄上互不重叠的区间。
+ */
+struct RawHandle;
+
+/**
+ * @brief 原始句柄的打开方式
+ */
+enum class RawMode {
+    Read,      // 只读打开已有文件
+    ReadWrite, // 读写打开已有文件
+    Create,    // 读写打开，不存在时创建，已存在时保留内容
+    Truncate,  // 读写打开，不存在时创建，已存在时截断
+};
+
+/**
+ * @brief 文件访问模式提示，对应 posix_fadvise
+ */
+enum class FileAdvice {
+    Normal,
+    Sequential, // 顺序访问：加大预读
+    Random,     // 随机访问：关闭预读
+    WillNeed,   // 即将访问：异步读入页缓存
+    DontNeed,   // 不再访问：丢弃页缓存中的干净页
+    NoReuse,    // 只访问一次
+};
+
+RawHandle* open_raw(str::StringView path, RawMode mode);
+
+/**
+ * @brief 关闭并释放句柄
+ */
+void close_raw(RawHandle* file);
+
+/**
+ * @brief 获取底层文件描述符（Windows 为 HANDLE）
+ */
+i64 native_handle(RawHandle* file);
+
+/**
+ * @brief 从指定偏移读取
+ * @return 读取的字节数，0 表示已到文件末尾
+ */
+usize pread(RawHandle* file, char* buf, usize size, u64 offset);
+
+/**
+ * @brief 写入到指定偏移
+ * @return 写入的字节数
+ */
+usize pwrite(RawHandle* file, const char* data, usize size, u64 offset);
+
+/**
+ * @brief 从指定偏移起依次读入多段缓冲区
+ * @return 读取的总字节数，可能少于各段之和
+ */
+usize preadv(RawHandle* file, const IoSliceMut* slices, usize n, u64 offset);
+
+/**
+ * @brief 从指定偏移起依次写出多段数据
+ * @return 写入的总字节数，可能少于各段之和
+ */
+usize pwritev(RawHandle* file, const IoSlice* slices, usize n, u64 offset);
+
+/**
+ * @brief 对 [offset, offset + len) 给出访问提示，len 为 0 表示到文件末尾
+ * @return 平台不支持该提示时返回 false
+ */
+bool fadvise(RawHandle* file, FileAdvice advice, u64 offset, u64 len);
+
+/**
+ * @brief 文件长度
+ */
+u64 file_len(RawHandle* file);
+
+/**
+ * @brief 截断或扩展文件到 len 字节
+ */
+void set_len(RawHandle* file, u64 len);
+
+/**
+ * @brief 为 [offset, offset + len) 预先分配磁盘块，文件长度随之扩展，新分配的区域读出为 0
+ * @details 预分配之后追加写入不再改变文件长度，fdatasync 无需同时落盘长度等元数据
+ * @return 平台或文件系统不支持时返回 false
+ */
+bool allocate(RawHandle* file, u64 offset, u64 len);
+
+/**
+ * @brief 把文件数据落盘
+ * @param metadata 为 false 时只保证数据与读取数据所需的元数据（fdatasync），否则同时落盘全部元数据（fsync）
+ */
+void sync(RawHandle* file, bool metadata);
+
+/**
+ * @brief 把目录项的变化（新建、删除、重命名文件）落盘
+ * @note Windows 没有对应操作，为空操作
+ */
+void sync_dir(str::StringView path);
+
+/**
+ * @brief 把 from 的内容复制到 to（不存在时创建，已存在时截断，权限位与 from 相同），数据尽量不经过用户态
+ * @details Linux 先尝试 FICLONE 让两个文件共享数据块（btrfs、xfs 等支持 reflink 的文件系统上为常数时间），
+ *          不支持时用 copy_file_range 在内核内复制，仍不支持（如旧内核跨文件系统）时退回 read/write；
+ *          Windows 使用 CopyFileA，由系统选择块克隆或服务端复制
+ * @return 复制的字节数
+ */
+u64 copy_file(str::StringView from, str::StringView to);
+
+/**
+ * @brief 不透明内存映射句柄
+ */
+struct MapHandle;
+
+/**
+ * @brief 映射方式，可写映射均为共享映射，修改会写回文件
+ */
+enum class MapMode {
+    Read,      // 只读映射已有文件
+    ReadWrite, // 读写映射已有文件
+    Create,    // 创建或截断文件到指定长度后读写映射
+};
+
+/**
+ * @brief 访问模式提示
+ */
+enum class MapAdvice {
+    Normal,
+    Sequential, // 顺序访问：加大预读，读过的页可尽早回收
+    Random,     // 随机访问：关闭预读
+    WillNeed,   // 即将访问：异步预读入页缓存
+    DontNeed,   // 不再访问：允许回收
+    HugePage,   // 尽量使用透明大页，减少 TLB 缺失
+};
+
+/**
+ * @brief 映射文件
+ * @param len 仅 Create 使用，为文件的新长度
+ * @note 长度为 0 的文件不建立映射，map_data 返回 nullptr
+ */
+MapHandle* map_file(str::StringView path, MapMode mode, u64 len = 0);
+
+u8* map_data(MapHandle* map);
+
+usize map_len(MapHandle* map);
+
+/**
+ * @brief 对 [offset, offset + len) 给出访问提示，范围会扩展到页边界
+ * @return 平台或文件系统不支持该提示时返回 false
+ */
+bool map_advise(MapHandle* map, MapAdvice advice, usize offset, usize len);
+
+/**
+ * @brief 把 [offset, offset + len) 中的修改写回文件
+ * @param async 为 true 时只发起写回，不等待完成
+ */
+void map_sync(MapHandle* map, usize offset, usize len, bool async);
+
+/**
+ * @brief 解除映射并释放句柄
+ */
+void unmap(MapHandle* map);
+
 } // namespace my::plat::fs
 
 #endif // PLAT_FS_HPP
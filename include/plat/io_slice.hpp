@@ -0,0 +1,26 @@
+#ifndef PLAT_IO_SLICE_HPP
+#define PLAT_IO_SLICE_HPP
+
+#include "my_types.hpp"
+
+namespace my::plat {
+
+/**
+ * @brief 分散/聚集 I/O 的一段连续内存，对应 iovec / WSABUF
+ */
+struct IoSlice {
+    const char* data{nullptr};
+    usize size{0};
+};
+
+/**
+ * @brief 分散读的一段可写内存
+ */
+struct IoSliceMut {
+    char* data{nullptr};
+    usize size{0};
+};
+
+} // namespace my::plat
+
+#endif // PLAT_IO_SLICE_HPP
@@ -2,6 +2,8 @@
 #define PLAT_NET_HPP
 
 #include "string.hpp"
+#include "option.hpp"
+#include "io_slice.hpp"
 
 namespace my::plat::net {
 
@@ -15,6 +17,18 @@ enum class SocketType : u8 {
     Datagram
 };
 
+/**
+ * @brief 可移植的整型套接字选项，由 set_socket_option 翻译为平台常量
+ */
+enum class SocketOption : u8 {
+    ReuseAddr,   // SO_REUSEADDR
+    ReusePort,   // SO_REUSEPORT：多个套接字绑定同一端口，由内核按四元组哈希分摊新连接
+    NoDelay,     // TCP_NODELAY，accept 得到的连接继承监听套接字的设置
+    DeferAccept, // TCP_DEFER_ACCEPT（秒）：握手完成且有数据到达后才唤醒 accept
+    RecvBuffer,  // SO_RCVBUF（字节）
+    SendBuffer,  // SO_SNDBUF（字节）
+};
+
 /**
  * @brief 不透明Socket句柄
  */
@@ -96,6 +110,71 @@ void set_timeout_ms(SocketHandle* socket, u32 timeout_ms, bool receive);
  */
 void set_option(SocketHandle* socket, i32 level, i32 optname, const void* optval, u32 optlen);
 
+/**
+ * @brief 设置整型套接字选项
+ * @return 当前平台没有该选项时返回 false
+ * @exception Exception 若设置失败，则抛出 system_exception
+ */
+bool set_socket_option(SocketHandle* socket, SocketOption option, i32 value);
+
+/**
+ * @brief 阻塞接收到调用方缓冲区，不分配内存
+ * @return 读取的字节数，0 表示对端关闭
+ */
+usize recv_into(SocketHandle* socket, char* buf, usize size);
+
+/**
+ * @brief 聚集发送多段数据，一次系统调用
+ * @return 写入的总字节数，可能少于各段之和
+ */
+usize send_vectored(SocketHandle* socket, const IoSlice* slices, usize n);
+
+/**
+ * @brief 把文件 [offset, offset + len) 的内容直接从内核发送到套接字，数据不经过用户态（Linux sendfile，Windows TransmitFile）
+ * @param file 文件的底层句柄，见 plat::fs::native_handle
+ * @return 发送的字节数，可能少于 len；0 表示 offset 已到文件末尾
+ */
+usize send_file(SocketHandle* socket, i64 file, u64 offset, usize len);
+
+/**
+ * @brief 设置非阻塞模式
+ */
+void set_nonblocking(SocketHandle* socket, bool enable);
+
+/**
+ * @brief 获取底层句柄（Linux 为 fd，Windows 为 SOCKET），供事件多路复用器注册
+ */
+i64 native_handle(SocketHandle* socket);
+
+/**
+ * @brief 接管底层句柄（如 io_uring accept 返回的 fd），返回的 SocketHandle 负责关闭它
+ */
+SocketHandle* from_native_handle(i64 native);
+
+/**
+ * @brief 非阻塞接收到调用方缓冲区
+ * @return 读取的字节数，0 表示对端关闭；暂无数据时返回 None
+ */
+Option<usize> try_recv(SocketHandle* socket, char* buf, usize size);
+
+/**
+ * @brief 非阻塞发送
+ * @return 写入的字节数；发送缓冲区已满时返回 None
+ */
+Option<usize> try_send(SocketHandle* socket, const char* data, usize size);
+
+/**
+ * @brief 非阻塞聚集发送
+ * @return 写入的总字节数；发送缓冲区已满时返回 None
+ */
+Option<usize> try_send_vectored(SocketHandle* socket, const IoSlice* slices, usize n);
+
+/**
+ * @brief 非阻塞接受连接
+ * @return 新连接句柄；暂无连接时返回 nullptr
+ */
+SocketHandle* try_accept(SocketHandle* socket);
+
 /**
  * @brief UDP发送到指定地址
  */
@@ -112,6 +191,71 @@ struct UdpRecvResult {
 
 UdpRecvResult recv_from(SocketHandle* socket, usize size, i32 flags);
 
+/**
+ * @brief 紧凑的二进制套接字地址，收发路径上不做字符串格式化
+ */
+struct SockAddr {
+    u8 ip[16]{}; // 网络字节序，IPv4 只用前 4 字节
+    u16 port{0};
+    bool v6{false};
+
+    bool operator==(const SockAddr&) const = default;
+};
+
+/**
+ * @brief 解析一次文本地址，供批量发送复用
+ */
+SockAddr make_sock_addr(str::StringView ip, u16 port);
+
+/**
+ * @brief 批量收发中的单个数据报，数据存放在调用方缓冲区
+ */
+struct Datagram {
+    char* data{nullptr};
+    usize capacity{0};    // 接收缓冲区大小
+    usize len{0};         // 收到的字节数 / 待发送的字节数
+    SockAddr addr;        // 接收时为来源，发送时为目的
+    u16 segment_size{0};  // 开启 GRO 时合并报文的分段大小，0 表示未合并
+    bool truncated{false};
+};
+
+/**
+ * @brief 单次批量收发的最大数据报数
+ */
+inline constexpr usize MAX_BATCH = 64;
+
+/**
+ * @brief 一次系统调用接收多个数据报（Linux 为 recvmmsg）
+ * @details 阻塞直到至少收到一个，之后只取已到达的，不再等待
+ * @return 收到的个数，最多 min(n, MAX_BATCH)；非阻塞套接字无数据时返回 0
+ */
+usize recv_batch(SocketHandle* socket, Datagram* msgs, usize n);
+
+/**
+ * @brief 一次系统调用发送多个数据报（Linux 为 sendmmsg）
+ * @return 已发送的个数，可能少于 n
+ */
+usize send_batch(SocketHandle* socket, const Datagram* msgs, usize n);
+
+/**
+ * @brief 开关 UDP GRO：内核把同一流的多个数据报合并为一次接收
+ * @return 平台/内核不支持时返回 false
+ */
+bool set_udp_gro(SocketHandle* socket, bool enable);
+
+/**
+ * @brief 设置 UDP GSO 分段大小：一次发送的大缓冲区由内核切分为多个数据报，0 表示关闭
+ * @return 平台/内核不支持时返回 false
+ */
+bool set_udp_segment(SocketHandle* socket, u16 segment_size);
+
+/**
+ * @brief 不阻塞地探测空闲连接是否仍可复用
+ * @details 以 MSG_PEEK 窥探一个字节：对端已关闭、套接字有待处理错误，或残留未读数据
+ *          （说明协议状态未知）时均返回 false，不消耗数据
+ */
+bool is_alive(SocketHandle* socket);
+
 } // namespace my::plat::net
 
 #endif // PLAT_NET_HPP
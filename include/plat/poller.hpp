@@ -0,0 +1,59 @@
+#ifndef PLAT_POLLER_HPP
+#define PLAT_POLLER_HPP
+
+#include "net.hpp"
+
+namespace my::plat::poller {
+
+/**
+ * @brief 不透明的事件多路复用器句柄（Linux 上为 epoll 实例）
+ */
+struct PollerHandle;
+
+/**
+ * @brief 就绪事件
+ * @details token 为注册时传入的用户数据；token 为 0 保留给 wake
+ */
+struct PollEvent {
+    u64 token{0};
+    bool readable{false};
+    bool writable{false};
+    bool hangup{false}; // 对端关闭或出错
+};
+
+/**
+ * @brief 创建多路复用器
+ */
+PollerHandle* create();
+
+/**
+ * @brief 关闭多路复用器
+ */
+void close(PollerHandle* poller);
+
+/**
+ * @brief 以边缘触发方式同时关注读写就绪
+ * @note 边缘触发下每次就绪通知后需要读/写到返回 None（EAGAIN）为止，否则不会再收到通知
+ */
+void add(PollerHandle* poller, net::SocketHandle* socket, u64 token);
+
+/**
+ * @brief 取消关注
+ */
+void remove(PollerHandle* poller, net::SocketHandle* socket);
+
+/**
+ * @brief 等待就绪事件
+ * @param timeout_ms 超时毫秒数，-1 表示无限等待
+ * @return 写入 events 的事件个数
+ */
+usize wait(PollerHandle* poller, PollEvent* events, usize max_events, i32 timeout_ms);
+
+/**
+ * @brief 从其他线程唤醒阻塞在 wait 上的线程，产生一个 token 为 0 的事件
+ */
+void wake(PollerHandle* poller);
+
+} // namespace my::plat::poller
+
+#endif // PLAT_POLLER_HPP
@@ -3,6 +3,8 @@
 
 #include "my_types.hpp"
 
+#include <string>
+
 namespace my::plat::process {
 
 /**
@@ -15,6 +17,23 @@ u32 pid();
  */
 void set_console_utf8();
 
+/**
+ * @brief 抓取当前线程的调用栈返回地址，最内层在前
+ * @param skip 跳过的最内层帧数（不含本函数自身）
+ * @return 写入 frames 的帧数
+ */
+usize capture_stack(void** frames, usize max_frames, usize skip = 0);
+
+/**
+ * @brief 把代码地址解析为可读的符号名（已反修饰），无法解析时为 "模块+0x偏移" 或十六进制地址
+ */
+std::string symbolize(void* addr);
+
+/**
+ * @brief 当前进程的内存映射表（/proc/self/maps 格式），平台不支持时为空
+ */
+std::string memory_maps();
+
 } // namespace my::plat::process
 
 #endif // PLAT_PROCESS_HPP
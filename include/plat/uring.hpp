@@ -0,0 +1,90 @@
+#ifndef PLAT_URING_HPP
+#define PLAT_URING_HPP
+
+#include "fs.hpp"
+#include "net.hpp"
+
+namespace my::plat::uring {
+
+/**
+ * @brief 不透明的 io_uring 实例句柄
+ */
+struct RingHandle;
+
+/**
+ * @brief 完成事件
+ * @details result 为字节数或新连接的 fd；负数为 -errno
+ */
+struct Cqe {
+    u64 user_data{0};
+    i32 result{0};
+};
+
+/**
+ * @brief 待注册的固定缓冲区
+ */
+struct FixedBuffer {
+    char* data{nullptr};
+    usize size{0};
+};
+
+/**
+ * @brief 当前内核是否可用 io_uring（含 accept/recv/send/read/write 操作码）
+ * @details 首次调用时探测并缓存结果；环境变量 RICKY_IO_URING=0 可强制禁用
+ */
+bool is_supported();
+
+/**
+ * @brief 创建 io_uring 实例
+ * @param entries 提交队列深度，内核会向上取整到 2 的幂
+ */
+RingHandle* create(u32 entries);
+
+/**
+ * @brief 销毁实例，未完成的操作由内核取消
+ */
+void close(RingHandle* ring);
+
+/**
+ * @brief 注册固定缓冲区，之后可用 *_fixed 操作免去每次 I/O 的页固定开销
+ * @note 只能注册一次；缓冲区需活得比 ring 更久
+ */
+void register_buffers(RingHandle* ring, const FixedBuffer* buffers, usize n);
+
+/**
+ * @brief 以下 prep_* 在提交队列中准备一个操作，不产生系统调用
+ * @return 提交队列已满时返回 false，需先 submit
+ */
+bool prep_accept(RingHandle* ring, net::SocketHandle* listener, u64 user_data);
+
+bool prep_recv(RingHandle* ring, net::SocketHandle* socket, char* buf, usize size, u64 user_data);
+
+bool prep_send(RingHandle* ring, net::SocketHandle* socket, const char* data, usize size, u64 user_data);
+
+bool prep_read(RingHandle* ring, fs::FileHandle* file, char* buf, usize size, u64 offset, u64 user_data);
+
+bool prep_write(RingHandle* ring, fs::FileHandle* file, const char* data, usize size, u64 offset, u64 user_data);
+
+/**
+ * @brief 固定缓冲区读写，buf 必须落在第 buf_index 个已注册缓冲区内
+ * @param offset 文件偏移；对套接字传 npos
+ */
+bool prep_read_fixed(RingHandle* ring, i64 native, char* buf, usize size, u64 offset, u32 buf_index, u64 user_data);
+
+bool prep_write_fixed(RingHandle* ring, i64 native, const char* data, usize size, u64 offset, u32 buf_index, u64 user_data);
+
+/**
+ * @brief 一次系统调用提交全部已准备的操作，并可等待至少 wait_nr 个完成
+ * @return 本次提交的操作数
+ */
+usize submit(RingHandle* ring, usize wait_nr);
+
+/**
+ * @brief 取出已完成的事件，不产生系统调用
+ * @return 写入 out 的个数
+ */
+usize reap(RingHandle* ring, Cqe* out, usize max);
+
+} // namespace my::plat::uring
+
+#endif // PLAT_URING_HPP
@@ -19,11 +19,11 @@ namespace my::util {
  * @tparam T 数组元素的类型
  */
 template <typename T, typename Alloc = mem::Allocator<T>>
-class Array : public Sequence<Array<T>, T> {
+class Array : public Sequence<Array<T, Alloc>, T, Alloc> {
 public:
     using value_t = T;
     using Self = Array<T, Alloc>;
-    using Super = Sequence<Array<value_t>, value_t>;
+    using Super = Sequence<Self, value_t, Alloc>;
 
     /**
      * @brief 构造一个指定大小的静态数组，并初始化所有元素
@@ -39,6 +39,16 @@ public:
         }
     }
 
+    /**
+     * @brief 构造一个指定大小、元素值初始化的静态数组，使用给定的分配器
+     */
+    Array(const usize size, const Alloc& alloc) :
+            alloc_(alloc), size_(size), arr_(alloc_.allocate(size_)) {
+        for (usize i = 0; i < size_; ++i) {
+            alloc_.construct(arr_ + i);
+        }
+    }
+
     /**
      * @brief 使用初始化列表构造静态数组
      * @param init_list 初始化列表，包含数组的初始元素
@@ -212,6 +222,13 @@ public:
         return res;
     }
 
+    /**
+     * @brief 获取数组使用的分配器
+     */
+    const Alloc& get_allocator() const noexcept {
+        return alloc_;
+    }
+
     /**
      * @brief 获取数组的字符串表示
      * @return 返回数组的 CSV 格式的字符串
@@ -74,7 +74,7 @@ public:
     }
 
     ~BTree() {
-        // TODO
+        destroy(root_);
     }
 
     /**
@@ -93,6 +93,18 @@ public:
 
     // TODO
 
+private:
+    void destroy(Node* node) {
+        if (node == nullptr) return;
+        if (!node->is_leaf) {
+            for (usize i = 0; i <= node->key_cnt; ++i) {
+                destroy(node->subs[i]);
+            }
+        }
+        alloc_.destroy(node);
+        alloc_.deallocate(node, 1);
+    }
+
 private:
     Alloc alloc_{}; // 内存分配器
     Comp comp_;     // 比较函数
@@ -17,11 +17,11 @@ namespace my::util {
  * @tparam Alloc 内存分配器类型，默认为Allocator<T>
  */
 template <typename T, typename Alloc = mem::Allocator<T>>
-class Buffer : public Sequence<Buffer<T>, T> {
+class Buffer : public Sequence<Buffer<T, Alloc>, T, Alloc> {
 public:
     using value_t = T;
     using Self = Buffer<T, Alloc>;
-    using Super = Sequence<Buffer<value_t>, value_t>;
+    using Super = Sequence<Self, value_t, Alloc>;
 
     using iterator = typename Super::iterator;
     using const_iterator = typename Super::const_iterator;
@@ -18,7 +18,7 @@ namespace my::util {
  * @brief 码点抽象
  */
 template <EncodingType Enc = EncodingType::UTF8, typename Alloc = mem::Allocator<char>>
-class CodePoint : public Object<CodePoint<Enc>> {
+class CodePoint : public Object<CodePoint<Enc, Alloc>> {
 public:
     using Self = CodePoint<Enc, Alloc>;
     using Super = Object<Self>;
@@ -290,6 +290,12 @@ public:
     explicit RobinHashBucket(usize size = 0) :
             robin_managers_(size) {}
 
+    /**
+     * @brief 使用给定的分配器构造
+     */
+    RobinHashBucket(usize size, const Alloc& alloc) :
+            robin_managers_(size, alloc) {}
+
     /**
      * @brief 拷贝构造函数
      * @param other 需要拷贝的哈希桶
@@ -341,12 +347,19 @@ public:
      * @return 返回克隆后的哈希桶指针
      */
     Self* clone() const override {
-        // return new Self(*this);
+        // 副本本身与其中的管理器数组都从本桶的分配器分配，有状态分配器（如 ArenaAllocator）不会换到别处
         using alloc_type = typename Alloc::template rebind<Self>::other;
-        static alloc_type alloc;
+        alloc_type alloc(robin_managers_.get_allocator());
         return alloc.create(*this);
     }
 
+    /**
+     * @brief 获取哈希桶使用的分配器
+     */
+    const Alloc& get_allocator() const noexcept {
+        return robin_managers_.get_allocator();
+    }
+
     /**
      * @brief 根据哈希值获取对应的管理器地址
      * @details 1. 找到相同的hash值, 返回该管理器地址
@@ -492,7 +505,7 @@ public:
     public:
         using Self = RobinHashBucketIterator<IsConst>;
 
-        using container_t = std::conditional_t<IsConst, const Array<manager_t>, Array<manager_t>>;
+        using container_t = std::conditional_t<IsConst, const Array<manager_t, Alloc>, Array<manager_t, Alloc>>;
         using iterator_category = std::forward_iterator_tag;
         using value_type = std::conditional_t<IsConst, const value_t, value_t>;
         using difference_type = std::ptrdiff_t;
@@ -42,6 +42,14 @@ public:
     HashMap(usize bucket_size = MIN_BUCKET_SIZE) :
             bucket_(bucket_size), keys_() {}
 
+    /**
+     * @brief 使用给定的分配器构造空哈希表，桶与键数组都由它（rebind 后）分配
+     * @param alloc 内存分配器
+     * @param bucket_size 桶的初始大小
+     */
+    explicit HashMap(const Alloc& alloc, usize bucket_size = MIN_BUCKET_SIZE) :
+            bucket_(bucket_size, alloc), keys_(alloc) {}
+
     /**
      * @brief 使用初始化列表构造哈希表
      * @param init_list 初始化列表，包含键值对
@@ -264,9 +264,9 @@ private:
     }
 
 private:
+    Alloc alloc_{};  // 先于 sentinel_ 初始化，构造函数用它创建哨兵节点
     Node* sentinel_; // 哨兵节点
     usize size_;
-    Alloc alloc_{};
 };
 
 template <typename T>
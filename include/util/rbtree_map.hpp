@@ -153,6 +153,15 @@ public:
         this->root_ = nil_;
     }
 
+    /**
+     * @brief 构造一棵空红黑树，节点由 alloc 分配
+     */
+    explicit RBTree(const Alloc& alloc, Comp comp = Comp{}) :
+            alloc_(alloc), comp_(comp), size_(0), nil_(nullptr) {
+        create_nil();
+        this->root_ = nil_;
+    }
+
     /**
      * @brief 通过初始化成员列表构造
      */
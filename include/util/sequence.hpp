@@ -13,10 +13,11 @@ namespace my::util {
 
 /**
  * @class Sequence
- * @brief 序列CRTP基类  TODO Alloc
+ * @brief 序列CRTP基类
  * @note 需要子类实现 len() 和 at()
  * @tparam D 实现类类型
  * @tparam T 元素类型
+ * @tparam Alloc 实现类使用的分配器，决定迭代器类型
  */
 template <typename D, typename T, typename Alloc = mem::Allocator<T>>
 class Sequence : public Object<Sequence<D, T, Alloc>> {
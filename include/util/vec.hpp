@@ -19,11 +19,11 @@ namespace my::util {
  * @tparam T 元素类型
  */
 template <typename T, typename Alloc = mem::Allocator<T>>
-class Vec : public Sequence<Vec<T>, T> {
+class Vec : public Sequence<Vec<T, Alloc>, T, Alloc> {
 public:
     using value_t = T;
     using Self = Vec<value_t, Alloc>;
-    using Super = Sequence<Vec<value_t>, value_t>;
+    using Super = Sequence<Self, value_t, Alloc>;
 
     /**
      * @brief 默认构造函数
@@ -548,8 +548,8 @@ auto opt(const Vec<std::any>& args, usize idx) -> T {
 template <typename>
 struct is_vec : std::false_type {};
 
-template <typename T>
-struct is_vec<Vec<T>> : std::true_type {};
+template <typename T, typename Alloc>
+struct is_vec<Vec<T, Alloc>> : std::true_type {};
 
 template <typename T>
 constexpr bool is_vec_v = is_vec<T>::value;
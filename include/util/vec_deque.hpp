@@ -7,9 +7,286 @@
 #ifndef VEC_DEQUE_HPP
 #define VEC_DEQUE_HPP
 
+#include "my_exception.hpp"
+#include "sequence.hpp"
+#include "option.hpp"
+
+#include <bit>
+
 namespace my::util {
 
-// TODO 实现类似rust的Deque
+/**
+ * @class VecDeque
+ * @brief 类似 rust 的 VecDeque，容量为 2 的幂，头尾插入删除均摊 O(1)
+ * @note 仅要求元素可移动构造，可存放只移动类型
+ * @tparam T 元素类型
+ * @tparam Alloc 内存分配器
+ */
+template <typename T, typename Alloc = mem::Allocator<T>>
+class VecDeque : public Sequence<VecDeque<T, Alloc>, T, Alloc> {
+public:
+    using value_t = T;
+    using Self = VecDeque<value_t, Alloc>;
+    using Super = Sequence<Self, value_t, Alloc>;
+
+    VecDeque(const Alloc& alloc = Alloc{}) :
+            alloc_(alloc) {}
+
+    /**
+     * @brief 预分配指定容量
+     */
+    explicit VecDeque(const usize capacity, const Alloc& alloc = Alloc{}) :
+            alloc_(alloc) {
+        reserve(capacity);
+    }
+
+    VecDeque(const Self& other) :
+            alloc_(other.alloc_) {
+        reserve(other.len_);
+        for (usize i = 0; i < other.len_; ++i) {
+            push_back(other.at(i));
+        }
+    }
+
+    VecDeque(Self&& other) noexcept :
+            alloc_(other.alloc_), data_(other.data_), capacity_(other.capacity_), head_(other.head_), len_(other.len_) {
+        other.data_ = nullptr;
+        other.capacity_ = other.head_ = other.len_ = 0;
+    }
+
+    Self& operator=(const Self& other) {
+        if (this == &other) return *this;
+
+        Self tmp(other);
+        swap(tmp);
+        return *this;
+    }
+
+    Self& operator=(Self&& other) noexcept {
+        if (this == &other) return *this;
+
+        release();
+        alloc_ = std::move(other.alloc_);
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        head_ = other.head_;
+        len_ = other.len_;
+        other.data_ = nullptr;
+        other.capacity_ = other.head_ = other.len_ = 0;
+        return *this;
+    }
+
+    ~VecDeque() {
+        release();
+    }
+
+    [[nodiscard]] usize len() const noexcept {
+        return len_;
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept {
+        return len_ == 0;
+    }
+
+    [[nodiscard]] usize capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief 按逻辑下标访问，0 为队首
+     * @exception Exception 若下标越界，则抛出 index_out_of_bounds_exception
+     */
+    value_t& at(const usize idx) {
+        if (idx >= len_) {
+            throw index_out_of_bounds_exception("Index {} out of bounds [0..{}].", idx, len_);
+        }
+        return data_[physical(idx)];
+    }
+
+    const value_t& at(const usize idx) const {
+        if (idx >= len_) {
+            throw index_out_of_bounds_exception("Index {} out of bounds [0..{}].", idx, len_);
+        }
+        return data_[physical(idx)];
+    }
+
+    /**
+     * @brief 队首元素
+     * @exception Exception 若队空，则抛出 runtime_exception
+     */
+    value_t& front() {
+        if (is_empty()) {
+            throw runtime_exception("VecDeque is empty.");
+        }
+        return data_[head_];
+    }
+
+    const value_t& front() const {
+        if (is_empty()) {
+            throw runtime_exception("VecDeque is empty.");
+        }
+        return data_[head_];
+    }
+
+    /**
+     * @brief 队尾元素
+     * @exception Exception 若队空，则抛出 runtime_exception
+     */
+    value_t& back() {
+        if (is_empty()) {
+            throw runtime_exception("VecDeque is empty.");
+        }
+        return data_[physical(len_ - 1)];
+    }
+
+    const value_t& back() const {
+        if (is_empty()) {
+            throw runtime_exception("VecDeque is empty.");
+        }
+        return data_[physical(len_ - 1)];
+    }
+
+    /**
+     * @brief 尾部原地构造
+     */
+    template <typename... Args>
+    value_t& push_back(Args&&... args) {
+        try_expand();
+        auto* slot = data_ + physical(len_);
+        alloc_.construct(slot, std::forward<Args>(args)...);
+        ++len_;
+        return *slot;
+    }
+
+    /**
+     * @brief 头部原地构造
+     */
+    template <typename... Args>
+    value_t& push_front(Args&&... args) {
+        try_expand();
+        const usize new_head = (head_ + capacity_ - 1) & (capacity_ - 1);
+        auto* slot = data_ + new_head;
+        alloc_.construct(slot, std::forward<Args>(args)...);
+        head_ = new_head;
+        ++len_;
+        return *slot;
+    }
+
+    /**
+     * @brief 弹出队首元素
+     * @return 队空时返回 None
+     */
+    Option<value_t> pop_front() {
+        if (is_empty()) {
+            return Option<value_t>::None();
+        }
+        auto* slot = data_ + head_;
+        auto res = Option<value_t>::Some(std::move(*slot));
+        alloc_.destroy(slot);
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --len_;
+        return res;
+    }
+
+    /**
+     * @brief 弹出队尾元素
+     * @return 队空时返回 None
+     */
+    Option<value_t> pop_back() {
+        if (is_empty()) {
+            return Option<value_t>::None();
+        }
+        auto* slot = data_ + physical(len_ - 1);
+        auto res = Option<value_t>::Some(std::move(*slot));
+        alloc_.destroy(slot);
+        --len_;
+        return res;
+    }
+
+    /**
+     * @brief 清空元素，保留容量
+     */
+    void clear() {
+        for (usize i = 0; i < len_; ++i) {
+            alloc_.destroy(data_ + physical(i));
+        }
+        head_ = len_ = 0;
+    }
+
+    /**
+     * @brief 预留至少能容纳 new_cap 个元素的空间
+     */
+    void reserve(const usize new_cap) {
+        if (new_cap <= capacity_) return;
+        relocate(std::bit_ceil(std::max(new_cap, MIN_CAPACITY)));
+    }
+
+    void swap(Self& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(len_, other.len_);
+    }
+
+    [[nodiscard]] CString to_string() const {
+        std::stringstream stream;
+        stream << '[';
+        for (usize i = 0; i < len_; ++i) {
+            if (i) stream << ',';
+            stream << at(i);
+        }
+        stream << ']';
+        return CString{stream.str()};
+    }
+
+private:
+    [[nodiscard]] usize physical(const usize idx) const noexcept {
+        return (head_ + idx) & (capacity_ - 1);
+    }
+
+    void try_expand() {
+        if (len_ == capacity_) {
+            relocate(capacity_ == 0 ? MIN_CAPACITY : capacity_ << 1);
+        }
+    }
+
+    /**
+     * @brief 迁移到新缓冲区，迁移后队首位于下标 0
+     */
+    void relocate(const usize new_cap) {
+        value_t* ptr = alloc_.allocate(new_cap);
+        for (usize i = 0; i < len_; ++i) {
+            auto* src = data_ + physical(i);
+            alloc_.construct(ptr + i, std::move(*src));
+            alloc_.destroy(src);
+        }
+        if (data_) {
+            alloc_.deallocate(data_, capacity_);
+        }
+        data_ = ptr;
+        capacity_ = new_cap;
+        head_ = 0;
+    }
+
+    void release() {
+        if (data_) {
+            clear();
+            alloc_.deallocate(data_, capacity_);
+        }
+        data_ = nullptr;
+        capacity_ = head_ = len_ = 0;
+    }
+
+private:
+    Alloc alloc_{};          // 内存分配器
+    value_t* data_{nullptr}; // 环形缓冲区
+    usize capacity_{0};      // 容量，始终为 0 或 2 的幂
+    usize head_{0};          // 队首物理下标
+    usize len_{0};           // 元素个数
+
+    static constexpr usize MIN_CAPACITY = 8;
+};
 
 } // namespace my::util
 
@@ -18,14 +18,17 @@ namespace my::util {
  * @tparam Alloc 内存分配器
  */
 template <typename T, typename Alloc = mem::Allocator<T>>
-class Stack : public Object<Stack<T>> {
+class Stack : public Object<Stack<T, Alloc>> {
 public:
     using value_t = T;
-    using Self = Stack<value_t>;
+    using Self = Stack<value_t, Alloc>;
 
     Stack() :
             data_() {}
 
+    explicit Stack(const Alloc& alloc) :
+            data_(alloc) {}
+
     usize size() const {
         return data_.len();
     }
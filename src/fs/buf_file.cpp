@@ -0,0 +1,46 @@
+#include "buf_file.hpp"
+
+namespace my::fs {
+
+BufReader::BufReader(const char* path, const usize capacity) :
+        file_(path, plat::fs::OpenMode::ReadBinary), buf_(capacity), reader_(file_, std::span<char>(buf_.data(), buf_.len())) {}
+
+BufReader::BufReader(const PathBuf& path, const usize capacity) :
+        file_(path, plat::fs::OpenMode::ReadBinary), buf_(capacity), reader_(file_, std::span<char>(buf_.data(), buf_.len())) {}
+
+Option<str::StringView> BufReader::read_line() {
+    auto line = reader_.read_until('\n');
+    if (line.is_none()) {
+        return line;
+    }
+    auto res = line.unwrap();
+    usize n = res.len();
+    if (n > 0 && res[n - 1] == '\n') {
+        --n;
+        if (n > 0 && res[n - 1] == '\r') {
+            --n;
+        }
+    }
+    return Option<str::StringView>::Some(res.slice(0, n));
+}
+
+BufWriter::BufWriter(const char* path, const usize capacity) :
+        BufWriter(path, plat::fs::OpenMode::WriteBinary, capacity) {}
+
+BufWriter::BufWriter(const PathBuf& path, const usize capacity) :
+        file_(path, plat::fs::OpenMode::WriteBinary), buf_(capacity), writer_(file_, std::span<char>(buf_.data(), buf_.len())) {}
+
+BufWriter::BufWriter(const char* path, const File::OpenMode mode, const usize capacity) :
+        file_(path, mode), buf_(capacity), writer_(file_, std::span<char>(buf_.data(), buf_.len())) {}
+
+void BufWriter::write_line(const str::StringView line) {
+    writer_.write(line);
+    writer_.write("\n", 1);
+}
+
+void BufWriter::flush() {
+    writer_.flush();
+    file_.flush();
+}
+
+} // namespace my::fs
@@ -79,6 +79,20 @@ usize File::write(const CString& data) {
     return write(data.data(), data.length());
 }
 
+usize File::read_into(char* buf, const usize size) {
+    if (handle_ == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    return plat::fs::read(handle_, buf, size);
+}
+
+usize File::write_vectored(const plat::IoSlice* slices, const usize n) {
+    if (handle_ == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    return plat::fs::write_vectored(handle_, slices, n);
+}
+
 void File::flush() {
     if (handle_ == nullptr) {
         throw null_pointer_exception("Invalid file handle");
@@ -86,4 +100,12 @@ void File::flush() {
     plat::fs::flush(handle_);
 }
 
+u64 copy(const char* from, const char* to) {
+    return plat::fs::copy_file(str::StringView(from ? from : ""), str::StringView(to ? to : ""));
+}
+
+u64 copy(const PathBuf& from, const PathBuf& to) {
+    return plat::fs::copy_file(from.as_string().as_str(), to.as_string().as_str());
+}
+
 } // namespace my::fs
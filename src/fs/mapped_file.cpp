@@ -0,0 +1,98 @@
+#include "mapped_file.hpp"
+
+namespace my::fs {
+
+MappedFile::MappedFile(const str::StringView path, const plat::fs::MapMode mode, const u64 len) {
+    handle_ = plat::fs::map_file(path, mode, len);
+    data_ = plat::fs::map_data(handle_);
+    len_ = plat::fs::map_len(handle_);
+    writable_ = mode != plat::fs::MapMode::Read;
+}
+
+MappedFile MappedFile::open(const char* path) {
+    return MappedFile(str::StringView(path ? path : ""), plat::fs::MapMode::Read, 0);
+}
+
+MappedFile MappedFile::open(const PathBuf& path) {
+    return MappedFile(path.as_string().as_str(), plat::fs::MapMode::Read, 0);
+}
+
+MappedFile MappedFile::open_rw(const char* path) {
+    return MappedFile(str::StringView(path ? path : ""), plat::fs::MapMode::ReadWrite, 0);
+}
+
+MappedFile MappedFile::open_rw(const PathBuf& path) {
+    return MappedFile(path.as_string().as_str(), plat::fs::MapMode::ReadWrite, 0);
+}
+
+MappedFile MappedFile::create(const char* path, const u64 len) {
+    return MappedFile(str::StringView(path ? path : ""), plat::fs::MapMode::Create, len);
+}
+
+MappedFile MappedFile::create(const PathBuf& path, const u64 len) {
+    return MappedFile(path.as_string().as_str(), plat::fs::MapMode::Create, len);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+        handle_(std::exchange(other.handle_, nullptr)),
+        data_(std::exchange(other.data_, nullptr)),
+        len_(std::exchange(other.len_, 0)),
+        writable_(std::exchange(other.writable_, false)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        handle_ = std::exchange(other.handle_, nullptr);
+        data_ = std::exchange(other.data_, nullptr);
+        len_ = std::exchange(other.len_, 0);
+        writable_ = std::exchange(other.writable_, false);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+std::span<u8> MappedFile::as_mut_bytes() {
+    if (!writable_) {
+        throw runtime_exception("Mapping is read-only");
+    }
+    return {data_, len_};
+}
+
+bool MappedFile::advise(const Advice advice, const usize offset, const usize len) {
+    check_open();
+    return plat::fs::map_advise(handle_, advice, offset, len);
+}
+
+void MappedFile::flush(const bool async) {
+    flush_range(0, len_, async);
+}
+
+void MappedFile::flush_range(const usize offset, const usize len, const bool async) {
+    check_open();
+    if (!writable_) {
+        return;
+    }
+    plat::fs::map_sync(handle_, offset, len, async);
+}
+
+void MappedFile::close() {
+    if (handle_ == nullptr) {
+        return;
+    }
+    plat::fs::unmap(handle_);
+    handle_ = nullptr;
+    data_ = nullptr;
+    len_ = 0;
+    writable_ = false;
+}
+
+void MappedFile::check_open() const {
+    if (handle_ == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+}
+
+} // namespace my::fs
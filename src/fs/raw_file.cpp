@@ -0,0 +1,133 @@
+#include "raw_file.hpp"
+
+namespace my::fs {
+
+RawFile::RawFile(const str::StringView path, const plat::fs::RawMode mode) {
+    handle_ = plat::fs::open_raw(path, mode);
+}
+
+RawFile RawFile::open(const char* path) {
+    return RawFile(str::StringView(path ? path : ""), plat::fs::RawMode::Read);
+}
+
+RawFile RawFile::open(const PathBuf& path) {
+    return RawFile(path.as_string().as_str(), plat::fs::RawMode::Read);
+}
+
+RawFile RawFile::open_rw(const char* path) {
+    return RawFile(str::StringView(path ? path : ""), plat::fs::RawMode::ReadWrite);
+}
+
+RawFile RawFile::open_rw(const PathBuf& path) {
+    return RawFile(path.as_string().as_str(), plat::fs::RawMode::ReadWrite);
+}
+
+RawFile RawFile::create(const char* path) {
+    return RawFile(str::StringView(path ? path : ""), plat::fs::RawMode::Create);
+}
+
+RawFile RawFile::create(const PathBuf& path) {
+    return RawFile(path.as_string().as_str(), plat::fs::RawMode::Create);
+}
+
+RawFile RawFile::truncate(const char* path) {
+    return RawFile(str::StringView(path ? path : ""), plat::fs::RawMode::Truncate);
+}
+
+RawFile RawFile::truncate(const PathBuf& path) {
+    return RawFile(path.as_string().as_str(), plat::fs::RawMode::Truncate);
+}
+
+RawFile::RawFile(RawFile&& other) noexcept :
+        handle_(std::exchange(other.handle_, nullptr)) {}
+
+RawFile& RawFile::operator=(RawFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+}
+
+RawFile::~RawFile() {
+    close();
+}
+
+void RawFile::close() {
+    if (handle_ == nullptr) {
+        return;
+    }
+    plat::fs::close_raw(handle_);
+    handle_ = nullptr;
+}
+
+usize RawFile::read_at(char* buf, const usize size, const u64 offset) const {
+    return plat::fs::pread(checked(), buf, size, offset);
+}
+
+void RawFile::read_exact_at(std::span<char> out, const u64 offset) const {
+    usize done = 0;
+    while (done < out.size()) {
+        const usize n = plat::fs::pread(checked(), out.data() + done, out.size() - done, offset + done);
+        if (n == 0) {
+            throw io_exception("Unexpected end of file: expected {} bytes at offset {}, got {}", out.size(), offset, done);
+        }
+        done += n;
+    }
+}
+
+usize RawFile::write_at(const char* data, const usize size, const u64 offset) const {
+    return plat::fs::pwrite(checked(), data, size, offset);
+}
+
+void RawFile::write_all_at(const char* data, const usize size, const u64 offset) const {
+    usize done = 0;
+    while (done < size) {
+        const usize n = plat::fs::pwrite(checked(), data + done, size - done, offset + done);
+        if (n == 0) {
+            throw io_exception("Failed to write whole buffer at offset {}", offset);
+        }
+        done += n;
+    }
+}
+
+usize RawFile::read_vectored_at(const plat::IoSliceMut* slices, const usize n, const u64 offset) const {
+    return plat::fs::preadv(checked(), slices, n, offset);
+}
+
+usize RawFile::write_vectored_at(const plat::IoSlice* slices, const usize n, const u64 offset) const {
+    return plat::fs::pwritev(checked(), slices, n, offset);
+}
+
+bool RawFile::advise(const Advice advice, const u64 offset, const u64 len) const {
+    return plat::fs::fadvise(checked(), advice, offset, len);
+}
+
+u64 RawFile::len() const {
+    return plat::fs::file_len(checked());
+}
+
+void RawFile::set_len(const u64 len) const {
+    plat::fs::set_len(checked(), len);
+}
+
+bool RawFile::allocate(const u64 offset, const u64 len) const {
+    return plat::fs::allocate(checked(), offset, len);
+}
+
+void RawFile::sync_data() const {
+    plat::fs::sync(checked(), false);
+}
+
+void RawFile::sync_all() const {
+    plat::fs::sync(checked(), true);
+}
+
+RawFile::Handle* RawFile::checked() const {
+    if (handle_ == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    return handle_;
+}
+
+} // namespace my::fs
@@ -0,0 +1,458 @@
+#include "wal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <limits>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+namespace my::fs {
+
+namespace {
+
+constexpr u32 CRC32C_POLY = 0x82f63b78; // 反射形式
+
+constexpr std::array<std::array<u32, 256>, 8> make_crc_tables() {
+    std::array<std::array<u32, 256>, 8> t{};
+    for (u32 i = 0; i < 256; ++i) {
+        u32 c = i;
+        for (int k = 0; k < 8; ++k) {
+            c = (c >> 1) ^ (CRC32C_POLY & (0u - (c & 1)));
+        }
+        t[0][i] = c;
+    }
+    for (u32 i = 0; i < 256; ++i) {
+        for (usize k = 1; k < 8; ++k) {
+            t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xff];
+        }
+    }
+    return t;
+}
+
+constexpr auto CRC_TABLES = make_crc_tables();
+
+constexpr const char* SEGMENT_EXT = ".wal";
+constexpr usize SEGMENT_NAME_DIGITS = 20;
+constexpr usize SCAN_BUFFER = 1024 * 1024;
+
+void store_u32(char* p, const u32 v) {
+    p[0] = static_cast<char>(v);
+    p[1] = static_cast<char>(v >> 8);
+    p[2] = static_cast<char>(v >> 16);
+    p[3] = static_cast<char>(v >> 24);
+}
+
+u32 load_u32(const char* p) {
+    const auto* b = reinterpret_cast<const u8*>(p);
+    return static_cast<u32>(b[0]) | static_cast<u32>(b[1]) << 8 | static_cast<u32>(b[2]) << 16 | static_cast<u32>(b[3]) << 24;
+}
+
+/**
+ * @brief 把一条记录编码到 buf 的 [len, ...) 处
+ */
+void encode_record(util::Vec<char>& buf, usize& len, const str::StringView record) {
+    const usize size = Wal::HEADER_SIZE + record.len();
+    if (len + size > buf.len()) {
+        util::Vec<char> bigger(std::max<usize>({4096, buf.len() * 2, len + size}));
+        std::memcpy(bigger.data(), buf.data(), len);
+        buf = std::move(bigger);
+    }
+    char* p = buf.data() + len;
+    store_u32(p, static_cast<u32>(record.len()));
+    std::memcpy(p + Wal::HEADER_SIZE, record.as_bytes(), record.len());
+    store_u32(p + 4, crc32c(p + Wal::HEADER_SIZE, record.len(), crc32c(p, 4)));
+    len += size;
+}
+
+/**
+ * @brief 解析 "00000000000000000001.wal" 形式的段文件名
+ */
+Option<u64> parse_segment_name(const str::StringView name) {
+    const usize ext = std::strlen(SEGMENT_EXT);
+    if (name.len() != SEGMENT_NAME_DIGITS + ext || !name.ends_with(str::StringView(SEGMENT_EXT))) {
+        return Option<u64>::None();
+    }
+    u64 lsn = 0;
+    for (usize i = 0; i < SEGMENT_NAME_DIGITS; ++i) {
+        const u32 d = static_cast<u32>(name[i]) - '0';
+        if (d >= 10) return Option<u64>::None();
+        lsn = lsn * 10 + d;
+    }
+    return Option<u64>::Some(lsn);
+}
+
+/**
+ * @brief 列出 dir 下的段，按首条记录的 LSN 升序
+ */
+util::Vec<u64> list_segments(const str::StringView dir) {
+    util::Vec<plat::fs::ScanEntry> entries;
+    plat::fs::scan_dir(dir, entries);
+    util::Vec<u64> segments;
+    for (const auto& e : entries) {
+        if (auto lsn = parse_segment_name(e.name.as_str()); lsn.is_some()) {
+            segments.push(lsn.unwrap());
+        }
+    }
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+/**
+ * @brief 顺序扫描一个段
+ */
+struct SegmentScan {
+    u64 next_lsn;  // 下一条记录的 LSN
+    u64 valid_end; // 最后一条有效记录之后的偏移
+    bool corrupt;  // 是否因残缺或校验失败而停止（而不是遇到全 0 首部或文件末尾）
+};
+
+SegmentScan scan_segment(const RawFile& file, const u64 first_lsn, const Wal::Replay& replay) {
+    const u64 file_len = file.len();
+    file.advise(RawFile::Advice::Sequential);
+
+    util::Vec<char> buf(SCAN_BUFFER);
+    u64 buf_offset = 0; // buf[0] 在文件中的偏移
+    usize begin = 0, end = 0;
+
+    // 保证 [begin, end) 至少有 need 字节，文件不足时返回 false
+    auto ensure = [&](const usize need) -> bool {
+        if (end - begin >= need) return true;
+        if (begin + need > buf.len()) {
+            util::Vec<char> next(std::max(buf.len(), need));
+            std::memcpy(next.data(), buf.data() + begin, end - begin);
+            buf = std::move(next);
+            buf_offset += begin;
+            end -= begin;
+            begin = 0;
+        }
+        while (end - begin < need) {
+            const usize n = file.read_at(buf.data() + end, buf.len() - end, buf_offset + end);
+            if (n == 0) return false;
+            end += n;
+        }
+        return true;
+    };
+
+    SegmentScan res{first_lsn, 0, false};
+    while (res.valid_end < file_len) {
+        if (!ensure(Wal::HEADER_SIZE)) {
+            res.corrupt = true;
+            break;
+        }
+        const char* header = buf.data() + begin;
+        const u32 len = load_u32(header);
+        const u32 crc = load_u32(header + 4);
+        if (len == 0 && crc == 0) {
+            break; // 预分配的 0 区域
+        }
+        const u64 size = Wal::HEADER_SIZE + static_cast<u64>(len);
+        if (res.valid_end + size > file_len || !ensure(static_cast<usize>(size))) {
+            res.corrupt = true;
+            break;
+        }
+        const char* payload = buf.data() + begin + Wal::HEADER_SIZE;
+        if (crc32c(payload, len, crc32c(buf.data() + begin, 4)) != crc) {
+            res.corrupt = true;
+            break;
+        }
+        if (replay) {
+            replay(res.next_lsn, str::StringView(payload, len));
+        }
+        ++res.next_lsn;
+        res.valid_end += size;
+        begin += static_cast<usize>(size);
+    }
+    return res;
+}
+
+} // namespace
+
+u32 crc32c(const void* data, const usize len, u32 crc) noexcept {
+    const auto* p = static_cast<const u8*>(data);
+    usize n = len;
+    crc = ~crc;
+#if defined(__SSE4_2__)
+    u64 c = crc;
+    for (; n >= 8; n -= 8, p += 8) {
+        u64 v;
+        std::memcpy(&v, p, 8);
+        c = _mm_crc32_u64(c, v);
+    }
+    crc = static_cast<u32>(c);
+    for (; n > 0; --n, ++p) {
+        crc = _mm_crc32_u8(crc, *p);
+    }
+#else
+    const auto& t = CRC_TABLES;
+    for (; n >= 8; n -= 8, p += 8) {
+        const u32 lo = crc ^ (static_cast<u32>(p[0]) | static_cast<u32>(p[1]) << 8 | static_cast<u32>(p[2]) << 16 |
+                              static_cast<u32>(p[3]) << 24);
+        crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^ t[3][p[4]] ^
+              t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+    }
+    for (; n > 0; --n, ++p) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xff];
+    }
+#endif
+    return ~crc;
+}
+
+Wal::Wal(const str::StringView dir, const WalConfig config) : dir_(dir), config_(config) {}
+
+std::unique_ptr<Wal> Wal::open(const str::StringView dir, const WalConfig config, const Replay& replay) {
+    std::unique_ptr<Wal> wal(new Wal(dir, config));
+    plat::fs::mkdir(wal->dir_.as_str(), false, true);
+    wal->segments_ = list_segments(wal->dir_.as_str());
+
+    if (wal->segments_.is_empty()) {
+        wal->rotate();
+        return wal;
+    }
+
+    u64 next_lsn = wal->segments_.at(0);
+    for (usize i = 0; i < wal->segments_.len(); ++i) {
+        const u64 first = wal->segments_.at(i);
+        if (first != next_lsn) {
+            throw io_exception("WAL segment {} does not follow LSN {}", first, next_lsn - 1);
+        }
+        const bool last = i + 1 == wal->segments_.len();
+        auto file = last ? RawFile::open_rw(wal->segment_path(first).as_cstr())
+                         : RawFile::open(wal->segment_path(first).as_cstr());
+        const auto scan = scan_segment(file, first, replay);
+        if (scan.corrupt && !last) {
+            throw io_exception("Corrupt WAL segment {} at offset {}", first, scan.valid_end);
+        }
+        next_lsn = scan.next_lsn;
+        if (last) {
+            // 截掉崩溃时未写完的尾部，再重新预分配，保证有效记录之后全为 0
+            file.set_len(scan.valid_end);
+            if (config.preallocate && scan.valid_end < config.segment_size) {
+                file.allocate(scan.valid_end, config.segment_size - scan.valid_end);
+            }
+            file.sync_data();
+            wal->active_ = Option<RawFile>::Some(std::move(file));
+            wal->active_offset_ = scan.valid_end;
+        }
+    }
+    wal->last_lsn_ = wal->written_lsn_ = wal->synced_lsn_ = wal->sync_lsn_ = next_lsn - 1;
+    wal->next_write_lsn_ = next_lsn;
+    return wal;
+}
+
+u64 Wal::replay(const str::StringView dir, const Replay& replay) {
+    const str::String<> owned(dir);
+    const auto segments = list_segments(owned.as_str());
+    u64 next_lsn = segments.is_empty() ? 1 : segments.at(0);
+    for (usize i = 0; i < segments.len(); ++i) {
+        if (segments.at(i) != next_lsn) {
+            throw io_exception("WAL segment {} does not follow LSN {}", segments.at(i), next_lsn - 1);
+        }
+        const auto name = std::format("{:0{}}{}", segments.at(i), SEGMENT_NAME_DIGITS, SEGMENT_EXT);
+        const auto path = plat::fs::join(owned.as_str(), str::StringView(name.data(), name.size()));
+        const auto scan = scan_segment(RawFile::open(path.as_cstr()), segments.at(i), replay);
+        if (scan.corrupt && i + 1 < segments.len()) {
+            throw io_exception("Corrupt WAL segment {} at offset {}", segments.at(i), scan.valid_end);
+        }
+        next_lsn = scan.next_lsn;
+    }
+    return next_lsn - 1;
+}
+
+Wal::~Wal() {
+    try {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (config_.durability == Durability::Synced) {
+            sync_lsn_ = last_lsn_;
+        }
+        wait_for(lock, last_lsn_, config_.durability == Durability::Synced);
+    } catch (...) {
+    }
+}
+
+u64 Wal::append(const str::StringView record) {
+    return append(record, config_.durability);
+}
+
+u64 Wal::append(const str::StringView record, const Durability durability) {
+    if (record.len() > std::numeric_limits<u32>::max()) {
+        throw argument_exception("WAL record of {} bytes is too large", record.len());
+    }
+    std::unique_lock<std::mutex> lock(mtx_);
+    check_failed();
+    encode_record(pending_, pending_len_, record);
+    const u64 lsn = ++last_lsn_;
+    if (durability == Durability::Buffered && pending_len_ < config_.buffer_bytes) {
+        return lsn;
+    }
+    if (durability == Durability::Synced) {
+        sync_lsn_ = lsn;
+    }
+    wait_for(lock, lsn, durability == Durability::Synced);
+    return lsn;
+}
+
+void Wal::sync() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    sync_lsn_ = last_lsn_;
+    wait_for(lock, last_lsn_, true);
+}
+
+usize Wal::truncate_before(const u64 lsn) {
+    util::Vec<u64> removed;
+    {
+        std::lock_guard<std::mutex> lock(seg_mtx_);
+        // 第 i 段的记录都早于第 i + 1 段的首条记录；最后一段正在写，保留
+        usize n = 0;
+        while (n + 1 < segments_.len() && segments_.at(n + 1) <= lsn) {
+            ++n;
+        }
+        util::Vec<u64> rest;
+        for (usize i = 0; i < segments_.len(); ++i) {
+            (i < n ? removed : rest).push(segments_.at(i));
+        }
+        segments_ = std::move(rest);
+    }
+    for (const u64 first : removed) {
+        plat::fs::remove(segment_path(first).as_str());
+    }
+    if (!removed.is_empty()) {
+        plat::fs::sync_dir(dir_.as_str());
+    }
+    return removed.len();
+}
+
+u64 Wal::last_lsn() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return last_lsn_;
+}
+
+u64 Wal::synced_lsn() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return synced_lsn_;
+}
+
+u64 Wal::groups() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return groups_;
+}
+
+u64 Wal::syncs() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return syncs_;
+}
+
+usize Wal::segment_count() const {
+    std::lock_guard<std::mutex> lock(seg_mtx_);
+    return segments_.len();
+}
+
+void Wal::wait_for(std::unique_lock<std::mutex>& lock, const u64 lsn, const bool need_sync) {
+    loop {
+        check_failed();
+        if ((need_sync ? synced_lsn_ : written_lsn_) >= lsn) {
+            return;
+        }
+        if (!leading_) {
+            lead(lock);
+            continue;
+        }
+        cv_.wait(lock);
+    }
+}
+
+void Wal::lead(std::unique_lock<std::mutex>& lock) {
+    // 只提交一批：自己的记录必然在这一批中，之后的记录交给下一个 leader，避免一个线程长期代劳
+    leading_ = true;
+    batch_.swap(pending_);
+    const usize batch_len = std::exchange(pending_len_, 0);
+    const u64 batch_end = last_lsn_;
+    const bool do_sync = sync_lsn_ > synced_lsn_;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+        write_batch(batch_.data(), batch_len);
+        if (do_sync) {
+            active_.unwrap().sync_data();
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    lock.lock();
+    leading_ = false;
+    if (error) {
+        failed_ = error;
+    } else {
+        written_lsn_ = batch_end;
+        if (do_sync) {
+            synced_lsn_ = batch_end;
+            ++syncs_;
+        }
+        ++groups_;
+    }
+    cv_.notify_all();
+}
+
+void Wal::write_batch(const char* data, const usize len) {
+    usize pos = 0;
+    while (pos < len) {
+        // 取出能放进当前段的若干条完整记录；段为空时即使超长也写入一条
+        usize end = pos;
+        u64 records = 0;
+        while (end < len) {
+            const u64 size = HEADER_SIZE + load_u32(data + end);
+            const u64 used = active_offset_ + (end - pos);
+            if (used > 0 && used + size > config_.segment_size) break;
+            end += static_cast<usize>(size);
+            ++records;
+        }
+        if (end == pos) {
+            rotate();
+            continue;
+        }
+        active_.unwrap().write_all_at(data + pos, end - pos, active_offset_);
+        active_offset_ += end - pos;
+        next_write_lsn_ += records;
+        pos = end;
+    }
+}
+
+void Wal::rotate() {
+    if (active_.is_some()) {
+        // 新段落盘之前旧段必须完整落盘，之后只需同步新段
+        active_.unwrap().sync_data();
+    }
+    const u64 first = next_write_lsn_;
+    auto file = RawFile::truncate(segment_path(first).as_cstr());
+    if (config_.preallocate) {
+        file.allocate(0, config_.segment_size);
+    }
+    file.sync_all();
+    plat::fs::sync_dir(dir_.as_str());
+    {
+        std::lock_guard<std::mutex> lock(seg_mtx_);
+        if (segments_.is_empty() || segments_.last() != first) {
+            segments_.push(first);
+        }
+    }
+    active_ = Option<RawFile>::Some(std::move(file));
+    active_offset_ = 0;
+}
+
+str::String<> Wal::segment_path(const u64 first_lsn) const {
+    const auto name = std::format("{:0{}}{}", first_lsn, SEGMENT_NAME_DIGITS, SEGMENT_EXT);
+    return plat::fs::join(dir_.as_str(), str::StringView(name.data(), name.size()));
+}
+
+void Wal::check_failed() const {
+    if (failed_) {
+        throw io_exception("WAL is in a failed state after a write or sync error");
+    }
+}
+
+} // namespace my::fs
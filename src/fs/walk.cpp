@@ -0,0 +1,196 @@
+#include "walk.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace my::fs {
+
+namespace {
+
+#if RICKY_WIN
+constexpr char PATH_SEP = '\\';
+#else
+constexpr char PATH_SEP = '/';
+#endif
+
+bool ends_with_sep(const str::StringView path) {
+    return path.len() > 0 && (path[path.len() - 1] == '/' || path[path.len() - 1] == '\\');
+}
+
+} // namespace
+
+/**
+ * @brief 一次遍历的共享状态，由调用线程与辅助任务共同持有
+ */
+struct Walker::Job {
+    struct Dir {
+        str::String<> path;
+        usize depth;
+    };
+
+    const Walker* walker;
+    const Visitor* visit;
+    std::mutex mtx;
+    std::condition_variable cv;
+    util::Vec<Dir> pending; // 待读目录，后进先出使遍历接近深度优先，待读目录数保持在较小规模
+    usize active{0};        // 正在读取的目录数
+    bool stopped{false};
+    std::exception_ptr error;
+    std::atomic<u64> entries{0};
+    std::atomic<u64> dirs{0};
+    std::atomic<u64> errors{0};
+
+    Job(const Walker* walker, const Visitor* visit) : walker(walker), visit(visit) {}
+
+    void work() {
+        util::Vec<plat::fs::ScanEntry> scratch;
+        util::Vec<Dir> found;
+        str::String<> path;
+        loop {
+            Option<Dir> dir = Option<Dir>::None();
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [this]() { return stopped || !pending.is_empty() || active == 0; });
+                if (stopped || pending.is_empty()) {
+                    return;
+                }
+                dir = Option<Dir>::Some(std::move(pending.last()));
+                pending.pop();
+                ++active;
+            }
+
+            try {
+                process(dir.unwrap(), scratch, found, path);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                stopped = true;
+            }
+
+            usize pushed = 0;
+            bool finished;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (!stopped) {
+                    for (auto& d : found) {
+                        pending.push(std::move(d));
+                    }
+                    pushed = found.len();
+                }
+                --active;
+                finished = active == 0 && (pending.is_empty() || stopped);
+            }
+            found.clear();
+            if (finished || stopped) {
+                cv.notify_all();
+            } else {
+                for (usize i = 0; i < pushed; ++i) {
+                    cv.notify_one();
+                }
+            }
+        }
+    }
+
+    void process(const Dir& dir, util::Vec<plat::fs::ScanEntry>& scratch, util::Vec<Dir>& found, str::String<>& path) {
+        try {
+            plat::fs::scan_dir(dir.path.as_str(), scratch);
+        } catch (const Exception&) {
+            if (dir.depth == 0) throw;
+            errors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        dirs.fetch_add(1, std::memory_order_relaxed);
+
+        const usize depth = dir.depth + 1;
+        const bool descend = depth < walker->max_depth_;
+        const bool need_sep = !ends_with_sep(dir.path.as_str());
+        u64 visited = 0;
+        for (const auto& e : scratch) {
+            path.clear();
+            path.reserve(dir.path.len() + 1 + e.name.len());
+            path.push_str(dir.path.as_str());
+            if (need_sep) {
+                path.push(PATH_SEP);
+            }
+            path.push_str(e.name.as_str());
+
+            const WalkEntry entry{path.as_str(), e.name.as_str(), e.type, depth};
+            if (!walker->filter_ || walker->filter_(entry)) {
+                (*visit)(entry);
+                ++visited;
+            }
+            if (e.type == FileType::Dir && descend && !(walker->prune_ && walker->prune_(entry))) {
+                found.push(Dir{str::String<>(path.as_str()), depth});
+            }
+        }
+        entries.fetch_add(visited, std::memory_order_relaxed);
+    }
+};
+
+Walker::Walker(const str::StringView root) : root_(root) {}
+
+Walker::Walker(const PathBuf& root) : root_(root.as_string().as_str()) {}
+
+Walker& Walker::max_depth(const usize depth) {
+    max_depth_ = depth;
+    return *this;
+}
+
+Walker& Walker::filter(Predicate pred) {
+    filter_ = std::move(pred);
+    return *this;
+}
+
+Walker& Walker::prune(Predicate pred) {
+    prune_ = std::move(pred);
+    return *this;
+}
+
+Walker& Walker::pool(async::ThreadPool& pool) {
+    pool_ = &pool;
+    return *this;
+}
+
+Walker& Walker::threads(const usize n) {
+    threads_ = n;
+    return *this;
+}
+
+WalkStats Walker::for_each(const Visitor& visit) const {
+    auto job = std::make_shared<Job>(this, &visit);
+    if (max_depth_ == 0) {
+        return WalkStats{};
+    }
+    job->pending.push(Job::Dir{str::String<>(root_.as_str()), 0});
+
+    auto& pool = pool_ != nullptr ? *pool_ : async::global_pool();
+    const usize helpers = threads_ == 0 ? pool.num_threads() : threads_ - 1;
+    for (usize i = 0; i < helpers; ++i) {
+        // 迟到的任务看到遍历已结束即退出，不会访问调用方栈上的 visit
+        pool.execute([job]() { job->work(); });
+    }
+    job->work();
+    {
+        // 出错停止时其他线程可能仍在处理目录，等它们退出后才能返回
+        std::unique_lock<std::mutex> lock(job->mtx);
+        job->cv.wait(lock, [&job]() { return job->active == 0; });
+    }
+    if (job->error) {
+        std::rethrow_exception(job->error);
+    }
+    return WalkStats{job->entries.load(), job->dirs.load(), job->errors.load()};
+}
+
+util::Vec<str::String<>> Walker::collect() const {
+    std::mutex mtx;
+    util::Vec<str::String<>> paths;
+    for_each([&](const WalkEntry& entry) {
+        std::lock_guard<std::mutex> lock(mtx);
+        paths.push(str::String<>(entry.path));
+    });
+    return paths;
+}
+
+} // namespace my::fs
@@ -0,0 +1,227 @@
+/**
+ * @brief 批量提交/完成式 I/O 引擎实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "io/io_engine.hpp"
+
+#include <algorithm>
+
+namespace my::io {
+
+IoEngine::IoEngine(const IoBackend backend, const u32 entries) :
+        backend_(backend) {
+    if (backend_ == IoBackend::Auto) {
+        backend_ = io_uring_available() ? IoBackend::IoUring : IoBackend::Blocking;
+    } else if (backend_ == IoBackend::IoUring && !io_uring_available()) {
+        throw runtime_exception("io_uring is not available on this system");
+    }
+    if (backend_ == IoBackend::IoUring) {
+        ring_ = plat::uring::create(entries);
+        cqes_ = util::Vec<plat::uring::Cqe>(entries);
+    }
+}
+
+IoEngine::~IoEngine() {
+    plat::uring::close(ring_);
+}
+
+bool IoEngine::io_uring_available() {
+    return plat::uring::is_supported();
+}
+
+void IoEngine::register_buffers(const util::Vec<plat::uring::FixedBuffer>& buffers) {
+    if (!buffers_.is_empty()) {
+        throw state_exception("IoEngine buffers are already registered");
+    }
+    if (ring_ != nullptr) {
+        plat::uring::register_buffers(ring_, buffers.data(), buffers.len());
+    }
+    buffers_ = buffers;
+}
+
+void IoEngine::accept(plat::net::SocketHandle* listener, const u64 token) {
+    enqueue(Op{.kind = OpKind::Accept, .token = token, .socket = listener});
+}
+
+void IoEngine::recv(plat::net::SocketHandle* socket, char* buf, const usize size, const u64 token) {
+    enqueue(Op{.kind = OpKind::Recv, .token = token, .socket = socket, .buf = buf, .size = size});
+}
+
+void IoEngine::send(plat::net::SocketHandle* socket, const char* data, const usize size, const u64 token) {
+    enqueue(Op{.kind = OpKind::Send, .token = token, .socket = socket, .buf = const_cast<char*>(data), .size = size});
+}
+
+void IoEngine::read(plat::fs::FileHandle* file, char* buf, const usize size, const u64 offset, const u64 token) {
+    enqueue(Op{.kind = OpKind::Read, .token = token, .file = file, .buf = buf, .size = size, .offset = offset});
+}
+
+void IoEngine::write(plat::fs::FileHandle* file, const char* data, const usize size, const u64 offset, const u64 token) {
+    enqueue(Op{.kind = OpKind::Write, .token = token, .file = file, .buf = const_cast<char*>(data), .size = size, .offset = offset});
+}
+
+void IoEngine::recv_fixed(plat::net::SocketHandle* socket, const u32 buf_index, const usize size, const u64 token) {
+    enqueue(Op{.kind = OpKind::ReadFixed, .token = token, .socket = socket, .buf = fixed_buffer(buf_index, size), .size = size, .offset = npos, .buf_index = buf_index});
+}
+
+void IoEngine::send_fixed(plat::net::SocketHandle* socket, const u32 buf_index, const usize size, const u64 token) {
+    enqueue(Op{.kind = OpKind::WriteFixed, .token = token, .socket = socket, .buf = fixed_buffer(buf_index, size), .size = size, .offset = npos, .buf_index = buf_index});
+}
+
+void IoEngine::read_fixed(plat::fs::FileHandle* file, const u32 buf_index, const usize size, const u64 offset, const u64 token) {
+    enqueue(Op{.kind = OpKind::ReadFixed, .token = token, .file = file, .buf = fixed_buffer(buf_index, size), .size = size, .offset = offset, .buf_index = buf_index});
+}
+
+void IoEngine::write_fixed(plat::fs::FileHandle* file, const u32 buf_index, const usize size, const u64 offset, const u64 token) {
+    enqueue(Op{.kind = OpKind::WriteFixed, .token = token, .file = file, .buf = fixed_buffer(buf_index, size), .size = size, .offset = offset, .buf_index = buf_index});
+}
+
+usize IoEngine::submit() {
+    if (ring_ != nullptr) {
+        return plat::uring::submit(ring_, 0);
+    }
+
+    const usize n = queued_.len();
+    for (const auto& op : queued_) {
+        done_.push_back(run_blocking(op));
+    }
+    queued_.clear();
+    return n;
+}
+
+usize IoEngine::wait(util::Vec<Completion>& out, const usize min_complete) {
+    if (ring_ == nullptr) {
+        submit();
+        usize n = 0;
+        for (auto c = done_.pop_front(); c.is_some(); c = done_.pop_front()) {
+            out.push(c.unwrap());
+            --in_flight_;
+            ++n;
+        }
+        return n;
+    }
+
+    usize n = 0;
+    bool submitted = false;
+    loop {
+        const usize got = plat::uring::reap(ring_, cqes_.data(), cqes_.len());
+        for (usize i = 0; i < got; ++i) {
+            out.push(complete(static_cast<u32>(cqes_.at(i).user_data), cqes_.at(i).result));
+        }
+        n += got;
+        if (n >= min_complete || in_flight_ == 0) {
+            if (!submitted) plat::uring::submit(ring_, 0); // 发布期间新排队的操作
+            return n;
+        }
+        // 提交与等待合并为一次 io_uring_enter
+        plat::uring::submit(ring_, std::min(min_complete - n, in_flight_));
+        submitted = true;
+    }
+}
+
+char* IoEngine::fixed_buffer(const u32 buf_index, const usize size) const {
+    if (buf_index >= buffers_.len()) {
+        throw index_out_of_bounds_exception("Fixed buffer {} out of bounds [0..{})", buf_index, buffers_.len());
+    }
+    const auto& buffer = buffers_.at(buf_index);
+    if (size > buffer.size) {
+        throw argument_exception("Size {} exceeds fixed buffer size {}", size, buffer.size);
+    }
+    return buffer.data;
+}
+
+void IoEngine::enqueue(const Op& op) {
+    if (ring_ == nullptr) {
+        queued_.push(op);
+        ++in_flight_;
+        return;
+    }
+
+    const u32 slot = acquire_slot(op);
+    while (!prep(op, slot)) {
+        plat::uring::submit(ring_, 0); // 提交队列已满，先提交已排队的部分
+    }
+    ++in_flight_;
+}
+
+bool IoEngine::prep(const Op& op, const u64 user_data) {
+    switch (op.kind) {
+    case OpKind::Accept: return plat::uring::prep_accept(ring_, op.socket, user_data);
+    case OpKind::Recv: return plat::uring::prep_recv(ring_, op.socket, op.buf, op.size, user_data);
+    case OpKind::Send: return plat::uring::prep_send(ring_, op.socket, op.buf, op.size, user_data);
+    case OpKind::Read: return plat::uring::prep_read(ring_, op.file, op.buf, op.size, op.offset, user_data);
+    case OpKind::Write: return plat::uring::prep_write(ring_, op.file, op.buf, op.size, op.offset, user_data);
+    case OpKind::ReadFixed:
+    case OpKind::WriteFixed: {
+        const i64 native = op.socket != nullptr ? plat::net::native_handle(op.socket) : plat::fs::native_handle(op.file);
+        return op.kind == OpKind::ReadFixed
+                   ? plat::uring::prep_read_fixed(ring_, native, op.buf, op.size, op.offset, op.buf_index, user_data)
+                   : plat::uring::prep_write_fixed(ring_, native, op.buf, op.size, op.offset, op.buf_index, user_data);
+    }
+    }
+    return false;
+}
+
+u32 IoEngine::acquire_slot(const Op& op) {
+    if (free_slots_.is_empty()) {
+        slots_.push(op);
+        return static_cast<u32>(slots_.len() - 1);
+    }
+    const u32 slot = free_slots_.last();
+    free_slots_.pop();
+    slots_.at(slot) = op;
+    return slot;
+}
+
+Completion IoEngine::complete(const u32 slot, const i64 result) {
+    const auto& op = slots_.at(slot);
+    Completion c{op.token, result};
+    if (op.kind == OpKind::Accept && result >= 0) {
+        c.socket = plat::net::from_native_handle(result);
+    }
+    free_slots_.push(slot);
+    --in_flight_;
+    return c;
+}
+
+Completion IoEngine::run_blocking(const Op& op) const {
+    Completion c{op.token, -1};
+    try {
+        switch (op.kind) {
+        case OpKind::Accept:
+            c.socket = plat::net::accept(op.socket);
+            c.result = plat::net::native_handle(c.socket);
+            break;
+        case OpKind::Recv:
+        case OpKind::ReadFixed:
+            if (op.socket != nullptr) {
+                const auto n = plat::net::try_recv(op.socket, op.buf, op.size);
+                c.result = n.is_some() ? static_cast<i64>(n.unwrap()) : -1;
+            } else {
+                c.result = static_cast<i64>(plat::fs::read_at(op.file, op.buf, op.size, op.offset));
+            }
+            break;
+        case OpKind::Send:
+        case OpKind::WriteFixed:
+            if (op.socket != nullptr) {
+                const auto n = plat::net::try_send(op.socket, op.buf, op.size);
+                c.result = n.is_some() ? static_cast<i64>(n.unwrap()) : -1;
+            } else {
+                c.result = static_cast<i64>(plat::fs::write_at(op.file, op.buf, op.size, op.offset));
+            }
+            break;
+        case OpKind::Read:
+            c.result = static_cast<i64>(plat::fs::read_at(op.file, op.buf, op.size, op.offset));
+            break;
+        case OpKind::Write:
+            c.result = static_cast<i64>(plat::fs::write_at(op.file, op.buf, op.size, op.offset));
+            break;
+        }
+    } catch (const Exception&) {
+        c.result = -1;
+    }
+    return c;
+}
+
+} // namespace my::io
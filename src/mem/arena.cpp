@@ -0,0 +1,68 @@
+#include "arena.hpp"
+
+#include <algorithm>
+
+namespace my::mem {
+
+Arena::Arena(const usize chunk_size) noexcept :
+        chunk_size_(std::max<usize>(chunk_size, 256)), next_size_(chunk_size_) {}
+
+Arena::~Arena() {
+    release();
+}
+
+void Arena::reset() noexcept {
+    used_ = 0;
+    if (head_ == nullptr) {
+        return;
+    }
+    enter(head_);
+}
+
+void Arena::release() noexcept {
+    for (Chunk* c = head_; c != nullptr;) {
+        Chunk* next = c->next;
+        ::operator delete(c, sizeof(Chunk) + c->size);
+        c = next;
+    }
+    head_ = active_ = nullptr;
+    cur_ = end_ = 0;
+    used_ = reserved_ = chunks_ = 0;
+    next_size_ = chunk_size_;
+}
+
+void* Arena::allocate_slow(const usize bytes, const usize align) {
+    const usize need = bytes + align - 1;
+
+    // reset 之后按顺序复用保留下来的块，放不下的块在本轮被跳过
+    for (Chunk* c = active_ != nullptr ? active_->next : nullptr; c != nullptr; c = c->next) {
+        if (c->size >= need) {
+            enter(c);
+            return allocate(bytes, align);
+        }
+    }
+
+    const usize size = std::max(need, next_size_);
+    next_size_ = std::min(next_size_ * 2, std::max(MAX_CHUNK_SIZE, chunk_size_));
+    auto* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + size));
+    chunk->size = size;
+    if (active_ == nullptr) {
+        chunk->next = head_;
+        head_ = chunk;
+    } else {
+        chunk->next = active_->next;
+        active_->next = chunk;
+    }
+    reserved_ += size;
+    ++chunks_;
+    enter(chunk);
+    return allocate(bytes, align);
+}
+
+void Arena::enter(Chunk* chunk) noexcept {
+    active_ = chunk;
+    cur_ = reinterpret_cast<usize>(chunk + 1);
+    end_ = cur_ + chunk->size;
+}
+
+} // namespace my::mem
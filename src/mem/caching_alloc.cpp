@@ -0,0 +1,737 @@
+#include "caching_alloc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace my::mem {
+
+namespace {
+
+constexpr usize PAGE_SHIFT = CachingHeap::PAGE_SHIFT;
+constexpr usize PAGE_SIZE = CachingHeap::PAGE_SIZE;
+constexpr usize CLASS_COUNT = CachingHeap::CLASS_COUNT;
+constexpr u32 NO_CLASS = ~u32{0};
+
+constexpr usize MAX_LIST_PAGES = 128;  // 页数不超过该值的空闲 span 按页数分链，更大的放在同一条链中
+constexpr usize GROW_PAGES = 128;      // 每次至少向系统申请 1MiB
+constexpr usize TRANSFER_SLOTS = 64;   // 每级转移缓存最多容纳的批数
+constexpr u32 MAX_LIST_LENGTH = 8192;  // 线程缓存单条链表长度上限
+constexpr usize MAX_THREAD_CACHE_BYTES = 4 * 1024 * 1024;
+
+static_assert(CachingHeap::size_class(CachingHeap::MAX_SMALL_SIZE) == CLASS_COUNT - 1);
+static_assert(CachingHeap::class_size(CLASS_COUNT - 1) == CachingHeap::MAX_SMALL_SIZE);
+
+struct ClassInfo {
+    usize size;
+    usize pages;   // 每个 span 的页数
+    usize objects; // 每个 span 切出的对象数
+    u32 batch;     // 线程缓存与中心之间一次移动的对象数
+};
+
+constexpr auto CLASSES = [] {
+    std::array<ClassInfo, CLASS_COUNT> classes{};
+    for (usize cls = 0; cls < CLASS_COUNT; ++cls) {
+        const usize size = CachingHeap::class_size(cls);
+        // 一个 span 至少容纳 8 个对象，32KiB 以上的对象放宽到 2 个
+        const usize want = std::max(size * (size >= 32 * 1024 ? 2 : 8), PAGE_SIZE);
+        const usize pages = (want + PAGE_SIZE - 1) / PAGE_SIZE;
+        classes[cls] = {size, pages, pages * PAGE_SIZE / size, static_cast<u32>(std::clamp<usize>(64 * 1024 / size, 2, 32))};
+    }
+    return classes;
+}();
+
+/**
+ * @brief 一段连续的页
+ */
+struct Span {
+    usize start;    // 起始页号
+    usize pages;
+    Span* prev;
+    Span* next;
+    void* objects;  // 小对象 span 中空闲对象的链表
+    u32 refcount;   // 小对象 span 中已分出的对象数
+    u32 size_class; // 大对象或空闲 span 为 NO_CLASS
+    bool free;      // 是否在页堆的空闲链中
+};
+
+void*& next_of(void* object) noexcept {
+    return *static_cast<void**>(object);
+}
+
+void* span_address(const Span* span) noexcept {
+    return reinterpret_cast<void*>(span->start << PAGE_SHIFT);
+}
+
+/**
+ * @brief 以哨兵节点为头的循环双向链表
+ */
+void list_init(Span* head) noexcept {
+    head->prev = head->next = head;
+}
+
+bool list_empty(const Span* head) noexcept {
+    return head->next == head;
+}
+
+void list_push(Span* head, Span* span) noexcept {
+    span->prev = head;
+    span->next = head->next;
+    head->next->prev = span;
+    head->next = span;
+}
+
+void list_remove(Span* span) noexcept {
+    span->prev->next = span->next;
+    span->next->prev = span->prev;
+    span->prev = span->next = nullptr;
+}
+
+/**
+ * @brief 页号到 span 的三级基数树，覆盖 48 位地址空间
+ * @details 只在页堆锁内写入。无锁读取只针对已交给中心空闲链表或调用方的 span，
+ *          其页表项在交出之前写好，由之后的加锁建立先后关系。
+ */
+class PageMap {
+public:
+    Span* get(const usize page) const noexcept {
+        const Mid* mid = root_[page >> (LEAF_BITS + MID_BITS)];
+        if (mid == nullptr) return nullptr;
+        const Leaf* leaf = mid->leaves[(page >> LEAF_BITS) & (MID_LEN - 1)];
+        if (leaf == nullptr) return nullptr;
+        return leaf->spans[page & (LEAF_LEN - 1)];
+    }
+
+    /**
+     * @brief 登记 page 所属的 span，叶节点须已由 ensure 建好
+     */
+    void set(const usize page, Span* span) noexcept {
+        root_[page >> (LEAF_BITS + MID_BITS)]->leaves[(page >> LEAF_BITS) & (MID_LEN - 1)]->spans[page & (LEAF_LEN - 1)] = span;
+    }
+
+    /**
+     * @brief 为 [page, page + count) 建好各级节点
+     */
+    void ensure(usize page, const usize count) {
+        const usize end = page + count;
+        while (page < end) {
+            Mid*& mid = root_[page >> (LEAF_BITS + MID_BITS)];
+            if (mid == nullptr) {
+                mid = new Mid{};
+            }
+            Leaf*& leaf = mid->leaves[(page >> LEAF_BITS) & (MID_LEN - 1)];
+            if (leaf == nullptr) {
+                leaf = new Leaf{};
+            }
+            page = (page | (LEAF_LEN - 1)) + 1;
+        }
+    }
+
+private:
+    static constexpr usize BITS = 48 - PAGE_SHIFT;
+    static constexpr usize LEAF_BITS = 11;
+    static constexpr usize MID_BITS = 12;
+    static constexpr usize ROOT_BITS = BITS - LEAF_BITS - MID_BITS;
+    static constexpr usize LEAF_LEN = usize{1} << LEAF_BITS;
+    static constexpr usize MID_LEN = usize{1} << MID_BITS;
+
+    struct Leaf {
+        Span* spans[LEAF_LEN];
+    };
+
+    struct Mid {
+        Leaf* leaves[MID_LEN];
+    };
+
+    Mid* root_[usize{1} << ROOT_BITS]{};
+};
+
+/**
+ * @brief 按页分配 span，空闲 span 按页数分链，归还时与相邻空闲 span 合并
+ */
+class PageHeap {
+public:
+    PageHeap() {
+        for (auto& head : free_) {
+            list_init(&head);
+        }
+        list_init(&large_);
+    }
+
+    /**
+     * @brief 分配 pages 页的 span；cls 不是 NO_CLASS 时登记每一页，供小对象反查
+     */
+    Span* allocate(const usize pages, const u32 cls) {
+        std::lock_guard lock(mtx_);
+        Span* span = search(pages);
+        if (span == nullptr) {
+            grow(pages);
+            span = search(pages);
+        }
+        span = carve(span, pages);
+        span->size_class = cls;
+        if (cls != NO_CLASS) {
+            for (usize i = 1; i + 1 < span->pages; ++i) {
+                map_.set(span->start + i, span);
+            }
+        } else {
+            ++large_spans_;
+        }
+        return span;
+    }
+
+    void deallocate(Span* span) noexcept {
+        std::lock_guard lock(mtx_);
+        if (span->size_class == NO_CLASS) {
+            --large_spans_;
+        }
+        release(span);
+    }
+
+    Span* lookup(const void* p) const noexcept {
+        return map_.get(reinterpret_cast<usize>(p) >> PAGE_SHIFT);
+    }
+
+    PageHeapStats stats() {
+        std::lock_guard lock(mtx_);
+        return {system_bytes_, free_pages_, large_spans_};
+    }
+
+private:
+    Span* search(const usize pages) noexcept {
+        for (usize n = pages; n <= MAX_LIST_PAGES; ++n) {
+            if (!list_empty(&free_[n])) {
+                return free_[n].next;
+            }
+        }
+        // 大块中取最小的一个
+        Span* best = nullptr;
+        for (Span* s = large_.next; s != &large_; s = s->next) {
+            if (s->pages >= pages && (best == nullptr || s->pages < best->pages)) {
+                best = s;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief 从空闲 span 切出前 pages 页，剩余部分留在空闲链中
+     */
+    Span* carve(Span* span, const usize pages) {
+        Span* rest = span->pages > pages ? new_span(span->start + pages, span->pages - pages) : nullptr;
+        list_remove(span);
+        span->free = false;
+        free_pages_ -= span->pages;
+        if (rest != nullptr) {
+            span->pages = pages;
+            insert_free(rest);
+        }
+        record(span);
+        return span;
+    }
+
+    void grow(const usize pages) {
+        const usize n = std::max(pages, GROW_PAGES);
+        void* mem = ::operator new(n * PAGE_SIZE, std::align_val_t(PAGE_SIZE));
+        const usize start = reinterpret_cast<usize>(mem) >> PAGE_SHIFT;
+        try {
+            map_.ensure(start, n);
+            chunks_.push(mem);
+        } catch (...) {
+            ::operator delete(mem, n * PAGE_SIZE, std::align_val_t(PAGE_SIZE));
+            throw;
+        }
+        system_bytes_ += n * PAGE_SIZE;
+        release(new_span(start, n));
+    }
+
+    /**
+     * @brief 与前后相邻的空闲 span 合并后放入空闲链
+     */
+    void release(Span* span) noexcept {
+        span->size_class = NO_CLASS;
+        span->objects = nullptr;
+        span->refcount = 0;
+        if (Span* prev = map_.get(span->start - 1); prev != nullptr && prev->free) {
+            list_remove(prev);
+            free_pages_ -= prev->pages;
+            span->start = prev->start;
+            span->pages += prev->pages;
+            delete_span(prev);
+        }
+        if (Span* next = map_.get(span->start + span->pages); next != nullptr && next->free) {
+            list_remove(next);
+            free_pages_ -= next->pages;
+            span->pages += next->pages;
+            delete_span(next);
+        }
+        insert_free(span);
+    }
+
+    void insert_free(Span* span) noexcept {
+        span->free = true;
+        free_pages_ += span->pages;
+        record(span);
+        list_push(span->pages <= MAX_LIST_PAGES ? &free_[span->pages] : &large_, span);
+    }
+
+    /**
+     * @brief 登记首尾两页，合并时据此找到相邻 span
+     */
+    void record(Span* span) noexcept {
+        map_.set(span->start, span);
+        map_.set(span->start + span->pages - 1, span);
+    }
+
+    Span* new_span(const usize start, const usize pages) {
+        if (spare_ == nullptr) {
+            constexpr usize n = 64 * 1024 / sizeof(Span);
+            auto* block = static_cast<Span*>(::operator new(n * sizeof(Span)));
+            for (usize i = 0; i < n; ++i) {
+                block[i].next = spare_;
+                spare_ = &block[i];
+            }
+        }
+        Span* span = spare_;
+        spare_ = span->next;
+        *span = Span{start, pages, nullptr, nullptr, nullptr, 0, NO_CLASS, false};
+        return span;
+    }
+
+    void delete_span(Span* span) noexcept {
+        span->next = spare_;
+        spare_ = span;
+    }
+
+private:
+    std::mutex mtx_;
+    Span free_[MAX_LIST_PAGES + 1]; // free_[n] 为恰好 n 页的空闲 span
+    Span large_;                    // 超过 MAX_LIST_PAGES 页的空闲 span
+    PageMap map_;
+    Span* spare_{nullptr};          // 回收的 Span 元数据
+    util::Vec<void*> chunks_;       // 向系统申请的内存，从不归还
+    usize system_bytes_{0};
+    usize free_pages_{0};
+    usize large_spans_{0};
+};
+
+/**
+ * @brief 一级小对象的中心空闲链表，按 span 记账
+ */
+class CentralFreeList {
+public:
+    CentralFreeList() {
+        list_init(&nonempty_);
+    }
+
+    /**
+     * @brief 取出最多 n 个对象串成链表，span 不足时向页堆申请
+     * @return 取出的个数
+     */
+    usize remove_range(PageHeap& heap, const usize cls, const usize n, void*& head) {
+        std::unique_lock lock(mtx_);
+        head = nullptr;
+        usize count = 0;
+        while (count < n) {
+            if (list_empty(&nonempty_)) {
+                lock.unlock();
+                Span* span = nullptr;
+                try {
+                    span = populate(heap, cls);
+                } catch (...) {
+                    // 已取到的对象照常交出，一个都没有时才把异常抛给调用方
+                    lock.lock();
+                    if (count == 0) throw;
+                    break;
+                }
+                lock.lock();
+                list_push(&nonempty_, span);
+                ++spans_;
+                objects_ += CLASSES[cls].objects;
+                free_ += CLASSES[cls].objects;
+            }
+            Span* span = nonempty_.next;
+            while (count < n && span->objects != nullptr) {
+                void* p = span->objects;
+                span->objects = next_of(p);
+                next_of(p) = head;
+                head = p;
+                ++span->refcount;
+                ++count;
+            }
+            if (span->objects == nullptr) {
+                list_remove(span);
+            }
+        }
+        free_ -= count;
+        return count;
+    }
+
+    /**
+     * @brief 归还由 head 串起的 n 个对象，完全空闲的 span 交还页堆
+     */
+    void insert_range(PageHeap& heap, const usize cls, void* head, const usize n) noexcept {
+        Span* empty = nullptr;
+        {
+            std::lock_guard lock(mtx_);
+            for (usize i = 0; i < n; ++i) {
+                void* p = head;
+                head = next_of(p);
+                Span* span = heap.lookup(p);
+                if (span->objects == nullptr) {
+                    list_push(&nonempty_, span);
+                }
+                next_of(p) = span->objects;
+                span->objects = p;
+                if (--span->refcount == 0) {
+                    list_remove(span);
+                    span->next = empty;
+                    empty = span;
+                    --spans_;
+                    objects_ -= CLASSES[cls].objects;
+                    free_ -= CLASSES[cls].objects - 1;
+                } else {
+                    ++free_;
+                }
+            }
+        }
+        while (empty != nullptr) {
+            Span* next = empty->next;
+            heap.deallocate(empty);
+            empty = next;
+        }
+    }
+
+    void stats(SizeClassStats& out) {
+        std::lock_guard lock(mtx_);
+        out.spans = spans_;
+        out.objects = objects_;
+        out.central_free = free_;
+    }
+
+private:
+    /**
+     * @brief 申请新 span 并切成对象链表
+     */
+    static Span* populate(PageHeap& heap, const usize cls) {
+        const auto& info = CLASSES[cls];
+        Span* span = heap.allocate(info.pages, static_cast<u32>(cls));
+        auto* base = static_cast<char*>(span_address(span));
+        void* head = nullptr;
+        for (usize i = info.objects; i > 0; --i) {
+            void* p = base + (i - 1) * info.size;
+            next_of(p) = head;
+            head = p;
+        }
+        span->objects = head;
+        return span;
+    }
+
+private:
+    std::mutex mtx_;
+    Span nonempty_; // 还有空闲对象的 span
+    usize spans_{0};
+    usize objects_{0};
+    usize free_{0};
+};
+
+/**
+ * @brief 一级小对象的转移缓存，只存放恰好一整批的链表，线程之间交换时不必逐个拆到 span
+ */
+class TransferCache {
+public:
+    bool insert(void* head) noexcept {
+        std::lock_guard lock(mtx_);
+        if (used_ == TRANSFER_SLOTS) {
+            return false;
+        }
+        slots_[used_++] = head;
+        return true;
+    }
+
+    void* remove() noexcept {
+        std::lock_guard lock(mtx_);
+        return used_ == 0 ? nullptr : slots_[--used_];
+    }
+
+    usize batches() {
+        std::lock_guard lock(mtx_);
+        return used_;
+    }
+
+private:
+    std::mutex mtx_;
+    std::array<void*, TRANSFER_SLOTS> slots_{};
+    usize used_{0};
+};
+
+class ThreadCache;
+
+struct Heap {
+    PageHeap pages;
+    std::array<CentralFreeList, CLASS_COUNT> central;
+    std::array<TransferCache, CLASS_COUNT> transfer;
+
+    std::mutex registry_mtx;
+    ThreadCache* threads{nullptr};               // 存活线程的缓存
+    std::array<u64, CLASS_COUNT> retired_allocs{}; // 已退出线程的计数
+    std::array<u64, CLASS_COUNT> retired_frees{};
+
+    /**
+     * @brief 取一批对象，整批时优先从转移缓存取
+     */
+    usize fetch(const usize cls, const usize n, void*& head) {
+        if (n == CLASSES[cls].batch) {
+            if (void* batch = transfer[cls].remove(); batch != nullptr) {
+                head = batch;
+                return n;
+            }
+        }
+        return central[cls].remove_range(pages, cls, n, head);
+    }
+
+    void release(const usize cls, void* head, const usize n) noexcept {
+        if (n == CLASSES[cls].batch && transfer[cls].insert(head)) {
+            return;
+        }
+        central[cls].insert_range(pages, cls, head, n);
+    }
+};
+
+Heap& heap() {
+    static auto* h = new Heap();
+    return *h;
+}
+
+/**
+ * @brief 线程缓存，length 与计数只由所属线程写入，stats 以 relaxed 读取
+ */
+class ThreadCache {
+public:
+    ThreadCache() {
+        auto& h = heap();
+        std::lock_guard lock(h.registry_mtx);
+        next_ = h.threads;
+        if (next_ != nullptr) {
+            next_->prev_ = this;
+        }
+        h.threads = this;
+    }
+
+    ~ThreadCache();
+
+    void* allocate(const usize cls) {
+        auto& list = lists_[cls];
+        if (list.head == nullptr) {
+            fetch(cls);
+        }
+        void* p = list.head;
+        list.head = next_of(p);
+        bump(list.length, -1);
+        bump(list.allocs, 1);
+        bytes_ -= CLASSES[cls].size;
+        return p;
+    }
+
+    void deallocate(void* p, const usize cls) noexcept {
+        auto& list = lists_[cls];
+        next_of(p) = list.head;
+        list.head = p;
+        bump(list.length, 1);
+        bump(list.frees, 1);
+        bytes_ += CLASSES[cls].size;
+        if (list.length.load(std::memory_order_relaxed) > list.max_length) {
+            release(cls, CLASSES[cls].batch);
+        }
+        if (bytes_ > MAX_THREAD_CACHE_BYTES) {
+            scavenge();
+        }
+    }
+
+    void flush() noexcept {
+        for (usize cls = 0; cls < CLASS_COUNT; ++cls) {
+            release(cls, lists_[cls].length.load(std::memory_order_relaxed));
+        }
+    }
+
+    void stats(const usize cls, SizeClassStats& out) const noexcept {
+        const auto& list = lists_[cls];
+        out.thread_free += list.length.load(std::memory_order_relaxed);
+        out.allocs += list.allocs.load(std::memory_order_relaxed);
+        out.frees += list.frees.load(std::memory_order_relaxed);
+    }
+
+    ThreadCache* next() const noexcept { return next_; }
+
+private:
+    struct FreeList {
+        void* head{nullptr};
+        std::atomic<u32> length{0};
+        u32 max_length{1};
+        std::atomic<u64> allocs{0};
+        std::atomic<u64> frees{0};
+    };
+
+    template <typename T, typename D>
+    static void bump(std::atomic<T>& counter, const D delta) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + static_cast<T>(delta), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 链表为空时取一批，批量随使用逐步增大
+     */
+    void fetch(const usize cls) {
+        auto& list = lists_[cls];
+        const u32 batch = CLASSES[cls].batch;
+        const u32 n = std::min(list.max_length, batch);
+        void* head = nullptr;
+        const usize got = heap().fetch(cls, n, head);
+        list.head = head;
+        bump(list.length, got);
+        bytes_ += got * CLASSES[cls].size;
+        if (list.max_length < batch) {
+            ++list.max_length;
+        } else {
+            list.max_length = std::min(list.max_length + batch, MAX_LIST_LENGTH);
+        }
+    }
+
+    /**
+     * @brief 从链表头取下 n 个对象还回去
+     */
+    void release(const usize cls, usize n) noexcept {
+        auto& list = lists_[cls];
+        n = std::min<usize>(n, list.length.load(std::memory_order_relaxed));
+        if (n == 0) return;
+        void* head = list.head;
+        void* tail = head;
+        for (usize i = 1; i < n; ++i) {
+            tail = next_of(tail);
+        }
+        list.head = next_of(tail);
+        next_of(tail) = nullptr;
+        bump(list.length, -static_cast<i64>(n));
+        bytes_ -= n * CLASSES[cls].size;
+        heap().release(cls, head, n);
+    }
+
+    /**
+     * @brief 缓存总量超限时每条链表还回一半，并把上限收回到一批
+     */
+    void scavenge() noexcept {
+        for (usize cls = 0; cls < CLASS_COUNT; ++cls) {
+            auto& list = lists_[cls];
+            release(cls, (list.length.load(std::memory_order_relaxed) + 1) / 2);
+            list.max_length = std::min(list.max_length, CLASSES[cls].batch);
+        }
+    }
+
+private:
+    std::array<FreeList, CLASS_COUNT> lists_;
+    usize bytes_{0};
+    ThreadCache* prev_{nullptr};
+    ThreadCache* next_{nullptr};
+};
+
+thread_local bool tls_dead = false; // 本线程的缓存已析构，之后的请求直接访问中心空闲链表
+thread_local ThreadCache tls_cache;
+
+ThreadCache::~ThreadCache() {
+    flush();
+    tls_dead = true;
+    auto& h = heap();
+    std::lock_guard lock(h.registry_mtx);
+    for (usize cls = 0; cls < CLASS_COUNT; ++cls) {
+        h.retired_allocs[cls] += lists_[cls].allocs.load(std::memory_order_relaxed);
+        h.retired_frees[cls] += lists_[cls].frees.load(std::memory_order_relaxed);
+    }
+    (prev_ != nullptr ? prev_->next_ : h.threads) = next_;
+    if (next_ != nullptr) {
+        next_->prev_ = prev_;
+    }
+}
+
+void* allocate_small(const usize cls) {
+    if (tls_dead) [[unlikely]] {
+        void* p = nullptr;
+        heap().fetch(cls, 1, p);
+        return p;
+    }
+    return tls_cache.allocate(cls);
+}
+
+void deallocate_small(void* p, const usize cls) noexcept {
+    if (tls_dead) [[unlikely]] {
+        next_of(p) = nullptr;
+        heap().release(cls, p, 1);
+        return;
+    }
+    tls_cache.deallocate(p, cls);
+}
+
+} // namespace
+
+void* CachingHeap::allocate(const usize bytes) {
+    if (bytes <= MAX_SMALL_SIZE) [[likely]] {
+        return allocate_small(size_class(bytes));
+    }
+    const usize pages = (bytes + PAGE_SIZE - 1) >> PAGE_SHIFT;
+    return span_address(heap().pages.allocate(pages, NO_CLASS));
+}
+
+void CachingHeap::deallocate(void* p, const usize bytes) noexcept {
+    if (p == nullptr) return;
+    if (bytes <= MAX_SMALL_SIZE) [[likely]] {
+        deallocate_small(p, size_class(bytes));
+        return;
+    }
+    auto& h = heap();
+    h.pages.deallocate(h.pages.lookup(p));
+}
+
+void CachingHeap::deallocate(void* p) noexcept {
+    if (p == nullptr) return;
+    auto& h = heap();
+    Span* span = h.pages.lookup(p);
+    if (span->size_class != NO_CLASS) {
+        deallocate_small(p, span->size_class);
+        return;
+    }
+    h.pages.deallocate(span);
+}
+
+void CachingHeap::flush_thread_cache() noexcept {
+    if (!tls_dead) {
+        tls_cache.flush();
+    }
+}
+
+util::Vec<SizeClassStats> CachingHeap::stats() {
+    auto& h = heap();
+    util::Vec<SizeClassStats> result;
+    result.reserve(CLASS_COUNT);
+    for (usize cls = 0; cls < CLASS_COUNT; ++cls) {
+        SizeClassStats s{};
+        s.size = CLASSES[cls].size;
+        s.span_pages = CLASSES[cls].pages;
+        h.central[cls].stats(s);
+        s.transfer_free = h.transfer[cls].batches() * CLASSES[cls].batch;
+        {
+            std::lock_guard lock(h.registry_mtx);
+            s.allocs = h.retired_allocs[cls];
+            s.frees = h.retired_frees[cls];
+            for (const ThreadCache* t = h.threads; t != nullptr; t = t->next()) {
+                t->stats(cls, s);
+            }
+        }
+        result.push(s);
+    }
+    return result;
+}
+
+PageHeapStats CachingHeap::page_heap_stats() {
+    return heap().pages.stats();
+}
+
+} // namespace my::mem
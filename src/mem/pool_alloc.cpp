@@ -0,0 +1,293 @@
+#include "pool_alloc.hpp"
+
+#include "my_exception.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace my::mem {
+
+struct alignas(64) SizeClassSlab::Slab {
+    Slab* prev;
+    Slab* next;
+    void* free;   // slab 内的空闲链表
+    char* unused; // 尚未切出过的区域起点，新 slab 按顺序切块，不必先串起整条空闲链表
+    usize used;
+    bool linked;  // 是否在可用链表中
+};
+
+static void*& next_of(void* block) noexcept {
+    return *static_cast<void**>(block);
+}
+
+SizeClassSlab::SizeClassSlab(const usize block_size) :
+        block_size_((std::max<usize>(block_size, sizeof(void*)) + 15) & ~usize{15}),
+        blocks_per_slab_((SLAB_SIZE - sizeof(Slab)) / block_size_) {
+    if (blocks_per_slab_ == 0) {
+        throw argument_exception("Block size {} does not fit in a slab", block_size);
+    }
+}
+
+SizeClassSlab::~SizeClassSlab() {
+    // 块全部归还后每个 slab 都在可用链表中
+    for (Slab* s = head_; s != nullptr;) {
+        Slab* next = s->next;
+        free_slab(s);
+        s = next;
+    }
+}
+
+void* SizeClassSlab::allocate() {
+    std::lock_guard lock(mtx_);
+    return allocate_locked();
+}
+
+void SizeClassSlab::deallocate(void* p) noexcept {
+    std::lock_guard lock(mtx_);
+    deallocate_locked(p);
+}
+
+void* SizeClassSlab::allocate_batch(const usize n) {
+    std::lock_guard lock(mtx_);
+    void* head = nullptr;
+    try {
+        for (usize i = 0; i < n; ++i) {
+            void* p = allocate_locked();
+            next_of(p) = head;
+            head = p;
+        }
+    } catch (...) {
+        while (head != nullptr) {
+            void* next = next_of(head);
+            deallocate_locked(head);
+            head = next;
+        }
+        throw;
+    }
+    return head;
+}
+
+void SizeClassSlab::deallocate_batch(void* head, const usize n) noexcept {
+    std::lock_guard lock(mtx_);
+    for (usize i = 0; i < n && head != nullptr; ++i) {
+        void* next = next_of(head);
+        deallocate_locked(head);
+        head = next;
+    }
+}
+
+usize SizeClassSlab::trim() noexcept {
+    std::lock_guard lock(mtx_);
+    usize freed = 0;
+    for (Slab* s = head_; s != nullptr;) {
+        Slab* next = s->next;
+        if (s->used == 0) {
+            unlink(s);
+            free_slab(s);
+            --empty_;
+            ++freed;
+        }
+        s = next;
+    }
+    return freed;
+}
+
+usize SizeClassSlab::slab_count() const {
+    std::lock_guard lock(mtx_);
+    return slabs_;
+}
+
+usize SizeClassSlab::in_use() const {
+    std::lock_guard lock(mtx_);
+    return in_use_;
+}
+
+void* SizeClassSlab::allocate_locked() {
+    Slab* s = head_ != nullptr ? head_ : new_slab();
+    void* p;
+    if (s->free != nullptr) {
+        p = s->free;
+        s->free = next_of(p);
+    } else {
+        p = s->unused;
+        s->unused += block_size_;
+    }
+    if (s->used++ == 0) {
+        --empty_;
+    }
+    ++in_use_;
+    if (s->used == blocks_per_slab_) {
+        unlink(s);
+    }
+    return p;
+}
+
+void SizeClassSlab::deallocate_locked(void* p) noexcept {
+    auto* s = reinterpret_cast<Slab*>(reinterpret_cast<usize>(p) & ~(SLAB_SIZE - 1));
+    --in_use_;
+    if (--s->used == 0) {
+        if (s->linked) {
+            unlink(s);
+        }
+        if (empty_ > 0) {
+            free_slab(s);
+            return;
+        }
+        // 备用的空 slab 从头切块，之前的空闲链表作废
+        s->free = nullptr;
+        s->unused = reinterpret_cast<char*>(s + 1);
+        link_back(s);
+        ++empty_;
+        return;
+    }
+    next_of(p) = s->free;
+    s->free = p;
+    if (!s->linked) {
+        link_front(s);
+    }
+}
+
+SizeClassSlab::Slab* SizeClassSlab::new_slab() {
+    void* mem = ::operator new(SLAB_SIZE, std::align_val_t(SLAB_SIZE));
+    auto* s = static_cast<Slab*>(mem);
+    s->prev = s->next = nullptr;
+    s->free = nullptr;
+    s->unused = reinterpret_cast<char*>(s + 1);
+    s->used = 0;
+    s->linked = false;
+    link_front(s);
+    ++slabs_;
+    ++empty_;
+    return s;
+}
+
+void SizeClassSlab::free_slab(Slab* slab) noexcept {
+    ::operator delete(slab, SLAB_SIZE, std::align_val_t(SLAB_SIZE));
+    --slabs_;
+}
+
+void SizeClassSlab::link_front(Slab* slab) noexcept {
+    slab->prev = nullptr;
+    slab->next = head_;
+    if (head_ != nullptr) {
+        head_->prev = slab;
+    } else {
+        tail_ = slab;
+    }
+    head_ = slab;
+    slab->linked = true;
+}
+
+void SizeClassSlab::link_back(Slab* slab) noexcept {
+    slab->next = nullptr;
+    slab->prev = tail_;
+    if (tail_ != nullptr) {
+        tail_->next = slab;
+    } else {
+        head_ = slab;
+    }
+    tail_ = slab;
+    slab->linked = true;
+}
+
+void SizeClassSlab::unlink(Slab* slab) noexcept {
+    (slab->prev != nullptr ? slab->prev->next : head_) = slab->next;
+    (slab->next != nullptr ? slab->next->prev : tail_) = slab->prev;
+    slab->prev = slab->next = nullptr;
+    slab->linked = false;
+}
+
+namespace {
+
+/**
+ * @brief 每个线程每级一条空闲链表，线程退出时归还共享池
+ */
+struct ThreadCache {
+    struct Bin {
+        void* head{nullptr};
+        usize count{0};
+    };
+
+    std::array<Bin, NodePool::CLASS_COUNT> bins{};
+
+    ~ThreadCache() {
+        flush();
+    }
+
+    void flush() noexcept {
+        for (usize cls = 0; cls < bins.size(); ++cls) {
+            auto& bin = bins[cls];
+            if (bin.count != 0) {
+                NodePool::shared(cls).deallocate_batch(bin.head, bin.count);
+                bin = Bin{};
+            }
+        }
+    }
+};
+
+thread_local ThreadCache tls_cache;
+
+} // namespace
+
+SizeClassSlab& NodePool::shared(const usize cls) noexcept {
+    static SizeClassSlab* pools = [] {
+        auto* p = static_cast<SizeClassSlab*>(::operator new(sizeof(SizeClassSlab) * CLASS_COUNT));
+        for (usize i = 0; i < CLASS_COUNT; ++i) {
+            new (p + i) SizeClassSlab((i + 1) * GRANULE);
+        }
+        return p;
+    }();
+    return pools[cls];
+}
+
+void* NodePool::allocate(const usize cls, const bool cached) {
+    if (!cached) {
+        return shared(cls).allocate();
+    }
+    auto& bin = tls_cache.bins[cls];
+    if (bin.count == 0) {
+        bin.head = shared(cls).allocate_batch(CACHE_BATCH);
+        bin.count = CACHE_BATCH;
+    }
+    void* p = bin.head;
+    bin.head = next_of(p);
+    --bin.count;
+    return p;
+}
+
+void NodePool::deallocate(void* p, const usize cls, const bool cached) noexcept {
+    if (!cached) {
+        shared(cls).deallocate(p);
+        return;
+    }
+    auto& bin = tls_cache.bins[cls];
+    next_of(p) = bin.head;
+    bin.head = p;
+    if (++bin.count < CACHE_CAPACITY) {
+        return;
+    }
+    // 缓存满时留下最近释放的块，把较早的 CACHE_BATCH 块归还共享池
+    void* last = bin.head;
+    for (usize i = 1; i < CACHE_CAPACITY - CACHE_BATCH; ++i) {
+        last = next_of(last);
+    }
+    void* rest = next_of(last);
+    next_of(last) = nullptr;
+    bin.count = CACHE_CAPACITY - CACHE_BATCH;
+    shared(cls).deallocate_batch(rest, CACHE_BATCH);
+}
+
+void NodePool::flush_thread_cache() noexcept {
+    tls_cache.flush();
+}
+
+usize NodePool::trim() noexcept {
+    flush_thread_cache();
+    usize freed = 0;
+    for (usize cls = 0; cls < CLASS_COUNT; ++cls) {
+        freed += shared(cls).trim();
+    }
+    return freed;
+}
+
+} // namespace my::mem
@@ -0,0 +1,195 @@
+#include "stats_alloc.hpp"
+
+#include <atomic>
+#include <mutex>
+
+namespace my::mem {
+
+namespace {
+
+/**
+ * @brief 一个标签的计数器，只由所属线程写入，快照以 relaxed 读取
+ */
+struct Counters {
+    std::atomic<u64> allocs{0};
+    std::atomic<u64> frees{0};
+    std::atomic<u64> bytes_allocated{0};
+    std::atomic<u64> bytes_freed{0};
+    std::atomic<u64> timed_frees{0};
+    std::atomic<u64> lifetime_ns{0};
+    std::array<std::atomic<u64>, AllocStats::SIZE_BUCKETS> sizes{};
+    std::array<std::atomic<u64>, AllocStats::LIFETIME_BUCKETS> lifetimes{};
+
+    void add_to(AllocStats& s) const noexcept {
+        s.allocs += allocs.load(std::memory_order_relaxed);
+        s.frees += frees.load(std::memory_order_relaxed);
+        s.bytes_allocated += bytes_allocated.load(std::memory_order_relaxed);
+        s.bytes_freed += bytes_freed.load(std::memory_order_relaxed);
+        s.timed_frees += timed_frees.load(std::memory_order_relaxed);
+        s.lifetime_ns += lifetime_ns.load(std::memory_order_relaxed);
+        for (usize i = 0; i < s.sizes.size(); ++i) {
+            s.sizes[i] += sizes[i].load(std::memory_order_relaxed);
+        }
+        for (usize i = 0; i < s.lifetimes.size(); ++i) {
+            s.lifetimes[i] += lifetimes[i].load(std::memory_order_relaxed);
+        }
+    }
+};
+
+class ThreadStats;
+
+struct Registry {
+    std::mutex mtx;
+    ThreadStats* threads{nullptr};                      // 存活线程的计数器
+    std::array<AllocStats, ALLOC_TAG_COUNT> retired{}; // 已退出线程的计数
+};
+
+Registry& registry() {
+    static auto* r = new Registry();
+    return *r;
+}
+
+/**
+ * @brief 只有所属线程写入，不需要原子读改写
+ */
+void bump(std::atomic<u64>& counter, const u64 delta) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+void add(u64& counter, const u64 delta) noexcept {
+    counter += delta;
+}
+
+/**
+ * @brief 按统计项更新计数器，Counters 与 AllocStats 共用一套逻辑
+ */
+template <typename C, typename Add>
+void on_alloc(C& c, const usize bytes, Add&& inc) noexcept {
+    inc(c.allocs, 1);
+    inc(c.bytes_allocated, bytes);
+    inc(c.sizes[AllocStats::size_bucket(bytes)], 1);
+}
+
+template <typename C, typename Add>
+void on_free(C& c, const usize bytes, Add&& inc) noexcept {
+    inc(c.frees, 1);
+    inc(c.bytes_freed, bytes);
+}
+
+template <typename C, typename Add>
+void on_lifetime(C& c, const u64 ns, Add&& inc) noexcept {
+    inc(c.timed_frees, 1);
+    inc(c.lifetime_ns, ns);
+    inc(c.lifetimes[AllocStats::lifetime_bucket(ns)], 1);
+}
+
+class ThreadStats {
+public:
+    ThreadStats() {
+        auto& r = registry();
+        std::lock_guard lock(r.mtx);
+        next_ = r.threads;
+        if (next_ != nullptr) {
+            next_->prev_ = this;
+        }
+        r.threads = this;
+    }
+
+    ~ThreadStats();
+
+    Counters& operator[](const AllocTag tag) noexcept {
+        return tags_[static_cast<usize>(tag)];
+    }
+
+    const Counters& operator[](const AllocTag tag) const noexcept {
+        return tags_[static_cast<usize>(tag)];
+    }
+
+    const ThreadStats* next() const noexcept { return next_; }
+
+private:
+    std::array<Counters, ALLOC_TAG_COUNT> tags_;
+    ThreadStats* prev_{nullptr};
+    ThreadStats* next_{nullptr};
+};
+
+thread_local bool tls_dead = false; // 本线程的计数器已析构，之后的记录加锁计入 retired
+thread_local ThreadStats tls_stats;
+
+ThreadStats::~ThreadStats() {
+    tls_dead = true;
+    auto& r = registry();
+    std::lock_guard lock(r.mtx);
+    for (usize i = 0; i < ALLOC_TAG_COUNT; ++i) {
+        tags_[i].add_to(r.retired[i]);
+    }
+    (prev_ != nullptr ? prev_->next_ : r.threads) = next_;
+    if (next_ != nullptr) {
+        next_->prev_ = prev_;
+    }
+}
+
+/**
+ * @brief 线程退出后的记录直接加锁计入 retired
+ */
+template <typename F>
+void record_retired(const AllocTag tag, F&& f) noexcept {
+    auto& r = registry();
+    std::lock_guard lock(r.mtx);
+    f(r.retired[static_cast<usize>(tag)]);
+}
+
+} // namespace
+
+void AllocStatistics::record_alloc(const AllocTag tag, const usize bytes) noexcept {
+    if (tls_dead) [[unlikely]] {
+        record_retired(tag, [&](AllocStats& s) { on_alloc(s, bytes, add); });
+        return;
+    }
+    on_alloc(tls_stats[tag], bytes, bump);
+}
+
+void AllocStatistics::record_free(const AllocTag tag, const usize bytes) noexcept {
+    if (tls_dead) [[unlikely]] {
+        record_retired(tag, [&](AllocStats& s) { on_free(s, bytes, add); });
+        return;
+    }
+    on_free(tls_stats[tag], bytes, bump);
+}
+
+void AllocStatistics::record_free(const AllocTag tag, const usize bytes, const u64 born) noexcept {
+    const u64 now_ns = now();
+    const u64 ns = now_ns > born ? now_ns - born : 0;
+    if (tls_dead) [[unlikely]] {
+        record_retired(tag, [&](AllocStats& s) {
+            on_free(s, bytes, add);
+            on_lifetime(s, ns, add);
+        });
+        return;
+    }
+    auto& c = tls_stats[tag];
+    on_free(c, bytes, bump);
+    on_lifetime(c, ns, bump);
+}
+
+AllocStats AllocStatistics::snapshot(const AllocTag tag) {
+    auto& r = registry();
+    std::lock_guard lock(r.mtx);
+    AllocStats s = r.retired[static_cast<usize>(tag)];
+    s.tag = tag;
+    for (const ThreadStats* t = r.threads; t != nullptr; t = t->next()) {
+        (*t)[tag].add_to(s);
+    }
+    return s;
+}
+
+util::Vec<AllocStats> AllocStatistics::snapshot() {
+    util::Vec<AllocStats> result;
+    result.reserve(ALLOC_TAG_COUNT);
+    for (usize i = 0; i < ALLOC_TAG_COUNT; ++i) {
+        result.push(snapshot(static_cast<AllocTag>(i)));
+    }
+    return result;
+}
+
+} // namespace my::mem
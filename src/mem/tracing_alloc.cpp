@@ -0,0 +1,399 @@
+#include "tracing_alloc.hpp"
+
+#include "process.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <thread>
+
+namespace my::mem {
+
+namespace {
+
+/**
+ * @brief 每个线程的采样状态，平凡析构，线程退出与静态析构期间仍可使用
+ */
+struct Sampler {
+    u64 rng;        // xorshift64* 状态
+    usize interval; // 抽取 until 时的采样间隔
+    usize until;    // 距下一次采样还剩的字节数
+    bool ready;
+
+    double uniform() noexcept {
+        rng ^= rng >> 12;
+        rng ^= rng << 25;
+        rng ^= rng >> 27;
+        // 取高 53 位，落在 (0, 1]
+        return static_cast<double>(((rng * 0x2545F4914F6CDD1DULL) >> 11) + 1) * 0x1.0p-53;
+    }
+
+    /**
+     * @brief 抽取下一次采样前的字节数，服从均值为 interval 的指数分布
+     */
+    void draw(const usize mean) noexcept {
+        interval = mean;
+        const double next = -std::log(uniform()) * static_cast<double>(mean);
+        until = static_cast<usize>(std::min(next, 0x1.0p62)) + 1;
+    }
+};
+
+thread_local Sampler tls_sampler{};
+thread_local usize tls_stripe = static_cast<usize>(-1);
+
+std::atomic<usize> next_stripe{0};
+
+u64 hash_ptr(const void* ptr) noexcept {
+    return (reinterpret_cast<u64>(ptr) >> 4) * 0x9E3779B97F4A7C15ULL;
+}
+
+u64 hash_frames(void* const* frames, const usize n) noexcept {
+    u64 h = 0xcbf29ce484222325ULL;
+    for (usize i = 0; i < n; ++i) {
+        h ^= reinterpret_cast<u64>(frames[i]);
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+std::string format_now(const std::chrono::system_clock::time_point now) {
+    const auto t = std::chrono::system_clock::to_time_t(now);
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
+    return std::format("{}.{:03d}", format_time(time_conv(t), "%T"), static_cast<int>(ms.count()));
+}
+
+} // namespace
+
+MemoryTracer::MemoryTracer() {
+    // 注册退出时报告函数，只在详细模式下输出
+    std::atexit([]() {
+        auto& tracer = instance();
+        if (tracer.verbose_.load(std::memory_order_relaxed) && !tracer.reported_.exchange(true)) {
+            tracer.report_leaks();
+        }
+    });
+}
+
+MemoryTracer& MemoryTracer::instance() {
+    static auto* tracer = new MemoryTracer();
+    return *tracer;
+}
+
+void MemoryTracer::trace_alloc(void* ptr, const usize size) {
+    if (tls_stripe == static_cast<usize>(-1)) {
+        tls_stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % STRIPE_COUNT;
+    }
+    auto& stripe = stripes_[tls_stripe];
+    stripe.allocated.fetch_add(size, std::memory_order_relaxed);
+    stripe.allocs.fetch_add(1, std::memory_order_relaxed);
+
+    const usize interval = interval_.load(std::memory_order_relaxed);
+    if (interval != 0) {
+        auto& sampler = tls_sampler;
+        if (!sampler.ready || sampler.interval != interval) [[unlikely]] {
+            if (!sampler.ready) {
+                sampler.rng = hash_ptr(&sampler) ^ static_cast<u64>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+                sampler.rng |= 1;
+                sampler.ready = true;
+            }
+            sampler.draw(interval);
+        }
+        if (size < sampler.until) [[likely]] {
+            sampler.until -= size;
+            return;
+        }
+        sampler.draw(interval);
+    }
+    record_sample(ptr, size);
+}
+
+void MemoryTracer::trace_dealloc(void* ptr, const usize size) {
+    if (tls_stripe == static_cast<usize>(-1)) {
+        tls_stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % STRIPE_COUNT;
+    }
+    auto& stripe = stripes_[tls_stripe];
+    stripe.deallocated.fetch_add(size, std::memory_order_relaxed);
+
+    // 绝大多数指针没有被采样，过滤器为 0 时不必加锁
+    const u64 h = hash_ptr(ptr);
+    auto& slot = filter_[(h >> 16) & (FILTER_SIZE - 1)];
+    if (slot.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    auto& shard = samples_[h >> 58];
+    AllocationRecord record;
+    {
+        std::lock_guard lock(shard.mtx);
+        const auto it = shard.live.find(ptr);
+        if (it == shard.live.end()) {
+            return;
+        }
+        record = it->second;
+        shard.live.erase(it);
+        slot.fetch_sub(1, std::memory_order_relaxed);
+    }
+    live_samples_.fetch_sub(1, std::memory_order_relaxed);
+    live_estimate_.fetch_sub(record.weight, std::memory_order_relaxed);
+
+    if (verbose_.load(std::memory_order_relaxed)) {
+        std::cout << std::format(
+            "[FREE] {} ID: {} Size: {} bytes Time: {} Current: {} bytes\n",
+            ptr,
+            record.id,
+            record.size,
+            format_now(std::chrono::system_clock::now()),
+            current());
+    }
+}
+
+void MemoryTracer::record_sample(void* ptr, const usize size) {
+    const usize interval = interval_.load(std::memory_order_relaxed);
+    usize weight = size;
+    if (interval != 0 && size != 0) {
+        // 大小为 size 的分配被采到的概率为 1 - e^(-size/interval)，按其倒数折算
+        const double p = -std::expm1(-static_cast<double>(size) / static_cast<double>(interval));
+        weight = static_cast<usize>(static_cast<double>(size) / p + 0.5);
+    }
+
+    void* frames[MAX_FRAMES];
+    const usize depth = plat::process::capture_stack(frames, MAX_FRAMES, 2);
+    const u64 stack = hash_frames(frames, depth);
+    {
+        auto& shard = stacks_[stack >> 58];
+        std::lock_guard lock(shard.mtx);
+        auto [it, inserted] = shard.traces.try_emplace(stack);
+        if (inserted) {
+            it->second.frames.assign(frames, frames + depth);
+        }
+        ++it->second.samples;
+        it->second.bytes += size;
+    }
+
+    const auto now = std::chrono::system_clock::now();
+    const AllocationRecord record{sample_count_.fetch_add(1, std::memory_order_relaxed) + 1, size, weight, now, stack};
+    const u64 h = hash_ptr(ptr);
+    {
+        auto& shard = samples_[h >> 58];
+        std::lock_guard lock(shard.mtx);
+        auto [it, inserted] = shard.live.try_emplace(ptr, record);
+        if (!inserted) {
+            // 同一地址未经 trace_dealloc 再次分配，旧样本作废
+            live_samples_.fetch_sub(1, std::memory_order_relaxed);
+            live_estimate_.fetch_sub(it->second.weight, std::memory_order_relaxed);
+            it->second = record;
+        } else {
+            filter_[(h >> 16) & (FILTER_SIZE - 1)].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    live_samples_.fetch_add(1, std::memory_order_relaxed);
+    live_estimate_.fetch_add(weight, std::memory_order_relaxed);
+    update_peak();
+
+    if (verbose_.load(std::memory_order_relaxed)) {
+        std::cout << std::format(
+            "[ALLOC] {} ID: {} Size: {} bytes Time: {} Current: {} bytes Peak: {} bytes\n",
+            ptr,
+            record.id,
+            size,
+            format_now(now),
+            current(),
+            peak_memory_.load(std::memory_order_relaxed));
+    }
+}
+
+void MemoryTracer::set_sample_interval(const usize bytes) noexcept {
+    interval_.store(bytes, std::memory_order_relaxed);
+}
+
+usize MemoryTracer::sample_interval() const noexcept {
+    return interval_.load(std::memory_order_relaxed);
+}
+
+TracerStats MemoryTracer::stats() const {
+    TracerStats s{};
+    for (const auto& stripe : stripes_) {
+        s.total_allocated += stripe.allocated.load(std::memory_order_relaxed);
+        s.total_deallocated += stripe.deallocated.load(std::memory_order_relaxed);
+        s.allocs += stripe.allocs.load(std::memory_order_relaxed);
+    }
+    s.current = s.total_allocated > s.total_deallocated ? s.total_allocated - s.total_deallocated : 0;
+    update_peak();
+    s.peak = std::max(peak_memory_.load(std::memory_order_relaxed), s.current);
+    s.samples = sample_count_.load(std::memory_order_relaxed);
+    s.live_samples = live_samples_.load(std::memory_order_relaxed);
+    s.live_estimate = live_estimate_.load(std::memory_order_relaxed);
+    return s;
+}
+
+std::string MemoryTracer::heap_profile(const ProfileFormat format) const {
+    struct Site {
+        usize count{0};
+        usize bytes{0};
+        usize weight{0};
+    };
+
+    // 逐片加锁，按调用栈汇总存活样本
+    std::map<u64, Site> sites;
+    for (const auto& shard : samples_) {
+        std::lock_guard lock(shard.mtx);
+        for (const auto& [ptr, record] : shard.live) {
+            auto& site = sites[record.stack];
+            ++site.count;
+            site.bytes += record.size;
+            site.weight += record.weight;
+        }
+    }
+
+    auto frames_of = [this](const u64 stack, auto&& fn) {
+        const auto& shard = stacks_[stack >> 58];
+        std::lock_guard lock(shard.mtx);
+        const auto it = shard.traces.find(stack);
+        if (it != shard.traces.end()) {
+            fn(it->second);
+        }
+    };
+
+    std::string out;
+    if (format == ProfileFormat::Pprof) {
+        usize live_count = 0, live_bytes = 0, alloc_count = 0, alloc_bytes = 0;
+        for (const auto& [stack, site] : sites) {
+            live_count += site.count;
+            live_bytes += site.bytes;
+        }
+        for (const auto& shard : stacks_) {
+            std::lock_guard lock(shard.mtx);
+            for (const auto& [stack, trace] : shard.traces) {
+                alloc_count += trace.samples;
+                alloc_bytes += trace.bytes;
+            }
+        }
+
+        const usize interval = sample_interval();
+        out += std::format("heap profile: {}: {} [{}: {}] @ ", live_count, live_bytes, alloc_count, alloc_bytes);
+        out += interval == 0 ? std::string("heap\n") : std::format("heap_v2/{}\n", interval);
+        for (const auto& [stack, site] : sites) {
+            frames_of(stack, [&](const StackTrace& trace) {
+                out += std::format("{}: {} [{}: {}] @", site.count, site.bytes, trace.samples, trace.bytes);
+                for (void* frame : trace.frames) {
+                    out += std::format(" {}", frame);
+                }
+                out += '\n';
+            });
+        }
+        out += "\nMAPPED_LIBRARIES:\n";
+        out += plat::process::memory_maps();
+        return out;
+    }
+
+    std::unordered_map<void*, std::string> symbols;
+    for (const auto& [stack, site] : sites) {
+        frames_of(stack, [&](const StackTrace& trace) {
+            std::string line;
+            for (auto it = trace.frames.rbegin(); it != trace.frames.rend(); ++it) {
+                auto [sym, inserted] = symbols.try_emplace(*it);
+                if (inserted) {
+                    sym->second = plat::process::symbolize(*it);
+                    // 折叠格式以 ';' 分隔帧、以最后一个空格分隔计数
+                    std::ranges::replace(sym->second, ';', ':');
+                    std::ranges::replace(sym->second, ' ', '_');
+                }
+                if (!line.empty()) line += ';';
+                line += sym->second;
+            }
+            if (line.empty()) line = "[unknown]";
+            out += std::format("{} {}\n", line, site.weight);
+        });
+    }
+    return out;
+}
+
+bool MemoryTracer::dump_heap_profile(const char* path, const ProfileFormat format) const {
+    const std::string profile = heap_profile(format);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(profile.data(), static_cast<std::streamsize>(profile.size()));
+    return static_cast<bool>(file.flush());
+}
+
+void MemoryTracer::report_leaks() const {
+    std::vector<std::pair<void*, AllocationRecord>> live;
+    for (const auto& shard : samples_) {
+        std::lock_guard lock(shard.mtx);
+        live.insert(live.end(), shard.live.begin(), shard.live.end());
+    }
+    std::ranges::sort(live, {}, [](const auto& entry) { return entry.second.id; });
+
+    const usize interval = sample_interval();
+    if (live.empty()) {
+        std::cout << "\n[TRACKER] No memory leaks detected\n";
+    } else {
+        std::cout << std::format("\n[TRACKER] Memory leaks detected: {} {}\n",
+                                 live.size(),
+                                 interval == 0 ? "allocations" : "sampled allocations");
+        for (const auto& [ptr, record] : live) {
+            std::cout << std::format("  Leak #{} at {} - Size: {} bytes Allocated at: {}\n",
+                                     record.id,
+                                     ptr,
+                                     record.size,
+                                     format_now(record.time));
+            const auto& shard = stacks_[record.stack >> 58];
+            std::lock_guard lock(shard.mtx);
+            const auto it = shard.traces.find(record.stack);
+            if (it == shard.traces.end()) continue;
+            for (void* frame : it->second.frames) {
+                std::cout << "    at " << plat::process::symbolize(frame) << '\n';
+            }
+        }
+    }
+
+    // 打印内存统计摘要
+    const TracerStats s = stats();
+    std::cout << std::format(
+        "\n[TRACKER] Memory usage summary:\n"
+        "  Current memory:   {} bytes\n"
+        "  Peak memory:      {} bytes\n"
+        "  Total allocated:  {} bytes\n"
+        "  Total deallocated:{} bytes\n"
+        "  Net memory:       {} bytes\n"
+        "  Sampled:          {} of {} allocations (interval {} bytes)\n"
+        "  Live estimate:    {} bytes\n",
+        s.current,
+        s.peak,
+        s.total_allocated,
+        s.total_deallocated,
+        s.total_allocated - s.total_deallocated,
+        s.samples,
+        s.allocs,
+        interval,
+        s.live_estimate);
+}
+
+void MemoryTracer::set_verbose(const bool verbose) noexcept {
+    verbose_.store(verbose, std::memory_order_relaxed);
+}
+
+void MemoryTracer::update_peak() const noexcept {
+    const usize cur = current();
+    usize peak = peak_memory_.load(std::memory_order_relaxed);
+    while (cur > peak && !peak_memory_.compare_exchange_weak(peak, cur, std::memory_order_relaxed)) {}
+}
+
+usize MemoryTracer::current() const noexcept {
+    usize allocated = 0, deallocated = 0;
+    for (const auto& stripe : stripes_) {
+        allocated += stripe.allocated.load(std::memory_order_relaxed);
+        deallocated += stripe.deallocated.load(std::memory_order_relaxed);
+    }
+    // 各条带分别读取，并发时释放可能先于对应的分配被读到
+    return allocated > deallocated ? allocated - deallocated : 0;
+}
+
+} // namespace my::mem
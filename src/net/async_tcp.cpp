@@ -0,0 +1,192 @@
+/**
+ * @brief 基于事件循环的非阻塞 TCP 实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/async_tcp.hpp"
+
+namespace my::net {
+
+AsyncTcpListener::AsyncTcpListener(EventLoop& event_loop, str::StringView ip, u16 port, i32 backlog) :
+        loop_(&event_loop), handle_(nullptr, plat::net::close) {
+    plat::net::startup();
+    handle_.reset(plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream));
+    plat::net::bind(handle_.get(), ip, port);
+    plat::net::get_local_addr(handle_.get(), local_ip_, local_port_);
+    plat::net::listen(handle_.get(), backlog);
+    source_ = loop_->watch(handle_.get());
+}
+
+AsyncTcpListener::AsyncTcpListener(EventLoop& event_loop, plat::net::SocketHandle* h) :
+        loop_(&event_loop), handle_(h, plat::net::close) {
+    plat::net::get_local_addr(handle_.get(), local_ip_, local_port_);
+    source_ = loop_->watch(handle_.get());
+}
+
+AsyncTcpListener::~AsyncTcpListener() {
+    close();
+}
+
+str::String<> AsyncTcpListener::local_ip() const {
+    return local_ip_;
+}
+
+u16 AsyncTcpListener::local_port() const {
+    return local_port_;
+}
+
+coro::Task<std::unique_ptr<AsyncTcpStream>> AsyncTcpListener::accept() {
+    loop {
+        if (!is_open()) {
+            throw network_exception("Listener is closed");
+        }
+        if (auto* client = plat::net::try_accept(handle_.get())) {
+            co_return std::make_unique<AsyncTcpStream>(*loop_, client);
+        }
+        source_->ready.readable = false;
+        co_await loop_->readable(source_);
+    }
+}
+
+void AsyncTcpListener::close() {
+    if (source_ != nullptr) {
+        loop_->unwatch(std::exchange(source_, nullptr));
+    }
+    handle_.reset();
+}
+
+bool AsyncTcpListener::is_open() const {
+    return source_ != nullptr && plat::net::is_valid(handle_.get());
+}
+
+std::unique_ptr<AsyncTcpStream> AsyncTcpStream::connect(EventLoop& event_loop, str::StringView ip, u16 port) {
+    plat::net::startup();
+    std::unique_ptr<plat::net::SocketHandle, void (*)(plat::net::SocketHandle*)> h(
+        plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream), plat::net::close);
+    plat::net::connect(h.get(), ip, port);
+    return std::make_unique<AsyncTcpStream>(event_loop, h.release());
+}
+
+AsyncTcpStream::AsyncTcpStream(EventLoop& event_loop, plat::net::SocketHandle* h) :
+        loop_(&event_loop), handle_(h, plat::net::close) {
+    source_ = loop_->watch(handle_.get());
+}
+
+AsyncTcpStream::~AsyncTcpStream() {
+    close();
+}
+
+coro::Task<usize> AsyncTcpStream::read_some(char* buf, usize size) {
+    loop {
+        ensure_usable();
+        if (auto n = plat::net::try_recv(handle_.get(), buf, size); n.is_some()) {
+            touch();
+            co_return n.unwrap();
+        }
+        source_->ready.readable = false;
+        co_await loop_->readable(source_);
+    }
+}
+
+coro::Task<str::String<>> AsyncTcpStream::read(usize max_size) {
+    util::Vec<char> buf(max_size);
+    const usize n = co_await read_some(buf.data(), max_size);
+    co_return n == 0 ? str::String<>{} : str::String<>(buf.data(), n);
+}
+
+coro::Task<usize> AsyncTcpStream::write(str::StringView data) {
+    const usize total = data.len();
+    const auto* ptr = reinterpret_cast<const char*>(data.as_bytes());
+    usize written = 0;
+    while (written < total) {
+        ensure_usable();
+        if (auto n = plat::net::try_send(handle_.get(), ptr + written, total - written); n.is_some()) {
+            written += n.unwrap();
+            touch();
+            continue;
+        }
+        source_->ready.writable = false;
+        co_await loop_->writable(source_);
+    }
+    co_return total;
+}
+
+coro::Task<usize> AsyncTcpStream::write_vectored(plat::IoSlice* slices, usize n) {
+    usize total = 0;
+    while (n > 0) {
+        if (slices->size == 0) {
+            ++slices, --n;
+            continue;
+        }
+        ensure_usable();
+        auto sent = plat::net::try_send_vectored(handle_.get(), slices, n);
+        if (sent.is_none()) {
+            source_->ready.writable = false;
+            co_await loop_->writable(source_);
+            continue;
+        }
+        touch();
+        usize written = sent.unwrap();
+        total += written;
+        while (n > 0 && written >= slices->size) {
+            written -= slices->size;
+            ++slices, --n;
+        }
+        if (n > 0) {
+            slices->data += written;
+            slices->size -= written;
+        }
+    }
+    co_return total;
+}
+
+void AsyncTcpStream::set_idle_timeout(const u64 idle_ms) {
+    cancel_idle_timer();
+    idle_ms_ = idle_ms;
+    timed_out_ = false;
+    if (idle_ms_ == 0 || source_ == nullptr) return;
+
+    idle_timer_ = loop_->call_after(idle_ms_, [this]() {
+        has_idle_timer_ = false;
+        timed_out_ = true;
+        loop_->interrupt(source_);
+    });
+    has_idle_timer_ = true;
+}
+
+void AsyncTcpStream::close() {
+    cancel_idle_timer();
+    if (source_ != nullptr) {
+        loop_->unwatch(std::exchange(source_, nullptr));
+    }
+    handle_.reset();
+}
+
+bool AsyncTcpStream::is_open() const {
+    return source_ != nullptr && plat::net::is_valid(handle_.get());
+}
+
+void AsyncTcpStream::touch() {
+    if (has_idle_timer_) {
+        loop_->reset_timer(idle_timer_, idle_ms_);
+    }
+}
+
+void AsyncTcpStream::ensure_usable() const {
+    if (!is_open()) {
+        throw network_exception("Connection is closed");
+    }
+    if (timed_out_) {
+        throw network_exception("Connection idle timeout");
+    }
+}
+
+void AsyncTcpStream::cancel_idle_timer() {
+    if (has_idle_timer_) {
+        loop_->cancel_timer(idle_timer_);
+        has_idle_timer_ = false;
+    }
+}
+
+} // namespace my::net
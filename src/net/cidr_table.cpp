@@ -0,0 +1,217 @@
+/**
+ * @brief 最长前缀匹配的 CIDR 路由表实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/cidr_table.hpp"
+
+#include <algorithm>
+
+namespace my::net::detail {
+
+namespace {
+
+/**
+ * @brief 清零 (hi, lo) 中 len 位之后的主机位
+ */
+void mask_host_bits(u64& hi, u64& lo, const u32 len) {
+    if (len == 0) {
+        hi = lo = 0;
+    } else if (len < 64) {
+        hi &= ~0ull << (64 - len);
+        lo = 0;
+    } else if (len == 64) {
+        lo = 0;
+    } else if (len < 128) {
+        lo &= ~0ull << (128 - len);
+    }
+}
+
+} // namespace
+
+PrefixTrie::PrefixTrie(const u32 width) :
+        width_(width), direct_(1uz << DIRECT_BITS) {
+    for (auto& e : direct_) {
+        e = LEAF | NONE;
+    }
+}
+
+void PrefixTrie::add(u64 hi, u64 lo, const u32 len, const u32 value) {
+    if (len > width_) {
+        throw argument_exception("Prefix length {} exceeds address width {}", len, width_);
+    }
+    mask_host_bits(hi, lo, len);
+    staged_.push(Prefix{hi, lo, len, value});
+}
+
+void PrefixTrie::build() {
+    // 按地址、长度排序；同一前缀保留最后加入的（值下标最大）
+    sorted_.clear();
+    for (const auto& p : staged_) {
+        sorted_.push(p);
+    }
+    std::sort(sorted_.begin(), sorted_.end(), [](const Prefix& a, const Prefix& b) {
+        if (a.hi != b.hi) return a.hi < b.hi;
+        if (a.lo != b.lo) return a.lo < b.lo;
+        if (a.len != b.len) return a.len < b.len;
+        return a.value > b.value;
+    });
+    util::Vec<Prefix> unique;
+    for (const auto& p : sorted_) {
+        if (unique.is_empty() || unique.last().hi != p.hi || unique.last().lo != p.lo || unique.last().len != p.len) {
+            unique.push(p);
+        }
+    }
+
+    // 不超过 16 位的前缀按长度从短到长直接涂到索引表上，长的覆盖短的
+    util::Vec<u32> best(1uz << DIRECT_BITS);
+    for (auto& b : best) {
+        b = NONE;
+    }
+    util::Vec<Prefix> shorts;
+    sorted_.clear();
+    for (const auto& p : unique) {
+        (p.len <= DIRECT_BITS ? shorts : sorted_).push(p);
+    }
+    std::stable_sort(shorts.begin(), shorts.end(), [](const Prefix& a, const Prefix& b) { return a.len < b.len; });
+    for (const auto& p : shorts) {
+        const usize start = p.hi >> (64 - DIRECT_BITS);
+        const usize span = 1uz << (DIRECT_BITS - p.len);
+        for (usize i = start; i < start + span; ++i) {
+            best.at(i) = p.value;
+        }
+    }
+
+    // 更长的前缀按高 16 位分组，每组生成一棵子树
+    nodes_.clear();
+    leaves_.clear();
+    for (usize i = 0; i < direct_.len(); ++i) {
+        direct_.at(i) = LEAF | best.at(i);
+    }
+    for (usize first = 0; first < sorted_.len();) {
+        const u64 top = sorted_.at(first).hi >> (64 - DIRECT_BITS);
+        usize last = first + 1;
+        while (last < sorted_.len() && sorted_.at(last).hi >> (64 - DIRECT_BITS) == top) {
+            ++last;
+        }
+        const auto index = static_cast<u32>(nodes_.len());
+        nodes_.push(Node{});
+        build_node(index, first, last, DIRECT_BITS, best.at(top));
+        direct_.at(top) = index;
+        first = last;
+    }
+    sorted_.clear();
+}
+
+void PrefixTrie::build_node(const u32 index, const usize first, const usize last, const u32 depth, const u32 inherited) {
+    // sorted_[first, last) 中的前缀长度都大于 depth 且前 depth 位相同
+    u32 slot_value[64];
+    u32 slot_len[64];
+    for (usize s = 0; s < 64; ++s) {
+        slot_value[s] = inherited;
+        slot_len[s] = 0;
+    }
+    u64 vector = 0;
+    for (usize i = first; i < last; ++i) {
+        const auto& p = sorted_.at(i);
+        const u32 c = chunk(p.hi, p.lo, depth);
+        if (p.len > depth + STRIDE) {
+            vector |= 1ull << c;
+            continue;
+        }
+        const u32 span = 1u << (depth + STRIDE - p.len);
+        for (u32 s = c; s < c + span; ++s) {
+            if (p.len >= slot_len[s]) {
+                slot_value[s] = p.value;
+                slot_len[s] = p.len;
+            }
+        }
+    }
+
+    const auto base1 = static_cast<u32>(nodes_.len());
+    for (int k = std::popcount(vector); k > 0; --k) {
+        nodes_.push(Node{});
+    }
+    const auto base0 = static_cast<u32>(leaves_.len());
+    u64 leafvec = 0;
+    bool has_prev = false;
+    u32 prev = 0;
+    for (u32 s = 0; s < 64; ++s) {
+        if (vector >> s & 1) continue;
+        if (!has_prev || slot_value[s] != prev) {
+            leafvec |= 1ull << s;
+            leaves_.push(slot_value[s]);
+            prev = slot_value[s];
+            has_prev = true;
+        }
+    }
+    nodes_.at(index) = Node{vector, leafvec, base0, base1};
+
+    // 地址有序，因此同一分支的长前缀相邻
+    u32 child = base1;
+    for (usize i = first; i < last;) {
+        const auto& p = sorted_.at(i);
+        const u32 c = chunk(p.hi, p.lo, depth);
+        usize end = i;
+        while (end < last && chunk(sorted_.at(end).hi, sorted_.at(end).lo, depth) == c) {
+            ++end;
+        }
+        if (vector >> c & 1) {
+            usize begin = i;
+            while (begin < end && sorted_.at(begin).len <= depth + STRIDE) {
+                ++begin;
+            }
+            build_node(child++, begin, end, depth + STRIDE, slot_value[c]);
+        }
+        i = end;
+    }
+}
+
+void PrefixTrie::lookup_batch(const u64* his, const u64* los, const usize n, u32* out) const noexcept {
+    const u32* direct = direct_.data();
+    for (usize i = 0; i < n; ++i) {
+        out[i] = direct[his[i] >> (64 - DIRECT_BITS)];
+    }
+    for (usize i = 0; i < n; ++i) {
+        out[i] = (out[i] & LEAF) ? out[i] & ~LEAF : descend(out[i], his[i], los[i]);
+    }
+}
+
+ParsedCidr parse_cidr(const str::StringView cidr) {
+    const auto slash = cidr.find("/"_sv);
+    if (slash.is_none()) {
+        throw argument_exception("Missing prefix length in '{}'", cidr);
+    }
+    const auto addr = cidr.slice(0, slash.unwrap());
+    const auto len_str = cidr.slice(slash.unwrap() + 1);
+    u32 len = 0;
+    if (len_str.len() == 0 || len_str.len() > 3) {
+        throw argument_exception("Invalid prefix length in '{}'", cidr);
+    }
+    for (usize i = 0; i < len_str.len(); ++i) {
+        const u32 d = static_cast<u32>(len_str[i]) - '0';
+        if (d >= 10) {
+            throw argument_exception("Invalid prefix length in '{}'", cidr);
+        }
+        len = len * 10 + d;
+    }
+
+    ParsedCidr res{};
+    res.len = len;
+    if (addr.find(":"_sv).is_some()) {
+        if (len > 128) {
+            throw argument_exception("IPv6 prefix length {} exceeds 128", len);
+        }
+        res.v6 = true;
+        split_ipv6(Ipv6Addr::from_str(addr), res.hi, res.lo);
+    } else {
+        if (len > 32) {
+            throw argument_exception("IPv4 prefix length {} exceeds 32", len);
+        }
+        res.hi = static_cast<u64>(Ipv4Addr::from_str(addr).to_u32()) << 32;
+    }
+    return res;
+}
+
+} // namespace my::net::detail
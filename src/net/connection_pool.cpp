@@ -0,0 +1,227 @@
+/**
+ * @brief 客户端 TCP 连接池实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/connection_pool.hpp"
+
+#include <string_view>
+
+namespace my::net {
+
+namespace {
+
+u64 now_ms() {
+    using namespace std::chrono;
+    return static_cast<u64>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+struct PooledStream::Endpoint {
+    struct Idle {
+        std::unique_ptr<TcpStream> stream;
+        u64 since_ms;
+    };
+
+    str::String<> ip;
+    u16 port;
+    std::mutex* mtx;             // 所属分片的锁，保护以下字段
+    util::VecDeque<Idle> idle;   // 队头最旧，队尾最近归还
+    usize total{0};              // 空闲与借出的连接总数
+
+    Endpoint(const str::StringView ip, const u16 port, std::mutex* mtx) :
+            ip(ip), port(port), mtx(mtx) {}
+};
+
+struct alignas(64) ConnectionPool::Shard {
+    std::mutex mtx;
+    util::Vec<std::unique_ptr<Endpoint>> endpoints; // 端点不删除，借出的连接可安全持有其指针
+    std::atomic<u64> hits{0};
+    std::atomic<u64> misses{0};
+    std::atomic<u64> stale{0};
+
+    /**
+     * @brief 查找或创建端点，需持有 mtx
+     */
+    Endpoint* endpoint(const str::StringView ip, const u16 port) {
+        for (auto& ep : endpoints) {
+            if (ep->port == port && ep->ip == ip) {
+                return ep.get();
+            }
+        }
+        endpoints.push(std::make_unique<Endpoint>(ip, port, &mtx));
+        return endpoints.last().get();
+    }
+};
+
+PooledStream::PooledStream(PooledStream&& other) noexcept :
+        pool_(other.pool_), endpoint_(other.endpoint_), stream_(std::move(other.stream_)), reused_(other.reused_) {}
+
+PooledStream& PooledStream::operator=(PooledStream&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = other.pool_;
+        endpoint_ = other.endpoint_;
+        stream_ = std::move(other.stream_);
+        reused_ = other.reused_;
+    }
+    return *this;
+}
+
+PooledStream::~PooledStream() {
+    release();
+}
+
+void PooledStream::discard() {
+    if (stream_) {
+        stream_.reset();
+        pool_->forget(endpoint_);
+    }
+}
+
+void PooledStream::release() {
+    if (stream_) {
+        pool_->release(endpoint_, std::move(stream_));
+    }
+}
+
+ConnectionPool::ConnectionPool(const PoolConfig config, const usize shards) : config_(config) {
+    for (usize i = 0; i < std::max<usize>(shards, 1); ++i) {
+        shards_.push(std::make_unique<Shard>());
+    }
+}
+
+ConnectionPool::~ConnectionPool() = default;
+
+PooledStream ConnectionPool::acquire(const str::StringView ip, const u16 port) {
+    auto& shard = shard_for(ip, port);
+    loop {
+        Endpoint* ep;
+        std::unique_ptr<TcpStream> candidate;
+        u64 since = 0;
+        {
+            std::lock_guard<std::mutex> lock(shard.mtx);
+            ep = shard.endpoint(ip, port);
+            if (auto idle = ep->idle.pop_back(); idle.is_some()) {
+                candidate = std::move(idle.unwrap().stream);
+                since = idle.unwrap().since_ms;
+            } else if (ep->total >= config_.max_total) {
+                throw runtime_exception("Connection pool exhausted for {}:{} ({} connections)", ip, port, ep->total);
+            } else {
+                ++ep->total; // 先占位，建连失败时归还
+            }
+        }
+
+        if (!candidate) {
+            shard.misses.fetch_add(1, std::memory_order_relaxed);
+            try {
+                return PooledStream(this, ep, std::make_unique<TcpStream>(ip, port), false);
+            } catch (...) {
+                forget(ep);
+                throw;
+            }
+        }
+        if (!expired(since, now_ms()) && candidate->is_alive()) {
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return PooledStream(this, ep, std::move(candidate), true);
+        }
+        shard.stale.fetch_add(1, std::memory_order_relaxed);
+        candidate.reset();
+        forget(ep);
+    }
+}
+
+usize ConnectionPool::evict_idle() {
+    const u64 now = now_ms();
+    usize evicted = 0;
+    for (auto& shard : shards_) {
+        util::Vec<std::unique_ptr<TcpStream>> closing;
+        {
+            std::lock_guard<std::mutex> lock(shard->mtx);
+            for (auto& ep : shard->endpoints) {
+                while (!ep->idle.is_empty() && expired(ep->idle.front().since_ms, now)) {
+                    closing.push(std::move(ep->idle.pop_front().unwrap().stream));
+                    --ep->total;
+                }
+            }
+        }
+        evicted += closing.len(); // 在锁外关闭
+    }
+    return evicted;
+}
+
+u64 ConnectionPool::hits() const noexcept {
+    u64 sum = 0;
+    for (const auto& shard : shards_) {
+        sum += shard->hits.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+u64 ConnectionPool::misses() const noexcept {
+    u64 sum = 0;
+    for (const auto& shard : shards_) {
+        sum += shard->misses.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+u64 ConnectionPool::stale() const noexcept {
+    u64 sum = 0;
+    for (const auto& shard : shards_) {
+        sum += shard->stale.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+usize ConnectionPool::idle_count() const {
+    usize sum = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mtx);
+        for (const auto& ep : shard->endpoints) {
+            sum += ep->idle.len();
+        }
+    }
+    return sum;
+}
+
+ConnectionPool::Shard& ConnectionPool::shard_for(const str::StringView ip, const u16 port) {
+    const std::string_view key(reinterpret_cast<const char*>(ip.as_bytes()), ip.len());
+    const usize hash = std::hash<std::string_view>{}(key) ^ (static_cast<usize>(port) * 0x9e3779b97f4a7c15ull);
+    return *shards_.at(hash % shards_.len());
+}
+
+void ConnectionPool::release(Endpoint* endpoint, std::unique_ptr<TcpStream> stream) {
+    if (!stream->is_open()) {
+        forget(endpoint);
+        return;
+    }
+    const u64 now = now_ms();
+    util::Vec<std::unique_ptr<TcpStream>> closing;
+    {
+        std::lock_guard<std::mutex> lock(*endpoint->mtx);
+        while (!endpoint->idle.is_empty() && expired(endpoint->idle.front().since_ms, now)) {
+            closing.push(std::move(endpoint->idle.pop_front().unwrap().stream));
+            --endpoint->total;
+        }
+        if (endpoint->idle.len() < config_.max_idle) {
+            endpoint->idle.push_back(Endpoint::Idle{std::move(stream), now});
+        } else {
+            --endpoint->total;
+        }
+    }
+    // stream 未入队时在此处关闭，与 closing 一样都在锁外
+}
+
+void ConnectionPool::forget(Endpoint* endpoint) {
+    std::lock_guard<std::mutex> lock(*endpoint->mtx);
+    --endpoint->total;
+}
+
+bool ConnectionPool::expired(const u64 idle_since_ms, const u64 now) const noexcept {
+    return config_.idle_timeout_ms > 0 && now - idle_since_ms >= config_.idle_timeout_ms;
+}
+
+} // namespace my::net
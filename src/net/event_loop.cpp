@@ -0,0 +1,262 @@
+/**
+ * @brief 基于 epoll 的单线程事件循环实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/event_loop.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace my::net {
+
+coro::detail::Detached spawn_driver(coro::Task<> task, EventLoop* event_loop) {
+    try {
+        co_await std::move(task);
+    } catch (...) {
+        if (!event_loop->error_) {
+            event_loop->error_ = std::current_exception();
+        }
+    }
+    co_return nullptr;
+}
+
+EventLoop::EventLoop() :
+        poller_(nullptr), events_(MAX_EVENTS) {
+    plat::net::startup();
+    poller_ = plat::poller::create();
+}
+
+EventLoop::~EventLoop() {
+    for (auto* source : garbage_) {
+        delete source;
+    }
+    plat::poller::close(poller_);
+}
+
+IoSource* EventLoop::watch(plat::net::SocketHandle* socket, std::function<void(Readiness)> callback) {
+    plat::net::set_nonblocking(socket, true);
+    auto* source = new IoSource{};
+    source->socket = socket;
+    source->callback = std::move(callback);
+    try {
+        plat::poller::add(poller_, socket, reinterpret_cast<u64>(source));
+    } catch (...) {
+        delete source;
+        throw;
+    }
+    ++num_watched_;
+    return source;
+}
+
+void EventLoop::unwatch(IoSource* source) {
+    if (source == nullptr || source->closed) return;
+
+    if (plat::net::is_valid(source->socket)) {
+        plat::poller::remove(poller_, source->socket);
+    }
+    source->closed = true;
+    source->callback = nullptr;
+    interrupt(source);
+    garbage_.push(source);
+    --num_watched_;
+}
+
+void EventLoop::interrupt(IoSource* source) {
+    if (source->read_waiter) {
+        schedule(std::exchange(source->read_waiter, nullptr));
+    }
+    if (source->write_waiter) {
+        schedule(std::exchange(source->write_waiter, nullptr));
+    }
+}
+
+EventLoop::TimerId EventLoop::call_after(const u64 ms, async::UniqueTask fn) {
+    u32 slot;
+    if (free_slots_.is_empty()) {
+        slot = static_cast<u32>(timer_slots_.len());
+        timer_slots_.push(TimerSlot{});
+    } else {
+        slot = free_slots_.last();
+        free_slots_.pop();
+    }
+    auto& timer = timer_slots_.at(slot);
+    timer.deadline = now_ms() + ms;
+    timer.active = true;
+    timer.fn = std::move(fn);
+    timer_heap_.push(TimerEntry{timer.deadline, slot, timer.generation});
+    ++num_timers_;
+    return (static_cast<u64>(timer.generation) << 32) | slot;
+}
+
+bool EventLoop::reset_timer(const TimerId id, const u64 ms) {
+    auto* timer = find_timer(id);
+    if (timer == nullptr) return false;
+
+    const u64 deadline = now_ms() + ms;
+    if (deadline < timer->deadline) {
+        // 提前到期需要新的堆项；延期只改槽位，旧堆项弹出时再按新期限重新入堆
+        timer_heap_.push(TimerEntry{deadline, static_cast<u32>(id), timer->generation});
+    }
+    timer->deadline = deadline;
+    return true;
+}
+
+bool EventLoop::cancel_timer(const TimerId id) {
+    auto* timer = find_timer(id);
+    if (timer == nullptr) return false;
+
+    timer->active = false;
+    timer->fn = async::UniqueTask{};
+    ++timer->generation;
+    free_slots_.push(static_cast<u32>(id));
+    --num_timers_;
+    return true;
+}
+
+void EventLoop::schedule(const coro::Coroutine coro) {
+    ready_.push_back(coro);
+}
+
+void EventLoop::spawn(coro::Task<> task) {
+    spawn_driver(std::move(task), this).start();
+}
+
+void EventLoop::post(async::UniqueTask fn) {
+    {
+        std::lock_guard<std::mutex> lock(posted_mtx_);
+        posted_.push(std::move(fn));
+        has_posted_.store(true, std::memory_order_release);
+    }
+    plat::poller::wake(poller_);
+}
+
+void EventLoop::run() {
+    stop_requested_.store(false, std::memory_order_relaxed);
+    while (!stop_requested_.load(std::memory_order_acquire)) {
+        run_once();
+    }
+}
+
+void EventLoop::run_once(const i32 timeout_ms) {
+    i32 timeout = timeout_ms;
+    if (!ready_.is_empty() || has_posted_.load(std::memory_order_acquire) || stop_requested_.load(std::memory_order_acquire)) {
+        timeout = 0;
+    } else if (!timer_heap_.is_empty()) {
+        const u64 now = now_ms();
+        const u64 deadline = timer_heap_.top().deadline;
+        const u64 wait = deadline > now ? deadline - now : 0;
+        const u64 clamped = std::min<u64>(wait, std::numeric_limits<i32>::max());
+        timeout = timeout < 0 ? static_cast<i32>(clamped) : std::min(timeout, static_cast<i32>(clamped));
+    }
+
+    const usize n = plat::poller::wait(poller_, events_.data(), events_.len(), timeout);
+    handle_events(n);
+    run_timers();
+    run_posted();
+    run_ready();
+
+    for (auto* source : garbage_) {
+        delete source;
+    }
+    garbage_.clear();
+    rethrow_if_failed();
+}
+
+void EventLoop::stop() {
+    stop_requested_.store(true, std::memory_order_release);
+    plat::poller::wake(poller_);
+}
+
+u64 EventLoop::now_ms() {
+    using namespace std::chrono;
+    return static_cast<u64>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+EventLoop::TimerSlot* EventLoop::find_timer(const TimerId id) {
+    const auto slot = static_cast<u32>(id);
+    const auto generation = static_cast<u32>(id >> 32);
+    if (slot >= timer_slots_.len()) return nullptr;
+
+    auto& timer = timer_slots_.at(slot);
+    return timer.active && timer.generation == generation ? &timer : nullptr;
+}
+
+void EventLoop::handle_events(const usize n) {
+    for (usize i = 0; i < n; ++i) {
+        const auto& event = events_.at(i);
+        if (event.token == 0) continue; // wake
+
+        auto* source = reinterpret_cast<IoSource*>(event.token);
+        if (source->closed) continue;
+
+        source->ready.readable |= event.readable || event.hangup;
+        source->ready.writable |= event.writable || event.hangup;
+        source->ready.hangup |= event.hangup;
+        if (source->ready.readable && source->read_waiter) {
+            schedule(std::exchange(source->read_waiter, nullptr));
+        }
+        if (source->ready.writable && source->write_waiter) {
+            schedule(std::exchange(source->write_waiter, nullptr));
+        }
+        if (source->callback) {
+            source->callback(source->ready);
+        }
+    }
+}
+
+void EventLoop::run_timers() {
+    const u64 now = now_ms();
+    while (!timer_heap_.is_empty() && timer_heap_.top().deadline <= now) {
+        const auto entry = timer_heap_.top();
+        timer_heap_.pop();
+
+        auto& timer = timer_slots_.at(entry.slot);
+        if (!timer.active || timer.generation != entry.generation) continue; // 已取消
+        if (timer.deadline > now) {
+            if (timer.deadline != entry.deadline) {
+                timer_heap_.push(TimerEntry{timer.deadline, entry.slot, entry.generation}); // 已延期
+            }
+            continue;
+        }
+
+        // 回调可能新建定时器导致槽位数组扩容，先取出再调用
+        auto fn = std::move(timer.fn);
+        timer.active = false;
+        ++timer.generation;
+        free_slots_.push(entry.slot);
+        --num_timers_;
+        fn();
+    }
+}
+
+void EventLoop::run_posted() {
+    if (!has_posted_.load(std::memory_order_acquire)) return;
+
+    util::Vec<async::UniqueTask> tasks;
+    {
+        std::lock_guard<std::mutex> lock(posted_mtx_);
+        tasks.swap(posted_);
+        has_posted_.store(false, std::memory_order_relaxed);
+    }
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+void EventLoop::run_ready() {
+    // 只处理本轮开始时已就绪的协程，恢复过程中新就绪的留到下一轮，避免饿死 I/O
+    for (usize n = ready_.len(); n > 0; --n) {
+        ready_.pop_front().unwrap().resume();
+    }
+}
+
+void EventLoop::rethrow_if_failed() {
+    if (error_) {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
+
+} // namespace my::net
@@ -0,0 +1,127 @@
+/**
+ * @brief 变长整数长度前缀的二进制分帧实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/frame.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace my::net {
+
+usize decode_varint(const u8* data, const usize len, u64& value) {
+    u64 res = 0;
+    for (usize i = 0; i < len; ++i) {
+        const u8 byte = data[i];
+        if (i == MAX_VARINT_LEN - 1 && byte > 1) {
+            throw io_exception("Varint overflows 64 bits");
+        }
+        res |= static_cast<u64>(byte & 0x7f) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            value = res;
+            return i + 1;
+        }
+        if (i == MAX_VARINT_LEN - 1) {
+            throw io_exception("Varint is longer than {} bytes", MAX_VARINT_LEN);
+        }
+    }
+    return 0;
+}
+
+void FrameEncoder::push(const str::StringView header, const str::StringView body) {
+    u8 prefix[MAX_VARINT_LEN];
+    put(reinterpret_cast<const char*>(prefix), encode_varint(header.len() + body.len(), prefix));
+    put(reinterpret_cast<const char*>(header.as_bytes()), header.len());
+    const auto* data = reinterpret_cast<const char*>(body.as_bytes());
+    if (body.len() < COPY_THRESHOLD) {
+        put(data, body.len());
+    } else {
+        chunks_.push(Chunk{data, 0, body.len()});
+    }
+    ++frames_;
+}
+
+util::Vec<plat::IoSlice>& FrameEncoder::slices() {
+    slices_.clear();
+    for (const auto& c : chunks_) {
+        slices_.push(plat::IoSlice{c.ext != nullptr ? c.ext : buf_.data() + c.offset, c.size});
+    }
+    return slices_;
+}
+
+void FrameEncoder::clear() noexcept {
+    len_ = 0;
+    chunks_.clear();
+    slices_.clear();
+    frames_ = 0;
+}
+
+void FrameEncoder::swap(FrameEncoder& other) noexcept {
+    buf_.swap(other.buf_);
+    std::swap(len_, other.len_);
+    chunks_.swap(other.chunks_);
+    slices_.swap(other.slices_);
+    std::swap(frames_, other.frames_);
+}
+
+void FrameEncoder::put(const char* data, const usize size) {
+    if (size == 0) return;
+    if (chunks_.is_empty() || chunks_.last().ext != nullptr) {
+        chunks_.push(Chunk{nullptr, len_, 0});
+    }
+    if (len_ + size > buf_.len()) {
+        util::Vec<char> bigger(std::max<usize>({256, buf_.len() * 2, len_ + size}));
+        std::memcpy(bigger.data(), buf_.data(), len_);
+        buf_ = std::move(bigger);
+    }
+    std::memcpy(buf_.data() + len_, data, size);
+    len_ += size;
+    chunks_.last().size += size;
+}
+
+FrameDecoder::FrameDecoder(const usize initial_capacity, const usize max_frame) :
+        buf_(std::max<usize>(initial_capacity, MAX_VARINT_LEN)), max_frame_(max_frame) {}
+
+std::span<char> FrameDecoder::prepare() {
+    if (begin_ == end_) {
+        begin_ = end_ = 0;
+    }
+    // 尾部不足以容纳当前帧时先整理；整理后仍放不下再扩容
+    const usize want = std::max(need_, buffered() + MAX_VARINT_LEN);
+    if (begin_ > 0 && (end_ == buf_.len() || begin_ + want > buf_.len())) {
+        std::memmove(buf_.data(), buf_.data() + begin_, buffered());
+        end_ -= begin_;
+        begin_ = 0;
+    }
+    if (want > buf_.len()) {
+        util::Vec<char> bigger(std::max(want, buf_.len() * 2));
+        std::memcpy(bigger.data(), buf_.data() + begin_, buffered());
+        end_ -= begin_;
+        begin_ = 0;
+        buf_ = std::move(bigger);
+    }
+    return std::span<char>(buf_.data() + end_, buf_.len() - end_);
+}
+
+Option<str::StringView> FrameDecoder::next() {
+    const auto* base = reinterpret_cast<const u8*>(buf_.data() + begin_);
+    u64 len = 0;
+    const usize prefix = decode_varint(base, buffered(), len);
+    if (prefix == 0) {
+        return Option<str::StringView>::None();
+    }
+    if (len > max_frame_) {
+        throw io_exception("Frame of {} bytes exceeds limit {}", len, max_frame_);
+    }
+    if (buffered() < prefix + len) {
+        need_ = prefix + len;
+        return Option<str::StringView>::None();
+    }
+    need_ = 0;
+    begin_ += prefix + len;
+    return Option<str::StringView>::Some(str::StringView(base + prefix, len));
+}
+
+} // namespace my::net
@@ -0,0 +1,392 @@
+/**
+ * @brief HTTP/1.1 请求解析、响应序列化与路由实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/http.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace my::net::http {
+
+namespace {
+
+const char* chars(const str::StringView s) {
+    return reinterpret_cast<const char*>(s.as_bytes());
+}
+
+char lower(const u8 c) {
+    return static_cast<char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+}
+
+bool iequals(const str::StringView a, const str::StringView b) {
+    if (a.len() != b.len()) return false;
+    for (usize i = 0; i < a.len(); ++i) {
+        if (lower(a[i]) != lower(b[i])) return false;
+    }
+    return true;
+}
+
+bool is_space(const u8 c) {
+    return c == ' ' || c == '\t';
+}
+
+str::StringView trim_ows(const str::StringView s) {
+    usize begin = 0, end = s.len();
+    while (begin < end && is_space(s[begin])) ++begin;
+    while (end > begin && is_space(s[end - 1])) --end;
+    return s.slice(begin, end);
+}
+
+/**
+ * @brief 在 s[from..] 中查找字节 c
+ */
+Option<usize> find_byte(const str::StringView s, const char c, const usize from = 0) {
+    if (from >= s.len()) return Option<usize>::None();
+    const void* hit = std::memchr(chars(s) + from, c, s.len() - from);
+    return hit == nullptr ? Option<usize>::None() : Option<usize>::Some(static_cast<const char*>(hit) - chars(s));
+}
+
+/**
+ * @brief 逗号分隔的令牌列表中是否包含 token，不区分大小写
+ */
+bool has_token(const str::StringView list, const str::StringView token) {
+    usize begin = 0;
+    while (begin <= list.len()) {
+        const auto comma = find_byte(list, ',', begin);
+        const usize end = comma.is_some() ? comma.unwrap() : list.len();
+        if (iequals(trim_ows(list.slice(begin, end)), token)) return true;
+        begin = end + 1;
+    }
+    return false;
+}
+
+/**
+ * @brief 追加到以 len 标记有效长度的缓冲区，容量不足时倍增
+ * @return 追加数据的起始偏移
+ */
+usize append_bytes(util::Vec<char>& buf, usize& len, const char* data, const usize size) {
+    if (len + size > buf.len()) {
+        util::Vec<char> bigger(std::max<usize>({64, buf.len() * 2, len + size}));
+        std::memcpy(bigger.data(), buf.data(), len);
+        buf = std::move(bigger);
+    }
+    std::memcpy(buf.data() + len, data, size);
+    const usize offset = len;
+    len += size;
+    return offset;
+}
+
+Method to_method(const str::StringView name) {
+    if (name == "GET") return Method::Get;
+    if (name == "HEAD") return Method::Head;
+    if (name == "POST") return Method::Post;
+    if (name == "PUT") return Method::Put;
+    if (name == "DELETE") return Method::Delete;
+    if (name == "PATCH") return Method::Patch;
+    if (name == "OPTIONS") return Method::Options;
+    return Method::Other;
+}
+
+} // namespace
+
+Option<str::StringView> Request::header(const str::StringView name) const {
+    for (const auto& h : headers) {
+        if (iequals(h.name, name)) {
+            return Option<str::StringView>::Some(h.value);
+        }
+    }
+    return Option<str::StringView>::None();
+}
+
+Option<str::StringView> Request::query_param(const str::StringView name) const {
+    usize begin = 0;
+    while (begin < query.len()) {
+        const auto amp = find_byte(query, '&', begin);
+        const usize end = amp.is_some() ? amp.unwrap() : query.len();
+        const auto pair = query.slice(begin, end);
+        const auto eq = find_byte(pair, '=');
+        const auto key = eq.is_some() ? pair.slice(0, eq.unwrap()) : pair;
+        if (key == name) {
+            return Option<str::StringView>::Some(eq.is_some() ? pair.slice(eq.unwrap() + 1) : str::StringView{});
+        }
+        begin = end + 1;
+    }
+    return Option<str::StringView>::None();
+}
+
+ParseStatus RequestParser::parse(const str::StringView data, Request& req) {
+    if (error_ != 0) {
+        return ParseStatus::Error;
+    }
+    if (head_len_ == 0) {
+        // 从上次扫描处回退 3 字节继续查找，以免漏掉跨两次到达的 \r\n\r\n
+        usize from = scanned_ >= 3 ? scanned_ - 3 : 0;
+        loop {
+            const auto lf = find_byte(data, '\n', from);
+            if (lf.is_none()) break;
+            const usize i = lf.unwrap();
+            if (i >= 3 && data[i - 3] == '\r' && data[i - 2] == '\n' && data[i - 1] == '\r') {
+                head_len_ = i + 1;
+                break;
+            }
+            from = i + 1;
+        }
+        if (head_len_ == 0) {
+            scanned_ = data.len();
+            return ParseStatus::Incomplete;
+        }
+    }
+    if (data.len() < head_len_ + body_len_) {
+        return ParseStatus::Incomplete; // 请求体尚未到齐，头部已解析过
+    }
+
+    const auto status = parse_head(data.slice(0, head_len_), req);
+    if (status != ParseStatus::Complete) {
+        return status;
+    }
+    if (data.len() < head_len_ + body_len_) {
+        return ParseStatus::Incomplete;
+    }
+    req.body = data.slice(head_len_, head_len_ + body_len_);
+    return ParseStatus::Complete;
+}
+
+ParseStatus RequestParser::fail(const u16 status) noexcept {
+    error_ = status;
+    return ParseStatus::Error;
+}
+
+ParseStatus RequestParser::parse_head(const str::StringView head, Request& req) {
+    req.headers.clear();
+    req.body = str::StringView{};
+
+    // 请求行：METHOD SP target SP HTTP/1.x CRLF
+    const usize line_end = find_byte(head, '\r').unwrap();
+    const auto line = head.slice(0, line_end);
+    if (head[line_end + 1] != '\n' || find_byte(line, '\n').is_some()) {
+        return fail(400);
+    }
+    const auto sp1 = find_byte(line, ' ');
+    const auto sp2 = sp1.is_some() ? find_byte(line, ' ', sp1.unwrap() + 1) : Option<usize>::None();
+    if (sp2.is_none() || sp1.unwrap() == 0 || sp2.unwrap() == sp1.unwrap() + 1) {
+        return fail(400);
+    }
+    req.method_name = line.slice(0, sp1.unwrap());
+    req.method = to_method(req.method_name);
+    req.target = line.slice(sp1.unwrap() + 1, sp2.unwrap());
+    const auto version = line.slice(sp2.unwrap() + 1);
+    if (version.len() != 8 || !version.starts_with(str::StringView("HTTP/"))) {
+        return fail(400);
+    }
+    if (version[5] != '1' || version[6] != '.' || (version[7] != '0' && version[7] != '1')) {
+        return fail(505);
+    }
+    req.minor_version = static_cast<u8>(version[7] - '0');
+    const auto q = find_byte(req.target, '?');
+    req.path = q.is_some() ? req.target.slice(0, q.unwrap()) : req.target;
+    req.query = q.is_some() ? req.target.slice(q.unwrap() + 1) : str::StringView{};
+
+    // 首部：name ":" OWS value OWS CRLF，最后一行为空行
+    bool keep_alive = req.minor_version == 1;
+    bool has_length = false;
+    usize length = 0;
+    usize pos = line_end + 2;
+    while (pos + 2 < head.len()) {
+        const usize end = find_byte(head, '\r', pos).unwrap();
+        const auto field = head.slice(pos, end);
+        if (head[end + 1] != '\n') {
+            return fail(400); // 孤立的 CR 不得被当作行尾
+        }
+        pos = end + 2;
+        const auto colon = find_byte(field, ':');
+        if (find_byte(field, '\n').is_some() || colon.is_none() || colon.unwrap() == 0 || is_space(field[0]) || is_space(field[colon.unwrap() - 1])) {
+            return fail(400); // 含续行（obs-fold）或名称后带空白
+        }
+        if (req.headers.len() == MAX_HEADERS) {
+            return fail(431);
+        }
+        const Header h{field.slice(0, colon.unwrap()), trim_ows(field.slice(colon.unwrap() + 1))};
+        req.headers.push(h);
+
+        if (iequals(h.name, str::StringView("Content-Length"))) {
+            usize n = 0;
+            const auto* first = chars(h.value);
+            const auto [ptr, ec] = std::from_chars(first, first + h.value.len(), n);
+            if (h.value.len() == 0 || ec != std::errc{} || ptr != first + h.value.len() || (has_length && n != length)) {
+                return fail(400);
+            }
+            has_length = true;
+            length = n;
+        } else if (iequals(h.name, str::StringView("Transfer-Encoding"))) {
+            return fail(501);
+        } else if (iequals(h.name, str::StringView("Connection"))) {
+            if (has_token(h.value, str::StringView("close"))) {
+                keep_alive = false;
+            } else if (has_token(h.value, str::StringView("keep-alive"))) {
+                keep_alive = true;
+            }
+        }
+    }
+    if (length > max_body_) {
+        return fail(413);
+    }
+    req.keep_alive = keep_alive;
+    body_len_ = length;
+    return ParseStatus::Complete;
+}
+
+str::StringView reason_phrase(const u16 status) {
+    switch (status) {
+    case 100: return str::StringView("Continue");
+    case 200: return str::StringView("OK");
+    case 201: return str::StringView("Created");
+    case 202: return str::StringView("Accepted");
+    case 204: return str::StringView("No Content");
+    case 301: return str::StringView("Moved Permanently");
+    case 302: return str::StringView("Found");
+    case 304: return str::StringView("Not Modified");
+    case 307: return str::StringView("Temporary Redirect");
+    case 308: return str::StringView("Permanent Redirect");
+    case 400: return str::StringView("Bad Request");
+    case 401: return str::StringView("Unauthorized");
+    case 403: return str::StringView("Forbidden");
+    case 404: return str::StringView("Not Found");
+    case 405: return str::StringView("Method Not Allowed");
+    case 408: return str::StringView("Request Timeout");
+    case 413: return str::StringView("Content Too Large");
+    case 431: return str::StringView("Request Header Fields Too Large");
+    case 500: return str::StringView("Internal Server Error");
+    case 501: return str::StringView("Not Implemented");
+    case 503: return str::StringView("Service Unavailable");
+    case 505: return str::StringView("HTTP Version Not Supported");
+    default: return str::StringView("Unknown");
+    }
+}
+
+Response& Response::header(const str::StringView name, const str::StringView value) {
+    append_bytes(headers_, headers_len_, chars(name), name.len());
+    append_bytes(headers_, headers_len_, ": ", 2);
+    append_bytes(headers_, headers_len_, chars(value), value.len());
+    append_bytes(headers_, headers_len_, "\r\n", 2);
+    return *this;
+}
+
+Response& Response::body(const str::StringView data) noexcept {
+    owned_ = Option<str::String<>>::None();
+    body_ = data;
+    return *this;
+}
+
+Response& Response::body(str::String<> data) {
+    owned_ = Option<str::String<>>::Some(std::move(data));
+    body_ = owned_.unwrap().as_str();
+    return *this;
+}
+
+void Response::clear() noexcept {
+    status_ = 200;
+    headers_len_ = 0;
+    body_ = str::StringView{};
+    owned_ = Option<str::String<>>::None();
+}
+
+void ResponseWriter::append(Response& res, const bool keep_alive, const u8 minor_version, const bool head_only) {
+    char digits[24];
+    put(str::StringView("HTTP/1.1 "));
+    put(digits, std::to_chars(digits, digits + sizeof(digits), res.status_).ptr - digits);
+    put(" ", 1);
+    put(reason_phrase(res.status_));
+    put(str::StringView("\r\nContent-Length: "));
+    put(digits, std::to_chars(digits, digits + sizeof(digits), res.body_.len()).ptr - digits);
+    if (!keep_alive) {
+        put(str::StringView("\r\nConnection: close"));
+    } else if (minor_version == 0) {
+        put(str::StringView("\r\nConnection: keep-alive"));
+    }
+    put("\r\n", 2);
+    put(res.headers_.data(), res.headers_len_);
+    put("\r\n", 2);
+
+    if (head_only || res.body_.len() == 0) {
+        return;
+    }
+    if (res.body_.len() < COPY_THRESHOLD) {
+        put(res.body_);
+        return;
+    }
+    const char* data = chars(res.body_);
+    if (res.owned_.is_some()) {
+        owned_.push(std::move(res.owned_).unwrap()); // 字符串堆内存随移动转移，data 仍有效
+        res.owned_ = Option<str::String<>>::None();
+    }
+    chunks_.push(Chunk{data, 0, res.body_.len()});
+}
+
+util::Vec<plat::IoSlice>& ResponseWriter::slices() {
+    slices_.clear();
+    for (const auto& c : chunks_) {
+        slices_.push(plat::IoSlice{c.ext != nullptr ? c.ext : buf_.data() + c.offset, c.size});
+    }
+    return slices_;
+}
+
+void ResponseWriter::clear() noexcept {
+    len_ = 0;
+    chunks_.clear();
+    owned_.clear();
+    slices_.clear();
+}
+
+void ResponseWriter::put(const char* data, const usize size) {
+    if (size == 0) return;
+    // 与上一个内部分段相邻时直接延长，整批响应的首部与小响应体合成一段
+    if (chunks_.is_empty() || chunks_.last().ext != nullptr) {
+        chunks_.push(Chunk{nullptr, len_, 0});
+    }
+    append_bytes(buf_, len_, data, size);
+    chunks_.last().size += size;
+}
+
+Router& Router::route(const Method method, const str::StringView pattern, Handler handler) {
+    const bool prefix = pattern.ends_with(str::StringView("/*"));
+    routes_.push(Route{method, str::String<>(prefix ? pattern.slice(0, pattern.len() - 1) : pattern), prefix, std::move(handler)});
+    return *this;
+}
+
+void Router::dispatch(const Request& req, Response& res) const {
+    bool path_matched = false;
+    const Route* route = find(req.method, req.path, path_matched);
+    if (route == nullptr && req.method == Method::Head) {
+        route = find(Method::Get, req.path, path_matched);
+    }
+    if (route == nullptr) {
+        res.status(path_matched ? 405 : 404).body(reason_phrase(path_matched ? 405 : 404));
+        return;
+    }
+    try {
+        route->handler(req, res);
+    } catch (const std::exception&) {
+        res.clear();
+        res.status(500).body(reason_phrase(500));
+    }
+}
+
+const Router::Route* Router::find(const Method method, const str::StringView path, bool& path_matched) const {
+    for (const auto& r : routes_) {
+        const auto pattern = r.pattern.as_str();
+        if (r.prefix ? !path.starts_with(pattern) : path != pattern) {
+            continue;
+        }
+        path_matched = true;
+        if (r.method == method) {
+            return &r;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace my::net::http
@@ -0,0 +1,109 @@
+/**
+ * @brief 基于事件循环的 HTTP/1.1 服务端实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/http_server.hpp"
+
+#include <cstring>
+
+namespace my::net::http {
+
+coro::Task<> HttpServer::serve(EventLoop& event_loop, AsyncTcpListener& listener) {
+    while (listener.is_open()) {
+        std::unique_ptr<AsyncTcpStream> stream;
+        try {
+            stream = co_await listener.accept();
+        } catch (const Exception&) {
+            if (!listener.is_open()) co_return;
+            throw;
+        }
+        event_loop.spawn(serve_connection(std::move(stream)));
+    }
+}
+
+coro::Task<> HttpServer::serve_connection(std::unique_ptr<AsyncTcpStream> stream) {
+    active_.fetch_add(1, std::memory_order_acq_rel);
+    try {
+        co_await run_connection(*stream);
+    } catch (const Exception&) {
+        // 对端复位、空闲超时等，关闭连接即可
+    }
+    stream->close();
+    active_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+coro::Task<> HttpServer::run_connection(AsyncTcpStream& stream) {
+    if (config_.idle_timeout_ms > 0) {
+        stream.set_idle_timeout(config_.idle_timeout_ms);
+    }
+    const usize max_buffer = config_.read_buffer + config_.max_body;
+    util::Vec<char> buf(config_.read_buffer);
+    usize begin = 0, end = 0;
+    RequestParser parser(config_.max_body);
+    Request req;
+    Response res;
+    ResponseWriter out;
+
+    loop {
+        // 处理缓冲区中全部完整的请求，响应合并到 out
+        bool close = false;
+        loop {
+            const auto data = str::StringView(reinterpret_cast<const u8*>(buf.data() + begin), end - begin);
+            const auto status = parser.parse(data, req);
+            if (status == ParseStatus::Incomplete) break;
+            res.clear();
+            if (status == ParseStatus::Error) {
+                res.status(parser.error_status()).body(reason_phrase(parser.error_status()));
+                out.append(res, false, 1, false);
+                close = true;
+                break;
+            }
+            router_->dispatch(req, res);
+            out.append(res, req.keep_alive, req.minor_version, req.method == Method::Head);
+            served_.fetch_add(1, std::memory_order_relaxed);
+            begin += parser.consumed();
+            parser.reset();
+            if (!req.keep_alive) {
+                close = true;
+                break;
+            }
+        }
+        if (!out.is_empty()) {
+            auto& slices = out.slices();
+            co_await stream.write_vectored(slices.data(), slices.len());
+            out.clear();
+        }
+        if (close) co_return;
+
+        // 整理缓冲区：已消费的前缀丢弃；未完成的请求放不下时扩容，头部超过初始容量返回 431
+        if (begin == end) {
+            begin = end = 0;
+        } else if (end == buf.len() && begin > 0) {
+            std::memmove(buf.data(), buf.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (end == buf.len()) {
+            if (!parser.head_complete() || buf.len() >= max_buffer) {
+                res.clear();
+                const u16 code = parser.head_complete() ? 413 : 431;
+                res.status(code).body(reason_phrase(code));
+                out.append(res, false, 1, false);
+                auto& slices = out.slices();
+                co_await stream.write_vectored(slices.data(), slices.len());
+                co_return;
+            }
+            util::Vec<char> bigger(std::min(buf.len() * 2, max_buffer));
+            std::memcpy(bigger.data(), buf.data(), end);
+            buf = std::move(bigger);
+        }
+
+        const usize n = co_await stream.read_some(buf.data() + end, buf.len() - end);
+        if (n == 0) co_return;
+        end += n;
+    }
+}
+
+} // namespace my::net::http
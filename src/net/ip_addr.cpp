@@ -1,20 +1,112 @@
 #include "net/ip_addr.hpp"
 
+#include <bit>
+#include <cstring>
+
 namespace my::net {
 
+namespace {
+
+constexpr u64 BYTES_01 = 0x0101010101010101ull;
+constexpr u64 BYTES_7F = 0x7f7f7f7f7f7f7f7full;
+constexpr u64 BYTES_80 = 0x8080808080808080ull;
+
+/**
+ * @brief 把每字节最高位收集成 8 位掩码，第 i 位对应第 i 字节
+ */
+u32 gather_high_bits(const u64 high) {
+    return static_cast<u32>(((high >> 7) * 0x0102040810204080ull) >> 56);
+}
+
+/**
+ * @brief 等于 '.' 的字节
+ */
+u32 dot_mask(const u64 w) {
+    const u64 x = w ^ ('.' * BYTES_01);
+    return gather_high_bits(~(((x & BYTES_7F) + BYTES_7F) | x) & BYTES_80);
+}
+
+/**
+ * @brief 位于 '0'..'9' 的字节：最高位为 0，且加上偏移后恰好越过 0x30 而未越过 0x3a
+ */
+u32 digit_mask(const u64 w) {
+    const u64 low = w & BYTES_7F;
+    const u64 ge_0 = (low + (0x80 - '0') * BYTES_01) & BYTES_80;
+    const u64 gt_9 = (low + (0x80 - '9' - 1) * BYTES_01) & BYTES_80;
+    return gather_high_bits(ge_0 & ~gt_9 & ~w & BYTES_80);
+}
+
+} // namespace
+
 Ipv4Addr Ipv4Addr::from_str(str::StringView s) {
-    u8 octets[4] = {0};
-    usize idx = 0;
-    for (usize i = 0; i < s.len() && idx < 4; ++i) {
-        if (s.as_bytes()[i] == '.') {
-            ++idx;
-            continue;
-        }
-        if (s.as_bytes()[i] >= '0' && s.as_bytes()[i] <= '9') {
-            octets[idx] = octets[idx] * 10 + (s.as_bytes()[i] - '0');
+    const auto addr = parse(s);
+    if (addr.is_none()) {
+        throw argument_exception("Invalid IPv4 address '{}'", s);
+    }
+    return addr.unwrap();
+}
+
+Option<Ipv4Addr> Ipv4Addr::parse(const str::StringView s) noexcept {
+    const usize n = s.len();
+    if (n < 7 || n > 15) {
+        return Option<Ipv4Addr>::None();
+    }
+    // 把输入装入两个 64 位字：首尾两次定长读取，不越界也不走变长 memcpy
+    const u8* src = s.as_bytes();
+    u64 w0, w1 = 0;
+    if (n >= 8) {
+        std::memcpy(&w0, src, 8);
+        if (n > 8) {
+            std::memcpy(&w1, src + n - 8, 8);
+            w1 >>= (16 - n) * 8;
         }
+    } else {
+        u32 a, b;
+        std::memcpy(&a, src, 4);
+        std::memcpy(&b, src + 3, 4);
+        w0 = a | static_cast<u64>(b) << 24;
+    }
+    const u32 valid = (1u << n) - 1;
+    const u32 dots = (dot_mask(w0) | dot_mask(w1) << 8) & valid;
+    const u32 digits = digit_mask(w0) | digit_mask(w1) << 8;
+    if ((dots | digits) != valid) {
+        return Option<Ipv4Addr>::None();
+    }
+
+    // 依次取出三个点号的位置，不多不少恰好三个；之后四段互不依赖
+    u32 ends[4];
+    u32 rest = dots;
+    for (u32 k = 0; k < 3; ++k) {
+        ends[k] = static_cast<u32>(std::countr_zero(rest | 0x10000));
+        rest &= rest - 1;
+    }
+    if (rest != 0 || ends[2] >= n) {
+        return Option<Ipv4Addr>::None();
+    }
+    ends[3] = static_cast<u32>(n);
+
+    // 前 3 字节留空，使任意段都能无条件回看 3 个字节
+    u8 buf[3 + 16] = {};
+    std::memcpy(buf + 3, &w0, 8);
+    std::memcpy(buf + 11, &w1, 8);
+    const u8* p = buf + 3;
+    u32 addr = 0, bad = 0, start = 0;
+    for (u32 k = 0; k < 4; ++k) {
+        const u32 len = ends[k] - start;
+        const i32 e = static_cast<i32>(ends[k]);
+        const u32 d0 = p[e - 1] - '0';
+        const u32 d1 = (p[e - 2] - '0') & (0u - (len >= 2));
+        const u32 d2 = (p[e - 3] - '0') & (0u - (len >= 3));
+        const u32 octet = d0 + 10 * d1 + 100 * d2;
+        // 空段、超过 3 位、超过 255、前导零均非法
+        bad |= (len - 1 > 2) | (octet > 255) | ((len > 1) & (p[start] == '0'));
+        addr = addr << 8 | octet;
+        start = ends[k] + 1;
+    }
+    if (bad) {
+        return Option<Ipv4Addr>::None();
     }
-    return Ipv4Addr(octets[0], octets[1], octets[2], octets[3]);
+    return Option<Ipv4Addr>::Some(from_u32(addr));
 }
 
 Ipv4Addr Ipv4Addr::any() { return Ipv4Addr(0, 0, 0, 0); }
@@ -0,0 +1,322 @@
+/**
+ * @brief 基于分帧的多路复用 RPC 实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/rpc.hpp"
+
+namespace my::net::rpc {
+
+namespace {
+
+/**
+ * @brief 帧首部：kind, varint 请求 ID[, varint 方法 ID]
+ */
+struct FrameHeader {
+    u8 bytes[1 + 2 * MAX_VARINT_LEN];
+    usize len{0};
+
+    FrameHeader(const FrameKind kind, const u64 request_id) {
+        bytes[len++] = static_cast<u8>(kind);
+        len += encode_varint(request_id, bytes + len);
+    }
+
+    FrameHeader(const FrameKind kind, const u64 request_id, const u32 method_id) :
+            FrameHeader(kind, request_id) {
+        len += encode_varint(method_id, bytes + len);
+    }
+
+    [[nodiscard]] str::StringView view() const {
+        return str::StringView(bytes, len);
+    }
+};
+
+/**
+ * @brief 从帧负载开头读取一个 varint，推进 frame
+ */
+u64 take_varint(str::StringView& frame) {
+    u64 value = 0;
+    const usize n = decode_varint(frame.as_bytes(), frame.len(), value);
+    if (n == 0) {
+        throw io_exception("Truncated RPC frame");
+    }
+    frame = frame.slice(n);
+    return value;
+}
+
+FrameKind take_kind(str::StringView& frame) {
+    if (frame.len() == 0 || frame[0] > static_cast<u8>(FrameKind::Error)) {
+        throw io_exception("Invalid RPC frame kind");
+    }
+    const auto kind = static_cast<FrameKind>(frame[0]);
+    frame = frame.slice(1);
+    return kind;
+}
+
+} // namespace
+
+RpcServer& RpcServer::method(const u32 method_id, Handler handler) {
+    while (methods_.len() <= method_id) {
+        methods_.push(Handler{});
+    }
+    methods_.at(method_id) = std::move(handler);
+    return *this;
+}
+
+coro::Task<> RpcServer::serve(EventLoop& event_loop, AsyncTcpListener& listener) {
+    while (listener.is_open()) {
+        std::unique_ptr<AsyncTcpStream> stream;
+        try {
+            stream = co_await listener.accept();
+        } catch (const Exception&) {
+            if (!listener.is_open()) co_return;
+            throw;
+        }
+        event_loop.spawn(serve_connection(std::move(stream)));
+    }
+}
+
+coro::Task<> RpcServer::serve_connection(std::unique_ptr<AsyncTcpStream> stream) {
+    active_.fetch_add(1, std::memory_order_acq_rel);
+    try {
+        co_await run_connection(*stream);
+    } catch (const Exception&) {
+        // 对端复位或协议错误，关闭连接即可
+    }
+    stream->close();
+    active_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+coro::Task<> RpcServer::run_connection(AsyncTcpStream& stream) {
+    FrameDecoder decoder;
+    FrameEncoder out;
+    util::Vec<str::String<>> results; // 结果需活到本批写出完成
+
+    loop {
+        auto space = decoder.prepare();
+        const usize n = co_await stream.read_some(space.data(), space.size());
+        if (n == 0) co_return;
+        decoder.commit(n);
+
+        for (auto frame = decoder.next(); frame.is_some(); frame = decoder.next()) {
+            auto payload = frame.unwrap();
+            if (take_kind(payload) != FrameKind::Request) {
+                throw io_exception("Unexpected RPC frame kind");
+            }
+            const u64 request_id = take_varint(payload);
+            const u64 method_id = take_varint(payload);
+            try {
+                if (method_id >= methods_.len() || !methods_.at(method_id)) {
+                    throw runtime_exception("Unknown method {}", method_id);
+                }
+                results.push(methods_.at(method_id)(payload));
+                out.push(FrameHeader(FrameKind::Response, request_id).view(), results.last().as_str());
+            } catch (const Exception& e) {
+                results.push(str::String<>(e.message()));
+                out.push(FrameHeader(FrameKind::Error, request_id).view(), results.last().as_str());
+            }
+            served_.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (!out.is_empty()) {
+            auto& slices = out.slices();
+            co_await stream.write_vectored(slices.data(), slices.len());
+            out.clear();
+            results.clear();
+        }
+    }
+}
+
+/**
+ * @brief 读协程、刷新协程与 RpcClient 共享的连接状态
+ */
+struct RpcClient::Connection {
+    struct Pending {
+        coro::Coroutine waiter = nullptr;
+        str::String<> result;
+        u32 generation{0};
+        bool in_use{false};
+        bool done{false};
+        bool failed{false};
+        bool remote_error{false};
+    };
+
+    EventLoop* loop_;
+    std::unique_ptr<AsyncTcpStream> stream;
+    FrameDecoder decoder;
+    FrameEncoder out;     // 等待写出的请求
+    FrameEncoder writing; // 正在写出的请求
+    util::Vec<Pending> slots;
+    util::Vec<u32> free_slots;
+    usize in_flight{0};
+    bool flush_scheduled{false};
+    bool closed{false};
+
+    Connection(EventLoop& event_loop, std::unique_ptr<AsyncTcpStream> s) :
+            loop_(&event_loop), stream(std::move(s)) {}
+
+    u32 acquire() {
+        u32 slot;
+        if (free_slots.is_empty()) {
+            slots.push(Pending{});
+            slot = static_cast<u32>(slots.len() - 1);
+        } else {
+            slot = free_slots.last();
+            free_slots.pop();
+        }
+        auto& p = slots.at(slot);
+        p.in_use = true;
+        p.done = p.failed = p.remote_error = false;
+        p.waiter = nullptr;
+        ++in_flight;
+        return slot;
+    }
+
+    void release(const u32 slot) {
+        auto& p = slots.at(slot);
+        p.in_use = false;
+        p.result = str::String<>{};
+        ++p.generation; // 迟到的同 ID 响应将被忽略
+        free_slots.push(slot);
+        --in_flight;
+    }
+
+    void finish(Pending& p) {
+        p.done = true;
+        if (p.waiter) {
+            loop_->schedule(std::exchange(p.waiter, nullptr));
+        }
+    }
+
+    void complete(str::StringView frame) {
+        const auto kind = take_kind(frame);
+        if (kind == FrameKind::Request) {
+            throw io_exception("Unexpected RPC frame kind");
+        }
+        const u64 id = take_varint(frame);
+        const auto slot = static_cast<u32>(id);
+        const auto generation = static_cast<u32>(id >> 32);
+        if (slot >= slots.len()) return;
+        auto& p = slots.at(slot);
+        if (!p.in_use || p.done || p.generation != generation) return;
+        p.result = str::String<>(frame);
+        p.remote_error = kind == FrameKind::Error;
+        finish(p);
+    }
+
+    void fail_all() {
+        closed = true;
+        for (auto& p : slots) {
+            if (p.in_use && !p.done) {
+                p.failed = true;
+                finish(p);
+            }
+        }
+    }
+
+    void schedule_flush(const std::shared_ptr<Connection>& self) {
+        if (flush_scheduled) return;
+        flush_scheduled = true;
+        // 下一轮迭代再写出，本轮中发起的调用合并为一次聚集写
+        loop_->post([self]() { self->loop_->spawn(flush(self)); });
+    }
+
+    static coro::Task<> flush(std::shared_ptr<Connection> self) {
+        while (!self->out.is_empty() && !self->closed) {
+            self->writing.swap(self->out);
+            auto& slices = self->writing.slices();
+            try {
+                co_await self->stream->write_vectored(slices.data(), slices.len());
+            } catch (const Exception&) {
+                self->fail_all();
+            }
+            self->writing.clear();
+        }
+        self->out.clear();
+        self->flush_scheduled = false;
+    }
+
+    static coro::Task<> read_loop(std::shared_ptr<Connection> self) {
+        try {
+            while (!self->closed) {
+                auto space = self->decoder.prepare();
+                const usize n = co_await self->stream->read_some(space.data(), space.size());
+                if (n == 0) break;
+                self->decoder.commit(n);
+                for (auto frame = self->decoder.next(); frame.is_some(); frame = self->decoder.next()) {
+                    self->complete(frame.unwrap());
+                }
+            }
+        } catch (const Exception&) {
+            // 连接关闭或协议错误
+        }
+        self->fail_all();
+        self->stream->close();
+    }
+
+    struct CallAwaiter {
+        Connection* conn;
+        u32 slot;
+
+        bool await_ready() const noexcept {
+            return conn->slots.at(slot).done;
+        }
+
+        void await_suspend(const coro::Coroutine coro) const noexcept {
+            conn->slots.at(slot).waiter = coro;
+        }
+
+        void await_resume() const noexcept {}
+    };
+};
+
+std::unique_ptr<RpcClient> RpcClient::connect(EventLoop& event_loop, const str::StringView ip, const u16 port) {
+    return std::make_unique<RpcClient>(event_loop, AsyncTcpStream::connect(event_loop, ip, port));
+}
+
+RpcClient::RpcClient(EventLoop& event_loop, std::unique_ptr<AsyncTcpStream> stream) :
+        conn_(std::make_shared<Connection>(event_loop, std::move(stream))) {
+    event_loop.spawn(Connection::read_loop(conn_));
+}
+
+RpcClient::~RpcClient() {
+    close();
+}
+
+coro::Task<str::String<>> RpcClient::call(const u32 method_id, const str::StringView request) {
+    const auto conn = conn_; // 保证调用期间连接状态存活
+    if (conn->closed) {
+        throw network_exception("RPC connection is closed");
+    }
+    const u32 slot = conn->acquire();
+    const u64 id = static_cast<u64>(conn->slots.at(slot).generation) << 32 | slot;
+    conn->out.push(FrameHeader(FrameKind::Request, id, method_id).view(), request);
+    conn->schedule_flush(conn);
+
+    co_await Connection::CallAwaiter{conn.get(), slot};
+
+    auto& p = conn->slots.at(slot);
+    const bool failed = p.failed, remote_error = p.remote_error;
+    auto result = std::move(p.result);
+    conn->release(slot);
+    if (failed) {
+        throw network_exception("RPC connection closed");
+    }
+    if (remote_error) {
+        throw runtime_exception("{}", result.as_str());
+    }
+    co_return result;
+}
+
+usize RpcClient::in_flight() const noexcept {
+    return conn_->in_flight;
+}
+
+void RpcClient::close() {
+    if (!conn_->closed) {
+        conn_->fail_all();
+        conn_->stream->close();
+    }
+}
+
+} // namespace my::net::rpc
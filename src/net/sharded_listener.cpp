@@ -0,0 +1,164 @@
+/**
+ * @brief 可配置的监听套接字构建器与 SO_REUSEPORT 分片监听实现
+ * @author Ricky
+ * @date 2026/10/16
+ * @version 1.0
+ */
+#include "net/sharded_listener.hpp"
+
+namespace my::net {
+
+TcpListenerBuilder::TcpListenerBuilder(const str::StringView ip, const u16 port) :
+        ip_(ip), port_(port), shards_(std::max<usize>(1, std::thread::hardware_concurrency())) {}
+
+TcpListenerBuilder& TcpListenerBuilder::backlog(const i32 n) {
+    backlog_ = n;
+    return *this;
+}
+
+TcpListenerBuilder& TcpListenerBuilder::nodelay(const bool enable) {
+    nodelay_ = enable;
+    return *this;
+}
+
+TcpListenerBuilder& TcpListenerBuilder::defer_accept(const u32 seconds) {
+    defer_accept_ = seconds;
+    return *this;
+}
+
+TcpListenerBuilder& TcpListenerBuilder::recv_buffer(const i32 bytes) {
+    recv_buffer_ = bytes;
+    return *this;
+}
+
+TcpListenerBuilder& TcpListenerBuilder::send_buffer(const i32 bytes) {
+    send_buffer_ = bytes;
+    return *this;
+}
+
+TcpListenerBuilder& TcpListenerBuilder::shards(const usize n) {
+    if (n == 0) {
+        throw argument_exception("Shard count must be positive");
+    }
+    shards_ = n;
+    return *this;
+}
+
+TcpListener TcpListenerBuilder::build() const {
+    return TcpListener(open(port_, false, nullptr));
+}
+
+std::unique_ptr<ShardedTcpListener> TcpListenerBuilder::build_sharded() const {
+    bool reuse_port = false;
+    std::unique_ptr<plat::net::SocketHandle, void (*)(plat::net::SocketHandle*)> first(open(port_, true, &reuse_port), plat::net::close);
+    str::String<> ip;
+    u16 port = 0;
+    plat::net::get_local_addr(first.get(), ip, port);
+
+    std::unique_ptr<ShardedTcpListener> res(new ShardedTcpListener(port));
+    const usize n = reuse_port ? shards_ : 1;
+    for (usize i = 0; i < n; ++i) {
+        auto shard = std::make_unique<ShardedTcpListener::Shard>();
+        shard->socket.reset(i == 0 ? first.release() : open(port, true, nullptr));
+        res->shards_.push(std::move(shard));
+    }
+    return res;
+}
+
+plat::net::SocketHandle* TcpListenerBuilder::open(const u16 port, const bool reuse_port, bool* reuse_port_applied) const {
+    using plat::net::SocketOption;
+    plat::net::startup();
+    std::unique_ptr<plat::net::SocketHandle, void (*)(plat::net::SocketHandle*)> h(
+        plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream), plat::net::close);
+    // 选项须在 listen 之前设置：缓冲区大小决定握手时通告的窗口，REUSEPORT 须在 bind 之前
+    const bool applied = reuse_port && plat::net::set_socket_option(h.get(), SocketOption::ReusePort, 1);
+    if (reuse_port_applied != nullptr) *reuse_port_applied = applied;
+    if (nodelay_) plat::net::set_socket_option(h.get(), SocketOption::NoDelay, 1);
+    if (defer_accept_ > 0) plat::net::set_socket_option(h.get(), SocketOption::DeferAccept, static_cast<i32>(defer_accept_));
+    if (recv_buffer_ > 0) plat::net::set_socket_option(h.get(), SocketOption::RecvBuffer, recv_buffer_);
+    if (send_buffer_ > 0) plat::net::set_socket_option(h.get(), SocketOption::SendBuffer, send_buffer_);
+    plat::net::bind(h.get(), ip_.as_str(), port);
+    plat::net::listen(h.get(), backlog_);
+    return h.release();
+}
+
+ShardedTcpListener::ShardedTcpListener(const u16 port) :
+        local_port_(port) {}
+
+ShardedTcpListener::~ShardedTcpListener() {
+    try {
+        stop();
+    } catch (...) {
+    }
+}
+
+void ShardedTcpListener::start(Handler handler) {
+    if (started_) {
+        throw state_exception("ShardedTcpListener is already started");
+    }
+    started_ = true;
+    for (auto& shard : shards_) {
+        shard->thread = std::thread([s = shard.get(), handler]() { run_shard(*s, handler); });
+    }
+}
+
+void ShardedTcpListener::stop() {
+    for (auto& shard : shards_) {
+        // 经 post 在循环线程上停止，避免与 run() 开始时复位停止标志竞争
+        shard->event_loop.post([ev = &shard->event_loop]() { ev->stop(); });
+    }
+    std::exception_ptr error;
+    for (auto& shard : shards_) {
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+        shard->socket.reset();
+        if (!error) error = std::exchange(shard->error, nullptr);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+u64 ShardedTcpListener::accepted(const usize shard) const {
+    if (shard >= shards_.len()) {
+        throw index_out_of_bounds_exception("Shard {} out of bounds [0..{})", shard, shards_.len());
+    }
+    return shards_.at(shard)->accepted.load(std::memory_order_relaxed);
+}
+
+u64 ShardedTcpListener::total_accepted() const {
+    u64 total = 0;
+    for (const auto& shard : shards_) {
+        total += shard->accepted.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+coro::Task<> ShardedTcpListener::accept_loop(AsyncTcpListener& listener, Shard& shard, Handler handler) {
+    while (listener.is_open()) {
+        std::unique_ptr<AsyncTcpStream> stream;
+        try {
+            stream = co_await listener.accept();
+        } catch (const Exception&) {
+            if (!listener.is_open()) co_return;
+            throw;
+        }
+        shard.accepted.fetch_add(1, std::memory_order_relaxed);
+        shard.event_loop.spawn(handler(std::move(stream)));
+    }
+}
+
+void ShardedTcpListener::run_shard(Shard& shard, const Handler& handler) {
+    try {
+        AsyncTcpListener listener(shard.event_loop, shard.socket.release());
+        shard.event_loop.spawn(accept_loop(listener, shard, handler));
+        shard.event_loop.run();
+        listener.close();
+        shard.event_loop.run_once(0); // 让 accept_loop 观察到关闭并结束
+    } catch (...) {
+        shard.error = std::current_exception();
+    }
+}
+
+} // namespace my::net
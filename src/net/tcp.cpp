@@ -25,6 +25,10 @@ TcpListener::TcpListener(str::StringView ip, u16 port) : handle_(nullptr, plat::
     plat::net::listen(handle_.get(), 128);
 }
 
+TcpListener::TcpListener(plat::net::SocketHandle* h) : handle_(h, plat::net::close), local_ip_(), local_port_(0) {
+    plat::net::get_local_addr(handle_.get(), local_ip_, local_port_);
+}
+
 str::String<> TcpListener::local_ip() const {
     return local_ip_;
 }
@@ -72,6 +76,26 @@ str::String<> TcpStream::read(usize max_size) {
     return plat::net::recv_bytes(handle_.get(), max_size, 0);
 }
 
+usize TcpStream::read_into(char* buf, usize size) {
+    return plat::net::recv_into(handle_.get(), buf, size);
+}
+
+usize TcpStream::write_vectored(const plat::IoSlice* slices, usize n) {
+    return plat::net::send_vectored(handle_.get(), slices, n);
+}
+
+usize TcpStream::send_file(fs::File& file, const u64 offset, const usize len) {
+    file.flush();
+    const i64 native = plat::fs::native_handle(file.handle());
+    usize done = 0;
+    while (done < len) {
+        const usize n = plat::net::send_file(handle_.get(), native, offset + done, len - done);
+        if (n == 0) break;
+        done += n;
+    }
+    return done;
+}
+
 void TcpStream::set_read_timeout(u32 timeout_ms) {
     plat::net::set_timeout_ms(handle_.get(), timeout_ms, true);
 }
@@ -88,4 +112,8 @@ bool TcpStream::is_open() const {
     return plat::net::is_valid(handle_.get());
 }
 
+bool TcpStream::is_alive() const {
+    return plat::net::is_alive(handle_.get());
+}
+
 } // namespace my::net
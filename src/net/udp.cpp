@@ -41,6 +41,32 @@ UdpSocket::RecvResult UdpSocket::recv_from(usize max_size) {
     return {std::move(result.data), std::move(result.src_ip), result.src_port};
 }
 
+usize UdpSocket::recv_batch(std::span<plat::net::Datagram> msgs) {
+    return plat::net::recv_batch(handle_.get(), msgs.data(), msgs.size());
+}
+
+usize UdpSocket::send_batch(std::span<const plat::net::Datagram> msgs) {
+    usize sent = 0;
+    while (sent < msgs.size()) {
+        const usize n = plat::net::send_batch(handle_.get(), msgs.data() + sent, msgs.size() - sent);
+        if (n == 0) break;
+        sent += n;
+    }
+    return sent;
+}
+
+bool UdpSocket::set_gro(const bool enable) {
+    return plat::net::set_udp_gro(handle_.get(), enable);
+}
+
+bool UdpSocket::set_gso(const u16 segment_size) {
+    return plat::net::set_udp_segment(handle_.get(), segment_size);
+}
+
+plat::net::SockAddr UdpSocket::local_addr() const {
+    return plat::net::make_sock_addr(local_ip_.as_str(), local_port_);
+}
+
 void UdpSocket::set_read_timeout(u32 timeout_ms) {
     plat::net::set_timeout_ms(handle_.get(), timeout_ms, true);
 }
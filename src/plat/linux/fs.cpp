@@ -3,13 +3,25 @@
 #if RICKY_LINUX
 
 #include "fs.hpp"
+#include "option.hpp"
 #include "vec.hpp"
 
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+
 namespace my::plat::fs {
 
 struct FileHandle {
@@ -208,11 +220,17 @@ util::Vec<DirEntry> listdir(str::StringView path) {
         DirEntry info{};
         info.name = str::String<>(entry->d_name);
 
-        auto full_path = join(path, str::StringView(entry->d_name));
-        struct stat st {};
-        if (::stat(full_path.as_cstr(), &st) == 0) {
-            info.is_dir = S_ISDIR(st.st_mode);
-            info.is_file = S_ISREG(st.st_mode);
+        if (entry->d_type == DT_DIR || entry->d_type == DT_REG) {
+            info.is_dir = entry->d_type == DT_DIR;
+            info.is_file = entry->d_type == DT_REG;
+        } else {
+            // 符号链接与未知类型需要 stat 才能得到目标类型
+            auto full_path = join(path, str::StringView(entry->d_name));
+            struct stat st {};
+            if (::stat(full_path.as_cstr(), &st) == 0) {
+                info.is_dir = S_ISDIR(st.st_mode);
+                info.is_file = S_ISREG(st.st_mode);
+            }
         }
 
         results.push(std::move(info));
@@ -222,6 +240,76 @@ util::Vec<DirEntry> listdir(str::StringView path) {
     return results;
 }
 
+namespace {
+
+/**
+ * @brief getdents64 返回的记录布局
+ */
+struct LinuxDirent64 {
+    u64 d_ino;
+    i64 d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+FileType type_from_mode(const mode_t mode) {
+    if (S_ISREG(mode)) return FileType::File;
+    if (S_ISDIR(mode)) return FileType::Dir;
+    if (S_ISLNK(mode)) return FileType::Symlink;
+    return FileType::Other;
+}
+
+} // namespace
+
+void scan_dir(const str::StringView path, util::Vec<ScanEntry>& out) {
+    if (path.is_empty()) {
+        throw argument_exception("Invalid path");
+    }
+    out.clear();
+    const auto path_cstr = path.into_cstr();
+    int fd;
+    do {
+        fd = ::open(path_cstr.get(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+        throw system_exception("Failed to list directory: {}", path);
+    }
+
+    alignas(LinuxDirent64) char buf[32 * 1024];
+    loop {
+        const auto n = ::syscall(SYS_getdents64, fd, buf, sizeof(buf));
+        if (n == 0) break;
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ::close(fd);
+            throw system_exception("Failed to list directory: {}", path);
+        }
+        for (long pos = 0; pos < n;) {
+            const auto* d = reinterpret_cast<const LinuxDirent64*>(buf + pos);
+            pos += d->d_reclen;
+            const char* name = d->d_name;
+            if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+                continue;
+            }
+            FileType type;
+            switch (d->d_type) {
+            case DT_REG: type = FileType::File; break;
+            case DT_DIR: type = FileType::Dir; break;
+            case DT_LNK: type = FileType::Symlink; break;
+            case DT_UNKNOWN: {
+                struct stat st{};
+                type = ::fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) == 0 ? type_from_mode(st.st_mode) : FileType::Unknown;
+                break;
+            }
+            default: type = FileType::Other; break;
+            }
+            out.push(ScanEntry{str::String<>(name, std::strlen(name)), type});
+        }
+    }
+    ::close(fd);
+}
+
 FileHandle* open(str::StringView path, str::StringView mode) {
     if (path.is_empty() || mode.is_empty()) {
         throw argument_exception("Invalid path or mode");
@@ -291,6 +379,38 @@ usize write(FileHandle* file, str::StringView data, usize size) {
     return static_cast<usize>(written);
 }
 
+usize read(FileHandle* file, char* buf, const usize size) {
+    if (file == nullptr || file->fp == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    const size_t n = std::fread(buf, 1, size, file->fp);
+    if (n != size && std::ferror(file->fp)) {
+        throw io_exception("Failed to read file");
+    }
+    return static_cast<usize>(n);
+}
+
+usize write_vectored(FileHandle* file, const IoSlice* slices, const usize n) {
+    const int fd = static_cast<int>(native_handle(file));
+    if (std::fflush(file->fp) != 0) {
+        throw io_exception("Failed to flush file");
+    }
+    constexpr usize MAX_IOV = 64;
+    iovec iov[MAX_IOV];
+    const usize count = std::min(n, MAX_IOV);
+    for (usize i = 0; i < count; ++i) {
+        iov[i].iov_base = const_cast<char*>(slices[i].data);
+        iov[i].iov_len = slices[i].size;
+    }
+    loop {
+        const auto written = ::writev(fd, iov, static_cast<int>(count));
+        if (written >= 0) return static_cast<usize>(written);
+        if (errno != EINTR) {
+            throw io_exception("Failed to write file");
+        }
+    }
+}
+
 void flush(FileHandle* file) {
     if (file == nullptr || file->fp == nullptr) {
         throw null_pointer_exception("Invalid file handle");
@@ -311,6 +431,440 @@ void close(FileHandle* file) {
     delete file;
 }
 
+i64 native_handle(FileHandle* file) {
+    if (file == nullptr || file->fp == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    return ::fileno(file->fp);
+}
+
+usize read_at(FileHandle* file, char* buf, const usize size, const u64 offset) {
+    const int fd = static_cast<int>(native_handle(file));
+    loop {
+        const auto n = ::pread(fd, buf, size, static_cast<off_t>(offset));
+        if (n >= 0) return static_cast<usize>(n);
+        if (errno != EINTR) {
+            throw io_exception("Failed to read file at offset {}", offset);
+        }
+    }
+}
+
+usize write_at(FileHandle* file, const char* data, const usize size, const u64 offset) {
+    const int fd = static_cast<int>(native_handle(file));
+    loop {
+        const auto n = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (n >= 0) return static_cast<usize>(n);
+        if (errno != EINTR) {
+            throw io_exception("Failed to write file at offset {}", offset);
+        }
+    }
+}
+
+struct RawHandle {
+    int fd{-1};
+};
+
+namespace {
+
+RawHandle* check_raw(RawHandle* file) {
+    if (file == nullptr || file->fd < 0) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    return file;
+}
+
+} // namespace
+
+RawHandle* open_raw(const str::StringView path, const RawMode mode) {
+    if (path.is_empty()) {
+        throw argument_exception("Invalid path");
+    }
+    int flags = O_CLOEXEC;
+    switch (mode) {
+    case RawMode::Read: flags |= O_RDONLY; break;
+    case RawMode::ReadWrite: flags |= O_RDWR; break;
+    case RawMode::Create: flags |= O_RDWR | O_CREAT; break;
+    case RawMode::Truncate: flags |= O_RDWR | O_CREAT | O_TRUNC; break;
+    }
+    const auto path_cstr = path.into_cstr();
+    int fd;
+    do {
+        fd = ::open(path_cstr.get(), flags, 0644);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+        throw io_exception("Failed to open file: {}", path);
+    }
+    return new RawHandle{fd};
+}
+
+void close_raw(RawHandle* file) {
+    if (file == nullptr) {
+        return;
+    }
+    if (file->fd >= 0) {
+        ::close(file->fd);
+    }
+    delete file;
+}
+
+i64 native_handle(RawHandle* file) {
+    return check_raw(file)->fd;
+}
+
+usize pread(RawHandle* file, char* buf, const usize size, const u64 offset) {
+    const int fd = check_raw(file)->fd;
+    loop {
+        const auto n = ::pread(fd, buf, size, static_cast<off_t>(offset));
+        if (n >= 0) return static_cast<usize>(n);
+        if (errno != EINTR) {
+            throw io_exception("Failed to read file at offset {}", offset);
+        }
+    }
+}
+
+usize pwrite(RawHandle* file, const char* data, const usize size, const u64 offset) {
+    const int fd = check_raw(file)->fd;
+    loop {
+        const auto n = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (n >= 0) return static_cast<usize>(n);
+        if (errno != EINTR) {
+            throw io_exception("Failed to write file at offset {}", offset);
+        }
+    }
+}
+
+usize preadv(RawHandle* file, const IoSliceMut* slices, const usize n, const u64 offset) {
+    const int fd = check_raw(file)->fd;
+    constexpr usize MAX_IOV = 64;
+    iovec iov[MAX_IOV];
+    const usize count = std::min(n, MAX_IOV);
+    for (usize i = 0; i < count; ++i) {
+        iov[i].iov_base = slices[i].data;
+        iov[i].iov_len = slices[i].size;
+    }
+    loop {
+        const auto read = ::preadv(fd, iov, static_cast<int>(count), static_cast<off_t>(offset));
+        if (read >= 0) return static_cast<usize>(read);
+        if (errno != EINTR) {
+            throw io_exception("Failed to read file at offset {}", offset);
+        }
+    }
+}
+
+usize pwritev(RawHandle* file, const IoSlice* slices, const usize n, const u64 offset) {
+    const int fd = check_raw(file)->fd;
+    constexpr usize MAX_IOV = 64;
+    iovec iov[MAX_IOV];
+    const usize count = std::min(n, MAX_IOV);
+    for (usize i = 0; i < count; ++i) {
+        iov[i].iov_base = const_cast<char*>(slices[i].data);
+        iov[i].iov_len = slices[i].size;
+    }
+    loop {
+        const auto written = ::pwritev(fd, iov, static_cast<int>(count), static_cast<off_t>(offset));
+        if (written >= 0) return static_cast<usize>(written);
+        if (errno != EINTR) {
+            throw io_exception("Failed to write file at offset {}", offset);
+        }
+    }
+}
+
+bool fadvise(RawHandle* file, const FileAdvice advice, const u64 offset, const u64 len) {
+    const int fd = check_raw(file)->fd;
+    int native = POSIX_FADV_NORMAL;
+    switch (advice) {
+    case FileAdvice::Normal: native = POSIX_FADV_NORMAL; break;
+    case FileAdvice::Sequential: native = POSIX_FADV_SEQUENTIAL; break;
+    case FileAdvice::Random: native = POSIX_FADV_RANDOM; break;
+    case FileAdvice::WillNeed: native = POSIX_FADV_WILLNEED; break;
+    case FileAdvice::DontNeed: native = POSIX_FADV_DONTNEED; break;
+    case FileAdvice::NoReuse: native = POSIX_FADV_NOREUSE; break;
+    }
+    return ::posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(len), native) == 0;
+}
+
+u64 file_len(RawHandle* file) {
+    struct stat st{};
+    if (::fstat(check_raw(file)->fd, &st) != 0) {
+        throw io_exception("Failed to get file size");
+    }
+    return static_cast<u64>(st.st_size);
+}
+
+void set_len(RawHandle* file, const u64 len) {
+    const int fd = check_raw(file)->fd;
+    int rc;
+    do {
+        rc = ::ftruncate(fd, static_cast<off_t>(len));
+    } while (rc != 0 && errno == EINTR);
+    if (rc != 0) {
+        throw io_exception("Failed to resize file to {} bytes", len);
+    }
+}
+
+bool allocate(RawHandle* file, const u64 offset, const u64 len) {
+    const int fd = check_raw(file)->fd;
+    int rc;
+    do {
+        rc = ::fallocate(fd, 0, static_cast<off_t>(offset), static_cast<off_t>(len));
+    } while (rc != 0 && errno == EINTR);
+    if (rc == 0) return true;
+    if (errno == EOPNOTSUPP || errno == ENOSYS) return false;
+    throw io_exception("Failed to allocate {} bytes at offset {}: errno {}", len, offset, errno);
+}
+
+void sync(RawHandle* file, const bool metadata) {
+    const int fd = check_raw(file)->fd;
+    if ((metadata ? ::fsync(fd) : ::fdatasync(fd)) != 0) {
+        throw io_exception("Failed to sync file: errno {}", errno);
+    }
+}
+
+void sync_dir(const str::StringView path) {
+    const auto path_cstr = path.into_cstr();
+    int fd;
+    do {
+        fd = ::open(path_cstr.get(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+        throw io_exception("Failed to open directory: {}", path);
+    }
+    const int rc = ::fsync(fd);
+    ::close(fd);
+    if (rc != 0) {
+        throw io_exception("Failed to sync directory: {}", path);
+    }
+}
+
+namespace {
+
+/**
+ * @brief 打开 path，失败时抛出 io_exception
+ */
+int open_fd(const str::StringView path, const int flags, const mode_t mode = 0) {
+    const auto path_cstr = path.into_cstr();
+    int fd;
+    do {
+        fd = ::open(path_cstr.get(), flags | O_CLOEXEC, mode);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+        throw io_exception("Failed to open file: {}: {}", path, std::strerror(errno));
+    }
+    return fd;
+}
+
+/**
+ * @brief 用 copy_file_range 从两个文件的当前位置起复制 len 字节
+ * @return 复制的字节数；内核或文件系统不支持时在复制任何数据之前返回 None
+ */
+Option<u64> copy_range(const int in, const int out, const u64 len, const str::StringView from) {
+    u64 done = 0;
+    while (done < len) {
+        const usize chunk = static_cast<usize>(std::min<u64>(len - done, 1ULL << 30));
+        const ssize_t n = ::copy_file_range(in, nullptr, out, nullptr, chunk, 0);
+        if (n > 0) {
+            done += static_cast<u64>(n);
+            continue;
+        }
+        if (n == 0) break; // 源文件在复制期间变短
+        if (errno == EINTR) continue;
+        if (done == 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP || errno == EPERM)) {
+            return Option<u64>::None();
+        }
+        throw io_exception("Failed to copy file: {}: {}", from, std::strerror(errno));
+    }
+    return Option<u64>::Some(done);
+}
+
+u64 copy_read_write(const int in, const int out, const str::StringView from) {
+    util::Vec<char> buf(128 * 1024);
+    u64 done = 0;
+    loop {
+        const ssize_t n = ::read(in, buf.data(), buf.len());
+        if (n == 0) return done;
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw io_exception("Failed to read file: {}: {}", from, std::strerror(errno));
+        }
+        usize written = 0;
+        while (written < static_cast<usize>(n)) {
+            const ssize_t w = ::write(out, buf.data() + written, static_cast<usize>(n) - written);
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                throw io_exception("Failed to write file: {}", std::strerror(errno));
+            }
+            written += static_cast<usize>(w);
+        }
+        done += static_cast<u64>(n);
+    }
+}
+
+} // namespace
+
+u64 copy_file(const str::StringView from, const str::StringView to) {
+    int in = open_fd(from, O_RDONLY);
+    int out = -1;
+    try {
+        struct stat st{};
+        if (::fstat(in, &st) != 0) {
+            throw io_exception("Failed to stat file: {}: {}", from, std::strerror(errno));
+        }
+        if (!S_ISREG(st.st_mode)) {
+            throw argument_exception("Not a regular file: {}", from);
+        }
+        // 先不截断地打开目标，确认不是源文件本身（同路径、硬链接或符号链接）后再截断
+        out = open_fd(to, O_WRONLY | O_CREAT, st.st_mode & 07777);
+        struct stat out_st{};
+        if (::fstat(out, &out_st) != 0) {
+            throw io_exception("Failed to stat file: {}: {}", to, std::strerror(errno));
+        }
+        if (out_st.st_dev == st.st_dev && out_st.st_ino == st.st_ino) {
+            throw argument_exception("Source and destination are the same file: {}", from);
+        }
+        if (::ftruncate(out, 0) != 0) {
+            throw io_exception("Failed to truncate file: {}: {}", to, std::strerror(errno));
+        }
+
+        u64 copied;
+        if (::ioctl(out, FICLONE, in) == 0) {
+            copied = static_cast<u64>(st.st_size);
+        } else if (auto n = copy_range(in, out, static_cast<u64>(st.st_size), from); n.is_some()) {
+            copied = n.unwrap();
+        } else {
+            copied = copy_read_write(in, out, from);
+        }
+        ::close(std::exchange(in, -1));
+        if (::close(std::exchange(out, -1)) != 0) {
+            throw io_exception("Failed to close file: {}: {}", to, std::strerror(errno));
+        }
+        return copied;
+    } catch (...) {
+        if (in >= 0) ::close(in);
+        if (out >= 0) ::close(out);
+        throw;
+    }
+}
+
+struct MapHandle {
+    u8* data{nullptr};
+    usize len{0};
+};
+
+namespace {
+
+usize page_size() {
+    static const auto size = static_cast<usize>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+} // namespace
+
+MapHandle* map_file(const str::StringView path, const MapMode mode, const u64 len) {
+    if (path.is_empty()) {
+        throw argument_exception("Invalid path");
+    }
+    const auto path_cstr = path.into_cstr();
+    const int flags = mode == MapMode::Read ? O_RDONLY : (mode == MapMode::ReadWrite ? O_RDWR : O_RDWR | O_CREAT | O_TRUNC);
+    int fd;
+    do {
+        fd = ::open(path_cstr.get(), flags | O_CLOEXEC, 0644);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+        throw io_exception("Failed to open file: {}", path);
+    }
+
+    usize size = 0;
+    if (mode == MapMode::Create) {
+        if (::ftruncate(fd, static_cast<off_t>(len)) != 0) {
+            ::close(fd);
+            throw io_exception("Failed to resize file {} to {} bytes", path, len);
+        }
+        size = static_cast<usize>(len);
+    } else {
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw io_exception("Failed to get file size: {}", path);
+        }
+        size = static_cast<usize>(st.st_size);
+    }
+
+    auto* map = new MapHandle{};
+    if (size > 0) {
+        const int prot = mode == MapMode::Read ? PROT_READ : PROT_READ | PROT_WRITE;
+        void* addr = ::mmap(nullptr, size, prot, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            delete map;
+            throw io_exception("Failed to map file {}: errno {}", path, errno);
+        }
+        map->data = static_cast<u8*>(addr);
+        map->len = size;
+    }
+    ::close(fd); // 映射持有对文件的引用
+    return map;
+}
+
+u8* map_data(MapHandle* map) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    return map->data;
+}
+
+usize map_len(MapHandle* map) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    return map->len;
+}
+
+bool map_advise(MapHandle* map, const MapAdvice advice, const usize offset, const usize len) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    if (map->len == 0 || offset >= map->len) {
+        return true;
+    }
+    int native;
+    switch (advice) {
+    case MapAdvice::Normal: native = MADV_NORMAL; break;
+    case MapAdvice::Sequential: native = MADV_SEQUENTIAL; break;
+    case MapAdvice::Random: native = MADV_RANDOM; break;
+    case MapAdvice::WillNeed: native = MADV_WILLNEED; break;
+    case MapAdvice::DontNeed: native = MADV_DONTNEED; break;
+#ifdef MADV_HUGEPAGE
+    case MapAdvice::HugePage: native = MADV_HUGEPAGE; break;
+#endif
+    default: return false;
+    }
+    const usize begin = offset & ~(page_size() - 1);
+    const usize end = std::min(map->len, offset + std::min(len, map->len - offset));
+    return ::madvise(map->data + begin, end - begin, native) == 0;
+}
+
+void map_sync(MapHandle* map, const usize offset, const usize len, const bool async) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    if (map->len == 0 || offset >= map->len) {
+        return;
+    }
+    const usize begin = offset & ~(page_size() - 1);
+    const usize end = std::min(map->len, offset + std::min(len, map->len - offset));
+    if (::msync(map->data + begin, end - begin, async ? MS_ASYNC : MS_SYNC) != 0) {
+        throw io_exception("Failed to sync mapping: errno {}", errno);
+    }
+}
+
+void unmap(MapHandle* map) {
+    if (map == nullptr) return;
+    if (map->data != nullptr) {
+        ::munmap(map->data, map->len);
+    }
+    delete map;
+}
+
 } // namespace my::plat::fs
 
 #endif // RICKY_LINUX
@@ -4,10 +4,16 @@
 
 #include "net.hpp"
 
+#include <algorithm>
 #include <arpa/inet.h>
 #include <cerrno>
+#include <fcntl.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netinet/udp.h>
+#include <sys/sendfile.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 namespace my::plat::net {
@@ -61,6 +67,37 @@ void fill_sockaddr(const str::StringView ip, const u16 port, sockaddr_storage& a
     len = sizeof(sockaddr_in);
 }
 
+socklen_t to_sockaddr(const SockAddr& src, sockaddr_storage& addr) {
+    std::memset(&addr, 0, sizeof(addr));
+    if (src.v6) {
+        auto* a6 = reinterpret_cast<sockaddr_in6*>(&addr);
+        a6->sin6_family = AF_INET6;
+        a6->sin6_port = htons(src.port);
+        std::memcpy(&a6->sin6_addr, src.ip, 16);
+        return sizeof(sockaddr_in6);
+    }
+    auto* a4 = reinterpret_cast<sockaddr_in*>(&addr);
+    a4->sin_family = AF_INET;
+    a4->sin_port = htons(src.port);
+    std::memcpy(&a4->sin_addr, src.ip, 4);
+    return sizeof(sockaddr_in);
+}
+
+SockAddr from_sockaddr(const sockaddr_storage& addr) {
+    SockAddr res;
+    if (addr.ss_family == AF_INET6) {
+        const auto* a6 = reinterpret_cast<const sockaddr_in6*>(&addr);
+        std::memcpy(res.ip, &a6->sin6_addr, 16);
+        res.port = ntohs(a6->sin6_port);
+        res.v6 = true;
+    } else if (addr.ss_family == AF_INET) {
+        const auto* a4 = reinterpret_cast<const sockaddr_in*>(&addr);
+        std::memcpy(res.ip, &a4->sin_addr, 4);
+        res.port = ntohs(a4->sin_port);
+    }
+    return res;
+}
+
 } // namespace
 
 void startup() {}
@@ -222,6 +259,184 @@ void set_option(SocketHandle* socket, const i32 level, const i32 optname, const
     }
 }
 
+bool set_socket_option(SocketHandle* socket, const SocketOption option, const i32 value) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    int level = SOL_SOCKET, optname = 0;
+    switch (option) {
+    case SocketOption::ReuseAddr: optname = SO_REUSEADDR; break;
+    case SocketOption::ReusePort: optname = SO_REUSEPORT; break;
+    case SocketOption::NoDelay: level = IPPROTO_TCP, optname = TCP_NODELAY; break;
+    case SocketOption::DeferAccept: level = IPPROTO_TCP, optname = TCP_DEFER_ACCEPT; break;
+    case SocketOption::RecvBuffer: optname = SO_RCVBUF; break;
+    case SocketOption::SendBuffer: optname = SO_SNDBUF; break;
+    default: return false;
+    }
+    const int opt = value;
+    if (::setsockopt(socket->fd, level, optname, &opt, sizeof(opt)) != 0) {
+        throw system_exception("Set option failed: {}", last_error());
+    }
+    return true;
+}
+
+usize recv_into(SocketHandle* socket, char* buf, const usize size) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    loop {
+        const auto received = ::recv(socket->fd, buf, size, 0);
+        if (received >= 0) return static_cast<usize>(received);
+        if (errno != EINTR) {
+            throw system_exception("Recv failed: {}", last_error());
+        }
+    }
+}
+
+usize send_vectored(SocketHandle* socket, const IoSlice* slices, const usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    constexpr usize MAX_IOV = 64;
+    iovec iov[MAX_IOV];
+    const usize count = std::min(n, MAX_IOV);
+    for (usize i = 0; i < count; ++i) {
+        iov[i].iov_base = const_cast<char*>(slices[i].data);
+        iov[i].iov_len = slices[i].size;
+    }
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+    loop {
+        const auto sent = ::sendmsg(socket->fd, &msg, MSG_NOSIGNAL);
+        if (sent >= 0) return static_cast<usize>(sent);
+        if (errno != EINTR) {
+            throw system_exception("Send failed: {}", last_error());
+        }
+    }
+}
+
+usize send_file(SocketHandle* socket, const i64 file, const u64 offset, const usize len) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    auto off = static_cast<off_t>(offset);
+    loop {
+        const auto sent = ::sendfile(socket->fd, static_cast<int>(file), &off, len);
+        if (sent >= 0) return static_cast<usize>(sent);
+        if (errno != EINTR) {
+            throw system_exception("Send file failed: {}", last_error());
+        }
+    }
+}
+
+void set_nonblocking(SocketHandle* socket, const bool enable) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    const int flags = ::fcntl(socket->fd, F_GETFL, 0);
+    if (flags < 0) {
+        throw system_exception("fcntl failed: {}", last_error());
+    }
+    const int new_flags = enable ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    if (new_flags != flags && ::fcntl(socket->fd, F_SETFL, new_flags) != 0) {
+        throw system_exception("fcntl failed: {}", last_error());
+    }
+}
+
+i64 native_handle(SocketHandle* socket) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    return socket->fd;
+}
+
+SocketHandle* from_native_handle(const i64 native) {
+    auto* handle = new SocketHandle{};
+    handle->fd = static_cast<int>(native);
+    return handle;
+}
+
+Option<usize> try_recv(SocketHandle* socket, char* buf, const usize size) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    loop {
+        const auto received = ::recv(socket->fd, buf, size, 0);
+        if (received >= 0) {
+            return Option<usize>::Some(static_cast<usize>(received));
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return Option<usize>::None();
+        }
+        throw system_exception("Recv failed: {}", last_error());
+    }
+}
+
+Option<usize> try_send(SocketHandle* socket, const char* data, const usize size) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    loop {
+        const auto sent = ::send(socket->fd, data, size, MSG_NOSIGNAL);
+        if (sent >= 0) {
+            return Option<usize>::Some(static_cast<usize>(sent));
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return Option<usize>::None();
+        }
+        throw system_exception("Send failed: {}", last_error());
+    }
+}
+
+Option<usize> try_send_vectored(SocketHandle* socket, const IoSlice* slices, const usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    constexpr usize MAX_IOV = 64;
+    iovec iov[MAX_IOV];
+    const usize count = std::min(n, MAX_IOV);
+    for (usize i = 0; i < count; ++i) {
+        iov[i].iov_base = const_cast<char*>(slices[i].data);
+        iov[i].iov_len = slices[i].size;
+    }
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+    loop {
+        const auto sent = ::sendmsg(socket->fd, &msg, MSG_NOSIGNAL);
+        if (sent >= 0) {
+            return Option<usize>::Some(static_cast<usize>(sent));
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return Option<usize>::None();
+        }
+        throw system_exception("Send failed: {}", last_error());
+    }
+}
+
+SocketHandle* try_accept(SocketHandle* socket) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    loop {
+        const int fd = ::accept4(socket->fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd >= 0) {
+            auto* handle = new SocketHandle{};
+            handle->fd = fd;
+            return handle;
+        }
+        if (errno == EINTR || errno == ECONNABORTED) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return nullptr;
+        }
+        throw system_exception("Accept failed: {}", last_error());
+    }
+}
+
 usize send_to(SocketHandle* socket, const str::StringView data, const usize size, const str::StringView ip, const u16 port, const i32 flags) {
     if (!is_valid(socket)) {
         throw null_pointer_exception("Invalid socket");
@@ -275,6 +490,127 @@ UdpRecvResult recv_from(SocketHandle* socket, const usize size, const i32 flags)
     return result;
 }
 
+SockAddr make_sock_addr(const str::StringView ip, const u16 port) {
+    sockaddr_storage addr{};
+    socklen_t len = sizeof(addr);
+    fill_sockaddr(ip, port, addr, len);
+    return from_sockaddr(addr);
+}
+
+usize recv_batch(SocketHandle* socket, Datagram* msgs, usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    n = std::min(n, MAX_BATCH);
+    if (n == 0) {
+        return 0;
+    }
+    mmsghdr hdrs[MAX_BATCH]{};
+    iovec iovs[MAX_BATCH];
+    sockaddr_storage addrs[MAX_BATCH];
+    alignas(cmsghdr) char controls[MAX_BATCH][CMSG_SPACE(sizeof(int))];
+    for (usize i = 0; i < n; ++i) {
+        iovs[i] = iovec{msgs[i].data, msgs[i].capacity};
+        auto& h = hdrs[i].msg_hdr;
+        h.msg_name = &addrs[i];
+        h.msg_namelen = sizeof(sockaddr_storage);
+        h.msg_iov = &iovs[i];
+        h.msg_iovlen = 1;
+        h.msg_control = controls[i];
+        h.msg_controllen = sizeof(controls[i]);
+    }
+
+    int got;
+    do {
+        // MSG_WAITFORONE：收到第一个后不再阻塞，只取已到达的
+        got = ::recvmmsg(socket->fd, hdrs, static_cast<unsigned>(n), MSG_WAITFORONE, nullptr);
+    } while (got < 0 && errno == EINTR);
+    if (got < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        throw system_exception("Recvmmsg failed: {}", last_error());
+    }
+
+    for (usize i = 0; i < static_cast<usize>(got); ++i) {
+        auto& m = msgs[i];
+        const auto& h = hdrs[i].msg_hdr;
+        m.len = hdrs[i].msg_len;
+        m.addr = from_sockaddr(addrs[i]);
+        m.truncated = (h.msg_flags & MSG_TRUNC) != 0;
+        m.segment_size = 0;
+        for (auto* c = CMSG_FIRSTHDR(&h); c != nullptr; c = CMSG_NXTHDR(const_cast<msghdr*>(&h), c)) {
+            if (c->cmsg_level == SOL_UDP && c->cmsg_type == UDP_GRO) {
+                int seg = 0;
+                std::memcpy(&seg, CMSG_DATA(c), sizeof(seg));
+                m.segment_size = static_cast<u16>(seg);
+            }
+        }
+    }
+    return static_cast<usize>(got);
+}
+
+usize send_batch(SocketHandle* socket, const Datagram* msgs, usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    n = std::min(n, MAX_BATCH);
+    if (n == 0) {
+        return 0;
+    }
+    mmsghdr hdrs[MAX_BATCH]{};
+    iovec iovs[MAX_BATCH];
+    sockaddr_storage addrs[MAX_BATCH];
+    for (usize i = 0; i < n; ++i) {
+        iovs[i] = iovec{msgs[i].data, msgs[i].len};
+        auto& h = hdrs[i].msg_hdr;
+        h.msg_name = &addrs[i];
+        h.msg_namelen = to_sockaddr(msgs[i].addr, addrs[i]);
+        h.msg_iov = &iovs[i];
+        h.msg_iovlen = 1;
+    }
+
+    int sent;
+    do {
+        sent = ::sendmmsg(socket->fd, hdrs, static_cast<unsigned>(n), MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    if (sent < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        throw system_exception("Sendmmsg failed: {}", last_error());
+    }
+    return static_cast<usize>(sent);
+}
+
+bool set_udp_gro(SocketHandle* socket, const bool enable) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    const int opt = enable ? 1 : 0;
+    return ::setsockopt(socket->fd, SOL_UDP, UDP_GRO, &opt, sizeof(opt)) == 0;
+}
+
+bool set_udp_segment(SocketHandle* socket, const u16 segment_size) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    const int opt = segment_size;
+    return ::setsockopt(socket->fd, SOL_UDP, UDP_SEGMENT, &opt, sizeof(opt)) == 0;
+}
+
+bool is_alive(SocketHandle* socket) {
+    if (!is_valid(socket)) {
+        return false;
+    }
+    char byte;
+    ssize_t n;
+    do {
+        n = ::recv(socket->fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    } while (n < 0 && errno == EINTR);
+    return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+}
+
 } // namespace my::plat::net
 
 #endif // RICKY_LINUX
@@ -0,0 +1,109 @@
+#include "my_config.hpp"
+
+#if RICKY_LINUX
+
+#include "poller.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace my::plat::poller {
+
+struct PollerHandle {
+    int epfd{-1};
+    int wakefd{-1};
+};
+
+PollerHandle* create() {
+    const int epfd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0) {
+        throw system_exception("epoll_create1 failed: {}", net::last_error());
+    }
+    const int wakefd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakefd < 0) {
+        ::close(epfd);
+        throw system_exception("eventfd failed: {}", net::last_error());
+    }
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLET;
+    ev.data.u64 = 0;
+    if (::epoll_ctl(epfd, EPOLL_CTL_ADD, wakefd, &ev) != 0) {
+        ::close(wakefd);
+        ::close(epfd);
+        throw system_exception("epoll_ctl failed: {}", net::last_error());
+    }
+    return new PollerHandle{epfd, wakefd};
+}
+
+void close(PollerHandle* poller) {
+    if (poller == nullptr) {
+        return;
+    }
+    ::close(poller->wakefd);
+    ::close(poller->epfd);
+    delete poller;
+}
+
+void add(PollerHandle* poller, net::SocketHandle* socket, const u64 token) {
+    if (poller == nullptr) {
+        throw null_pointer_exception("Invalid poller");
+    }
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    ev.data.u64 = token;
+    if (::epoll_ctl(poller->epfd, EPOLL_CTL_ADD, static_cast<int>(net::native_handle(socket)), &ev) != 0) {
+        throw system_exception("epoll_ctl add failed: {}", net::last_error());
+    }
+}
+
+void remove(PollerHandle* poller, net::SocketHandle* socket) {
+    if (poller == nullptr) {
+        throw null_pointer_exception("Invalid poller");
+    }
+    if (::epoll_ctl(poller->epfd, EPOLL_CTL_DEL, static_cast<int>(net::native_handle(socket)), nullptr) != 0 && errno != ENOENT) {
+        throw system_exception("epoll_ctl del failed: {}", net::last_error());
+    }
+}
+
+usize wait(PollerHandle* poller, PollEvent* events, const usize max_events, const i32 timeout_ms) {
+    if (poller == nullptr) {
+        throw null_pointer_exception("Invalid poller");
+    }
+    constexpr usize BATCH = 256;
+    epoll_event raw[BATCH];
+    const int n = ::epoll_wait(poller->epfd, raw, static_cast<int>(std::min(max_events, BATCH)), timeout_ms);
+    if (n < 0) {
+        if (errno == EINTR) {
+            return 0;
+        }
+        throw system_exception("epoll_wait failed: {}", net::last_error());
+    }
+    for (int i = 0; i < n; ++i) {
+        const u32 flags = raw[i].events;
+        auto& ev = events[i];
+        ev.token = raw[i].data.u64;
+        ev.readable = (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0;
+        ev.writable = (flags & (EPOLLOUT | EPOLLHUP | EPOLLERR)) != 0;
+        ev.hangup = (flags & (EPOLLHUP | EPOLLERR)) != 0;
+        if (ev.token == 0) {
+            u64 drained = 0;
+            (void)::read(poller->wakefd, &drained, sizeof(drained));
+        }
+    }
+    return static_cast<usize>(n);
+}
+
+void wake(PollerHandle* poller) {
+    if (poller == nullptr) {
+        throw null_pointer_exception("Invalid poller");
+    }
+    const u64 one = 1;
+    (void)::write(poller->wakefd, &one, sizeof(one));
+}
+
+} // namespace my::plat::poller
+
+#endif // RICKY_LINUX
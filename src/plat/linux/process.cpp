@@ -4,8 +4,17 @@
 
 #include "process.hpp"
 
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+
 namespace my::plat::process {
 
 u32 pid() {
@@ -14,6 +23,51 @@ u32 pid() {
 
 void set_console_utf8() {}
 
+usize capture_stack(void** frames, const usize max_frames, const usize skip) {
+    constexpr usize MAX_DEPTH = 128;
+    void* buf[MAX_DEPTH];
+    const usize want = std::min(max_frames + skip + 1, MAX_DEPTH);
+    const usize got = static_cast<usize>(::backtrace(buf, static_cast<int>(want)));
+    const usize first = std::min(got, skip + 1); // 跳过本函数
+    const usize n = std::min(got - first, max_frames);
+    std::copy_n(buf + first, n, frames);
+    return n;
+}
+
+std::string symbolize(void* addr) {
+    Dl_info info{};
+    if (::dladdr(addr, &info) == 0) {
+        return std::format("{}", addr);
+    }
+    if (info.dli_sname != nullptr) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        std::string name = status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+        std::free(demangled);
+        return name;
+    }
+    const char* module = info.dli_fname != nullptr ? info.dli_fname : "?";
+    if (const char* slash = std::strrchr(module, '/'); slash != nullptr) {
+        module = slash + 1;
+    }
+    return std::format("{}+{:#x}", module, static_cast<char*>(addr) - static_cast<char*>(info.dli_fbase));
+}
+
+std::string memory_maps() {
+    std::string maps;
+    std::FILE* f = std::fopen("/proc/self/maps", "r");
+    if (f == nullptr) {
+        return maps;
+    }
+    char buf[4096];
+    usize n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) {
+        maps.append(buf, n);
+    }
+    std::fclose(f);
+    return maps;
+}
+
 } // namespace my::plat::process
 
 #endif // RICKY_LINUX
@@ -0,0 +1,287 @@
+#include "my_config.hpp"
+
+#if RICKY_LINUX
+
+#include "uring.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace my::plat::uring {
+
+/**
+ * @brief 直接通过 io_uring_setup/io_uring_enter/io_uring_register 系统调用驱动的环，不依赖 liburing
+ * @details sq_tail 只在 submit 时发布，prep_* 只推进本地的 local_tail
+ */
+struct RingHandle {
+    int fd{-1};
+
+    void* sq_ring{nullptr};
+    usize sq_ring_len{0};
+    void* cq_ring{nullptr};
+    usize cq_ring_len{0};
+    io_uring_sqe* sqes{nullptr};
+    usize sqes_len{0};
+
+    u32* sq_head{nullptr};
+    u32* sq_tail{nullptr};
+    u32* sq_array{nullptr};
+    u32 sq_mask{0};
+    u32 sq_entries{0};
+    u32 local_tail{0};
+
+    u32* cq_head{nullptr};
+    u32* cq_tail{nullptr};
+    io_uring_cqe* cqes{nullptr};
+    u32 cq_mask{0};
+
+    bool buffers_registered{false};
+};
+
+namespace {
+
+int sys_setup(const u32 entries, io_uring_params* params) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sys_enter(const int fd, const u32 to_submit, const u32 min_complete, const u32 flags) {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int sys_register(const int fd, const u32 opcode, const void* arg, const u32 nr_args) {
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+u32 load_acquire(const u32* p) {
+    return std::atomic_ref<const u32>(*p).load(std::memory_order_acquire);
+}
+
+void store_release(u32* p, const u32 v) {
+    std::atomic_ref<u32>(*p).store(v, std::memory_order_release);
+}
+
+template <typename T>
+T* at_offset(void* base, const u32 offset) {
+    return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+void unmap(RingHandle* ring) {
+    if (ring->sqes != nullptr) ::munmap(ring->sqes, ring->sqes_len);
+    if (ring->cq_ring != nullptr && ring->cq_ring != ring->sq_ring) ::munmap(ring->cq_ring, ring->cq_ring_len);
+    if (ring->sq_ring != nullptr) ::munmap(ring->sq_ring, ring->sq_ring_len);
+}
+
+bool probe() {
+    if (const char* env = std::getenv("RICKY_IO_URING"); env != nullptr && std::strcmp(env, "0") == 0) {
+        return false;
+    }
+    io_uring_params params{};
+    const int fd = sys_setup(2, &params);
+    if (fd < 0) {
+        return false; // ENOSYS：内核过旧；EPERM：被 sysctl/seccomp 禁用
+    }
+
+    constexpr u32 PROBE_OPS = 64;
+    const usize probe_size = sizeof(io_uring_probe) + PROBE_OPS * sizeof(io_uring_probe_op);
+    auto* probe = static_cast<io_uring_probe*>(std::calloc(1, probe_size));
+    bool ok = probe != nullptr && sys_register(fd, IORING_REGISTER_PROBE, probe, PROBE_OPS) == 0;
+    if (ok) {
+        for (const u32 op : {IORING_OP_ACCEPT, IORING_OP_RECV, IORING_OP_SEND, IORING_OP_READ, IORING_OP_WRITE,
+                             IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED}) {
+            ok = ok && op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+        }
+    }
+    std::free(probe);
+    ::close(fd);
+    return ok;
+}
+
+io_uring_sqe* next_sqe(RingHandle* ring) {
+    const u32 head = load_acquire(ring->sq_head);
+    if (ring->local_tail - head >= ring->sq_entries) {
+        return nullptr;
+    }
+    const u32 idx = ring->local_tail & ring->sq_mask;
+    auto* sqe = &ring->sqes[idx];
+    std::memset(sqe, 0, sizeof(*sqe));
+    ring->sq_array[idx] = idx;
+    ++ring->local_tail;
+    return sqe;
+}
+
+bool prep_rw(RingHandle* ring, const u8 opcode, const i64 fd, const void* addr, const usize len, const u64 offset, const u64 user_data) {
+    auto* sqe = next_sqe(ring);
+    if (sqe == nullptr) return false;
+    sqe->opcode = opcode;
+    sqe->fd = static_cast<i32>(fd);
+    sqe->addr = reinterpret_cast<u64>(addr);
+    sqe->len = static_cast<u32>(len);
+    sqe->off = offset;
+    sqe->user_data = user_data;
+    return true;
+}
+
+} // namespace
+
+bool is_supported() {
+    static const bool supported = probe();
+    return supported;
+}
+
+RingHandle* create(const u32 entries) {
+    io_uring_params params{};
+    const int fd = sys_setup(entries, &params);
+    if (fd < 0) {
+        throw system_exception("io_uring_setup failed: {}", net::last_error());
+    }
+
+    auto* ring = new RingHandle{};
+    ring->fd = fd;
+    ring->sq_ring_len = params.sq_off.array + params.sq_entries * sizeof(u32);
+    ring->cq_ring_len = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        ring->sq_ring_len = ring->cq_ring_len = std::max(ring->sq_ring_len, ring->cq_ring_len);
+    }
+
+    auto map = [fd](const usize len, const u64 offset) -> void* {
+        void* p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, static_cast<off_t>(offset));
+        return p == MAP_FAILED ? nullptr : p;
+    };
+    ring->sq_ring = map(ring->sq_ring_len, IORING_OFF_SQ_RING);
+    ring->cq_ring = single_mmap ? ring->sq_ring : map(ring->cq_ring_len, IORING_OFF_CQ_RING);
+    ring->sqes_len = params.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes = static_cast<io_uring_sqe*>(map(ring->sqes_len, IORING_OFF_SQES));
+    if (ring->sq_ring == nullptr || ring->cq_ring == nullptr || ring->sqes == nullptr) {
+        const auto err = net::last_error();
+        unmap(ring);
+        ::close(fd);
+        delete ring;
+        throw system_exception("io_uring mmap failed: {}", err);
+    }
+
+    ring->sq_head = at_offset<u32>(ring->sq_ring, params.sq_off.head);
+    ring->sq_tail = at_offset<u32>(ring->sq_ring, params.sq_off.tail);
+    ring->sq_array = at_offset<u32>(ring->sq_ring, params.sq_off.array);
+    ring->sq_mask = *at_offset<u32>(ring->sq_ring, params.sq_off.ring_mask);
+    ring->sq_entries = *at_offset<u32>(ring->sq_ring, params.sq_off.ring_entries);
+    ring->local_tail = *ring->sq_tail;
+
+    ring->cq_head = at_offset<u32>(ring->cq_ring, params.cq_off.head);
+    ring->cq_tail = at_offset<u32>(ring->cq_ring, params.cq_off.tail);
+    ring->cqes = at_offset<io_uring_cqe>(ring->cq_ring, params.cq_off.cqes);
+    ring->cq_mask = *at_offset<u32>(ring->cq_ring, params.cq_off.ring_mask);
+    return ring;
+}
+
+void close(RingHandle* ring) {
+    if (ring == nullptr) return;
+    unmap(ring);
+    if (ring->fd >= 0) ::close(ring->fd);
+    delete ring;
+}
+
+void register_buffers(RingHandle* ring, const FixedBuffer* buffers, const usize n) {
+    if (ring->buffers_registered) {
+        throw state_exception("io_uring buffers are already registered");
+    }
+    util::Vec<iovec> iov;
+    for (usize i = 0; i < n; ++i) {
+        iov.push(iovec{buffers[i].data, buffers[i].size});
+    }
+    if (sys_register(ring->fd, IORING_REGISTER_BUFFERS, iov.data(), static_cast<u32>(n)) != 0) {
+        throw system_exception("io_uring buffer registration failed: {}", net::last_error());
+    }
+    ring->buffers_registered = true;
+}
+
+bool prep_accept(RingHandle* ring, net::SocketHandle* listener, const u64 user_data) {
+    auto* sqe = next_sqe(ring);
+    if (sqe == nullptr) return false;
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = static_cast<i32>(net::native_handle(listener));
+    sqe->accept_flags = SOCK_CLOEXEC;
+    sqe->user_data = user_data;
+    return true;
+}
+
+bool prep_recv(RingHandle* ring, net::SocketHandle* socket, char* buf, const usize size, const u64 user_data) {
+    return prep_rw(ring, IORING_OP_RECV, net::native_handle(socket), buf, size, 0, user_data);
+}
+
+bool prep_send(RingHandle* ring, net::SocketHandle* socket, const char* data, const usize size, const u64 user_data) {
+    auto* sqe = next_sqe(ring);
+    if (sqe == nullptr) return false;
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = static_cast<i32>(net::native_handle(socket));
+    sqe->addr = reinterpret_cast<u64>(data);
+    sqe->len = static_cast<u32>(size);
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = user_data;
+    return true;
+}
+
+bool prep_read(RingHandle* ring, fs::FileHandle* file, char* buf, const usize size, const u64 offset, const u64 user_data) {
+    return prep_rw(ring, IORING_OP_READ, fs::native_handle(file), buf, size, offset, user_data);
+}
+
+bool prep_write(RingHandle* ring, fs::FileHandle* file, const char* data, const usize size, const u64 offset, const u64 user_data) {
+    return prep_rw(ring, IORING_OP_WRITE, fs::native_handle(file), data, size, offset, user_data);
+}
+
+bool prep_read_fixed(RingHandle* ring, const i64 native, char* buf, const usize size, const u64 offset, const u32 buf_index, const u64 user_data) {
+    if (!prep_rw(ring, IORING_OP_READ_FIXED, native, buf, size, offset, user_data)) return false;
+    ring->sqes[(ring->local_tail - 1) & ring->sq_mask].buf_index = static_cast<u16>(buf_index);
+    return true;
+}
+
+bool prep_write_fixed(RingHandle* ring, const i64 native, const char* data, const usize size, const u64 offset, const u32 buf_index, const u64 user_data) {
+    if (!prep_rw(ring, IORING_OP_WRITE_FIXED, native, data, size, offset, user_data)) return false;
+    ring->sqes[(ring->local_tail - 1) & ring->sq_mask].buf_index = static_cast<u16>(buf_index);
+    return true;
+}
+
+usize submit(RingHandle* ring, const usize wait_nr) {
+    const u32 to_submit = ring->local_tail - *ring->sq_tail;
+    store_release(ring->sq_tail, ring->local_tail);
+    if (to_submit == 0 && wait_nr == 0) {
+        return 0;
+    }
+
+    const u32 flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+    const int ret = sys_enter(ring->fd, to_submit, static_cast<u32>(wait_nr), flags);
+    if (ret >= 0) {
+        return static_cast<usize>(ret);
+    }
+    if (errno != EINTR) {
+        throw system_exception("io_uring_enter failed: {}", net::last_error());
+    }
+    // 被信号打断时提交已完成，只是等待被中断；调用方按需再次等待
+    return to_submit;
+}
+
+usize reap(RingHandle* ring, Cqe* out, const usize max) {
+    u32 head = *ring->cq_head;
+    const u32 tail = load_acquire(ring->cq_tail);
+    usize n = 0;
+    while (head != tail && n < max) {
+        const auto& cqe = ring->cqes[head & ring->cq_mask];
+        out[n++] = Cqe{cqe.user_data, cqe.res};
+        ++head;
+    }
+    store_release(ring->cq_head, head);
+    return n;
+}
+
+} // namespace my::plat::uring
+
+#endif // RICKY_LINUX
@@ -5,6 +5,9 @@
 #include "fs.hpp"
 
 #include <Windows.h>
+#include <algorithm>
+#include <cstring>
+#include <io.h>
 
 namespace my::plat::fs {
 
@@ -227,6 +230,39 @@ util::Vec<DirEntry> listdir(const str::StringView path) {
     return results;
 }
 
+void scan_dir(const str::StringView path, util::Vec<ScanEntry>& out) {
+    if (path.len() == 0) {
+        throw argument_exception("Invalid path");
+    }
+    out.clear();
+    WIN32_FIND_DATAA find_data;
+    const auto pattern = join(path, str::StringView("*"));
+    const auto pattern_cstr = pattern.into_cstr();
+    // 不查询短文件名，并让内核每次返回更多目录项
+    auto handle = ::FindFirstFileExA(pattern_cstr.get(), FindExInfoBasic, &find_data, FindExSearchNameMatch, nullptr,
+                                     FIND_FIRST_EX_LARGE_FETCH);
+    if (handle == INVALID_HANDLE_VALUE) {
+        throw system_exception("Failed to list directory: {}", path);
+    }
+    do {
+        const char* name = find_data.cFileName;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+            continue;
+        }
+        const DWORD attrs = find_data.dwFileAttributes;
+        FileType type = FileType::File;
+        if (attrs & FILE_ATTRIBUTE_REPARSE_POINT) {
+            type = FileType::Symlink;
+        } else if (attrs & FILE_ATTRIBUTE_DIRECTORY) {
+            type = FileType::Dir;
+        } else if (attrs & FILE_ATTRIBUTE_DEVICE) {
+            type = FileType::Other;
+        }
+        out.push(ScanEntry{str::String<>(name, std::strlen(name)), type});
+    } while (::FindNextFileA(handle, &find_data));
+    ::FindClose(handle);
+}
+
 FileHandle* open(const str::StringView path, const str::StringView mode) {
     if (path.len() == 0 || mode.len() == 0) {
         throw argument_exception("Invalid path or mode");
@@ -307,6 +343,36 @@ usize write(FileHandle* file, const str::StringView data, const usize size) {
     return static_cast<usize>(written);
 }
 
+usize read(FileHandle* file, char* buf, const usize size) {
+    if (file == nullptr || file->fp == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    const size_t n = std::fread(buf, 1, size, file->fp);
+    if (n != size && std::ferror(file->fp)) {
+        throw io_exception("Failed to read file");
+    }
+    return static_cast<usize>(n);
+}
+
+usize write_vectored(FileHandle* file, const IoSlice* slices, const usize n) {
+    if (file == nullptr || file->fp == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    // 没有面向文件的 writev，逐段写入 FILE*，大块数据由 CRT 直接写出
+    usize total = 0;
+    for (usize i = 0; i < n; ++i) {
+        const size_t written = std::fwrite(slices[i].data, 1, slices[i].size, file->fp);
+        total += written;
+        if (written != slices[i].size) {
+            if (std::ferror(file->fp)) {
+                throw io_exception("Failed to write file");
+            }
+            break;
+        }
+    }
+    return total;
+}
+
 void flush(FileHandle* file) {
     if (file == nullptr || file->fp == nullptr) {
         throw null_pointer_exception("Invalid file handle");
@@ -327,6 +393,293 @@ void close(FileHandle* file) {
     delete file;
 }
 
+i64 native_handle(FileHandle* file) {
+    if (file == nullptr || file->fp == nullptr) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    return static_cast<i64>(::_get_osfhandle(::_fileno(file->fp)));
+}
+
+usize read_at(FileHandle* file, char* buf, const usize size, const u64 offset) {
+    auto* h = reinterpret_cast<HANDLE>(native_handle(file));
+    OVERLAPPED ov{};
+    ov.Offset = static_cast<DWORD>(offset);
+    ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD n = 0;
+    if (!::ReadFile(h, buf, static_cast<DWORD>(size), &n, &ov) && ::GetLastError() != ERROR_HANDLE_EOF) {
+        throw io_exception("Failed to read file at offset {}", offset);
+    }
+    return static_cast<usize>(n);
+}
+
+usize write_at(FileHandle* file, const char* data, const usize size, const u64 offset) {
+    auto* h = reinterpret_cast<HANDLE>(native_handle(file));
+    OVERLAPPED ov{};
+    ov.Offset = static_cast<DWORD>(offset);
+    ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD n = 0;
+    if (!::WriteFile(h, data, static_cast<DWORD>(size), &n, &ov)) {
+        throw io_exception("Failed to write file at offset {}", offset);
+    }
+    return static_cast<usize>(n);
+}
+
+struct RawHandle {
+    HANDLE h{INVALID_HANDLE_VALUE};
+};
+
+namespace {
+
+HANDLE check_raw(RawHandle* file) {
+    if (file == nullptr || file->h == INVALID_HANDLE_VALUE) {
+        throw null_pointer_exception("Invalid file handle");
+    }
+    return file->h;
+}
+
+OVERLAPPED at_offset(const u64 offset) {
+    OVERLAPPED ov{};
+    ov.Offset = static_cast<DWORD>(offset);
+    ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    return ov;
+}
+
+} // namespace
+
+RawHandle* open_raw(const str::StringView path, const RawMode mode) {
+    if (path.len() == 0) {
+        throw argument_exception("Invalid path");
+    }
+    DWORD access = GENERIC_READ | GENERIC_WRITE;
+    DWORD disposition = OPEN_EXISTING;
+    switch (mode) {
+    case RawMode::Read: access = GENERIC_READ; break;
+    case RawMode::ReadWrite: break;
+    case RawMode::Create: disposition = OPEN_ALWAYS; break;
+    case RawMode::Truncate: disposition = CREATE_ALWAYS; break;
+    }
+    const auto path_cstr = path.into_cstr();
+    HANDLE h = ::CreateFileA(path_cstr.get(), access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                             disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (h == INVALID_HANDLE_VALUE) {
+        throw io_exception("Failed to open file: {}", path);
+    }
+    return new RawHandle{h};
+}
+
+void close_raw(RawHandle* file) {
+    if (file == nullptr) {
+        return;
+    }
+    if (file->h != INVALID_HANDLE_VALUE) {
+        ::CloseHandle(file->h);
+    }
+    delete file;
+}
+
+i64 native_handle(RawHandle* file) {
+    return reinterpret_cast<i64>(check_raw(file));
+}
+
+usize pread(RawHandle* file, char* buf, const usize size, const u64 offset) {
+    HANDLE h = check_raw(file);
+    auto ov = at_offset(offset);
+    DWORD n = 0;
+    if (!::ReadFile(h, buf, static_cast<DWORD>(size), &n, &ov) && ::GetLastError() != ERROR_HANDLE_EOF) {
+        throw io_exception("Failed to read file at offset {}", offset);
+    }
+    return static_cast<usize>(n);
+}
+
+usize pwrite(RawHandle* file, const char* data, const usize size, const u64 offset) {
+    HANDLE h = check_raw(file);
+    auto ov = at_offset(offset);
+    DWORD n = 0;
+    if (!::WriteFile(h, data, static_cast<DWORD>(size), &n, &ov)) {
+        throw io_exception("Failed to write file at offset {}", offset);
+    }
+    return static_cast<usize>(n);
+}
+
+usize preadv(RawHandle* file, const IoSliceMut* slices, const usize n, const u64 offset) {
+    // 同步句柄上没有分散读，逐段读取，遇到短读即停止
+    usize total = 0;
+    for (usize i = 0; i < n; ++i) {
+        const usize got = pread(file, slices[i].data, slices[i].size, offset + total);
+        total += got;
+        if (got < slices[i].size) break;
+    }
+    return total;
+}
+
+usize pwritev(RawHandle* file, const IoSlice* slices, const usize n, const u64 offset) {
+    usize total = 0;
+    for (usize i = 0; i < n; ++i) {
+        const usize put = pwrite(file, slices[i].data, slices[i].size, offset + total);
+        total += put;
+        if (put < slices[i].size) break;
+    }
+    return total;
+}
+
+bool fadvise(RawHandle* file, const FileAdvice, const u64, const u64) {
+    check_raw(file);
+    return false; // 访问模式只能在 CreateFile 时通过标志指定
+}
+
+u64 file_len(RawHandle* file) {
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(check_raw(file), &size)) {
+        throw io_exception("Failed to get file size");
+    }
+    return static_cast<u64>(size.QuadPart);
+}
+
+void set_len(RawHandle* file, const u64 len) {
+    FILE_END_OF_FILE_INFO info{};
+    info.EndOfFile.QuadPart = static_cast<LONGLONG>(len);
+    if (!::SetFileInformationByHandle(check_raw(file), FileEndOfFileInfo, &info, sizeof(info))) {
+        throw io_exception("Failed to resize file to {} bytes", len);
+    }
+}
+
+bool allocate(RawHandle* file, const u64 offset, const u64 len) {
+    // FileAllocationInfo 只分配磁盘块、不改变文件长度，需再把长度设到分配区间末尾
+    HANDLE h = check_raw(file);
+    FILE_ALLOCATION_INFO info{};
+    info.AllocationSize.QuadPart = static_cast<LONGLONG>(offset + len);
+    if (!::SetFileInformationByHandle(h, FileAllocationInfo, &info, sizeof(info))) {
+        return false;
+    }
+    if (file_len(file) < offset + len) {
+        set_len(file, offset + len);
+    }
+    return true;
+}
+
+void sync(RawHandle* file, const bool) {
+    if (!::FlushFileBuffers(check_raw(file))) {
+        throw io_exception("Failed to sync file");
+    }
+}
+
+void sync_dir(const str::StringView) {}
+
+u64 copy_file(const str::StringView from, const str::StringView to) {
+    const auto from_cstr = from.into_cstr();
+    const auto to_cstr = to.into_cstr();
+    WIN32_FILE_ATTRIBUTE_DATA attr{};
+    if (!::GetFileAttributesExA(from_cstr.get(), GetFileExInfoStandard, &attr)) {
+        throw io_exception("Failed to stat file: {}", from);
+    }
+    if (attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+        throw argument_exception("Not a regular file: {}", from);
+    }
+    if (!::CopyFileA(from_cstr.get(), to_cstr.get(), FALSE)) {
+        throw io_exception("Failed to copy file: {} -> {}", from, to);
+    }
+    return (static_cast<u64>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+}
+
+struct MapHandle {
+    u8* data{nullptr};
+    usize len{0};
+};
+
+MapHandle* map_file(const str::StringView path, const MapMode mode, const u64 len) {
+    if (path.len() == 0) {
+        throw argument_exception("Invalid path");
+    }
+    const auto path_cstr = path.into_cstr();
+    const DWORD access = mode == MapMode::Read ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+    const DWORD disposition = mode == MapMode::Create ? CREATE_ALWAYS : OPEN_EXISTING;
+    HANDLE file = ::CreateFileA(path_cstr.get(), access, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, disposition,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw io_exception("Failed to open file: {}", path);
+    }
+
+    u64 size = len;
+    if (mode != MapMode::Create) {
+        LARGE_INTEGER st{};
+        if (!::GetFileSizeEx(file, &st)) {
+            ::CloseHandle(file);
+            throw io_exception("Failed to get file size: {}", path);
+        }
+        size = static_cast<u64>(st.QuadPart);
+    }
+
+    auto* map = new MapHandle{};
+    if (size > 0) {
+        // Create 时 CreateFileMapping 按最大长度扩展文件
+        const DWORD protect = mode == MapMode::Read ? PAGE_READONLY : PAGE_READWRITE;
+        HANDLE mapping = ::CreateFileMappingA(file, nullptr, protect, static_cast<DWORD>(size >> 32),
+                                              static_cast<DWORD>(size), nullptr);
+        void* addr = nullptr;
+        if (mapping != nullptr) {
+            addr = ::MapViewOfFile(mapping, mode == MapMode::Read ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0);
+            ::CloseHandle(mapping); // 视图持有对映射对象的引用
+        }
+        if (addr == nullptr) {
+            ::CloseHandle(file);
+            delete map;
+            throw io_exception("Failed to map file: {}", path);
+        }
+        map->data = static_cast<u8*>(addr);
+        map->len = static_cast<usize>(size);
+    }
+    ::CloseHandle(file);
+    return map;
+}
+
+u8* map_data(MapHandle* map) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    return map->data;
+}
+
+usize map_len(MapHandle* map) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    return map->len;
+}
+
+bool map_advise(MapHandle* map, const MapAdvice advice, const usize offset, const usize len) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    if (map->len == 0 || offset >= map->len) {
+        return true;
+    }
+    if (advice != MapAdvice::WillNeed) {
+        return false; // 其余提示没有对应的 Win32 接口
+    }
+    WIN32_MEMORY_RANGE_ENTRY range{map->data + offset, std::min(len, map->len - offset)};
+    return ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0) != 0;
+}
+
+void map_sync(MapHandle* map, const usize offset, const usize len, const bool) {
+    if (map == nullptr) {
+        throw null_pointer_exception("Invalid map handle");
+    }
+    if (map->len == 0 || offset >= map->len) {
+        return;
+    }
+    if (!::FlushViewOfFile(map->data + offset, std::min(len, map->len - offset))) {
+        throw io_exception("Failed to sync mapping");
+    }
+}
+
+void unmap(MapHandle* map) {
+    if (map == nullptr) return;
+    if (map->data != nullptr) {
+        ::UnmapViewOfFile(map->data);
+    }
+    delete map;
+}
+
 } // namespace my::plat::fs
 
 #endif // RICKY_WIN
@@ -4,7 +4,9 @@
 
 #include "net.hpp"
 
+#include <algorithm>
 #include <winsock2.h>
+#include <mswsock.h>
 #include <ws2tcpip.h>
 
 namespace my::plat::net {
@@ -58,6 +60,37 @@ void fill_sockaddr(const str::StringView ip, const u16 port, sockaddr_storage& a
     len = sizeof(sockaddr_in);
 }
 
+int to_sockaddr(const SockAddr& src, sockaddr_storage& addr) {
+    std::memset(&addr, 0, sizeof(addr));
+    if (src.v6) {
+        auto* a6 = reinterpret_cast<sockaddr_in6*>(&addr);
+        a6->sin6_family = AF_INET6;
+        a6->sin6_port = htons(src.port);
+        std::memcpy(&a6->sin6_addr, src.ip, 16);
+        return sizeof(sockaddr_in6);
+    }
+    auto* a4 = reinterpret_cast<sockaddr_in*>(&addr);
+    a4->sin_family = AF_INET;
+    a4->sin_port = htons(src.port);
+    std::memcpy(&a4->sin_addr, src.ip, 4);
+    return sizeof(sockaddr_in);
+}
+
+SockAddr from_sockaddr(const sockaddr_storage& addr) {
+    SockAddr res;
+    if (addr.ss_family == AF_INET6) {
+        const auto* a6 = reinterpret_cast<const sockaddr_in6*>(&addr);
+        std::memcpy(res.ip, &a6->sin6_addr, 16);
+        res.port = ntohs(a6->sin6_port);
+        res.v6 = true;
+    } else if (addr.ss_family == AF_INET) {
+        const auto* a4 = reinterpret_cast<const sockaddr_in*>(&addr);
+        std::memcpy(res.ip, &a4->sin_addr, 4);
+        res.port = ntohs(a4->sin_port);
+    }
+    return res;
+}
+
 } // namespace
 
 void startup() {
@@ -233,6 +266,169 @@ void set_option(SocketHandle* socket, const i32 level, const i32 optname, const
     }
 }
 
+bool set_socket_option(SocketHandle* socket, const SocketOption option, const i32 value) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    int level = SOL_SOCKET, optname = 0;
+    switch (option) {
+    case SocketOption::ReuseAddr: optname = SO_REUSEADDR; break;
+    case SocketOption::NoDelay: level = IPPROTO_TCP, optname = TCP_NODELAY; break;
+    case SocketOption::RecvBuffer: optname = SO_RCVBUF; break;
+    case SocketOption::SendBuffer: optname = SO_SNDBUF; break;
+    default: return false; // 无 SO_REUSEPORT / TCP_DEFER_ACCEPT
+    }
+    const int opt = value;
+    if (::setsockopt(socket->socket, level, optname, reinterpret_cast<const char*>(&opt), sizeof(opt)) == SOCKET_ERROR) {
+        throw system_exception("Set option failed: {}", last_error());
+    }
+    return true;
+}
+
+usize recv_into(SocketHandle* socket, char* buf, const usize size) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    const int received = ::recv(socket->socket, buf, static_cast<int>(size), 0);
+    if (received == SOCKET_ERROR) {
+        throw system_exception("Recv failed: {}", last_error());
+    }
+    return static_cast<usize>(received);
+}
+
+usize send_vectored(SocketHandle* socket, const IoSlice* slices, const usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    constexpr usize MAX_BUFS = 64;
+    WSABUF bufs[MAX_BUFS];
+    const usize count = n < MAX_BUFS ? n : MAX_BUFS;
+    for (usize i = 0; i < count; ++i) {
+        bufs[i].buf = const_cast<char*>(slices[i].data);
+        bufs[i].len = static_cast<ULONG>(slices[i].size);
+    }
+    DWORD sent = 0;
+    if (::WSASend(socket->socket, bufs, static_cast<DWORD>(count), &sent, 0, nullptr, nullptr) == SOCKET_ERROR) {
+        throw system_exception("Send failed: {}", last_error());
+    }
+    return static_cast<usize>(sent);
+}
+
+usize send_file(SocketHandle* socket, const i64 file, const u64 offset, const usize len) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    auto* h = reinterpret_cast<HANDLE>(file);
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(h, &size)) {
+        throw system_exception("GetFileSizeEx failed: {}", ::GetLastError());
+    }
+    if (offset >= static_cast<u64>(size.QuadPart)) {
+        return 0;
+    }
+    // TransmitFile 单次最多发送 2^31 - 2 字节，从文件当前位置开始
+    const auto chunk = static_cast<DWORD>(std::min<u64>({len, static_cast<u64>(size.QuadPart) - offset, 0x7ffffffeULL}));
+    LARGE_INTEGER pos{};
+    pos.QuadPart = static_cast<LONGLONG>(offset);
+    if (!::SetFilePointerEx(h, pos, nullptr, FILE_BEGIN)) {
+        throw system_exception("SetFilePointerEx failed: {}", ::GetLastError());
+    }
+    if (!::TransmitFile(socket->socket, h, chunk, 0, nullptr, nullptr, 0)) {
+        throw system_exception("Send file failed: {}", last_error());
+    }
+    return chunk;
+}
+
+void set_nonblocking(SocketHandle* socket, const bool enable) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    u_long mode = enable ? 1 : 0;
+    if (::ioctlsocket(socket->socket, FIONBIO, &mode) == SOCKET_ERROR) {
+        throw system_exception("ioctlsocket failed: {}", last_error());
+    }
+}
+
+i64 native_handle(SocketHandle* socket) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    return static_cast<i64>(socket->socket);
+}
+
+SocketHandle* from_native_handle(const i64 native) {
+    auto* handle = new SocketHandle{};
+    handle->socket = static_cast<SOCKET>(native);
+    return handle;
+}
+
+Option<usize> try_recv(SocketHandle* socket, char* buf, const usize size) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    const int received = ::recv(socket->socket, buf, static_cast<int>(size), 0);
+    if (received != SOCKET_ERROR) {
+        return Option<usize>::Some(static_cast<usize>(received));
+    }
+    if (::WSAGetLastError() == WSAEWOULDBLOCK) {
+        return Option<usize>::None();
+    }
+    throw system_exception("Recv failed: {}", last_error());
+}
+
+Option<usize> try_send(SocketHandle* socket, const char* data, const usize size) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    const int sent = ::send(socket->socket, data, static_cast<int>(size), 0);
+    if (sent != SOCKET_ERROR) {
+        return Option<usize>::Some(static_cast<usize>(sent));
+    }
+    if (::WSAGetLastError() == WSAEWOULDBLOCK) {
+        return Option<usize>::None();
+    }
+    throw system_exception("Send failed: {}", last_error());
+}
+
+Option<usize> try_send_vectored(SocketHandle* socket, const IoSlice* slices, const usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    constexpr usize MAX_BUFS = 64;
+    WSABUF bufs[MAX_BUFS];
+    const usize count = n < MAX_BUFS ? n : MAX_BUFS;
+    for (usize i = 0; i < count; ++i) {
+        bufs[i].buf = const_cast<char*>(slices[i].data);
+        bufs[i].len = static_cast<ULONG>(slices[i].size);
+    }
+    DWORD sent = 0;
+    if (::WSASend(socket->socket, bufs, static_cast<DWORD>(count), &sent, 0, nullptr, nullptr) != SOCKET_ERROR) {
+        return Option<usize>::Some(static_cast<usize>(sent));
+    }
+    if (::WSAGetLastError() == WSAEWOULDBLOCK) {
+        return Option<usize>::None();
+    }
+    throw system_exception("Send failed: {}", last_error());
+}
+
+SocketHandle* try_accept(SocketHandle* socket) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    const SOCKET client = ::accept(socket->socket, nullptr, nullptr);
+    if (client == INVALID_SOCKET) {
+        if (::WSAGetLastError() == WSAEWOULDBLOCK) {
+            return nullptr;
+        }
+        throw system_exception("Accept failed: {}", last_error());
+    }
+    u_long mode = 1;
+    ::ioctlsocket(client, FIONBIO, &mode);
+    auto* handle = new SocketHandle{};
+    handle->socket = client;
+    return handle;
+}
+
 usize send_to(SocketHandle* socket, const str::StringView data, const usize size, const str::StringView ip, const u16 port, const i32 flags) {
     if (!is_valid(socket)) {
         throw null_pointer_exception("Invalid socket");
@@ -286,6 +482,95 @@ UdpRecvResult recv_from(SocketHandle* socket, const usize size, const i32 flags)
     return result;
 }
 
+SockAddr make_sock_addr(const str::StringView ip, const u16 port) {
+    sockaddr_storage addr{};
+    int len = sizeof(addr);
+    fill_sockaddr(ip, port, addr, len);
+    return from_sockaddr(addr);
+}
+
+usize recv_batch(SocketHandle* socket, Datagram* msgs, usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    // 无 recvmmsg：第一个阻塞接收，之后仅在已有数据时继续
+    n = std::min(n, MAX_BATCH);
+    usize got = 0;
+    while (got < n) {
+        if (got > 0) {
+            u_long pending = 0;
+            if (ioctlsocket(socket->socket, FIONREAD, &pending) != 0 || pending == 0) break;
+        }
+        auto& m = msgs[got];
+        sockaddr_storage addr{};
+        int len = sizeof(addr);
+        const int received = ::recvfrom(socket->socket, m.data, static_cast<int>(m.capacity), 0, reinterpret_cast<sockaddr*>(&addr), &len);
+        m.truncated = false;
+        if (received == SOCKET_ERROR) {
+            const int err = WSAGetLastError();
+            if (err == WSAEMSGSIZE) {
+                m.truncated = true;
+                m.len = m.capacity;
+            } else if (err == WSAEWOULDBLOCK) {
+                break;
+            } else if (got > 0) {
+                break;
+            } else {
+                throw system_exception("Recvfrom failed: {}", last_error());
+            }
+        } else {
+            m.len = static_cast<usize>(received);
+        }
+        m.addr = from_sockaddr(addr);
+        m.segment_size = 0;
+        ++got;
+    }
+    return got;
+}
+
+usize send_batch(SocketHandle* socket, const Datagram* msgs, usize n) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    n = std::min(n, MAX_BATCH);
+    usize sent = 0;
+    for (; sent < n; ++sent) {
+        sockaddr_storage addr{};
+        const int len = to_sockaddr(msgs[sent].addr, addr);
+        if (::sendto(socket->socket, msgs[sent].data, static_cast<int>(msgs[sent].len), 0, reinterpret_cast<sockaddr*>(&addr), len) == SOCKET_ERROR) {
+            if (sent > 0 || WSAGetLastError() == WSAEWOULDBLOCK) break;
+            throw system_exception("Sendto failed: {}", last_error());
+        }
+    }
+    return sent;
+}
+
+bool set_udp_gro(SocketHandle* socket, const bool) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    return false;
+}
+
+bool set_udp_segment(SocketHandle* socket, const u16) {
+    if (!is_valid(socket)) {
+        throw null_pointer_exception("Invalid socket");
+    }
+    return false;
+}
+
+bool is_alive(SocketHandle* socket) {
+    if (!is_valid(socket)) {
+        return false;
+    }
+    // Windows 没有 MSG_DONTWAIT，先以零超时 select 判断是否可读，可读即关闭、出错或有残留数据
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(socket->socket, &readable);
+    timeval zero{0, 0};
+    return ::select(0, &readable, nullptr, nullptr, &zero) == 0;
+}
+
 } // namespace my::plat::net
 
 #endif // RICKY_WIN
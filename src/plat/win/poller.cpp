@@ -0,0 +1,39 @@
+#include "my_config.hpp"
+
+#if RICKY_WIN
+
+#include "poller.hpp"
+
+namespace my::plat::poller {
+
+// 事件循环目前只有 Linux epoll 后端，Windows 上各入口均抛出 runtime_exception
+
+struct PollerHandle {};
+
+PollerHandle* create() {
+    throw runtime_exception("Poller is not supported on Windows yet");
+}
+
+void close(PollerHandle* poller) {
+    delete poller;
+}
+
+void add(PollerHandle*, net::SocketHandle*, u64) {
+    throw runtime_exception("Poller is not supported on Windows yet");
+}
+
+void remove(PollerHandle*, net::SocketHandle*) {
+    throw runtime_exception("Poller is not supported on Windows yet");
+}
+
+usize wait(PollerHandle*, PollEvent*, usize, i32) {
+    throw runtime_exception("Poller is not supported on Windows yet");
+}
+
+void wake(PollerHandle*) {
+    throw runtime_exception("Poller is not supported on Windows yet");
+}
+
+} // namespace my::plat::poller
+
+#endif // RICKY_WIN
@@ -6,6 +6,9 @@
 
 #include <Windows.h>
 
+#include <algorithm>
+#include <format>
+
 namespace my::plat::process {
 
 u32 pid() {
@@ -17,6 +20,30 @@ void set_console_utf8() {
     ::SetConsoleCP(CP_UTF8);
 }
 
+usize capture_stack(void** frames, const usize max_frames, const usize skip) {
+    const auto n = ::RtlCaptureStackBackTrace(static_cast<DWORD>(skip + 1), static_cast<DWORD>(std::min<usize>(max_frames, 62)), frames, nullptr);
+    return static_cast<usize>(n);
+}
+
+std::string symbolize(void* addr) {
+    HMODULE module = nullptr;
+    if (::GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                             static_cast<LPCSTR>(addr), &module) == 0) {
+        return std::format("{}", addr);
+    }
+    char path[MAX_PATH];
+    const DWORD len = ::GetModuleFileNameA(module, path, MAX_PATH);
+    std::string name(path, len);
+    if (const auto slash = name.find_last_of("\\/"); slash != std::string::npos) {
+        name.erase(0, slash + 1);
+    }
+    return std::format("{}+{:#x}", name, static_cast<char*>(addr) - reinterpret_cast<char*>(module));
+}
+
+std::string memory_maps() {
+    return {};
+}
+
 } // namespace my::plat::process
 
 #endif // RICKY_WIN
@@ -0,0 +1,67 @@
+#include "my_config.hpp"
+
+#if RICKY_WIN
+
+#include "uring.hpp"
+
+namespace my::plat::uring {
+
+// io_uring 仅 Linux 可用；is_supported 恒为 false，上层退回阻塞路径
+
+struct RingHandle {};
+
+bool is_supported() {
+    return false;
+}
+
+RingHandle* create(u32) {
+    throw runtime_exception("io_uring is not supported on Windows");
+}
+
+void close(RingHandle* ring) {
+    delete ring;
+}
+
+void register_buffers(RingHandle*, const FixedBuffer*, usize) {
+    throw runtime_exception("io_uring is not supported on Windows");
+}
+
+bool prep_accept(RingHandle*, net::SocketHandle*, u64) {
+    return false;
+}
+
+bool prep_recv(RingHandle*, net::SocketHandle*, char*, usize, u64) {
+    return false;
+}
+
+bool prep_send(RingHandle*, net::SocketHandle*, const char*, usize, u64) {
+    return false;
+}
+
+bool prep_read(RingHandle*, fs::FileHandle*, char*, usize, u64, u64) {
+    return false;
+}
+
+bool prep_write(RingHandle*, fs::FileHandle*, const char*, usize, u64, u64) {
+    return false;
+}
+
+bool prep_read_fixed(RingHandle*, i64, char*, usize, u64, u32, u64) {
+    return false;
+}
+
+bool prep_write_fixed(RingHandle*, i64, const char*, usize, u64, u32, u64) {
+    return false;
+}
+
+usize submit(RingHandle*, usize) {
+    return 0;
+}
+
+usize reap(RingHandle*, Cqe*, usize) {
+    return 0;
+}
+
+} // namespace my::plat::uring
+
+#endif // RICKY_WIN
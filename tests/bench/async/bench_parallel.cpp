@@ -0,0 +1,103 @@
+#include "bench_parallel.hpp"
+
+#include "test_suite.hpp"
+#include "parallel.hpp"
+#include "printer.hpp"
+#include "random.hpp"
+#include "timer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace my::bench::bench_parallel {
+
+static constexpr usize N = 2'000'000;
+
+static util::Vec<f64> random_data() {
+    auto& rnd = util::Random::instance();
+    util::Vec<f64> v;
+    for (usize i = 0; i < N; ++i) {
+        v.push(rnd.next<f64>(0.0, 1.0));
+    }
+    return v;
+}
+
+static const util::Vec<f64>& data() {
+    static const auto v = random_data();
+    return v;
+}
+
+void speed_of_std_sort() {
+    auto v = data();
+    std::sort(v.data(), v.data() + v.len());
+}
+
+void speed_of_parallel_sort() {
+    auto v = data();
+    async::par::parallel_sort(v);
+}
+
+void speed_of_parallel_reduce() {
+    volatile f64 sink = async::par::parallel_transform_reduce(data(), 0.0, std::plus<>{}, [](f64 x) { return std::sqrt(x); });
+    (void)sink;
+}
+
+void speed_of_parallel_scan() {
+    util::Vec<f64> out(N, 0.0);
+    async::par::parallel_inclusive_scan(data(), out);
+}
+
+template <typename F>
+static f64 measure_ms(F&& fn) {
+    constexpr usize ROUNDS = 3;
+    f64 best = 1e300;
+    for (usize i = 0; i < ROUNDS; ++i) {
+        util::Timer_ns timer;
+        best = std::min(best, static_cast<f64>(timer(fn)) / 1e6);
+    }
+    return best;
+}
+
+/**
+ * @brief 线程数从 1 倍增到硬件并发数，输出各算法耗时与相对单线程的加速比
+ */
+void scaling_by_threads() {
+    const usize max_threads = std::max<usize>(1, std::thread::hardware_concurrency());
+    f64 base_reduce = 0, base_scan = 0, base_sort = 0;
+    util::Vec<f64> out(N, 0.0);
+
+    for (usize threads = 1;; threads = std::min(threads * 2, max_threads)) {
+        async::ThreadPool tp{threads, async::ScheduleMode::WorkStealing};
+        const f64 reduce_ms = measure_ms([&]() {
+            volatile f64 sink = async::par::parallel_transform_reduce(tp, data(), 0.0, std::plus<>{}, [](f64 x) { return std::sqrt(x); });
+            (void)sink;
+        });
+        const f64 scan_ms = measure_ms([&]() { async::par::parallel_inclusive_scan(tp, data(), out); });
+        const f64 sort_ms = measure_ms([&]() {
+            auto v = data();
+            async::par::parallel_sort(tp, v);
+        });
+        if (threads == 1) {
+            base_reduce = reduce_ms, base_scan = scan_ms, base_sort = sort_ms;
+        }
+
+        io::println(std::format("         threads={:<3} reduce={:8.2f}ms (x{:.2f}) scan={:8.2f}ms (x{:.2f}) sort={:8.2f}ms (x{:.2f})",
+                                threads,
+                                reduce_ms, base_reduce / reduce_ms,
+                                scan_ms, base_scan / scan_ms,
+                                sort_ms, base_sort / sort_ms));
+        if (threads == max_threads) break;
+    }
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 3, 3);
+static constexpr auto REPORT_CFG = BENCH_CONFIG(0, 1, 1);
+BENCH_NAME("bench_parallel");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_std_sort, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_parallel_sort, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_parallel_reduce, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_parallel_scan, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(scaling_by_threads, REPORT_CFG))
+
+} // namespace my::bench::bench_parallel
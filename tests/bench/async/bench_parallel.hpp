@@ -0,0 +1,14 @@
+#ifndef BENCH_PARALLEL_HPP
+#define BENCH_PARALLEL_HPP
+
+namespace my::bench::bench_parallel {
+
+void speed_of_std_sort();
+void speed_of_parallel_sort();
+void speed_of_parallel_reduce();
+void speed_of_parallel_scan();
+void scaling_by_threads();
+
+} // namespace my::bench::bench_parallel
+
+#endif // BENCH_PARALLEL_HPP
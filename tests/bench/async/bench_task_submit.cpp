@@ -0,0 +1,139 @@
+#include "bench_task_submit.hpp"
+
+#include "test_suite.hpp"
+#include "printer.hpp"
+#include "thread_pool.hpp"
+#include "timer.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief 统计全局 operator new 次数，仅在 CountScope 存活期间计数
+ * @note 替换全局分配函数会作用于整个测试程序；计数关闭时只多一次对只读标志的 relaxed 读取，
+ *       不会给其他基准的分配路径带来共享原子写
+ */
+static std::atomic<bool> g_counting{false};
+static std::atomic<my::usize> g_new_calls{0};
+
+void* operator new(std::size_t size) {
+    if (g_counting.load(std::memory_order_relaxed)) [[unlikely]] {
+        g_new_calls.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace my::bench::bench_task_submit {
+
+static constexpr usize N = 20000;
+static constexpr usize THREADS = 4;
+
+/**
+ * @brief 在作用域内开启 operator new 计数
+ */
+struct CountScope {
+    CountScope() {
+        g_new_calls.store(0, std::memory_order_relaxed);
+        g_counting.store(true, std::memory_order_seq_cst);
+    }
+
+    ~CountScope() {
+        g_counting.store(false, std::memory_order_seq_cst);
+    }
+
+    static usize calls() {
+        return g_new_calls.load(std::memory_order_relaxed);
+    }
+};
+
+static i32 tiny(i32 x) {
+    return x + 1;
+}
+
+void speed_of_push_std_future() {
+    async::ThreadPool tp{THREADS};
+    for (usize i = 0; i < N; ++i) {
+        tp.push(tiny, static_cast<i32>(i));
+    }
+    tp.wait();
+}
+
+void speed_of_submit_future() {
+    async::ThreadPool tp{THREADS};
+    for (usize i = 0; i < N; ++i) {
+        tp.submit(tiny, static_cast<i32>(i));
+    }
+    tp.wait();
+}
+
+void speed_of_execute() {
+    async::ThreadPool tp{THREADS};
+    std::atomic<i32> sink{0};
+    for (usize i = 0; i < N; ++i) {
+        tp.execute([&sink](i32 x) { sink.fetch_add(tiny(x), std::memory_order_relaxed); }, static_cast<i32>(i));
+    }
+    tp.wait();
+}
+
+/**
+ * @brief 只统计提交与执行阶段（不含线程池构造）的分配次数与吞吐
+ */
+template <typename Submit>
+static void report(const char* name, async::ScheduleMode mode, Submit&& submit) {
+    async::ThreadPool tp{THREADS, mode};
+    // 预热：让 VecDeque 扩容、SlabPool 切分 slab
+    for (usize i = 0; i < N; ++i) {
+        submit(tp, static_cast<i32>(i));
+    }
+
+    util::Timer_ns timer;
+    usize allocs = 0;
+    f64 cost_ns = 0;
+    {
+        CountScope scope;
+        timer.start();
+        for (usize i = 0; i < N; ++i) {
+            submit(tp, static_cast<i32>(i));
+        }
+        tp.wait();
+        cost_ns = static_cast<f64>(timer.end());
+        allocs = CountScope::calls();
+    }
+
+    io::println(std::format("         {:<28} {:<12} allocs/task={:.3f} tasks/sec={:.0f}",
+                            name,
+                            mode == async::ScheduleMode::Shared ? "shared" : "work-stealing",
+                            static_cast<f64>(allocs) / static_cast<f64>(N),
+                            static_cast<f64>(N) * 1e9 / cost_ns));
+}
+
+void allocations_per_task() {
+    for (auto mode : {async::ScheduleMode::Shared, async::ScheduleMode::WorkStealing}) {
+        report("push + std::future", mode, [](async::ThreadPool& tp, i32 x) { tp.push(tiny, x); });
+        report("submit + async::Future", mode, [](async::ThreadPool& tp, i32 x) { tp.submit(tiny, x); });
+        report("execute", mode, [](async::ThreadPool& tp, i32 x) { tp.execute(tiny, x); });
+    }
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 3, 3);
+static constexpr auto REPORT_CFG = BENCH_CONFIG(0, 1, 1);
+BENCH_NAME("bench_task_submit");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_push_std_future, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_submit_future, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_execute, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(allocations_per_task, REPORT_CFG))
+
+} // namespace my::bench::bench_task_submit
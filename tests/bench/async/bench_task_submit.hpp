@@ -0,0 +1,13 @@
+#ifndef BENCH_TASK_SUBMIT_HPP
+#define BENCH_TASK_SUBMIT_HPP
+
+namespace my::bench::bench_task_submit {
+
+void speed_of_push_std_future();
+void speed_of_submit_future();
+void speed_of_execute();
+void allocations_per_task();
+
+} // namespace my::bench::bench_task_submit
+
+#endif // BENCH_TASK_SUBMIT_HPP
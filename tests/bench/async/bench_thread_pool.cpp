@@ -3,12 +3,16 @@
 #include "test_suite.hpp"
 #include "thread_pool.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 
 namespace my::bench::bench_thread_pool {
 
 static usize g_n = 50;
+static usize g_tiny_n = 20000;
+static usize g_fanout = 64;
+static usize g_threads = std::max<usize>(2, std::thread::hardware_concurrency());
 
 static void task() {
     std::this_thread::sleep_for(std::chrono::milliseconds(3));
@@ -28,10 +32,59 @@ void speed_of_sync() {
     }
 }
 
+/**
+ * @brief 大量微任务由外部线程提交
+ */
+static void tiny_tasks(async::ScheduleMode mode) {
+    async::ThreadPool tp{g_threads, mode};
+    std::atomic<usize> counter{0};
+    for (usize i = 0; i < g_tiny_n; ++i) {
+        tp.push([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+    }
+    tp.wait();
+}
+
+/**
+ * @brief 任务在工作线程内继续派生子任务
+ */
+static void nested_tasks(async::ScheduleMode mode) {
+    async::ThreadPool tp{g_threads, mode};
+    std::atomic<usize> counter{0};
+    for (usize i = 0; i < g_tiny_n / g_fanout; ++i) {
+        tp.push([&]() {
+            for (usize j = 0; j < g_fanout; ++j) {
+                tp.push([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+            }
+        });
+    }
+    tp.wait();
+}
+
+void speed_of_shared_tiny_tasks() {
+    tiny_tasks(async::ScheduleMode::Shared);
+}
+
+void speed_of_work_stealing_tiny_tasks() {
+    tiny_tasks(async::ScheduleMode::WorkStealing);
+}
+
+void speed_of_shared_nested_tasks() {
+    nested_tasks(async::ScheduleMode::Shared);
+}
+
+void speed_of_work_stealing_nested_tasks() {
+    nested_tasks(async::ScheduleMode::WorkStealing);
+}
+
 static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 1, 3);
+static constexpr auto MODE_CFG = BENCH_CONFIG(1, 5, 3);
 BENCH_NAME("bench_thread_pool");
 REGISTER_BENCH_TESTS(
     BENCH_TEST_ITEM_CFG(speed_of_thread_pool, BENCH_CFG),
-    BENCH_TEST_ITEM_CFG(speed_of_sync, BENCH_CFG))
+    BENCH_TEST_ITEM_CFG(speed_of_sync, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_shared_tiny_tasks, MODE_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_work_stealing_tiny_tasks, MODE_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_shared_nested_tasks, MODE_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_work_stealing_nested_tasks, MODE_CFG))
 
 } // namespace my::bench::bench_thread_pool
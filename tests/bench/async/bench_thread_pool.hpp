@@ -5,6 +5,10 @@ namespace my::bench::bench_thread_pool {
 
 void speed_of_thread_pool();
 void speed_of_sync();
+void speed_of_shared_tiny_tasks();
+void speed_of_work_stealing_tiny_tasks();
+void speed_of_shared_nested_tasks();
+void speed_of_work_stealing_nested_tasks();
 
 } // namespace my::bench::bench_thread_pool
 
@@ -0,0 +1,71 @@
+#include "bench_co_task.hpp"
+
+#include "test_suite.hpp"
+#include "co_task.hpp"
+#include "printer.hpp"
+#include "sync_wait.hpp"
+#include "thread_pool.hpp"
+#include "when_all.hpp"
+
+namespace my::bench::bench_co_task {
+
+static constexpr usize CHAIN = 100000;
+static constexpr usize FLOWS = 10000;
+
+static coro::Task<i32> one() {
+    co_return 1;
+}
+
+static coro::Task<usize> chain() {
+    usize acc = 0;
+    for (usize i = 0; i < CHAIN; ++i) {
+        acc += co_await one();
+    }
+    co_return acc;
+}
+
+static coro::Task<> flow(async::ThreadPool& tp) {
+    co_await tp.schedule();
+    co_await tp.schedule();
+}
+
+static void run_flows(async::ThreadPool& tp) {
+    util::Vec<coro::Task<>> flows;
+    for (usize i = 0; i < FLOWS; ++i) {
+        flows.push(flow(tp));
+    }
+    coro::sync_wait(coro::when_all(std::move(flows)));
+}
+
+void speed_of_sync_await_chain() {
+    (void)coro::sync_wait(chain());
+}
+
+void speed_of_when_all_flows() {
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    run_flows(tp);
+}
+
+/**
+ * @brief 反复创建上万个并发协程，帧池的 slab 数在首轮后保持不变
+ */
+void frames_per_slab() {
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    for (usize round = 1; round <= 5; ++round) {
+        run_flows(tp);
+        io::println(std::format("         round={} flows={} slabs(128B)={} slabs(256B)={}",
+                                round, FLOWS,
+                                async::SlabPool<128>::instance().slab_count(),
+                                async::SlabPool<256>::instance().slab_count()));
+    }
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+static constexpr auto REPORT_CFG = BENCH_CONFIG(0, 1, 1);
+BENCH_NAME("bench_co_task");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_sync_await_chain, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_when_all_flows, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(frames_per_slab, REPORT_CFG))
+
+} // namespace my::bench::bench_co_task
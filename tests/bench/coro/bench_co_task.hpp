@@ -0,0 +1,12 @@
+#ifndef BENCH_CO_TASK_HPP
+#define BENCH_CO_TASK_HPP
+
+namespace my::bench::bench_co_task {
+
+void speed_of_sync_await_chain();
+void speed_of_when_all_flows();
+void frames_per_slab();
+
+} // namespace my::bench::bench_co_task
+
+#endif // BENCH_CO_TASK_HPP
@@ -0,0 +1,115 @@
+#include "bench_buf_file.hpp"
+
+#include "test_suite.hpp"
+#include "buf_file.hpp"
+#include "printer.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <format>
+
+namespace my::bench::bench_buf_file {
+
+static constexpr const char* LOG_PATH = "bench_buf_file_log.tmp";
+static constexpr const char* OUT_PATH = "bench_buf_file_out.tmp";
+static constexpr usize LOG_LINES = 1 << 20;
+static constexpr usize RECORDS = 1 << 22;
+
+/**
+ * @brief 约 80 MiB 的日志式文本文件，行长 40..120 字节，进程退出时删除
+ */
+struct Fixture {
+    usize bytes{0};
+
+    Fixture() {
+        fs::BufWriter writer(LOG_PATH);
+        char line[128];
+        u64 state = 0x9e3779b97f4a7c15ull;
+        for (usize i = 0; i < LOG_LINES; ++i) {
+            state ^= state << 13, state ^= state >> 7, state ^= state << 17;
+            const usize len = 40 + state % 80;
+            std::memset(line, 'a' + static_cast<char>(i % 26), len);
+            line[len] = '\n';
+            writer.write(line, len + 1);
+            bytes += len + 1;
+        }
+    }
+
+    ~Fixture() {
+        plat::fs::remove(str::StringView(LOG_PATH));
+        if (plat::fs::exists(str::StringView(OUT_PATH))) {
+            plat::fs::remove(str::StringView(OUT_PATH));
+        }
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+static void report(const char* label, const usize n, const char* unit, const std::chrono::steady_clock::time_point t0) {
+    const auto s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    io::println(std::format("         {}: {:.1f}ms, {:.1f}M {}/s", label, s * 1000.0, static_cast<double>(n) / 1e6 / s, unit));
+}
+
+void speed_of_read_all_lines() {
+    auto& f = fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    auto content = fs::File::open(LOG_PATH).read_all();
+    usize total = 0;
+    for (const auto line : content.as_str().lines()) {
+        total += line.len();
+    }
+    report("read_all + lines", f.bytes, "B", t0);
+    volatile usize sink = total;
+    (void)sink;
+}
+
+void speed_of_buf_reader_lines() {
+    auto& f = fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    fs::BufReader reader(LOG_PATH);
+    usize total = 0;
+    for (const auto line : reader.lines()) {
+        total += line.len();
+    }
+    report("BufReader::lines", f.bytes, "B", t0);
+    volatile usize sink = total;
+    (void)sink;
+}
+
+void speed_of_file_write_records() {
+    const char record[] = "id=0000 status=ok\n";
+    const auto t0 = std::chrono::steady_clock::now();
+    {
+        auto file = fs::File::create(OUT_PATH);
+        for (usize i = 0; i < RECORDS; ++i) {
+            file.write(record, sizeof(record) - 1);
+        }
+    }
+    report("File::write", RECORDS, "records", t0);
+}
+
+void speed_of_buf_writer_records() {
+    const char record[] = "id=0000 status=ok\n";
+    const auto t0 = std::chrono::steady_clock::now();
+    {
+        fs::BufWriter writer(OUT_PATH);
+        for (usize i = 0; i < RECORDS; ++i) {
+            writer.write(record, sizeof(record) - 1);
+        }
+        writer.flush();
+    }
+    report("BufWriter::write", RECORDS, "records", t0);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_buf_file");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_read_all_lines, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_buf_reader_lines, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_file_write_records, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_buf_writer_records, BENCH_CFG))
+
+} // namespace my::bench::bench_buf_file
@@ -0,0 +1,13 @@
+#ifndef BENCH_BUF_FILE_HPP
+#define BENCH_BUF_FILE_HPP
+
+namespace my::bench::bench_buf_file {
+
+void speed_of_read_all_lines();
+void speed_of_buf_reader_lines();
+void speed_of_file_write_records();
+void speed_of_buf_writer_records();
+
+} // namespace my::bench::bench_buf_file
+
+#endif // BENCH_BUF_FILE_HPP
@@ -0,0 +1,77 @@
+#include "bench_copy.hpp"
+
+#include "test_suite.hpp"
+#include "file.hpp"
+#include "printer.hpp"
+
+#include <chrono>
+#include <format>
+
+namespace my::bench::bench_copy {
+
+static constexpr const char* FROM = "bench_copy_from.tmp";
+static constexpr const char* TO = "bench_copy_to.tmp";
+static constexpr usize CHUNK = 128 * 1024;
+static constexpr usize CHUNKS = 512;
+
+/**
+ * @brief 64 MiB 源文件，进程退出时删除
+ */
+struct Fixture {
+    Fixture() {
+        auto file = fs::File::create(FROM);
+        util::Vec<char> chunk(CHUNK, 'c');
+        for (usize i = 0; i < CHUNKS; ++i) {
+            file.write(chunk.data(), CHUNK);
+        }
+    }
+
+    ~Fixture() {
+        plat::fs::remove(str::StringView(FROM));
+        if (plat::fs::exists(str::StringView(TO))) {
+            plat::fs::remove(str::StringView(TO));
+        }
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+static void report(const char* label, const u64 bytes, const std::chrono::steady_clock::time_point t0) {
+    const auto s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    io::println(std::format("         {}: {:.1f}ms, {:.0f} MiB/s", label, s * 1000.0, static_cast<double>(bytes) / 1048576.0 / s));
+}
+
+void speed_of_read_write_copy() {
+    fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    auto in = fs::File::open(FROM);
+    auto out = fs::File::create(TO);
+    util::Vec<char> buf(CHUNK);
+    u64 copied = 0;
+    while (const usize n = in.read_into(buf.data(), buf.len())) {
+        out.write(buf.data(), n);
+        copied += n;
+    }
+    out.close();
+    volatile u64 sink = copied;
+    report("read+write copy", copied, t0);
+    (void)sink;
+}
+
+void speed_of_kernel_copy() {
+    fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    volatile u64 sink = fs::copy(FROM, TO);
+    report("fs::copy", sink, t0);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_copy");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_read_write_copy, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_kernel_copy, BENCH_CFG))
+
+} // namespace my::bench::bench_copy
@@ -0,0 +1,11 @@
+#ifndef BENCH_COPY_HPP
+#define BENCH_COPY_HPP
+
+namespace my::bench::bench_copy {
+
+void speed_of_read_write_copy();
+void speed_of_kernel_copy();
+
+} // namespace my::bench::bench_copy
+
+#endif // BENCH_COPY_HPP
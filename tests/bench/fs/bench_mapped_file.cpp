@@ -0,0 +1,81 @@
+#include "bench_mapped_file.hpp"
+
+#include "test_suite.hpp"
+#include "file.hpp"
+#include "mapped_file.hpp"
+#include "printer.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <format>
+
+namespace my::bench::bench_mapped_file {
+
+static constexpr const char* PATH = "bench_mapped_file.tmp";
+static constexpr usize LINES = 1 << 20;
+
+/**
+ * @brief 约 64 MiB、每行 64 字节的日志式文本文件，进程退出时删除
+ */
+struct Fixture {
+    usize bytes{0};
+
+    Fixture() {
+        auto file = fs::File::create(PATH);
+        char line[64];
+        for (usize i = 0; i < LINES; ++i) {
+            std::memset(line, 'a' + static_cast<char>(i % 26), sizeof(line) - 1);
+            line[sizeof(line) - 1] = '\n';
+            bytes += file.write(line, sizeof(line));
+        }
+    }
+
+    ~Fixture() {
+        plat::fs::remove(str::StringView(PATH));
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+static void report(const char* label, const usize bytes, const std::chrono::steady_clock::time_point t0) {
+    const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    io::println(std::format("         {}: {:.1f}ms, {:.0f} MiB/s", label, ms, static_cast<double>(bytes) / 1048576.0 / (ms / 1000.0)));
+}
+
+void speed_of_read_all_lines() {
+    auto& f = fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    auto content = fs::File::open(PATH).read_all();
+    usize total = 0;
+    for (const auto line : content.as_str().lines()) {
+        total += line.len();
+    }
+    report("read_all + lines", f.bytes, t0);
+    volatile usize sink = total;
+    (void)sink;
+}
+
+void speed_of_mapped_lines() {
+    auto& f = fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    auto mapped = fs::MappedFile::open(PATH);
+    mapped.advise(fs::MappedFile::Advice::Sequential);
+    usize total = 0;
+    for (const auto line : mapped.lines()) {
+        total += line.len();
+    }
+    report("MappedFile::lines", f.bytes, t0);
+    volatile usize sink = total;
+    (void)sink;
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_mapped_file");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_read_all_lines, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_mapped_lines, BENCH_CFG))
+
+} // namespace my::bench::bench_mapped_file
@@ -0,0 +1,11 @@
+#ifndef BENCH_MAPPED_FILE_HPP
+#define BENCH_MAPPED_FILE_HPP
+
+namespace my::bench::bench_mapped_file {
+
+void speed_of_read_all_lines();
+void speed_of_mapped_lines();
+
+} // namespace my::bench::bench_mapped_file
+
+#endif // BENCH_MAPPED_FILE_HPP
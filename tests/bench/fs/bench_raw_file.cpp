@@ -0,0 +1,114 @@
+#include "bench_raw_file.hpp"
+
+#include "test_suite.hpp"
+#include "printer.hpp"
+#include "raw_file.hpp"
+#include "thread_pool.hpp"
+
+#include <chrono>
+#include <format>
+#include <future>
+#include <mutex>
+
+namespace my::bench::bench_raw_file {
+
+static constexpr const char* PATH = "bench_raw_file.tmp";
+static constexpr usize CHUNK = 64 * 1024;
+static constexpr usize CHUNKS = 1024;
+static constexpr usize THREADS = 4;
+
+/**
+ * @brief 64 MiB 文件，进程退出时删除
+ */
+struct Fixture {
+    fs::RawFile file;
+
+    Fixture() : file(fs::RawFile::truncate(PATH)) {
+        util::Vec<char> chunk(CHUNK, 'r');
+        for (usize i = 0; i < CHUNKS; ++i) {
+            file.write_all_at(chunk.data(), CHUNK, i * CHUNK);
+        }
+    }
+
+    ~Fixture() {
+        file.close();
+        plat::fs::remove(str::StringView(PATH));
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+static void report(const char* label, const usize bytes, const std::chrono::steady_clock::time_point t0) {
+    const auto s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    io::println(std::format("         {}: {:.1f}ms, {:.0f} MiB/s", label, s * 1000.0, static_cast<double>(bytes) / 1048576.0 / s));
+}
+
+/**
+ * @brief THREADS 个线程分段读取整个文件，locked 为 true 时模拟共享文件位置的串行化
+ */
+static usize read_chunks(const bool locked) {
+    auto& f = fixture();
+    std::mutex mtx;
+    async::ThreadPool pool(THREADS);
+    util::Vec<std::future<usize>> parts;
+    for (usize t = 0; t < THREADS; ++t) {
+        parts.push(pool.push([&f, &mtx, locked, t]() {
+            util::Vec<char> buf(CHUNK);
+            usize sum = 0;
+            for (usize i = t; i < CHUNKS; i += THREADS) {
+                std::unique_lock<std::mutex> lock(mtx, std::defer_lock);
+                if (locked) lock.lock();
+                f.file.read_exact_at(std::span<char>(buf.data(), CHUNK), i * CHUNK);
+                if (locked) lock.unlock();
+                sum += static_cast<u8>(buf.at(CHUNK - 1));
+            }
+            return sum;
+        }));
+    }
+    usize sum = 0;
+    for (auto& p : parts) {
+        sum += p.get();
+    }
+    pool.wait();
+    return sum;
+}
+
+void speed_of_locked_chunk_reads() {
+    fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    volatile usize sink = read_chunks(true);
+    report("locked chunk reads", CHUNK * CHUNKS, t0);
+    (void)sink;
+}
+
+void speed_of_parallel_chunk_reads() {
+    fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    volatile usize sink = read_chunks(false);
+    report("parallel pread chunks", CHUNK * CHUNKS, t0);
+    (void)sink;
+}
+
+void speed_of_vectored_writes() {
+    auto& f = fixture();
+    char header[16] = "record-header:";
+    util::Vec<char> body(CHUNK - sizeof(header), 'w');
+    const auto t0 = std::chrono::steady_clock::now();
+    for (usize i = 0; i < CHUNKS; ++i) {
+        plat::IoSlice slices[2] = {{header, sizeof(header)}, {body.data(), body.len()}};
+        f.file.write_vectored_at(slices, 2, i * CHUNK);
+    }
+    report("pwritev header+body", CHUNK * CHUNKS, t0);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_raw_file");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_locked_chunk_reads, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_parallel_chunk_reads, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_vectored_writes, BENCH_CFG))
+
+} // namespace my::bench::bench_raw_file
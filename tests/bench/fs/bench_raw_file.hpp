@@ -0,0 +1,12 @@
+#ifndef BENCH_RAW_FILE_HPP
+#define BENCH_RAW_FILE_HPP
+
+namespace my::bench::bench_raw_file {
+
+void speed_of_locked_chunk_reads();
+void speed_of_parallel_chunk_reads();
+void speed_of_vectored_writes();
+
+} // namespace my::bench::bench_raw_file
+
+#endif // BENCH_RAW_FILE_HPP
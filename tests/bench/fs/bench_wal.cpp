@@ -0,0 +1,101 @@
+#include "bench_wal.hpp"
+
+#include "test_suite.hpp"
+#include "printer.hpp"
+#include "wal.hpp"
+
+#include <chrono>
+#include <format>
+#include <thread>
+
+namespace my::bench::bench_wal {
+
+static constexpr const char* DIR = "bench_wal.tmp";
+static constexpr usize RECORD = 128;
+static constexpr usize THREADS = 8;
+
+/**
+ * @brief 每轮使用新的日志目录，结束时删除
+ */
+struct Fixture {
+    util::Vec<char> record;
+
+    Fixture() : record(RECORD, 'w') {
+        clean();
+    }
+
+    ~Fixture() {
+        clean();
+    }
+
+    static void clean() {
+        if (plat::fs::exists(str::StringView(DIR))) {
+            plat::fs::remove(str::StringView(DIR), true);
+        }
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+/**
+ * @brief threads 个线程各追加 per_thread 条记录，报告每秒追加数与每次 fdatasync 覆盖的记录数
+ */
+static void run(const char* label, const fs::Durability durability, const usize threads, const usize per_thread) {
+    auto& f = fixture();
+    Fixture::clean();
+    auto wal = fs::Wal::open(str::StringView(DIR), fs::WalConfig{.durability = durability});
+    const str::StringView record(f.record.data(), f.record.len());
+
+    const auto t0 = std::chrono::steady_clock::now();
+    util::Vec<std::thread> workers;
+    for (usize t = 0; t < threads; ++t) {
+        workers.push([&wal, record, per_thread]() {
+            for (usize i = 0; i < per_thread; ++i) {
+                wal->append(record);
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    wal->sync();
+    const auto s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    const usize total = threads * per_thread;
+    volatile u64 sink = wal->last_lsn();
+    io::println(std::format("         {}: {:.1f}ms, {:.0f} appends/s, {} groups, {:.1f} records/sync", label, s * 1000.0,
+                            static_cast<double>(total) / s, wal->groups(),
+                            static_cast<double>(total) / static_cast<double>(std::max<u64>(wal->syncs(), 1))));
+    (void)sink;
+    wal.reset();
+    Fixture::clean();
+}
+
+void speed_of_buffered_appends() {
+    run("buffered x1", fs::Durability::Buffered, 1, 100000);
+}
+
+void speed_of_written_appends() {
+    run("written x1", fs::Durability::Written, 1, 20000);
+}
+
+void speed_of_synced_appends() {
+    run("synced x1", fs::Durability::Synced, 1, 500);
+}
+
+void speed_of_group_committed_appends() {
+    run(std::format("synced x{}", THREADS).c_str(), fs::Durability::Synced, THREADS, 500);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_wal");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_buffered_appends, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_written_appends, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_synced_appends, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_group_committed_appends, BENCH_CFG))
+
+} // namespace my::bench::bench_wal
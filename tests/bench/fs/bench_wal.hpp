@@ -0,0 +1,13 @@
+#ifndef BENCH_WAL_HPP
+#define BENCH_WAL_HPP
+
+namespace my::bench::bench_wal {
+
+void speed_of_buffered_appends();
+void speed_of_written_appends();
+void speed_of_synced_appends();
+void speed_of_group_committed_appends();
+
+} // namespace my::bench::bench_wal
+
+#endif // BENCH_WAL_HPP
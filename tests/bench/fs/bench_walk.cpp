@@ -0,0 +1,110 @@
+#include "bench_walk.hpp"
+
+#include "test_suite.hpp"
+#include "file.hpp"
+#include "printer.hpp"
+#include "walk.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <format>
+
+namespace my::bench::bench_walk {
+
+static constexpr const char* ROOT = "bench_walk_tmp";
+static constexpr usize DIRS = 64;
+static constexpr usize SUBDIRS = 4;
+static constexpr usize FILES = 64;
+
+/**
+ * @brief 两层目录树：64 个目录各含 4 个子目录，每个子目录 64 个文件，共 16384 个文件
+ */
+struct Fixture {
+    usize entries{0};
+
+    Fixture() {
+        if (plat::fs::exists(str::StringView(ROOT))) {
+            plat::fs::remove(str::StringView(ROOT), true);
+        }
+        plat::fs::mkdir(str::StringView(ROOT));
+        for (usize d = 0; d < DIRS; ++d) {
+            const auto parent = std::format("{}/d{}", ROOT, d);
+            plat::fs::mkdir(str::String<>(str::StringView(parent.data(), parent.size())).as_str());
+            for (usize s = 0; s < SUBDIRS; ++s) {
+                const auto dir = std::format("{}/s{}", parent, s);
+                plat::fs::mkdir(str::String<>(str::StringView(dir.data(), dir.size())).as_str());
+                for (usize f = 0; f < FILES; ++f) {
+                    const auto file = std::format("{}/f{}.dat", dir, f);
+                    fs::File::create(file.c_str());
+                }
+            }
+        }
+        entries = DIRS + DIRS * SUBDIRS + DIRS * SUBDIRS * FILES;
+    }
+
+    ~Fixture() {
+        plat::fs::remove(str::StringView(ROOT), true);
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+static void report(const char* label, const usize n, const std::chrono::steady_clock::time_point t0) {
+    const auto s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    io::println(std::format("         {}: {:.1f}ms, {:.2f}M entries/s", label, s * 1000.0, static_cast<double>(n) / 1e6 / s));
+}
+
+/**
+ * @brief 逐个 stat 判断类型的串行递归，即改用 d_type 之前的做法
+ */
+static usize listdir_recursive(const str::StringView path) {
+    usize n = 0;
+    for (const auto& entry : plat::fs::listdir(path)) {
+        ++n;
+        const auto child = plat::fs::join(path, entry.name.as_str());
+        if (plat::fs::is_dir(child.as_str())) {
+            n += listdir_recursive(child.as_str());
+        }
+    }
+    return n;
+}
+
+void speed_of_recursive_listdir() {
+    auto& f = fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    volatile usize sink = listdir_recursive(str::StringView(ROOT));
+    report("listdir + stat", f.entries, t0);
+    (void)sink;
+}
+
+void speed_of_serial_walk() {
+    auto& f = fixture();
+    std::atomic<usize> n{0};
+    const auto t0 = std::chrono::steady_clock::now();
+    fs::Walker(str::StringView(ROOT)).threads(1).for_each([&](const fs::WalkEntry&) {
+        n.fetch_add(1, std::memory_order_relaxed);
+    });
+    report("Walker serial", f.entries, t0);
+}
+
+void speed_of_parallel_walk() {
+    auto& f = fixture();
+    std::atomic<usize> n{0};
+    const auto t0 = std::chrono::steady_clock::now();
+    fs::Walker(str::StringView(ROOT)).for_each([&](const fs::WalkEntry&) {
+        n.fetch_add(1, std::memory_order_relaxed);
+    });
+    report("Walker parallel", f.entries, t0);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_walk");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_recursive_listdir, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_serial_walk, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_parallel_walk, BENCH_CFG))
+
+} // namespace my::bench::bench_walk
@@ -0,0 +1,12 @@
+#ifndef BENCH_WALK_HPP
+#define BENCH_WALK_HPP
+
+namespace my::bench::bench_walk {
+
+void speed_of_recursive_listdir();
+void speed_of_serial_walk();
+void speed_of_parallel_walk();
+
+} // namespace my::bench::bench_walk
+
+#endif // BENCH_WALK_HPP
@@ -0,0 +1,126 @@
+#include "bench_io_engine.hpp"
+
+#include "test_suite.hpp"
+#include "io_engine.hpp"
+#include "printer.hpp"
+
+namespace my::bench::bench_io_engine {
+
+static constexpr usize CONNS = 64;
+static constexpr usize MSG = 64;
+static constexpr usize ROUNDS = 200;
+
+/**
+ * @brief CONNS 对回环连接；每轮客户端批量发送、服务端批量接收并回显、客户端批量接收
+ * @details Blocking 后端每轮 4 * CONNS 次系统调用，io_uring 后端每轮 4 次 io_uring_enter
+ */
+struct Echo {
+    io::IoEngine engine;
+    util::Vec<plat::net::SocketHandle*> clients;
+    util::Vec<plat::net::SocketHandle*> servers;
+    util::Vec<char> buf;
+    util::Vec<io::Completion> done;
+    bool fixed;
+
+    Echo(const io::IoBackend backend, const bool fixed_buffers) :
+            engine(backend, 2 * CONNS), buf(3 * CONNS * MSG, 'x'), fixed(fixed_buffers) {
+        plat::net::startup();
+        auto* listener = plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream);
+        plat::net::bind(listener, "127.0.0.1"_sv, 0);
+        str::String<> ip;
+        u16 port = 0;
+        plat::net::get_local_addr(listener, ip, port);
+        plat::net::listen(listener, CONNS);
+        for (usize i = 0; i < CONNS; ++i) {
+            auto* client = plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream);
+            plat::net::connect(client, "127.0.0.1"_sv, port);
+            clients.push(client);
+            servers.push(plat::net::accept(listener));
+        }
+        plat::net::close(listener);
+
+        if (fixed) {
+            util::Vec<plat::uring::FixedBuffer> buffers;
+            for (usize i = 0; i < 3 * CONNS; ++i) {
+                buffers.push(plat::uring::FixedBuffer{buf.data() + i * MSG, MSG});
+            }
+            engine.register_buffers(buffers);
+        }
+    }
+
+    ~Echo() {
+        for (usize i = 0; i < CONNS; ++i) {
+            plat::net::close(clients.at(i));
+            plat::net::close(servers.at(i));
+        }
+    }
+
+    void drain(const usize n) {
+        done.clear();
+        while (done.len() < n) {
+            engine.wait(done, n - done.len());
+        }
+    }
+
+    // 缓冲区划分：[0, CONNS) 客户端发送，[CONNS, 2*CONNS) 服务端，[2*CONNS, 3*CONNS) 客户端接收
+    char* slot(const usize i) {
+        return buf.data() + i * MSG;
+    }
+
+    void round() {
+        for (usize i = 0; i < CONNS; ++i) {
+            fixed ? engine.send_fixed(clients.at(i), i, MSG, i) : engine.send(clients.at(i), slot(i), MSG, i);
+        }
+        drain(CONNS);
+        for (usize i = 0; i < CONNS; ++i) {
+            fixed ? engine.recv_fixed(servers.at(i), CONNS + i, MSG, i) : engine.recv(servers.at(i), slot(CONNS + i), MSG, i);
+        }
+        drain(CONNS);
+        for (usize i = 0; i < CONNS; ++i) {
+            fixed ? engine.send_fixed(servers.at(i), CONNS + i, MSG, i) : engine.send(servers.at(i), slot(CONNS + i), MSG, i);
+        }
+        drain(CONNS);
+        for (usize i = 0; i < CONNS; ++i) {
+            fixed ? engine.recv_fixed(clients.at(i), 2 * CONNS + i, MSG, i) : engine.recv(clients.at(i), slot(2 * CONNS + i), MSG, i);
+        }
+        drain(CONNS);
+    }
+
+    void run() {
+        for (usize r = 0; r < ROUNDS; ++r) {
+            round();
+        }
+    }
+};
+
+void speed_of_echo_blocking() {
+    static Echo echo(io::IoBackend::Blocking, false);
+    echo.run();
+}
+
+void speed_of_echo_io_uring() {
+    if (!io::IoEngine::io_uring_available()) {
+        io::println("         io_uring unavailable, skipped");
+        return;
+    }
+    static Echo echo(io::IoBackend::IoUring, false);
+    echo.run();
+}
+
+void speed_of_echo_io_uring_fixed() {
+    if (!io::IoEngine::io_uring_available()) {
+        io::println("         io_uring unavailable, skipped");
+        return;
+    }
+    static Echo echo(io::IoBackend::IoUring, true);
+    echo.run();
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_io_engine");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_echo_blocking, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_echo_io_uring, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_echo_io_uring_fixed, BENCH_CFG))
+
+} // namespace my::bench::bench_io_engine
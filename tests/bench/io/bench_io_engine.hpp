@@ -0,0 +1,12 @@
+#ifndef BENCH_IO_ENGINE_HPP
+#define BENCH_IO_ENGINE_HPP
+
+namespace my::bench::bench_io_engine {
+
+void speed_of_echo_blocking();
+void speed_of_echo_io_uring();
+void speed_of_echo_io_uring_fixed();
+
+} // namespace my::bench::bench_io_engine
+
+#endif // BENCH_IO_ENGINE_HPP
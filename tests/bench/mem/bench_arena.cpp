@@ -0,0 +1,152 @@
+#include "bench_arena.hpp"
+
+#include "arena.hpp"
+#include "hash_map.hpp"
+#include "json_parser.hpp"
+#include "test_suite.hpp"
+
+#include <format>
+
+namespace my::bench::bench_arena {
+
+static constexpr usize ROUNDS = 200;   // 模拟的请求数，每个请求建立并丢弃一份数据
+static constexpr i32 ENTRIES = 2000;   // 每个请求的哈希表大小
+static constexpr usize RECORDS = 200;  // 每个请求的文档记录数
+static constexpr usize FIELDS = 8;     // 每条记录的字段数
+
+template <typename T>
+using Alloc = mem::ArenaAllocator<T>;
+
+/**
+ * @brief 与文档同形的 JSON 文本，以及预先切好的字段，供各轮复用
+ */
+struct Fixture {
+    str::String<> json;
+    util::Vec<str::String<>> keys;
+    util::Vec<str::String<>> values;
+
+    Fixture() {
+        for (usize f = 0; f < FIELDS; ++f) {
+            const auto key = std::format("field_name_{}", f);
+            const auto value = std::format("a value long enough to leave the small buffer #{}", f);
+            keys.push(str::String<>(key.data(), key.size()));
+            values.push(str::String<>(value.data(), value.size()));
+        }
+        std::string text = "[";
+        for (usize r = 0; r < RECORDS; ++r) {
+            text += r == 0 ? "{" : ",{";
+            for (usize f = 0; f < FIELDS; ++f) {
+                text += std::format("{}\"field_name_{}\":\"a value long enough to leave the small buffer #{}\"", f == 0 ? "" : ",", f, f);
+            }
+            text += "}";
+        }
+        text += "]";
+        json = str::String<>(text.data(), text.size());
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+static mem::Arena& arena() {
+    static mem::Arena a(256 * 1024);
+    return a;
+}
+
+template <typename Map>
+static i32 fill(Map& map) {
+    for (i32 i = 0; i < ENTRIES; ++i) {
+        map.insert(i, i ^ 0x5a5a);
+    }
+    return map.get(ENTRIES / 2);
+}
+
+void speed_of_hash_map_build_on_heap() {
+    i32 sum = 0;
+    for (usize r = 0; r < ROUNDS; ++r) {
+        util::HashMap<i32, i32> map;
+        sum += fill(map);
+    }
+    volatile i32 sink = sum;
+    (void)sink;
+}
+
+void speed_of_hash_map_build_on_arena() {
+    auto& a = arena();
+    i32 sum = 0;
+    for (usize r = 0; r < ROUNDS; ++r) {
+        {
+            util::HashMap<i32, i32, Alloc<i32>> map{Alloc<i32>(a)};
+            sum += fill(map);
+        }
+        a.reset();
+    }
+    volatile i32 sink = sum;
+    (void)sink;
+}
+
+void speed_of_json_parse_on_heap() {
+    auto& f = fixture();
+    usize n = 0;
+    for (usize r = 0; r < ROUNDS / 10; ++r) {
+        n += json::JsonParser::parse(f.json.as_str()).size();
+    }
+    volatile usize sink = n;
+    (void)sink;
+}
+
+/**
+ * @brief 把预先切好的字段组装成记录数组，等价于解析结果的内存形状
+ */
+template <typename Str, typename Doc>
+static usize build(Doc& doc) {
+    auto& f = fixture();
+    for (usize r = 0; r < RECORDS; ++r) {
+        auto& record = doc.push();
+        for (usize i = 0; i < FIELDS; ++i) {
+            record.insert(Str(f.keys.at(i).as_str()), Str(f.values.at(i).as_str()));
+        }
+    }
+    return doc.len();
+}
+
+void speed_of_document_build_on_heap() {
+    using Str = str::String<>;
+    usize n = 0;
+    for (usize r = 0; r < ROUNDS; ++r) {
+        util::Vec<util::HashMap<Str, Str>> doc;
+        n += build<Str>(doc);
+    }
+    volatile usize sink = n;
+    (void)sink;
+}
+
+void speed_of_document_build_on_arena() {
+    using Str = str::String<Alloc<u8>>;
+    using Record = util::HashMap<Str, Str, Alloc<Str>>;
+    auto& a = arena();
+    usize n = 0;
+    for (usize r = 0; r < ROUNDS; ++r) {
+        {
+            mem::ArenaScope scope(a);
+            util::Vec<Record, Alloc<Record>> doc;
+            n += build<Str>(doc);
+        }
+        a.reset();
+    }
+    volatile usize sink = n;
+    (void)sink;
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_arena");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_hash_map_build_on_heap, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_hash_map_build_on_arena, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_json_parse_on_heap, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_document_build_on_heap, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_document_build_on_arena, BENCH_CFG))
+
+} // namespace my::bench::bench_arena
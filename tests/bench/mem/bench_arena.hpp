@@ -0,0 +1,14 @@
+#ifndef BENCH_ARENA_HPP
+#define BENCH_ARENA_HPP
+
+namespace my::bench::bench_arena {
+
+void speed_of_hash_map_build_on_heap();
+void speed_of_hash_map_build_on_arena();
+void speed_of_json_parse_on_heap();
+void speed_of_document_build_on_heap();
+void speed_of_document_build_on_arena();
+
+} // namespace my::bench::bench_arena
+
+#endif // BENCH_ARENA_HPP
@@ -0,0 +1,104 @@
+#include "bench_caching_alloc.hpp"
+
+#include "caching_alloc.hpp"
+#include "test_suite.hpp"
+
+#include <array>
+#include <thread>
+
+namespace my::bench::bench_caching_alloc {
+
+static constexpr usize OPS = 200000; // 每个线程的分配次数，线程越多总工作量越大
+static constexpr usize LIVE = 256;   // 每个线程同时存活的对象数
+
+struct OperatorNew {
+    static void* allocate(const usize bytes) { return ::operator new(bytes); }
+    static void deallocate(void* p, const usize bytes) { ::operator delete(p, bytes); }
+};
+
+struct Caching {
+    static void* allocate(const usize bytes) { return mem::CachingHeap::allocate(bytes); }
+    static void deallocate(void* p, const usize bytes) { mem::CachingHeap::deallocate(p, bytes); }
+};
+
+/**
+ * @brief 大多为 16B~1KiB、偶尔到 16KiB 的对象，按环形窗口替换，模拟任务中短生命周期的分配
+ */
+template <typename Policy>
+static void churn() {
+    std::array<void*, LIVE> live{};
+    std::array<usize, LIVE> sizes{};
+    u64 x = reinterpret_cast<u64>(&live) | 1;
+    for (usize i = 0; i < OPS; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        const usize slot = i % LIVE;
+        if (live[slot] != nullptr) {
+            Policy::deallocate(live[slot], sizes[slot]);
+        }
+        sizes[slot] = (x & 0xf) == 0 ? 16 + x % (16 * 1024) : 16 + x % 1024;
+        live[slot] = Policy::allocate(sizes[slot]);
+        *static_cast<volatile char*>(live[slot]) = 1;
+    }
+    for (usize slot = 0; slot < LIVE; ++slot) {
+        Policy::deallocate(live[slot], sizes[slot]);
+    }
+}
+
+template <typename Policy>
+static void run(const usize threads) {
+    util::Vec<std::thread> workers;
+    for (usize t = 0; t < threads; ++t) {
+        workers.push(churn<Policy>);
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+}
+
+void speed_of_operator_new_1_thread() {
+    run<OperatorNew>(1);
+}
+
+void speed_of_caching_heap_1_thread() {
+    run<Caching>(1);
+}
+
+void speed_of_operator_new_2_threads() {
+    run<OperatorNew>(2);
+}
+
+void speed_of_caching_heap_2_threads() {
+    run<Caching>(2);
+}
+
+void speed_of_operator_new_4_threads() {
+    run<OperatorNew>(4);
+}
+
+void speed_of_caching_heap_4_threads() {
+    run<Caching>(4);
+}
+
+void speed_of_operator_new_8_threads() {
+    run<OperatorNew>(8);
+}
+
+void speed_of_caching_heap_8_threads() {
+    run<Caching>(8);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_caching_alloc");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_operator_new_1_thread, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_caching_heap_1_thread, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_operator_new_2_threads, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_caching_heap_2_threads, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_operator_new_4_threads, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_caching_heap_4_threads, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_operator_new_8_threads, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_caching_heap_8_threads, BENCH_CFG))
+
+} // namespace my::bench::bench_caching_alloc
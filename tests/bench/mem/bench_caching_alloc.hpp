@@ -0,0 +1,17 @@
+#ifndef BENCH_CACHING_ALLOC_HPP
+#define BENCH_CACHING_ALLOC_HPP
+
+namespace my::bench::bench_caching_alloc {
+
+void speed_of_operator_new_1_thread();
+void speed_of_caching_heap_1_thread();
+void speed_of_operator_new_2_threads();
+void speed_of_caching_heap_2_threads();
+void speed_of_operator_new_4_threads();
+void speed_of_caching_heap_4_threads();
+void speed_of_operator_new_8_threads();
+void speed_of_caching_heap_8_threads();
+
+} // namespace my::bench::bench_caching_alloc
+
+#endif // BENCH_CACHING_ALLOC_HPP
@@ -0,0 +1,91 @@
+#include "bench_stats_alloc.hpp"
+
+#include "hash_map.hpp"
+#include "printer.hpp"
+#include "rbtree_map.hpp"
+#include "stats_alloc.hpp"
+#include "string.hpp"
+#include "test_suite.hpp"
+#include "vec.hpp"
+
+#include <format>
+
+namespace my::bench::bench_stats_alloc {
+
+static constexpr usize OPS = 20000;
+
+/**
+ * @brief 分配器工厂：Plain 使用默认分配器，Stats 按标签统计
+ */
+struct Plain {
+    template <typename T, mem::AllocTag>
+    using Alloc = mem::Allocator<T>;
+};
+
+template <bool TrackLifetime>
+struct Stats {
+    template <typename T, mem::AllocTag Tag>
+    using Alloc = mem::StatsAllocator<T, Tag, mem::Allocator<T>, TrackLifetime>;
+};
+
+/**
+ * @brief 每轮 OPS 次 Vec 追加、HashMap 插入、RBTreeMap 插入与 String 拼接
+ */
+template <typename P>
+static void workload() {
+    using mem::AllocTag;
+    using Node = util::RBTreeNode<i32, i32>;
+    util::Vec<i32, typename P::template Alloc<i32, AllocTag::Vec>> vec;
+    util::HashMap<i32, i32, typename P::template Alloc<i32, AllocTag::HashMap>> map;
+    util::RBTreeMap<i32, i32, std::less<i32>, typename P::template Alloc<Node, AllocTag::RBTreeMap>> tree;
+    str::String<typename P::template Alloc<u8, AllocTag::String>> s;
+    for (usize i = 0; i < OPS; ++i) {
+        const auto k = static_cast<i32>(i);
+        vec.push(k);
+        map.insert(k, k);
+        tree.insert(k, k);
+        s.push_str("piece"_sv);
+    }
+}
+
+/**
+ * @brief 打印各标签在一轮中平均每次操作的分配次数
+ */
+static void report(const util::Vec<mem::AllocStats>& before) {
+    static bool printed = false;
+    if (printed) return;
+    printed = true;
+    const auto after = mem::AllocStatistics::snapshot();
+    for (usize i = 0; i < after.len(); ++i) {
+        const auto d = after.at(i) - before.at(i);
+        if (d.allocs == 0) continue;
+        io::println(std::format("         {}: {:.3f} allocs/op, {:.1f} B/alloc, mean lifetime {:.1f}us",
+                                mem::alloc_tag_name(d.tag),
+                                d.allocs_per_op(OPS),
+                                d.mean_size(),
+                                d.mean_lifetime_ns() / 1000.0));
+    }
+}
+
+void speed_of_plain_containers() {
+    workload<Plain>();
+}
+
+void speed_of_counting_containers() {
+    workload<Stats<false>>();
+}
+
+void speed_of_lifetime_containers() {
+    const auto before = mem::AllocStatistics::snapshot();
+    workload<Stats<true>>();
+    report(before);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_stats_alloc");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_plain_containers, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_counting_containers, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_lifetime_containers, BENCH_CFG))
+
+} // namespace my::bench::bench_stats_alloc
@@ -0,0 +1,12 @@
+#ifndef BENCH_STATS_ALLOC_HPP
+#define BENCH_STATS_ALLOC_HPP
+
+namespace my::bench::bench_stats_alloc {
+
+void speed_of_plain_containers();
+void speed_of_counting_containers();
+void speed_of_lifetime_containers();
+
+} // namespace my::bench::bench_stats_alloc
+
+#endif // BENCH_STATS_ALLOC_HPP
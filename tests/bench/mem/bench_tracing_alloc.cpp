@@ -0,0 +1,80 @@
+#include "bench_tracing_alloc.hpp"
+
+#include "test_suite.hpp"
+#include "tracing_alloc.hpp"
+#include "vec.hpp"
+
+#include <array>
+#include <thread>
+
+namespace my::bench::bench_tracing_alloc {
+
+static constexpr usize OPS = 200000; // 每个线程的分配次数
+static constexpr usize LIVE = 256;   // 每个线程同时存活的对象数
+
+/**
+ * @brief 16B~1KiB 的对象按环形窗口替换
+ */
+template <typename Alloc>
+static void churn() {
+    Alloc alloc;
+    std::array<char*, LIVE> live{};
+    std::array<usize, LIVE> sizes{};
+    u64 x = reinterpret_cast<u64>(&live) | 1;
+    for (usize i = 0; i < OPS; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        const usize slot = i % LIVE;
+        if (live[slot] != nullptr) {
+            alloc.deallocate(live[slot], sizes[slot]);
+        }
+        sizes[slot] = 16 + x % 1024;
+        live[slot] = alloc.allocate(sizes[slot]);
+        *static_cast<volatile char*>(live[slot]) = 1;
+    }
+    for (usize slot = 0; slot < LIVE; ++slot) {
+        alloc.deallocate(live[slot], sizes[slot]);
+    }
+}
+
+template <typename Alloc>
+static void run(const usize threads, const usize interval) {
+    auto& tracer = mem::MemoryTracer::instance();
+    const usize prev = tracer.sample_interval();
+    tracer.set_sample_interval(interval);
+    util::Vec<std::thread> workers;
+    for (usize t = 0; t < threads; ++t) {
+        workers.push(churn<Alloc>);
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    tracer.set_sample_interval(prev);
+}
+
+void speed_of_untraced_allocator() {
+    run<mem::Allocator<char>>(1, mem::MemoryTracer::DEFAULT_SAMPLE_INTERVAL);
+}
+
+void speed_of_tracing_allocator_sampled() {
+    run<mem::TracingAllocator<char>>(1, mem::MemoryTracer::DEFAULT_SAMPLE_INTERVAL);
+}
+
+void speed_of_tracing_allocator_exact() {
+    run<mem::TracingAllocator<char>>(1, 0);
+}
+
+void speed_of_tracing_allocator_sampled_4_threads() {
+    run<mem::TracingAllocator<char>>(4, mem::MemoryTracer::DEFAULT_SAMPLE_INTERVAL);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_tracing_alloc");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_untraced_allocator, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_tracing_allocator_sampled, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_tracing_allocator_exact, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_tracing_allocator_sampled_4_threads, BENCH_CFG))
+
+} // namespace my::bench::bench_tracing_alloc
@@ -0,0 +1,13 @@
+#ifndef BENCH_TRACING_ALLOC_HPP
+#define BENCH_TRACING_ALLOC_HPP
+
+namespace my::bench::bench_tracing_alloc {
+
+void speed_of_untraced_allocator();
+void speed_of_tracing_allocator_sampled();
+void speed_of_tracing_allocator_exact();
+void speed_of_tracing_allocator_sampled_4_threads();
+
+} // namespace my::bench::bench_tracing_alloc
+
+#endif // BENCH_TRACING_ALLOC_HPP
@@ -0,0 +1,102 @@
+#include "bench_cidr_table.hpp"
+
+#include "test_suite.hpp"
+#include "cidr_table.hpp"
+#include "printer.hpp"
+
+#include <chrono>
+#include <format>
+
+namespace my::bench::bench_cidr_table {
+
+static constexpr usize PREFIXES = 500000;
+static constexpr usize PROBES = 1 << 20;
+
+static u64 next(u64& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/**
+ * @brief 50 万条长度 8..32 的随机前缀（接近全球 BGP 表规模）与 100 万个随机地址
+ */
+struct Fixture {
+    net::CidrTable<u32> table;
+    util::Vec<net::Ipv4Addr> probes;
+    util::Vec<const u32*> out;
+
+    Fixture() : out(PROBES) {
+        u64 state = 0x2545f4914f6cdd1dull;
+        for (usize i = 0; i < PREFIXES; ++i) {
+            const u64 r = next(state);
+            const u32 len = static_cast<u32>(8 + r % 25);
+            table.insert(net::Ipv4Addr::from_u32(static_cast<u32>(r >> 32)), len, static_cast<u32>(i));
+        }
+        const auto t0 = std::chrono::steady_clock::now();
+        table.build();
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        io::println(std::format("         build {} prefixes: {:.1f}ms, {} KiB", PREFIXES, ms, table.memory_bytes() / 1024));
+        for (usize i = 0; i < PROBES; ++i) {
+            probes.push(net::Ipv4Addr::from_u32(static_cast<u32>(next(state))));
+        }
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+static void report(const char* label, const usize n, const std::chrono::steady_clock::time_point t0) {
+    const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    io::println(std::format("         {}: {:.1f}ns/op", label, ns / static_cast<double>(n)));
+}
+
+void speed_of_cidr_lookup() {
+    auto& f = fixture();
+    usize hits = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (const auto& addr : f.probes) {
+        hits += f.table.lookup(addr) != nullptr;
+    }
+    report("lookup", PROBES, t0);
+    volatile usize sink = hits;
+    (void)sink;
+}
+
+void speed_of_cidr_lookup_batch() {
+    auto& f = fixture();
+    const auto t0 = std::chrono::steady_clock::now();
+    f.table.lookup_batch(std::span<const net::Ipv4Addr>(f.probes.data(), f.probes.len()),
+                         std::span<const u32*>(f.out.data(), f.out.len()));
+    report("lookup_batch", PROBES, t0);
+    volatile const u32* sink = f.out.at(PROBES - 1);
+    (void)sink;
+}
+
+void speed_of_ipv4_parse() {
+    util::Vec<str::String<>> lines;
+    u64 state = 0x9e3779b97f4a7c15ull;
+    for (usize i = 0; i < 100000; ++i) {
+        lines.push(net::Ipv4Addr::from_u32(static_cast<u32>(next(state))).to_string());
+    }
+    u32 acc = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (const auto& line : lines) {
+        acc ^= net::Ipv4Addr::parse(line.as_str()).unwrap().to_u32();
+    }
+    report("Ipv4Addr::parse", lines.len(), t0);
+    volatile u32 sink = acc;
+    (void)sink;
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_cidr_table");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_cidr_lookup, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_cidr_lookup_batch, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_ipv4_parse, BENCH_CFG))
+
+} // namespace my::bench::bench_cidr_table
@@ -0,0 +1,12 @@
+#ifndef BENCH_CIDR_TABLE_HPP
+#define BENCH_CIDR_TABLE_HPP
+
+namespace my::bench::bench_cidr_table {
+
+void speed_of_cidr_lookup();
+void speed_of_cidr_lookup_batch();
+void speed_of_ipv4_parse();
+
+} // namespace my::bench::bench_cidr_table
+
+#endif // BENCH_CIDR_TABLE_HPP
@@ -0,0 +1,58 @@
+#include "bench_connection_pool.hpp"
+
+#include "test_suite.hpp"
+#include "connection_pool.hpp"
+#include "sharded_listener.hpp"
+
+namespace my::bench::bench_connection_pool {
+
+static constexpr usize CALLS = 500;
+
+static std::unique_ptr<net::ShardedTcpListener> echo_server() {
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).nodelay(true).build_sharded();
+    listener->start([](std::unique_ptr<net::AsyncTcpStream> stream) -> coro::Task<> {
+        char buf[64];
+        loop {
+            const usize n = co_await stream->read_some(buf, sizeof(buf));
+            if (n == 0) break;
+            co_await stream->write(str::StringView(buf, n));
+        }
+        stream->close();
+    });
+    return listener;
+}
+
+static void echo(net::TcpStream& stream) {
+    char buf[8];
+    stream.write("ping"_sv);
+    for (usize got = 0; got < 4;) {
+        got += stream.read_into(buf + got, 4 - got);
+    }
+}
+
+void speed_of_connect_per_call() {
+    auto server = echo_server();
+    for (usize i = 0; i < CALLS; ++i) {
+        auto stream = net::TcpStream::connect("127.0.0.1"_sv, server->local_port());
+        echo(stream);
+    }
+    server->stop();
+}
+
+void speed_of_pooled_call() {
+    auto server = echo_server();
+    net::ConnectionPool pool;
+    for (usize i = 0; i < CALLS; ++i) {
+        auto conn = pool.acquire("127.0.0.1"_sv, server->local_port());
+        echo(*conn);
+    }
+    server->stop();
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_connection_pool");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_connect_per_call, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_pooled_call, BENCH_CFG))
+
+} // namespace my::bench::bench_connection_pool
@@ -0,0 +1,11 @@
+#ifndef BENCH_CONNECTION_POOL_HPP
+#define BENCH_CONNECTION_POOL_HPP
+
+namespace my::bench::bench_connection_pool {
+
+void speed_of_connect_per_call();
+void speed_of_pooled_call();
+
+} // namespace my::bench::bench_connection_pool
+
+#endif // BENCH_CONNECTION_POOL_HPP
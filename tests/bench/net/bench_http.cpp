@@ -0,0 +1,94 @@
+#include "bench_http.hpp"
+
+#include "test_suite.hpp"
+#include "http_server.hpp"
+#include "printer.hpp"
+#include "sharded_listener.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <thread>
+
+namespace my::bench::bench_http {
+
+static constexpr usize CLIENTS = 4;
+static constexpr usize REQUESTS = 2000; // 每个客户端
+
+static constexpr const char REQUEST[] = "GET /plaintext HTTP/1.1\r\nHost: localhost\r\n\r\n";
+static constexpr const char RESPONSE[] = "HTTP/1.1 200 OK\r\nContent-Length: 13\r\nContent-Type: text/plain\r\n\r\nHello, World!";
+
+/**
+ * @brief 本地负载生成：CLIENTS 个线程各持一个长连接，每次发送 depth 个流水线请求并等待全部响应
+ * @details 以批为单位记录往返延迟，结束后打印吞吐（请求/秒）与 p99 延迟
+ */
+static void load(const usize depth) {
+    static net::http::Router router = [] {
+        net::http::Router r;
+        r.get(str::StringView("/plaintext"), [](const net::http::Request&, net::http::Response& res) {
+            res.content_type(str::StringView("text/plain")).body(str::StringView("Hello, World!"));
+        });
+        return r;
+    }();
+    net::http::HttpServer server(router);
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).nodelay(true).build_sharded();
+    listener->start([&server](std::unique_ptr<net::AsyncTcpStream> s) { return server.serve_connection(std::move(s)); });
+    const u16 port = listener->local_port();
+
+    util::Vec<util::Vec<u64>> latencies(CLIENTS);
+    util::Vec<std::thread> clients;
+    const auto start = std::chrono::steady_clock::now();
+    for (usize t = 0; t < CLIENTS; ++t) {
+        clients.push(std::thread([port, depth, out = &latencies.at(t)]() {
+            auto client = net::TcpStream::connect("127.0.0.1"_sv, port);
+            util::Vec<char> batch;
+            for (usize i = 0; i < depth; ++i) {
+                for (const char c : std::string_view(REQUEST)) batch.push(c);
+            }
+            const usize expected = depth * (sizeof(RESPONSE) - 1);
+            util::Vec<char> buf(expected);
+            for (usize r = 0; r < REQUESTS / depth; ++r) {
+                const auto t0 = std::chrono::steady_clock::now();
+                client.write(str::StringView(batch.data(), batch.len()));
+                for (usize got = 0; got < expected;) {
+                    got += client.read_into(buf.data() + got, expected - got);
+                }
+                const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+                out->push(static_cast<u64>(ns));
+            }
+        }));
+    }
+    for (auto& t : clients) {
+        t.join();
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    util::Vec<u64> all;
+    for (const auto& v : latencies) {
+        for (const u64 ns : v) all.push(ns);
+    }
+    std::sort(all.begin(), all.end());
+    const u64 p99 = all.at(std::min(all.len() - 1, all.len() * 99 / 100));
+    io::println(std::format("         depth={} req/s={:.0f} p99(batch)={}us", depth, static_cast<double>(CLIENTS * REQUESTS) / elapsed, p99 / 1000));
+
+    while (server.active_connections() > 0) {
+        std::this_thread::yield();
+    }
+    listener->stop();
+}
+
+void speed_of_http_keep_alive() {
+    load(1);
+}
+
+void speed_of_http_pipelined() {
+    load(16);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_http");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_http_keep_alive, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_http_pipelined, BENCH_CFG))
+
+} // namespace my::bench::bench_http
@@ -0,0 +1,11 @@
+#ifndef BENCH_HTTP_HPP
+#define BENCH_HTTP_HPP
+
+namespace my::bench::bench_http {
+
+void speed_of_http_keep_alive();
+void speed_of_http_pipelined();
+
+} // namespace my::bench::bench_http
+
+#endif // BENCH_HTTP_HPP
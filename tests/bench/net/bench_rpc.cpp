@@ -0,0 +1,93 @@
+#include "bench_rpc.hpp"
+
+#include "test_suite.hpp"
+#include "printer.hpp"
+#include "rpc.hpp"
+#include "sharded_listener.hpp"
+#include "when_all.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <thread>
+
+namespace my::bench::bench_rpc {
+
+static constexpr u32 ECHO = 1;
+static constexpr usize MULTIPLEXED_CALLS = 20000;
+static constexpr usize WINDOW = 64; // 同时在途的调用数
+static constexpr usize CONNECTION_CALLS = 1000;
+
+static constexpr const char PAYLOAD[] = "ping: 0123456789abcdef";
+
+using Clock = std::chrono::steady_clock;
+
+static u64 elapsed_ns(const Clock::time_point t0) {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count());
+}
+
+/**
+ * @brief 启动回显服务，在客户端事件循环上运行 body，打印吞吐（调用/秒）与 p99 延迟
+ */
+template <typename Body>
+static void run(const char* label, const usize calls, Body body) {
+    net::rpc::RpcServer server;
+    server.method(ECHO, [](const str::StringView arg) { return str::String<>(arg); });
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).nodelay(true).build_sharded();
+    listener->start([&server](std::unique_ptr<net::AsyncTcpStream> s) { return server.serve_connection(std::move(s)); });
+
+    net::EventLoop event_loop;
+    util::Vec<u64> latencies;
+    const auto start = Clock::now();
+    event_loop.block_on(body(event_loop, listener->local_port(), latencies));
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    event_loop.run_once(0);
+
+    std::sort(latencies.begin(), latencies.end());
+    const u64 p99 = latencies.at(std::min(latencies.len() - 1, latencies.len() * 99 / 100));
+    io::println(std::format("         {} calls/s={:.0f} p99={}us", label, static_cast<double>(calls) / elapsed, p99 / 1000));
+
+    while (server.active_connections() > 0) {
+        std::this_thread::yield();
+    }
+    listener->stop();
+}
+
+static coro::Task<> multiplexed(net::EventLoop& event_loop, const u16 port, util::Vec<u64>& latencies) {
+    auto client = net::rpc::RpcClient::connect(event_loop, "127.0.0.1"_sv, port);
+    for (usize w = 0; w < MULTIPLEXED_CALLS / WINDOW; ++w) {
+        const auto t0 = Clock::now();
+        util::Vec<coro::Task<str::String<>>> calls;
+        for (usize i = 0; i < WINDOW; ++i) {
+            calls.push(client->call(ECHO, str::StringView(PAYLOAD)));
+        }
+        co_await coro::when_all(std::move(calls));
+        latencies.push(elapsed_ns(t0)); // 一批调用全部完成的时间
+    }
+}
+
+static coro::Task<> connection_per_call(net::EventLoop& event_loop, const u16 port, util::Vec<u64>& latencies) {
+    for (usize i = 0; i < CONNECTION_CALLS; ++i) {
+        const auto t0 = Clock::now();
+        auto client = net::rpc::RpcClient::connect(event_loop, "127.0.0.1"_sv, port);
+        co_await client->call(ECHO, str::StringView(PAYLOAD));
+        client.reset();
+        latencies.push(elapsed_ns(t0));
+    }
+}
+
+void speed_of_rpc_multiplexed() {
+    run("multiplexed window=64 (p99 per window)", MULTIPLEXED_CALLS, multiplexed);
+}
+
+void speed_of_rpc_connection_per_call() {
+    run("connection per call", CONNECTION_CALLS, connection_per_call);
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_rpc");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_rpc_multiplexed, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_rpc_connection_per_call, BENCH_CFG))
+
+} // namespace my::bench::bench_rpc
@@ -0,0 +1,11 @@
+#ifndef BENCH_RPC_HPP
+#define BENCH_RPC_HPP
+
+namespace my::bench::bench_rpc {
+
+void speed_of_rpc_multiplexed();
+void speed_of_rpc_connection_per_call();
+
+} // namespace my::bench::bench_rpc
+
+#endif // BENCH_RPC_HPP
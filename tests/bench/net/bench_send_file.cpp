@@ -0,0 +1,96 @@
+#include "bench_send_file.hpp"
+
+#include "test_suite.hpp"
+#include "printer.hpp"
+#include "tcp.hpp"
+
+#include <chrono>
+#include <format>
+#include <functional>
+#include <thread>
+
+namespace my::bench::bench_send_file {
+
+static constexpr const char* PATH = "bench_send_file.tmp";
+static constexpr usize CHUNK = 64 * 1024;
+static constexpr usize CHUNKS = 512;
+static constexpr usize SIZE = CHUNK * CHUNKS;
+
+/**
+ * @brief 32 MiB 文件，进程退出时删除
+ */
+struct Fixture {
+    Fixture() {
+        auto file = fs::File::create(PATH);
+        util::Vec<char> chunk(CHUNK, 's');
+        for (usize i = 0; i < CHUNKS; ++i) {
+            file.write(chunk.data(), CHUNK);
+        }
+    }
+
+    ~Fixture() {
+        plat::fs::remove(str::StringView(PATH));
+    }
+};
+
+static Fixture& fixture() {
+    static Fixture f;
+    return f;
+}
+
+/**
+ * @brief 在回环连接上由 serve 发送整个文件，另一线程读空连接，报告吞吐
+ */
+static void run(const char* label, const std::function<usize(net::TcpStream&, fs::File&)>& serve) {
+    fixture();
+    auto listener = net::TcpListener::bind("127.0.0.1"_sv, 0);
+    auto client = net::TcpStream::connect("127.0.0.1"_sv, listener.local_port());
+    auto server = listener.accept();
+
+    usize received = 0;
+    std::thread reader([&client, &received]() {
+        util::Vec<char> buf(CHUNK);
+        while (const usize n = client.read_into(buf.data(), buf.len())) {
+            received += n;
+        }
+    });
+
+    const auto t0 = std::chrono::steady_clock::now();
+    auto file = fs::File::open(PATH);
+    const usize sent = serve(*server, file);
+    server->close();
+    reader.join();
+    const auto s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    volatile usize sink = received;
+    io::println(std::format("         {}: {:.1f}ms, {:.0f} MiB/s, {} bytes", label, s * 1000.0,
+                            static_cast<double>(sent) / 1048576.0 / s, sink));
+    client.close();
+    listener.close();
+}
+
+void speed_of_read_all_then_write() {
+    run("read_all + write", [](net::TcpStream& stream, fs::File& file) {
+        const auto data = file.read_all();
+        const auto view = data.as_str();
+        usize done = 0;
+        while (done < view.len()) {
+            done += stream.write(view.slice(done));
+        }
+        return done;
+    });
+}
+
+void speed_of_send_file() {
+    run("send_file", [](net::TcpStream& stream, fs::File& file) {
+        return stream.send_file(file, 0, SIZE);
+    });
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_send_file");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_read_all_then_write, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_send_file, BENCH_CFG))
+
+} // namespace my::bench::bench_send_file
@@ -0,0 +1,11 @@
+#ifndef BENCH_SEND_FILE_HPP
+#define BENCH_SEND_FILE_HPP
+
+namespace my::bench::bench_send_file {
+
+void speed_of_read_all_then_write();
+void speed_of_send_file();
+
+} // namespace my::bench::bench_send_file
+
+#endif // BENCH_SEND_FILE_HPP
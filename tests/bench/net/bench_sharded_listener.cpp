@@ -0,0 +1,60 @@
+#include "bench_sharded_listener.hpp"
+
+#include "test_suite.hpp"
+#include "sharded_listener.hpp"
+
+#include <thread>
+
+namespace my::bench::bench_sharded_listener {
+
+static constexpr usize CLIENTS = 4;
+static constexpr usize CONNECTS = 250;
+
+static coro::Task<> ping_once(std::unique_ptr<net::AsyncTcpStream> stream) {
+    char c;
+    if (co_await stream->read_some(&c, 1) == 1) {
+        co_await stream->write(str::StringView(reinterpret_cast<const u8*>(&c), 1));
+    }
+}
+
+/**
+ * @brief CLIENTS 个线程各自串行建立 CONNECTS 个短连接，每个连接一来一回 1 字节后关闭
+ * @details 衡量 accept 吞吐：单分片时所有连接在一个线程上 accept，分片时由内核分摊
+ */
+static void connection_storm(const usize shards) {
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).shards(shards).nodelay(true).build_sharded();
+    listener->start(ping_once);
+    const u16 port = listener->local_port();
+
+    util::Vec<std::thread> clients;
+    for (usize t = 0; t < CLIENTS; ++t) {
+        clients.push(std::thread([port]() {
+            for (usize i = 0; i < CONNECTS; ++i) {
+                auto client = net::TcpStream::connect("127.0.0.1"_sv, port);
+                client.write("x"_sv);
+                client.read(1);
+            }
+        }));
+    }
+    for (auto& t : clients) {
+        t.join();
+    }
+    // 处理协程写完即结束，此时已无挂起的连接
+    listener->stop();
+}
+
+void speed_of_connect_single_shard() {
+    connection_storm(1);
+}
+
+void speed_of_connect_sharded() {
+    connection_storm(std::max<usize>(2, std::thread::hardware_concurrency()));
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_sharded_listener");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_connect_single_shard, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_connect_sharded, BENCH_CFG))
+
+} // namespace my::bench::bench_sharded_listener
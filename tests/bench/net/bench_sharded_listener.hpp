@@ -0,0 +1,11 @@
+#ifndef BENCH_SHARDED_LISTENER_HPP
+#define BENCH_SHARDED_LISTENER_HPP
+
+namespace my::bench::bench_sharded_listener {
+
+void speed_of_connect_single_shard();
+void speed_of_connect_sharded();
+
+} // namespace my::bench::bench_sharded_listener
+
+#endif // BENCH_SHARDED_LISTENER_HPP
@@ -0,0 +1,65 @@
+#include "bench_udp.hpp"
+
+#include "test_suite.hpp"
+#include "udp.hpp"
+
+namespace my::bench::bench_udp {
+
+static constexpr usize BATCH = plat::net::MAX_BATCH;
+static constexpr usize MSG = 64;
+static constexpr usize ROUNDS = 500;
+
+/**
+ * @brief 回环上的一对 UDP 套接字；每轮发送 BATCH 个数据报再全部收回
+ * @details 逐个收发每轮 2 * BATCH 次系统调用，批量收发每轮 2 次（recvmmsg/sendmmsg）
+ */
+struct Pair {
+    net::UdpSocket server = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    net::UdpSocket client = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    char payload[MSG]{};
+    char bufs[BATCH][MSG]{};
+    plat::net::Datagram out[BATCH];
+    plat::net::Datagram in[BATCH];
+
+    Pair() {
+        server.set_read_timeout(2000);
+        const auto dst = server.local_addr();
+        for (usize i = 0; i < BATCH; ++i) {
+            out[i] = plat::net::Datagram{.data = payload, .len = MSG, .addr = dst};
+            in[i] = plat::net::Datagram{.data = bufs[i], .capacity = MSG};
+        }
+    }
+};
+
+void speed_of_udp_send_to_recv_from() {
+    static Pair pair;
+    const auto data = str::StringView(reinterpret_cast<const u8*>(pair.payload), MSG);
+    const u16 port = pair.server.local_port();
+    for (usize r = 0; r < ROUNDS; ++r) {
+        for (usize i = 0; i < BATCH; ++i) {
+            pair.client.send_to(str::StringView("127.0.0.1"), port, data);
+        }
+        for (usize i = 0; i < BATCH; ++i) {
+            pair.server.recv_from(MSG);
+        }
+    }
+}
+
+void speed_of_udp_batch() {
+    static Pair pair;
+    for (usize r = 0; r < ROUNDS; ++r) {
+        pair.client.send_batch(pair.out);
+        usize got = 0;
+        while (got < BATCH) {
+            got += pair.server.recv_batch(std::span(pair.in + got, BATCH - got));
+        }
+    }
+}
+
+static constexpr auto BENCH_CFG = BENCH_CONFIG(1, 5, 3);
+BENCH_NAME("bench_udp");
+REGISTER_BENCH_TESTS(
+    BENCH_TEST_ITEM_CFG(speed_of_udp_send_to_recv_from, BENCH_CFG),
+    BENCH_TEST_ITEM_CFG(speed_of_udp_batch, BENCH_CFG))
+
+} // namespace my::bench::bench_udp
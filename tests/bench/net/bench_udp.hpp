@@ -0,0 +1,11 @@
+#ifndef BENCH_UDP_HPP
+#define BENCH_UDP_HPP
+
+namespace my::bench::bench_udp {
+
+void speed_of_udp_send_to_recv_from();
+void speed_of_udp_batch();
+
+} // namespace my::bench::bench_udp
+
+#endif // BENCH_UDP_HPP
@@ -1,6 +1,7 @@
 #include "bench_queue.hpp"
 
 #include "link_list_queue.hpp"
+#include "pool_alloc.hpp"
 #include "random.hpp"
 #include "test_suite.hpp"
 #include <queue>
@@ -19,6 +20,16 @@
         }
     }
 
+    void speed_of_pooled_util_queue_push_and_pop() {
+        util::Queue<CString, mem::PoolAllocator<util::ChainNode<CString>>> q;
+        for (usize i = 0; i < N; ++i) {
+            q.push(util::Random::instance().next_str(3));
+        }
+        while (!q.empty()) {
+            q.pop();
+        }
+    }
+
     void speed_of_std_queue_push_and_pop() {
         std::queue<CString> q;
         for (usize i = 0; i < N; ++i) {
@@ -33,6 +44,7 @@
     BENCH_NAME("bench_queue");
     REGISTER_BENCH_TESTS(
         BENCH_TEST_ITEM_CFG(speed_of_util_queue_push_and_pop, BENCH_CFG),
+        BENCH_TEST_ITEM_CFG(speed_of_pooled_util_queue_push_and_pop, BENCH_CFG),
         BENCH_TEST_ITEM_CFG(speed_of_std_queue_push_and_pop, BENCH_CFG))
 
 } // namespace my::bench::bench_queue
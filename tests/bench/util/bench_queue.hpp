@@ -4,6 +4,7 @@
 namespace my::bench::bench_queue {
 
 void speed_of_util_queue_push_and_pop();
+void speed_of_pooled_util_queue_push_and_pop();
 void speed_of_std_queue_push_and_pop();
 
 } // namespace my::bench::bench_queue
@@ -1,5 +1,6 @@
 #include "bench_rbtree_map.hpp"
 
+#include "pool_alloc.hpp"
 #include "random.hpp"
 #include "rbtree_map.hpp"
 #include "test_suite.hpp"
@@ -37,6 +38,23 @@
         }
     }
 
+    void test_pooled_sorted_hash_map_operations_speed() {
+        setup_once();
+        util::RBTreeMap<i32, i32, std::less<i32>, mem::PoolAllocator<util::RBTreeNode<i32, i32>>> t;
+
+        for (i32 i = 0; i < g_n; ++i) {
+            t.insert(g_nums[i], 0);
+        }
+
+        for (i32 i = 0; i < g_n; ++i) {
+            t[g_nums[i]]++;
+        }
+
+        for (i32 i = 0; i < g_n; ++i) {
+            t.remove(g_nums[i]);
+        }
+    }
+
     void test_map_operations_speed() {
         setup_once();
         std::map<i32, i32> mp;
@@ -58,6 +76,7 @@
     BENCH_NAME("bench_rbtree_map");
     REGISTER_BENCH_TESTS(
         BENCH_TEST_ITEM_CFG(test_sorted_hash_map_operations_speed, BENCH_CFG),
+        BENCH_TEST_ITEM_CFG(test_pooled_sorted_hash_map_operations_speed, BENCH_CFG),
         BENCH_TEST_ITEM_CFG(test_map_operations_speed, BENCH_CFG))
 
 } // namespace my::bench::bench_rbtree_map
@@ -4,6 +4,7 @@
 namespace my::bench::bench_rbtree_map {
 
 void test_sorted_hash_map_operations_speed();
+void test_pooled_sorted_hash_map_operations_speed();
 void test_map_operations_speed();
 
 } // namespace my::bench::bench_rbtree_map
@@ -0,0 +1,94 @@
+#include "test_future.hpp"
+#include "future.hpp"
+#include "ricky_test.hpp"
+
+#include <thread>
+
+namespace my::test::test_future {
+
+void should_set_value() {
+    // Given
+    async::Promise<CString> promise;
+    auto future = promise.get_future();
+    Assertions::assertFalse(future.is_ready());
+
+    // When
+    promise.set_value("hello");
+
+    // Then
+    Assertions::assertTrue(future.is_ready());
+    Assertions::assertEquals(CString{"hello"}, future.get());
+    Assertions::assertFalse(future.is_valid());
+}
+
+void should_set_exception() {
+    // Given
+    async::Promise<void> promise;
+    auto future = promise.get_future();
+
+    // When
+    promise.set_exception(std::make_exception_ptr(runtime_exception("wa")));
+
+    // Then
+    Assertions::assertThrows("wa", [&]() {
+        future.get();
+    });
+}
+
+void should_report_broken_promise() {
+    // Given
+    async::Future<i32> future;
+    {
+        async::Promise<i32> promise;
+        future = promise.get_future();
+    }
+
+    // When & Then
+    Assertions::assertThrows("Broken promise", [&]() {
+        future.get();
+    });
+}
+
+void should_fail_to_get_future_twice() {
+    // Given
+    async::Promise<i32> promise;
+    auto future = promise.get_future();
+    promise.set_value(1);
+
+    // When & Then
+    Assertions::assertThrows("Future already retrieved", [&]() {
+        auto _ = promise.get_future();
+    });
+    Assertions::assertThrows("Promise already satisfied", [&]() {
+        promise.set_value(2);
+    });
+    Assertions::assertEquals(1, future.get());
+}
+
+void should_wait_across_threads() {
+    // Given
+    constexpr i32 n = 200;
+    for (i32 i = 0; i < n; ++i) {
+        async::Promise<i32> promise;
+        auto future = promise.get_future();
+
+        // When
+        std::thread producer([p = std::move(promise), i]() mutable {
+            p.set_value(i * 2);
+        });
+
+        // Then
+        Assertions::assertEquals(i * 2, future.get());
+        producer.join();
+    }
+}
+
+GROUP_NAME("test_future")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_set_value),
+    UNIT_TEST_ITEM(should_set_exception),
+    UNIT_TEST_ITEM(should_report_broken_promise),
+    UNIT_TEST_ITEM(should_fail_to_get_future_twice),
+    UNIT_TEST_ITEM(should_wait_across_threads))
+
+} // namespace my::test::test_future
@@ -0,0 +1,14 @@
+#ifndef TEST_FUTURE_HPP
+#define TEST_FUTURE_HPP
+
+namespace my::test::test_future {
+
+void should_set_value();
+void should_set_exception();
+void should_report_broken_promise();
+void should_fail_to_get_future_twice();
+void should_wait_across_threads();
+
+} // namespace my::test::test_future
+
+#endif // TEST_FUTURE_HPP
@@ -0,0 +1,186 @@
+#include "test_parallel.hpp"
+#include "parallel.hpp"
+#include "dyn_array.hpp"
+#include "my_exception.hpp"
+#include "random.hpp"
+#include "ricky_test.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace my::test::test_parallel {
+
+static constexpr usize N = 100003;
+
+void should_parallel_for() {
+    // Given
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    util::Vec<i32> v(N, 0);
+
+    // When
+    async::par::parallel_for(tp, 0, N, [&](usize i) { v.at(i) = static_cast<i32>(i) * 2; });
+    async::par::parallel_for(tp, 5, 5, [&](usize) { v.at(0) = -1; });
+
+    // Then
+    for (usize i = 0; i < N; ++i) {
+        Assertions::assertEquals(static_cast<i32>(i) * 2, v.at(i));
+    }
+}
+
+void should_reduce() {
+    // Given
+    async::ThreadPool tp{4};
+    util::Vec<i64> v;
+    for (usize i = 1; i <= N; ++i) {
+        v.push(static_cast<i64>(i));
+    }
+    util::Vec<CString> words;
+    for (usize i = 0; i < 1000; ++i) {
+        words.push(CString{std::to_string(i % 10)});
+    }
+
+    // When
+    const i64 sum = async::par::parallel_reduce(tp, v, i64{0});
+    const i64 max = async::par::parallel_reduce(v, i64{0}, [](i64 a, i64 b) { return std::max(a, b); });
+    const CString joined = async::par::parallel_reduce(tp, words, CString{});
+
+    // Then
+    Assertions::assertEquals(static_cast<i64>(N) * (N + 1) / 2, sum);
+    Assertions::assertEquals(static_cast<i64>(N), max);
+    CString expected;
+    for (usize i = 0; i < 1000; ++i) {
+        expected += CString{std::to_string(i % 10)};
+    }
+    Assertions::assertEquals(expected, joined); // 不可交换的归约也保持下标顺序
+    Assertions::assertEquals(7, async::par::parallel_reduce(tp, util::Vec<i32>{}, 7));
+}
+
+void should_transform_reduce() {
+    // Given
+    util::Vec<i32> v(N, 3);
+
+    // When
+    const i64 sum_sq = async::par::parallel_transform_reduce(v, i64{1}, std::plus<>{}, [](i32 x) { return static_cast<i64>(x) * x; });
+
+    // Then
+    Assertions::assertEquals(static_cast<i64>(N) * 9 + 1, sum_sq);
+}
+
+void should_scan() {
+    // Given
+    async::ThreadPool tp{4};
+    util::Vec<i64> in;
+    for (usize i = 0; i < N; ++i) {
+        in.push(static_cast<i64>(i % 7));
+    }
+    util::Vec<i64> inclusive(N, 0), exclusive(N, 0);
+
+    // When
+    async::par::parallel_inclusive_scan(tp, in, inclusive);
+    async::par::parallel_exclusive_scan(tp, in, exclusive, i64{10});
+    util::Vec<i64> in_place = in;
+    async::par::parallel_inclusive_scan(tp, in_place, in_place);
+
+    // Then
+    i64 acc = 0;
+    for (usize i = 0; i < N; ++i) {
+        Assertions::assertEquals(acc + 10, exclusive.at(i));
+        acc += in.at(i);
+        Assertions::assertEquals(acc, inclusive.at(i));
+        Assertions::assertEquals(acc, in_place.at(i));
+    }
+    Assertions::assertThrows("Scan output length 1 is less than input length 100003", [&]() {
+        util::Vec<i64> out(1, 0);
+        async::par::parallel_inclusive_scan(tp, in, out);
+    });
+}
+
+void should_sort_vec() {
+    // Given
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    auto& rnd = util::Random::instance();
+    util::Vec<i32> v;
+    for (usize i = 0; i < N; ++i) {
+        v.push(rnd.next<i32>(-1000, 1000));
+    }
+    util::Vec<i32> expected = v;
+    std::sort(expected.data(), expected.data() + N);
+
+    // When
+    async::par::parallel_sort(tp, v);
+
+    // Then
+    for (usize i = 0; i < N; ++i) {
+        Assertions::assertEquals(expected.at(i), v.at(i));
+    }
+}
+
+void should_sort_dyn_array() {
+    // Given
+    async::ThreadPool tp{4};
+    util::DynArray<std::pair<i32, usize>> arr;
+    for (usize i = 0; i < N; ++i) {
+        arr.append(std::pair<i32, usize>{static_cast<i32>((i * 7919) % 97), i});
+    }
+
+    // When
+    async::par::parallel_sort(tp, arr, [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    // Then
+    Assertions::assertEquals(N, arr.len());
+    for (usize i = 1; i < N; ++i) {
+        const auto& prev = arr.at(i - 1);
+        const auto& cur = arr.at(i);
+        Assertions::assertTrue(prev.first >= cur.first);
+        if (prev.first == cur.first) {
+            Assertions::assertTrue(prev.second < cur.second); // 稳定
+        }
+    }
+}
+
+void should_propagate_exception() {
+    // Given
+    async::ThreadPool tp{4};
+    std::atomic<usize> visited{0};
+
+    // When & Then
+    Assertions::assertThrows("boom", [&]() {
+        async::par::parallel_for(tp, 0, N, [&](usize i) {
+            visited.fetch_add(1, std::memory_order_relaxed);
+            if (i == N / 2) {
+                throw runtime_exception("boom");
+            }
+        });
+    });
+    Assertions::assertTrue(visited.load() <= N);
+}
+
+void should_nest_inside_pool() {
+    // Given
+    async::ThreadPool tp{2, async::ScheduleMode::WorkStealing};
+    util::Vec<i64> v(N, 1);
+
+    // When
+    auto futures = util::Vec<async::Future<i64>>{};
+    for (usize i = 0; i < 8; ++i) {
+        futures.push(tp.submit([&]() { return async::par::parallel_reduce(tp, v, i64{0}); }));
+    }
+
+    // Then
+    for (auto& future : futures) {
+        Assertions::assertEquals(static_cast<i64>(N), future.get());
+    }
+}
+
+GROUP_NAME("test_parallel")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_parallel_for),
+    UNIT_TEST_ITEM(should_reduce),
+    UNIT_TEST_ITEM(should_transform_reduce),
+    UNIT_TEST_ITEM(should_scan),
+    UNIT_TEST_ITEM(should_sort_vec),
+    UNIT_TEST_ITEM(should_sort_dyn_array),
+    UNIT_TEST_ITEM(should_propagate_exception),
+    UNIT_TEST_ITEM(should_nest_inside_pool))
+
+} // namespace my::test::test_parallel
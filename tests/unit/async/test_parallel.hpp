@@ -0,0 +1,17 @@
+#ifndef TEST_PARALLEL_HPP
+#define TEST_PARALLEL_HPP
+
+namespace my::test::test_parallel {
+
+void should_parallel_for();
+void should_reduce();
+void should_transform_reduce();
+void should_scan();
+void should_sort_vec();
+void should_sort_dyn_array();
+void should_propagate_exception();
+void should_nest_inside_pool();
+
+} // namespace my::test::test_parallel
+
+#endif // TEST_PARALLEL_HPP
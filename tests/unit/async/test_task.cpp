@@ -0,0 +1,80 @@
+#include "test_task.hpp"
+#include "task.hpp"
+#include "ricky_test.hpp"
+
+#include <array>
+#include <memory>
+
+namespace my::test::test_task {
+
+void should_store_small_callable_inline() {
+    // Given
+    i32 counter = 0;
+    async::UniqueTask task{[&counter]() { ++counter; }};
+
+    // When
+    task();
+    task();
+
+    // Then
+    Assertions::assertTrue(task.is_inline());
+    Assertions::assertEquals(2, counter);
+}
+
+void should_store_large_callable_on_heap() {
+    // Given
+    std::array<i64, 16> payload{};
+    payload[15] = 42;
+    i64 result = 0;
+    async::UniqueTask task{[payload, &result]() { result = payload[15]; }};
+
+    // When
+    task();
+
+    // Then
+    Assertions::assertFalse(task.is_inline());
+    Assertions::assertEquals(42, result);
+}
+
+void should_move_task() {
+    // Given
+    auto value = std::make_shared<i32>(1);
+    async::UniqueTask task{[value]() { ++*value; }};
+    Assertions::assertEquals(2, value.use_count());
+
+    // When
+    async::UniqueTask moved{std::move(task)};
+    moved();
+
+    // Then
+    Assertions::assertFalse(static_cast<bool>(task));
+    Assertions::assertTrue(static_cast<bool>(moved));
+    Assertions::assertEquals(2, *value);
+
+    moved.reset();
+    Assertions::assertEquals(1, value.use_count());
+}
+
+void should_hold_move_only_callable() {
+    // Given
+    auto ptr = std::make_unique<i32>(7);
+    i32 result = 0;
+    async::UniqueTask task{[p = std::move(ptr), &result]() { result = *p; }};
+
+    // When
+    async::UniqueTask other;
+    other = std::move(task);
+    other();
+
+    // Then
+    Assertions::assertEquals(7, result);
+}
+
+GROUP_NAME("test_task")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_store_small_callable_inline),
+    UNIT_TEST_ITEM(should_store_large_callable_on_heap),
+    UNIT_TEST_ITEM(should_move_task),
+    UNIT_TEST_ITEM(should_hold_move_only_callable))
+
+} // namespace my::test::test_task
@@ -0,0 +1,13 @@
+#ifndef TEST_TASK_HPP
+#define TEST_TASK_HPP
+
+namespace my::test::test_task {
+
+void should_store_small_callable_inline();
+void should_store_large_callable_on_heap();
+void should_move_task();
+void should_hold_move_only_callable();
+
+} // namespace my::test::test_task
+
+#endif // TEST_TASK_HPP
@@ -0,0 +1,152 @@
+#include "test_task_graph.hpp"
+#include "task_graph.hpp"
+#include "my_exception.hpp"
+#include "ricky_test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace my::test::test_task_graph {
+
+void should_respect_dependencies() {
+    for (auto mode : {async::ScheduleMode::Shared, async::ScheduleMode::WorkStealing}) {
+        // Given
+        async::ThreadPool tp{4, mode};
+        async::TaskGraph graph;
+        std::atomic<i32> clock{0};
+        i32 at[5]{};
+        auto stamp = [&](usize i) { return [&, i]() { at[i] = clock.fetch_add(1) + 1; }; };
+
+        // 0 -> {1, 2, 3} -> 4
+        auto src = graph.emplace("src", stamp(0));
+        auto sink = graph.emplace("sink", stamp(4));
+        for (usize i = 1; i <= 3; ++i) {
+            auto mid = graph.emplace(stamp(i));
+            src.precede(mid);
+            mid.precede(sink);
+        }
+
+        // When
+        graph.run_and_wait(tp);
+
+        // Then
+        Assertions::assertEquals(5, clock.load());
+        for (usize i = 1; i <= 3; ++i) {
+            Assertions::assertTrue(at[0] < at[i]);
+            Assertions::assertTrue(at[i] < at[4]);
+        }
+        Assertions::assertFalse(graph.is_running());
+    }
+}
+
+void should_rerun_without_rebuilding() {
+    // Given
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    async::TaskGraph graph;
+    std::atomic<i32> sum{0};
+    auto prev = graph.emplace([&]() { sum.fetch_add(1); });
+    for (i32 i = 0; i < 99; ++i) {
+        auto cur = graph.emplace([&]() { sum.fetch_add(1); });
+        cur.succeed(prev);
+        prev = cur;
+    }
+
+    // When
+    for (i32 round = 0; round < 10; ++round) {
+        graph.run(tp).get();
+    }
+
+    // Then
+    Assertions::assertEquals(1000, sum.load());
+}
+
+void should_detect_cycle() {
+    // Given
+    async::ThreadPool tp{2};
+    async::TaskGraph graph;
+    auto a = graph.emplace([]() {});
+    auto b = graph.emplace([]() {});
+    auto c = graph.emplace([]() {});
+    a.precede(b);
+    b.precede(c);
+    c.precede(a);
+
+    // When & Then
+    Assertions::assertThrows("TaskGraph contains a cycle", [&]() {
+        graph.run(tp);
+    });
+    Assertions::assertFalse(graph.is_running());
+}
+
+void should_propagate_exception() {
+    // Given
+    async::ThreadPool tp{2};
+    async::TaskGraph graph;
+    std::atomic<bool> after_ran{false};
+    auto boom = graph.emplace("boom", []() { throw runtime_exception("stage failed"); });
+    auto after = graph.emplace("after", [&]() { after_ran = true; });
+    boom.precede(after);
+
+    // When
+    auto future = graph.run(tp);
+
+    // Then
+    Assertions::assertThrows("stage failed", [&]() {
+        future.get();
+    });
+    Assertions::assertFalse(after_ran.load());
+    Assertions::assertFalse(graph.is_running());
+}
+
+void should_report_critical_path() {
+    // Given
+    using namespace std::chrono_literals;
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    async::TaskGraph graph;
+    auto load = graph.emplace("load", []() { std::this_thread::sleep_for(1ms); });
+    auto slow = graph.emplace("slow", []() { std::this_thread::sleep_for(30ms); });
+    auto fast = graph.emplace("fast", []() { std::this_thread::sleep_for(1ms); });
+    auto store = graph.emplace("store", []() { std::this_thread::sleep_for(1ms); });
+    load.precede(slow).precede(fast);
+    store.succeed(slow).succeed(fast);
+
+    // When
+    graph.run_and_wait(tp);
+    const auto path = graph.critical_path();
+    const auto report = graph.timing_report();
+
+    // Then
+    Assertions::assertEquals(3, path.len());
+    Assertions::assertEquals(load.id(), path.at(0));
+    Assertions::assertEquals(slow.id(), path.at(1));
+    Assertions::assertEquals(store.id(), path.at(2));
+    Assertions::assertTrue(graph.duration_ns(slow) >= 30'000'000);
+    Assertions::assertTrue(graph.makespan_ns() >= graph.duration_ns(slow));
+    Assertions::assertTrue(report.find("dominant stage: slow") != npos);
+}
+
+void should_run_empty_graph() {
+    // Given
+    async::ThreadPool tp{1};
+    async::TaskGraph graph;
+
+    // When
+    auto future = graph.run(tp);
+
+    // Then
+    Assertions::assertTrue(future.is_ready());
+    future.get();
+    Assertions::assertEquals(0, graph.critical_path().len());
+}
+
+GROUP_NAME("test_task_graph")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_respect_dependencies),
+    UNIT_TEST_ITEM(should_rerun_without_rebuilding),
+    UNIT_TEST_ITEM(should_detect_cycle),
+    UNIT_TEST_ITEM(should_propagate_exception),
+    UNIT_TEST_ITEM(should_report_critical_path),
+    UNIT_TEST_ITEM(should_run_empty_graph))
+
+} // namespace my::test::test_task_graph
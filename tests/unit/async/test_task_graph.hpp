@@ -0,0 +1,15 @@
+#ifndef TEST_TASK_GRAPH_HPP
+#define TEST_TASK_GRAPH_HPP
+
+namespace my::test::test_task_graph {
+
+void should_respect_dependencies();
+void should_rerun_without_rebuilding();
+void should_detect_cycle();
+void should_propagate_exception();
+void should_report_critical_path();
+void should_run_empty_graph();
+
+} // namespace my::test::test_task_graph
+
+#endif // TEST_TASK_GRAPH_HPP
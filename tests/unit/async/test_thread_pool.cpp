@@ -4,6 +4,10 @@
 #include "hash_map.hpp"
 #include "ricky_test.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace my::test::test_thread_pool {
 
 inline i32 add(i32 a, i32 b) {
@@ -76,11 +80,144 @@ void should_wait() {
     }
 }
 
+void should_push_in_work_stealing_mode() {
+    // Given
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+
+    // When
+    auto future = tp.push(add, 2, 3);
+    auto future2 = tp.push(throw_exception);
+
+    // Then
+    Assertions::assertEquals(5, future.get());
+    Assertions::assertThrows("wa", [&]() {
+        future2.get();
+    });
+}
+
+void should_run_nested_tasks_in_work_stealing_mode() {
+    // Given
+    constexpr usize n = 64;
+    constexpr usize m = 16;
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    std::atomic<usize> counter{0};
+
+    // When
+    for (usize i = 0; i < n; ++i) {
+        tp.push([&]() {
+            for (usize j = 0; j < m; ++j) {
+                // 工作线程内提交，进入本地队列
+                tp.push([&]() { counter.fetch_add(1, std::memory_order_relaxed); });
+            }
+        });
+    }
+    tp.wait();
+
+    // Then
+    Assertions::assertEquals(n * m, counter.load());
+}
+
+void should_wait_in_work_stealing_mode() {
+    // Given
+    usize n = 100;
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    util::HashMap<i32, i32> futures;
+
+    // When
+    for (usize i = 0; i < n; ++i) {
+        futures.insert(i, tp.push(add, i, i).get());
+    }
+    tp.wait();
+
+    // Then
+    for (usize i = 0; i < n; ++i) {
+        Assertions::assertEquals(i * 2, static_cast<usize>(futures[i]));
+    }
+}
+
+void should_stop_in_work_stealing_mode() {
+    // Given
+    struct Probe {
+        std::atomic<usize>* destroyed;
+
+        explicit Probe(std::atomic<usize>& d) : destroyed(&d) {}
+        Probe(Probe&& other) noexcept : destroyed(std::exchange(other.destroyed, nullptr)) {}
+        ~Probe() {
+            if (destroyed) destroyed->fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+    constexpr usize n = 1000;
+    std::atomic<usize> counter{0};
+    std::atomic<usize> destroyed{0};
+    usize after_stop = 0;
+    usize later = 0;
+
+    // When
+    {
+        async::ThreadPool tp{2, async::ScheduleMode::WorkStealing};
+        for (usize i = 0; i < n; ++i) {
+            tp.execute([&counter, probe = Probe(destroyed)]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                counter.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        tp.stop();
+        after_stop = counter.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        later = counter.load();
+    }
+
+    // Then
+    Assertions::assertTrue(after_stop < n); // stop() 没有等待队列中的任务
+    Assertions::assertEquals(after_stop, later); // 返回后不再有任务执行
+    Assertions::assertEquals(n, destroyed.load()); // 已执行与被丢弃的任务都被析构
+}
+
+void should_execute() {
+    for (auto mode : {async::ScheduleMode::Shared, async::ScheduleMode::WorkStealing}) {
+        // Given
+        async::ThreadPool tp{4, mode};
+        std::atomic<i32> sum{0};
+
+        // When
+        for (i32 i = 1; i <= 100; ++i) {
+            tp.execute([&sum](i32 x) { sum.fetch_add(x, std::memory_order_relaxed); }, i);
+        }
+        tp.wait();
+
+        // Then
+        Assertions::assertEquals(5050, sum.load());
+    }
+}
+
+void should_submit() {
+    for (auto mode : {async::ScheduleMode::Shared, async::ScheduleMode::WorkStealing}) {
+        // Given
+        async::ThreadPool tp{4, mode};
+
+        // When
+        auto future = tp.submit(add, 2, 3);
+        auto future2 = tp.submit([]() { throw runtime_exception("wa"); });
+
+        // Then
+        Assertions::assertEquals(5, future.get());
+        Assertions::assertThrows("wa", [&]() {
+            future2.get();
+        });
+    }
+}
+
 GROUP_NAME("test_thread_pool")
 REGISTER_UNIT_TESTS(
     UNIT_TEST_ITEM(should_push),
     UNIT_TEST_ITEM(should_push_tasks),
     UNIT_TEST_ITEM(should_push_tasks_with_exception),
-    UNIT_TEST_ITEM(should_wait))
+    UNIT_TEST_ITEM(should_wait),
+    UNIT_TEST_ITEM(should_push_in_work_stealing_mode),
+    UNIT_TEST_ITEM(should_run_nested_tasks_in_work_stealing_mode),
+    UNIT_TEST_ITEM(should_wait_in_work_stealing_mode),
+    UNIT_TEST_ITEM(should_stop_in_work_stealing_mode),
+    UNIT_TEST_ITEM(should_execute),
+    UNIT_TEST_ITEM(should_submit))
 
 } // namespace my::test::test_thread_pool
@@ -8,6 +8,12 @@ void should_push();
 void should_push_tasks();
 void should_push_tasks_with_exception();
 void should_wait();
+void should_push_in_work_stealing_mode();
+void should_run_nested_tasks_in_work_stealing_mode();
+void should_wait_in_work_stealing_mode();
+void should_stop_in_work_stealing_mode();
+void should_execute();
+void should_submit();
 
 } // namespace my::test::test_thread_pool
 
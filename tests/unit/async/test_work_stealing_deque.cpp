@@ -0,0 +1,86 @@
+#include "test_work_stealing_deque.hpp"
+#include "work_stealing_deque.hpp"
+#include "ricky_test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace my::test::test_work_stealing_deque {
+
+void it_works() {
+    // Given
+    async::WorkStealingDeque<usize> dq;
+    Assertions::assertTrue(dq.is_empty());
+
+    // When
+    dq.push(1), dq.push(2), dq.push(3);
+
+    // Then
+    Assertions::assertEquals(3, dq.len());
+    Assertions::assertEquals(3, dq.pop().unwrap()); // 所有者 LIFO
+    Assertions::assertEquals(1, dq.steal().unwrap()); // 窃取者 FIFO
+    Assertions::assertEquals(2, dq.pop().unwrap());
+    Assertions::assertTrue(dq.pop().is_none());
+    Assertions::assertTrue(dq.steal().is_none());
+}
+
+void should_grow() {
+    // Given
+    async::WorkStealingDeque<usize> dq{4};
+
+    // When
+    for (usize i = 0; i < 100; ++i) {
+        dq.push(i);
+    }
+
+    // Then
+    Assertions::assertEquals(100, dq.len());
+    for (usize i = 0; i < 100; ++i) {
+        Assertions::assertEquals(i, dq.steal().unwrap());
+    }
+    Assertions::assertTrue(dq.is_empty());
+}
+
+void should_steal_concurrently() {
+    // Given
+    constexpr usize n = 100000;
+    async::WorkStealingDeque<usize> dq{16};
+    std::atomic<usize> sum{0};
+    std::atomic<usize> taken{0};
+    std::atomic<bool> done{false};
+
+    auto thief = [&]() {
+        while (!done.load(std::memory_order_acquire) || !dq.is_empty()) {
+            if (auto item = dq.steal(); item.is_some()) {
+                sum.fetch_add(item.unwrap(), std::memory_order_relaxed);
+                taken.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    };
+    std::thread t1(thief), t2(thief);
+
+    // When
+    for (usize i = 1; i <= n; ++i) {
+        dq.push(i);
+        if (i % 3 == 0) {
+            if (auto item = dq.pop(); item.is_some()) {
+                sum.fetch_add(item.unwrap(), std::memory_order_relaxed);
+                taken.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    done.store(true, std::memory_order_release);
+    t1.join(), t2.join();
+
+    // Then: 每个元素恰好被取走一次
+    Assertions::assertEquals(n, taken.load());
+    Assertions::assertEquals(n * (n + 1) / 2, sum.load());
+}
+
+GROUP_NAME("test_work_stealing_deque")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(it_works),
+    UNIT_TEST_ITEM(should_grow),
+    UNIT_TEST_ITEM(should_steal_concurrently))
+
+} // namespace my::test::test_work_stealing_deque
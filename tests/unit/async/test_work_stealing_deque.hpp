@@ -0,0 +1,12 @@
+#ifndef TEST_WORK_STEALING_DEQUE_HPP
+#define TEST_WORK_STEALING_DEQUE_HPP
+
+namespace my::test::test_work_stealing_deque {
+
+void it_works();
+void should_grow();
+void should_steal_concurrently();
+
+} // namespace my::test::test_work_stealing_deque
+
+#endif // TEST_WORK_STEALING_DEQUE_HPP
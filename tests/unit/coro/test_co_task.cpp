@@ -0,0 +1,204 @@
+#include "test_co_task.hpp"
+#include "co_task.hpp"
+#include "sync_wait.hpp"
+#include "when_all.hpp"
+#include "thread_pool.hpp"
+#include "my_exception.hpp"
+#include "ricky_test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace my::test::test_co_task {
+
+static coro::Task<i32> value_of(i32 x) {
+    co_return x;
+}
+
+static coro::Task<i32> add(i32 a, i32 b) {
+    const i32 x = co_await value_of(a);
+    const i32 y = co_await value_of(b);
+    co_return x + y;
+}
+
+static coro::Task<i32> fail() {
+    throw runtime_exception("coro failed");
+    co_return 0;
+}
+
+static coro::Task<std::thread::id> hop(async::ThreadPool& tp) {
+    co_await tp.schedule();
+    co_return std::this_thread::get_id();
+}
+
+void should_start_lazily() {
+    // Given
+    bool started = false;
+    auto body = [&]() -> coro::Task<> { // 协程 lambda 的捕获存放在闭包中，闭包需活得比任务久
+        started = true;
+        co_return;
+    };
+    auto task = body();
+
+    // When & Then
+    Assertions::assertFalse(started);
+    coro::sync_wait(std::move(task));
+    Assertions::assertTrue(started);
+    Assertions::assertEquals(7, coro::sync_wait(add(3, 4)));
+}
+
+void should_chain_sync_awaits() {
+    // Given
+    constexpr i32 n = 10000;
+    auto sum = []() -> coro::Task<i64> {
+        i64 acc = 0;
+        for (i32 i = 0; i < n; ++i) {
+            acc += co_await value_of(1); // 同步完成，经对称转移回到循环
+        }
+        co_return acc;
+    };
+
+    // When
+    const i64 res = coro::sync_wait(sum());
+
+    // Then
+    Assertions::assertEquals(static_cast<i64>(n), res);
+}
+
+void should_propagate_exception() {
+    // Given
+    auto outer = []() -> coro::Task<i32> {
+        co_return co_await fail() + 1;
+    };
+
+    // When & Then
+    Assertions::assertThrows("coro failed", []() {
+        coro::sync_wait(fail());
+    });
+    Assertions::assertThrows("coro failed", [&]() {
+        coro::sync_wait(outer());
+    });
+}
+
+void should_schedule_on_pool() {
+    for (auto mode : {async::ScheduleMode::Shared, async::ScheduleMode::WorkStealing}) {
+        // Given
+        async::ThreadPool tp{2, mode};
+
+        // When
+        const auto id = coro::sync_wait(hop(tp));
+
+        // Then
+        Assertions::assertTrue(id != std::this_thread::get_id());
+    }
+}
+
+void should_when_all() {
+    // Given
+    async::ThreadPool tp{2};
+    auto unit = []() -> coro::Task<> { co_return; };
+
+    // When
+    auto [a, b, c] = coro::sync_wait(coro::when_all(add(1, 2), value_of(10), unit()));
+
+    util::Vec<coro::Task<i32>> tasks;
+    for (i32 i = 0; i < 10; ++i) {
+        tasks.push([](async::ThreadPool& tp, i32 i) -> coro::Task<i32> {
+            co_await tp.schedule();
+            co_return i * i;
+        }(tp, i));
+    }
+    const auto squares = coro::sync_wait(coro::when_all(std::move(tasks)));
+
+    // Then
+    Assertions::assertEquals(3, a);
+    Assertions::assertEquals(10, b);
+    (void)c;
+    Assertions::assertEquals(10, squares.len());
+    for (i32 i = 0; i < 10; ++i) {
+        Assertions::assertEquals(i * i, squares.at(i));
+    }
+    Assertions::assertThrows("coro failed", []() {
+        coro::sync_wait(coro::when_all(value_of(1), fail()));
+    });
+}
+
+void should_when_all_thousands_of_flows() {
+    // Given
+    constexpr usize n = 10000;
+    async::ThreadPool tp{4, async::ScheduleMode::WorkStealing};
+    std::atomic<usize> done{0};
+    util::Vec<coro::Task<>> flows;
+    for (usize i = 0; i < n; ++i) {
+        flows.push([](async::ThreadPool& tp, std::atomic<usize>& done) -> coro::Task<> {
+            co_await tp.schedule();
+            co_await tp.schedule(); // 模拟多次等待 I/O 后在任意工作线程恢复
+            done.fetch_add(1, std::memory_order_relaxed);
+        }(tp, done));
+    }
+
+    // When
+    coro::sync_wait(coro::when_all(std::move(flows)));
+
+    // Then
+    Assertions::assertEquals(n, done.load());
+}
+
+void should_when_any() {
+    // Given
+    using namespace std::chrono_literals;
+    async::ThreadPool tp{4};
+    auto after = [](async::ThreadPool& tp, std::chrono::milliseconds delay, i32 value) -> coro::Task<i32> {
+        co_await tp.schedule();
+        std::this_thread::sleep_for(delay);
+        co_return value;
+    };
+    util::Vec<coro::Task<i32>> tasks;
+    tasks.push(after(tp, 200ms, 1));
+    tasks.push(after(tp, 1ms, 2));
+    tasks.push(after(tp, 200ms, 3));
+
+    // When
+    const auto res = coro::sync_wait(coro::when_any(std::move(tasks)));
+
+    // Then
+    Assertions::assertEquals(1, res.index);
+    Assertions::assertEquals(2, res.value);
+    Assertions::assertThrows("when_any requires at least one task", []() {
+        coro::sync_wait(coro::when_any(util::Vec<coro::Task<i32>>{}));
+    });
+    tp.wait(); // 落败的任务在后台跑完
+}
+
+void should_reuse_pooled_frames() {
+    // Given
+    auto run = []() {
+        for (i32 i = 0; i < 10000; ++i) {
+            coro::sync_wait(add(i, 1));
+        }
+    };
+    run();
+    const usize small = async::SlabPool<128>::instance().slab_count();
+    const usize medium = async::SlabPool<256>::instance().slab_count();
+
+    // When
+    run();
+
+    // Then
+    Assertions::assertEquals(small, async::SlabPool<128>::instance().slab_count());
+    Assertions::assertEquals(medium, async::SlabPool<256>::instance().slab_count());
+}
+
+GROUP_NAME("test_co_task")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_start_lazily),
+    UNIT_TEST_ITEM(should_chain_sync_awaits),
+    UNIT_TEST_ITEM(should_propagate_exception),
+    UNIT_TEST_ITEM(should_schedule_on_pool),
+    UNIT_TEST_ITEM(should_when_all),
+    UNIT_TEST_ITEM(should_when_all_thousands_of_flows),
+    UNIT_TEST_ITEM(should_when_any),
+    UNIT_TEST_ITEM(should_reuse_pooled_frames))
+
+} // namespace my::test::test_co_task
@@ -0,0 +1,17 @@
+#ifndef TEST_CO_TASK_HPP
+#define TEST_CO_TASK_HPP
+
+namespace my::test::test_co_task {
+
+void should_start_lazily();
+void should_chain_sync_awaits();
+void should_propagate_exception();
+void should_schedule_on_pool();
+void should_when_all();
+void should_when_all_thousands_of_flows();
+void should_when_any();
+void should_reuse_pooled_frames();
+
+} // namespace my::test::test_co_task
+
+#endif // TEST_CO_TASK_HPP
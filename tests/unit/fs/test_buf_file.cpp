@@ -0,0 +1,194 @@
+#include "test_buf_file.hpp"
+#include "buf_file.hpp"
+#include "ricky_test.hpp"
+
+#include <cstring>
+#include <format>
+
+namespace my::test::test_buf_file {
+
+namespace {
+
+const fs::PathBuf& repo_root() {
+    static const fs::PathBuf root = []() {
+        std::string file = __FILE__;
+        const char* win_suffix = "\\tests\\unit\\fs\\test_buf_file.cpp";
+        const char* posix_suffix = "/tests/unit/fs/test_buf_file.cpp";
+        auto pos = file.find(win_suffix);
+        if (pos == std::string::npos) {
+            pos = file.find(posix_suffix);
+        }
+        if (pos == std::string::npos) {
+            return fs::PathBuf(".");
+        }
+        return fs::PathBuf(file.substr(0, pos).c_str());
+    }();
+    return root;
+}
+
+CString make_res_path(const char* leaf) {
+    return repo_root().join(R"(tests\resources)").join(leaf).as_cstr();
+}
+
+void write_file(const CString& path, const char* content) {
+    auto file = fs::File::create(path.data());
+    file.write(content, std::strlen(content));
+}
+
+void remove_tmp(const CString& path) {
+    plat::fs::remove(str::StringView(path.data(), path.length()));
+}
+
+} // namespace
+
+void test_read_lines() {
+    // Given
+    auto path = make_res_path("fs_buf_tmp_lines.txt");
+    write_file(path, "alpha\r\nbeta\n\ngamma");
+
+    // When
+    util::Vec<str::String<>> lines;
+    {
+        fs::BufReader reader(path.data());
+        for (auto line : reader.lines()) {
+            lines.push(str::String<>(line));
+        }
+    }
+
+    // Then
+    Assertions::assert_equals(4uz, lines.len());
+    Assertions::assert_true(lines.at(0).as_str() == "alpha"_sv);
+    Assertions::assert_true(lines.at(1).as_str() == "beta"_sv);
+    Assertions::assert_true(lines.at(2).as_str() == ""_sv);
+    Assertions::assert_true(lines.at(3).as_str() == "gamma"_sv);
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_read_lines_across_refills() {
+    // Given
+    auto path = make_res_path("fs_buf_tmp_refill.txt");
+    {
+        fs::BufWriter writer(path.data(), 64);
+        for (usize i = 0; i < 1000; ++i) {
+            auto line = std::format("line-{}", i);
+            writer.write_line(str::StringView(line.data(), line.size()));
+        }
+    }
+
+    // When
+    usize count = 0;
+    bool in_order = true;
+    {
+        fs::BufReader reader(path.data(), 32);
+        for (auto line : reader.lines()) {
+            auto expected = std::format("line-{}", count++);
+            in_order = in_order && line == str::StringView(expected.data(), expected.size());
+        }
+    }
+
+    // Then
+    Assertions::assert_equals(1000uz, count);
+    Assertions::assert_true(in_order);
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_read_exact() {
+    // Given
+    auto path = make_res_path("fs_buf_tmp_exact.bin");
+    write_file(path, "0123456789");
+
+    // When
+    char head[4];
+    char tail[6];
+    usize rest = 0;
+    {
+        fs::BufReader reader(path.data(), 4);
+        reader.read_exact(std::span<char>(head, sizeof(head)));
+        reader.read_exact(std::span<char>(tail, sizeof(tail)));
+        rest = reader.read(std::span<char>(tail, sizeof(tail)));
+    }
+
+    // Then
+    Assertions::assert_true(str::StringView(head, 4) == "0123"_sv);
+    Assertions::assert_true(str::StringView(tail, 6) == "456789"_sv);
+    Assertions::assert_equals(0uz, rest);
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_write_and_flush() {
+    // Given
+    auto path = make_res_path("fs_buf_tmp_write.txt");
+    fs::BufWriter writer(path.data(), 16);
+
+    // When
+    writer.write("abc", 3);
+    writer.write("def"_sv);
+
+    // Then
+    Assertions::assert_equals(6uz, writer.buffered());
+    Assertions::assert_equals("", fs::File::open(path.data()).read_all());
+
+    // When
+    writer.write_line("a longer record than the buffer"_sv);
+    writer.flush();
+
+    // Then
+    Assertions::assert_equals(0uz, writer.buffered());
+    Assertions::assert_equals("abcdefa longer record than the buffer\n", fs::File::open(path.data()).read_all());
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_append_mode() {
+    // Given
+    auto path = make_res_path("fs_buf_tmp_append.txt");
+    write_file(path, "head\n");
+
+    // When
+    {
+        fs::BufWriter writer(path.data(), fs::File::OpenMode::AppendBinary);
+        writer.write_line("tail"_sv);
+    }
+
+    // Then
+    Assertions::assert_equals("head\ntail\n", fs::File::open(path.data()).read_all());
+
+    // Final
+    remove_tmp(path);
+}
+
+void should_throw_when_line_exceeds_capacity() {
+    // Given
+    auto path = make_res_path("fs_buf_tmp_long.txt");
+    write_file(path, "0123456789abcdef\n");
+    CString expected_msg = CString("Line exceeds buffer capacity 8");
+
+    // When & Then
+    {
+        fs::BufReader reader(path.data(), 8);
+        Assertions::assert_throws<Exception>(expected_msg, [&]() {
+            reader.read_line();
+        });
+    }
+
+    // Final
+    remove_tmp(path);
+}
+
+GROUP_NAME("test_buf_file");
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_read_lines),
+    UNIT_TEST_ITEM(test_read_lines_across_refills),
+    UNIT_TEST_ITEM(test_read_exact),
+    UNIT_TEST_ITEM(test_write_and_flush),
+    UNIT_TEST_ITEM(test_append_mode),
+    UNIT_TEST_ITEM(should_throw_when_line_exceeds_capacity));
+
+} // namespace my::test::test_buf_file
@@ -0,0 +1,15 @@
+#ifndef TEST_BUF_FILE_HPP
+#define TEST_BUF_FILE_HPP
+
+namespace my::test::test_buf_file {
+
+void test_read_lines();
+void test_read_lines_across_refills();
+void test_read_exact();
+void test_write_and_flush();
+void test_append_mode();
+void should_throw_when_line_exceeds_capacity();
+
+} // namespace my::test::test_buf_file
+
+#endif // TEST_BUF_FILE_HPP
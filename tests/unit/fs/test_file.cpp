@@ -117,11 +117,82 @@ void should_throw_when_handle_invalid() {
     plat::fs::remove(str::StringView(path_cstr.data(), path_cstr.length()));
 }
 
+void test_copy() {
+    // Given
+    auto from = make_res_path("fs_file_tmp_copy_from.bin");
+    auto to = make_res_path("fs_file_tmp_copy_to.bin");
+    auto from_cstr = from.as_cstr();
+    auto to_cstr = to.as_cstr();
+    std::string data;
+    for (usize i = 0; i < 300000; ++i) {
+        data.push_back(static_cast<char>('a' + i % 26));
+    }
+    {
+        auto file = fs::File::create(from);
+        file.write(data.data(), data.size());
+    }
+    {
+        auto file = fs::File::create(to);
+        file.write("stale content longer than nothing", 33);
+    }
+
+    // When
+    const u64 copied = fs::copy(from, to);
+    const u64 again = fs::copy(from_cstr.data(), to_cstr.data());
+    auto content = fs::File::open(to).read_all();
+
+    // Then
+    Assertions::assert_equals(u64(data.size()), copied);
+    Assertions::assert_equals(copied, again);
+    Assertions::assert_equals(data.size(), content.len());
+    Assertions::assert_true(content.as_str() == str::StringView(data.data(), data.size()));
+
+    // Final
+    plat::fs::remove(str::StringView(from_cstr.data(), from_cstr.length()));
+    plat::fs::remove(str::StringView(to_cstr.data(), to_cstr.length()));
+}
+
+void should_throw_when_copy_source_missing() {
+    // Given
+    auto from = make_res_path("fs_file_tmp_copy_missing.bin");
+    auto to = make_res_path("fs_file_tmp_copy_missing_to.bin");
+    auto to_cstr = to.as_cstr();
+
+    // When & Then
+    Assertions::assert_throws<Exception>([&]() {
+        fs::copy(from, to);
+    });
+    Assertions::assert_false(plat::fs::exists(str::StringView(to_cstr.data(), to_cstr.length())));
+}
+
+void should_throw_when_copy_onto_itself() {
+    // Given
+    auto path = make_res_path("fs_file_tmp_copy_self.bin");
+    auto path_cstr = path.as_cstr();
+    {
+        auto file = fs::File::create(path);
+        file.write("keep me", 7);
+    }
+
+    // When & Then
+    Assertions::assert_throws<Exception>([&]() {
+        fs::copy(path, path);
+    });
+    auto content = fs::File::open(path).read_all();
+    Assertions::assert_true(content.as_str() == str::StringView("keep me"));
+
+    // Final
+    plat::fs::remove(str::StringView(path_cstr.data(), path_cstr.length()));
+}
+
 GROUP_NAME("test_file");
 REGISTER_UNIT_TESTS(
     UNIT_TEST_ITEM(test_open_and_read_all),
     UNIT_TEST_ITEM(test_create_write_and_read),
     UNIT_TEST_ITEM(test_append),
-    UNIT_TEST_ITEM(should_throw_when_handle_invalid));
+    UNIT_TEST_ITEM(should_throw_when_handle_invalid),
+    UNIT_TEST_ITEM(test_copy),
+    UNIT_TEST_ITEM(should_throw_when_copy_source_missing),
+    UNIT_TEST_ITEM(should_throw_when_copy_onto_itself));
 
 } // namespace my::test::test_file
@@ -7,6 +7,9 @@ void test_open_and_read_all();
 void test_create_write_and_read();
 void test_append();
 void should_throw_when_handle_invalid();
+void test_copy();
+void should_throw_when_copy_source_missing();
+void should_throw_when_copy_onto_itself();
 
 } // namespace my::test::test_file
 
@@ -0,0 +1,194 @@
+#include "test_mapped_file.hpp"
+#include "file.hpp"
+#include "json_parser.hpp"
+#include "mapped_file.hpp"
+#include "ricky_test.hpp"
+
+#include <cstring>
+
+namespace my::test::test_mapped_file {
+
+namespace {
+
+const fs::PathBuf& repo_root() {
+    static const fs::PathBuf root = []() {
+        std::string file = __FILE__;
+        const char* win_suffix = "\\tests\\unit\\fs\\test_mapped_file.cpp";
+        const char* posix_suffix = "/tests/unit/fs/test_mapped_file.cpp";
+        auto pos = file.find(win_suffix);
+        if (pos == std::string::npos) {
+            pos = file.find(posix_suffix);
+        }
+        if (pos == std::string::npos) {
+            return fs::PathBuf(".");
+        }
+        return fs::PathBuf(file.substr(0, pos).c_str());
+    }();
+    return root;
+}
+
+fs::PathBuf make_res_path(const char* leaf) {
+    return repo_root().join(R"(tests\resources)").join(leaf);
+}
+
+/**
+ * @brief 写出临时文件，返回其路径
+ */
+CString write_tmp(const char* leaf, const char* content) {
+    auto path_cstr = make_res_path(leaf).as_cstr();
+    auto file = fs::File::create(path_cstr.data());
+    file.write(content, std::strlen(content));
+    file.close();
+    return path_cstr;
+}
+
+void remove_tmp(const CString& path) {
+    plat::fs::remove(str::StringView(path.data(), path.length()));
+}
+
+} // namespace
+
+void test_open_and_read() {
+    // Given
+    auto path = make_res_path("text.txt");
+    auto expected = fs::File::open(path).read_all();
+
+    // When
+    auto mapped = fs::MappedFile::open(path);
+
+    // Then
+    Assertions::assert_true(mapped.is_open());
+    Assertions::assert_false(mapped.is_writable());
+    Assertions::assert_equals(expected.len(), mapped.len());
+    Assertions::assert_true(mapped.as_str() == expected.as_str());
+    Assertions::assert_true(mapped.as_str().find("Huffman Coding"_sv).is_some());
+}
+
+void test_empty_file() {
+    // Given
+    auto path = write_tmp("fs_mapped_tmp_empty.txt", "");
+
+    // When
+    usize lines = 0;
+    {
+        auto mapped = fs::MappedFile::open(path.data());
+        Assertions::assert_true(mapped.is_empty());
+        Assertions::assert_equals(0uz, mapped.as_bytes().size());
+        for ([[maybe_unused]] auto line : mapped.lines()) {
+            ++lines;
+        }
+        mapped.advise(fs::MappedFile::Advice::Sequential);
+    }
+
+    // Then
+    Assertions::assert_equals(0uz, lines);
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_parse_json_from_mapping() {
+    // Given
+    auto path = write_tmp("fs_mapped_tmp.json", R"({"name": "ricky", "ids": [1, 2, 3], "ok": true})");
+
+    // When
+    {
+        auto mapped = fs::MappedFile::open(path.data());
+        auto json = json::parse_json(mapped.as_str());
+
+        // Then
+        Assertions::assert_equals(3ULL, json["ids"].size());
+        Assertions::assert_true(json["ok"].into<bool>());
+    }
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_lines() {
+    // Given
+    auto path = write_tmp("fs_mapped_tmp_lines.txt", "first\r\nsecond\n\nlast");
+
+    // When
+    util::Vec<str::String<>> lines;
+    {
+        auto mapped = fs::MappedFile::open(path.data());
+        for (auto line : mapped.lines()) {
+            lines.push(str::String<>(line));
+        }
+    }
+
+    // Then
+    Assertions::assert_equals(4uz, lines.len());
+    Assertions::assert_true(lines.at(0).as_str() == "first"_sv);
+    Assertions::assert_true(lines.at(1).as_str() == "second"_sv);
+    Assertions::assert_true(lines.at(2).as_str() == ""_sv);
+    Assertions::assert_true(lines.at(3).as_str() == "last"_sv);
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_create_write_and_flush() {
+    // Given
+    auto path = make_res_path("fs_mapped_tmp_write.bin").as_cstr();
+    const char data[] = "mapped write test";
+    const usize n = sizeof(data) - 1;
+
+    // When
+    {
+        auto mapped = fs::MappedFile::create(path.data(), n);
+        Assertions::assert_true(mapped.is_writable());
+        std::memcpy(mapped.as_mut_bytes().data(), data, n);
+        mapped.flush();
+    }
+    {
+        auto mapped = fs::MappedFile::open_rw(path.data());
+        mapped.as_mut_bytes()[0] = 'M';
+        mapped.flush_range(0, 1);
+    }
+
+    // Then
+    auto content = fs::File::open(path.data()).read_all();
+    Assertions::assert_equals("Mapped write test", content);
+
+    // Final
+    remove_tmp(path);
+}
+
+void test_advise() {
+    // Given
+    auto mapped = fs::MappedFile::open(make_res_path("text.txt"));
+
+    // When
+    bool sequential = mapped.advise(fs::MappedFile::Advice::Sequential);
+    bool will_need = mapped.advise(fs::MappedFile::Advice::WillNeed, 1, 16);
+    mapped.advise(fs::MappedFile::Advice::HugePage); // 文件映射不一定支持大页
+
+    // Then
+    Assertions::assert_true(sequential || will_need);
+    Assertions::assert_true(mapped.as_str().find("Huffman Coding"_sv).is_some());
+}
+
+void should_throw_when_mapping_read_only() {
+    // Given
+    auto mapped = fs::MappedFile::open(make_res_path("text.txt"));
+    CString expected_msg = CString("Mapping is read-only");
+
+    // When & Then
+    Assertions::assert_throws<Exception>(expected_msg, [&]() {
+        mapped.as_mut_bytes();
+    });
+}
+
+GROUP_NAME("test_mapped_file");
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_open_and_read),
+    UNIT_TEST_ITEM(test_empty_file),
+    UNIT_TEST_ITEM(test_parse_json_from_mapping),
+    UNIT_TEST_ITEM(test_lines),
+    UNIT_TEST_ITEM(test_create_write_and_flush),
+    UNIT_TEST_ITEM(test_advise),
+    UNIT_TEST_ITEM(should_throw_when_mapping_read_only));
+
+} // namespace my::test::test_mapped_file
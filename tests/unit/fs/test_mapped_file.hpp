@@ -0,0 +1,16 @@
+#ifndef TEST_MAPPED_FILE_HPP
+#define TEST_MAPPED_FILE_HPP
+
+namespace my::test::test_mapped_file {
+
+void test_open_and_read();
+void test_empty_file();
+void test_parse_json_from_mapping();
+void test_lines();
+void test_create_write_and_flush();
+void test_advise();
+void should_throw_when_mapping_read_only();
+
+} // namespace my::test::test_mapped_file
+
+#endif // TEST_MAPPED_FILE_HPP
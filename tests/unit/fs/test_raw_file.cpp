@@ -0,0 +1,200 @@
+#include "test_raw_file.hpp"
+#include "file.hpp"
+#include "raw_file.hpp"
+#include "ricky_test.hpp"
+#include "thread_pool.hpp"
+
+#include <future>
+
+namespace my::test::test_raw_file {
+
+namespace {
+
+const fs::PathBuf& repo_root() {
+    static const fs::PathBuf root = []() {
+        std::string file = __FILE__;
+        const char* win_suffix = "\\tests\\unit\\fs\\test_raw_file.cpp";
+        const char* posix_suffix = "/tests/unit/fs/test_raw_file.cpp";
+        auto pos = file.find(win_suffix);
+        if (pos == std::string::npos) {
+            pos = file.find(posix_suffix);
+        }
+        if (pos == std::string::npos) {
+            return fs::PathBuf(".");
+        }
+        return fs::PathBuf(file.substr(0, pos).c_str());
+    }();
+    return root;
+}
+
+CString make_res_path(const char* leaf) {
+    return repo_root().join(R"(tests\resources)").join(leaf).as_cstr();
+}
+
+void remove_tmp(const CString& path) {
+    plat::fs::remove(str::StringView(path.data(), path.length()));
+}
+
+} // namespace
+
+void test_positional_read_write() {
+    // Given
+    auto path = make_res_path("fs_raw_tmp_pos.bin");
+    auto file = fs::RawFile::truncate(path.data());
+
+    // When
+    file.write_all_at("world", 5, 6);
+    file.write_all_at("hello ", 6, 0);
+    char buf[5];
+    const usize n = file.read_at(buf, sizeof(buf), 6);
+    const usize eof = file.read_at(buf, sizeof(buf), 11);
+
+    // Then
+    Assertions::assert_equals(5uz, n);
+    Assertions::assert_true(str::StringView(buf, n) == "world"_sv);
+    Assertions::assert_equals(0uz, eof);
+    Assertions::assert_equals("hello world", fs::File::open(path.data()).read_all());
+
+    // Final
+    file.close();
+    remove_tmp(path);
+}
+
+void test_vectored_read_write() {
+    // Given
+    auto path = make_res_path("fs_raw_tmp_vec.bin");
+    auto file = fs::RawFile::truncate(path.data());
+    plat::IoSlice out[3] = {{"head|", 5}, {"body|", 5}, {"tail", 4}};
+
+    // When
+    const usize written = file.write_vectored_at(out, 3, 2);
+    char a[7], b[7];
+    plat::IoSliceMut in[2] = {{a, sizeof(a)}, {b, sizeof(b)}};
+    const usize read = file.read_vectored_at(in, 2, 2);
+
+    // Then
+    Assertions::assert_equals(14uz, written);
+    Assertions::assert_equals(14uz, read);
+    Assertions::assert_true(str::StringView(a, 7) == "head|bo"_sv);
+    Assertions::assert_true(str::StringView(b, 7) == "dy|tail"_sv);
+    Assertions::assert_equals(16ULL, file.len());
+
+    // Final
+    file.close();
+    remove_tmp(path);
+}
+
+void test_parallel_chunked_read() {
+    // Given
+    constexpr usize CHUNK = 4096;
+    constexpr usize CHUNKS = 64;
+    auto path = make_res_path("fs_raw_tmp_par.bin");
+    {
+        auto file = fs::RawFile::truncate(path.data());
+        util::Vec<char> chunk(CHUNK);
+        for (usize i = 0; i < CHUNKS; ++i) {
+            for (auto& c : chunk) {
+                c = static_cast<char>(i);
+            }
+            file.write_all_at(chunk.data(), CHUNK, i * CHUNK);
+        }
+    }
+    const auto file = fs::RawFile::open(path.data());
+
+    // When
+    async::ThreadPool pool(4);
+    util::Vec<std::future<bool>> results;
+    for (usize i = 0; i < CHUNKS; ++i) {
+        results.push(pool.push([&file, i]() {
+            char buf[CHUNK];
+            file.read_exact_at(std::span<char>(buf, CHUNK), i * CHUNK);
+            for (const char c : buf) {
+                if (c != static_cast<char>(i)) return false;
+            }
+            return true;
+        }));
+    }
+
+    // Then
+    usize ok = 0;
+    for (auto& r : results) {
+        ok += r.get();
+    }
+    Assertions::assert_equals(CHUNKS, ok);
+
+    // Final
+    pool.wait();
+    remove_tmp(path);
+}
+
+void test_len_set_len_and_sync() {
+    // Given
+    auto path = make_res_path("fs_raw_tmp_len.bin");
+    auto file = fs::RawFile::create(path.data());
+
+    // When
+    file.set_len(8192);
+    file.write_all_at("x", 1, 100);
+    file.sync_data();
+    file.set_len(101);
+    file.sync_all();
+
+    // Then
+    Assertions::assert_equals(101ULL, file.len());
+    auto reopened = fs::RawFile::create(path.data());
+    Assertions::assert_equals(101ULL, reopened.len());
+
+    // Final
+    file.close();
+    reopened.close();
+    remove_tmp(path);
+}
+
+void test_advise() {
+    // Given
+    auto path = repo_root().join(R"(tests\resources)").join("text.txt");
+    auto file = fs::RawFile::open(path);
+
+    // When
+    const bool sequential = file.advise(fs::RawFile::Advice::Sequential);
+    const bool will_need = file.advise(fs::RawFile::Advice::WillNeed, 0, 4096);
+    char buf[64];
+    const usize n = file.read_at(buf, sizeof(buf), 0);
+
+    // Then
+#if RICKY_LINUX
+    Assertions::assert_true(sequential && will_need);
+#else
+    (void)sequential, (void)will_need;
+#endif
+    Assertions::assert_true(n > 0);
+}
+
+void should_throw_when_read_exact_past_end() {
+    // Given
+    auto path = make_res_path("fs_raw_tmp_short.bin");
+    auto file = fs::RawFile::truncate(path.data());
+    file.write_all_at("abc", 3, 0);
+    char buf[8];
+    CString expected_msg = CString("Unexpected end of file: expected 8 bytes at offset 0, got 3");
+
+    // When & Then
+    Assertions::assert_throws<Exception>(expected_msg, [&]() {
+        file.read_exact_at(std::span<char>(buf, sizeof(buf)), 0);
+    });
+
+    // Final
+    file.close();
+    remove_tmp(path);
+}
+
+GROUP_NAME("test_raw_file");
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_positional_read_write),
+    UNIT_TEST_ITEM(test_vectored_read_write),
+    UNIT_TEST_ITEM(test_parallel_chunked_read),
+    UNIT_TEST_ITEM(test_len_set_len_and_sync),
+    UNIT_TEST_ITEM(test_advise),
+    UNIT_TEST_ITEM(should_throw_when_read_exact_past_end));
+
+} // namespace my::test::test_raw_file
@@ -0,0 +1,15 @@
+#ifndef TEST_RAW_FILE_HPP
+#define TEST_RAW_FILE_HPP
+
+namespace my::test::test_raw_file {
+
+void test_positional_read_write();
+void test_vectored_read_write();
+void test_parallel_chunked_read();
+void test_len_set_len_and_sync();
+void test_advise();
+void should_throw_when_read_exact_past_end();
+
+} // namespace my::test::test_raw_file
+
+#endif // TEST_RAW_FILE_HPP
@@ -0,0 +1,282 @@
+#include "test_wal.hpp"
+#include "raw_file.hpp"
+#include "ricky_test.hpp"
+#include "wal.hpp"
+
+#include <format>
+#include <thread>
+
+namespace my::test::test_wal {
+
+namespace {
+
+const fs::PathBuf& repo_root() {
+    static const fs::PathBuf root = []() {
+        std::string file = __FILE__;
+        const char* win_suffix = "\\tests\\unit\\fs\\test_wal.cpp";
+        const char* posix_suffix = "/tests/unit/fs/test_wal.cpp";
+        auto pos = file.find(win_suffix);
+        if (pos == std::string::npos) {
+            pos = file.find(posix_suffix);
+        }
+        if (pos == std::string::npos) {
+            return fs::PathBuf(".");
+        }
+        return fs::PathBuf(file.substr(0, pos).c_str());
+    }();
+    return root;
+}
+
+CString make_res_path(const char* leaf) {
+    return repo_root().join(R"(tests\resources)").join(leaf).as_cstr();
+}
+
+str::StringView as_view(const CString& path) {
+    return str::StringView(path.data(), path.length());
+}
+
+void remove_tmp_dir(const CString& path) {
+    if (plat::fs::exists(as_view(path))) {
+        plat::fs::remove(as_view(path), true);
+    }
+}
+
+str::StringView as_view(const std::string& s) {
+    return str::StringView(s.data(), s.size());
+}
+
+struct Replayed {
+    util::Vec<u64> lsns;
+    util::Vec<std::string> records;
+
+    fs::Wal::Replay collector() {
+        return [this](const u64 lsn, const str::StringView record) {
+            lsns.push(lsn);
+            records.push(std::string(reinterpret_cast<const char*>(record.as_bytes()), record.len()));
+        };
+    }
+};
+
+} // namespace
+
+void test_crc32c() {
+    // Given
+    const char* check = "123456789";
+
+    // When
+    const u32 whole = fs::crc32c(check, 9);
+    const u32 split = fs::crc32c(check + 4, 5, fs::crc32c(check, 4));
+
+    // Then
+    Assertions::assert_equals(0xE3069283u, whole);
+    Assertions::assert_equals(whole, split);
+    Assertions::assert_equals(0u, fs::crc32c(check, 0));
+}
+
+void test_append_and_replay() {
+    // Given
+    auto dir = make_res_path("fs_wal_tmp_replay");
+    remove_tmp_dir(dir);
+    {
+        auto wal = fs::Wal::open(as_view(dir));
+        Assertions::assert_equals(1ULL, wal->append("first"_sv));
+        Assertions::assert_equals(2ULL, wal->append(""_sv));
+        Assertions::assert_equals(3ULL, wal->append("third"_sv, fs::Durability::Written));
+        Assertions::assert_equals(2ULL, wal->synced_lsn());
+    }
+
+    // When
+    Replayed replayed;
+    auto wal = fs::Wal::open(as_view(dir), {}, replayed.collector());
+    const u64 next = wal->append("fourth"_sv);
+
+    // Then
+    Assertions::assert_equals(3uz, replayed.lsns.len());
+    Assertions::assert_equals(1ULL, replayed.lsns.at(0));
+    Assertions::assert_equals(3ULL, replayed.lsns.at(2));
+    Assertions::assert_equals(std::string("first"), replayed.records.at(0));
+    Assertions::assert_equals(std::string(), replayed.records.at(1));
+    Assertions::assert_equals(std::string("third"), replayed.records.at(2));
+    Assertions::assert_equals(4ULL, next);
+    Assertions::assert_equals(4ULL, fs::Wal::replay(as_view(dir), {}));
+
+    // Final
+    wal.reset();
+    remove_tmp_dir(dir);
+}
+
+void test_group_commit() {
+    // Given
+    auto dir = make_res_path("fs_wal_tmp_group");
+    remove_tmp_dir(dir);
+    constexpr usize threads = 4;
+    constexpr usize per_thread = 100;
+    auto wal = fs::Wal::open(as_view(dir));
+
+    // When
+    util::Vec<std::thread> workers;
+    for (usize t = 0; t < threads; ++t) {
+        workers.push([&wal, t]() {
+            for (usize i = 0; i < per_thread; ++i) {
+                const auto record = std::format("{}:{}", t, i);
+                wal->append(as_view(record));
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    // Then
+    Assertions::assert_equals(u64(threads * per_thread), wal->last_lsn());
+    Assertions::assert_equals(wal->last_lsn(), wal->synced_lsn());
+    Assertions::assert_true(wal->groups() <= threads * per_thread);
+    Assertions::assert_equals(wal->groups(), wal->syncs());
+
+    Replayed replayed;
+    fs::Wal::replay(as_view(dir), replayed.collector());
+    Assertions::assert_equals(threads * per_thread, replayed.records.len());
+    usize next[threads] = {};
+    for (const auto& record : replayed.records) {
+        const usize t = static_cast<usize>(record[0] - '0');
+        Assertions::assert_equals(std::format("{}:{}", t, next[t]), record);
+        ++next[t];
+    }
+
+    // Final
+    wal.reset();
+    remove_tmp_dir(dir);
+}
+
+void test_segment_rotation() {
+    // Given
+    auto dir = make_res_path("fs_wal_tmp_rotate");
+    remove_tmp_dir(dir);
+    const fs::WalConfig config{.segment_size = 256};
+    const std::string record(50, 'r'); // 58 字节，每段 4 条
+    const std::string huge(400, 'h');
+
+    // When
+    {
+        auto wal = fs::Wal::open(as_view(dir), config);
+        for (usize i = 0; i < 10; ++i) {
+            wal->append(as_view(record));
+        }
+        wal->append(as_view(huge));
+        wal->append(as_view(record));
+        Assertions::assert_equals(5uz, wal->segment_count());
+    }
+    Replayed replayed;
+    auto wal = fs::Wal::open(as_view(dir), config, replayed.collector());
+
+    // Then
+    Assertions::assert_equals(5uz, wal->segment_count());
+    Assertions::assert_equals(12uz, replayed.records.len());
+    Assertions::assert_equals(huge, replayed.records.at(10));
+    Assertions::assert_equals(record, replayed.records.at(11));
+    Assertions::assert_equals(13ULL, wal->append(as_view(record)));
+
+    // Final
+    wal.reset();
+    remove_tmp_dir(dir);
+}
+
+void test_recover_torn_tail() {
+    // Given
+    auto dir = make_res_path("fs_wal_tmp_torn");
+    remove_tmp_dir(dir);
+    {
+        auto wal = fs::Wal::open(as_view(dir));
+        for (usize i = 0; i < 5; ++i) {
+            wal->append(as_view(std::format("record-{}", i)));
+        }
+    }
+    // 每条记录 8 + 8 字节，把最后一条负载的末字节改掉，模拟崩溃时没写完
+    const auto segment = plat::fs::join(as_view(dir), "00000000000000000001.wal"_sv);
+    fs::RawFile::open_rw(segment.as_cstr()).write_all_at("X", 1, 5 * 16 - 1);
+
+    // When
+    Replayed replayed;
+    auto wal = fs::Wal::open(as_view(dir), {}, replayed.collector());
+    const u64 lsn = wal->append("record-5"_sv);
+    wal.reset();
+    Replayed after;
+    fs::Wal::replay(as_view(dir), after.collector());
+
+    // Then
+    Assertions::assert_equals(4uz, replayed.records.len());
+    Assertions::assert_equals(std::string("record-3"), replayed.records.at(3));
+    Assertions::assert_equals(5ULL, lsn);
+    Assertions::assert_equals(5uz, after.records.len());
+    Assertions::assert_equals(std::string("record-5"), after.records.at(4));
+
+    // Final
+    remove_tmp_dir(dir);
+}
+
+void test_truncate_before() {
+    // Given
+    auto dir = make_res_path("fs_wal_tmp_truncate");
+    remove_tmp_dir(dir);
+    const fs::WalConfig config{.segment_size = 256};
+    const std::string record(50, 't');
+    auto wal = fs::Wal::open(as_view(dir), config);
+    for (usize i = 0; i < 20; ++i) {
+        wal->append(as_view(record));
+    }
+
+    // When
+    const usize removed = wal->truncate_before(10);
+    const usize none = wal->truncate_before(1000);
+    Replayed replayed;
+    const u64 last = fs::Wal::replay(as_view(dir), replayed.collector());
+
+    // Then
+    Assertions::assert_equals(2uz, removed);
+    Assertions::assert_equals(2uz, none);
+    Assertions::assert_equals(1uz, wal->segment_count());
+    Assertions::assert_equals(20ULL, last);
+    Assertions::assert_equals(17ULL, replayed.lsns.at(0));
+    Assertions::assert_equals(4uz, replayed.records.len());
+
+    // Final
+    wal.reset();
+    remove_tmp_dir(dir);
+}
+
+void test_buffered_then_sync() {
+    // Given
+    auto dir = make_res_path("fs_wal_tmp_buffered");
+    remove_tmp_dir(dir);
+    auto wal = fs::Wal::open(as_view(dir), fs::WalConfig{.durability = fs::Durability::Buffered});
+
+    // When
+    for (usize i = 0; i < 10; ++i) {
+        wal->append("buffered"_sv);
+    }
+    const u64 before = fs::Wal::replay(as_view(dir), {});
+    wal->sync();
+    const u64 after = fs::Wal::replay(as_view(dir), {});
+
+    // Then
+    Assertions::assert_equals(0ULL, before);
+    Assertions::assert_equals(10ULL, after);
+    Assertions::assert_equals(10ULL, wal->synced_lsn());
+    Assertions::assert_equals(1ULL, wal->groups());
+
+    // Final
+    wal.reset();
+    remove_tmp_dir(dir);
+}
+
+GROUP_NAME("test_wal");
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_crc32c),
+    UNIT_TEST_ITEM(test_append_and_replay),
+    UNIT_TEST_ITEM(test_group_commit),
+    UNIT_TEST_ITEM(test_segment_rotation),
+    UNIT_TEST_ITEM(test_recover_torn_tail),
+    UNIT_TEST_ITEM(test_truncate_before),
+    UNIT_TEST_ITEM(test_buffered_then_sync));
+
+} // namespace my::test::test_wal
@@ -0,0 +1,16 @@
+#ifndef TEST_WAL_HPP
+#define TEST_WAL_HPP
+
+namespace my::test::test_wal {
+
+void test_crc32c();
+void test_append_and_replay();
+void test_group_commit();
+void test_segment_rotation();
+void test_recover_torn_tail();
+void test_truncate_before();
+void test_buffered_then_sync();
+
+} // namespace my::test::test_wal
+
+#endif // TEST_WAL_HPP
@@ -0,0 +1,215 @@
+#include "test_walk.hpp"
+#include "file.hpp"
+#include "ricky_test.hpp"
+#include "walk.hpp"
+
+#include <algorithm>
+#include <format>
+#include <mutex>
+
+namespace my::test::test_walk {
+
+namespace {
+
+const fs::PathBuf& repo_root() {
+    static const fs::PathBuf root = []() {
+        std::string file = __FILE__;
+        const char* win_suffix = "\\tests\\unit\\fs\\test_walk.cpp";
+        const char* posix_suffix = "/tests/unit/fs/test_walk.cpp";
+        auto pos = file.find(win_suffix);
+        if (pos == std::string::npos) {
+            pos = file.find(posix_suffix);
+        }
+        if (pos == std::string::npos) {
+            return fs::PathBuf(".");
+        }
+        return fs::PathBuf(file.substr(0, pos).c_str());
+    }();
+    return root;
+}
+
+str::String<> owned(const std::string& s) {
+    return str::String<>(str::StringView(s.data(), s.size()));
+}
+
+/**
+ * @brief 临时目录树：root/{f0, f1, d0/{f0, f1, skip/{f0}}, d1/{f0, f1, skip/{f0}}, d2/...}
+ */
+struct Tree {
+    str::String<> root;
+
+    Tree() {
+        auto root_cstr = repo_root().join(R"(tests\resources)").join("fs_walk_tmp").as_cstr();
+        root = owned(std::string(root_cstr.data(), root_cstr.length()));
+        if (plat::fs::exists(root.as_str())) {
+            plat::fs::remove(root.as_str(), true);
+        }
+        plat::fs::mkdir(root.as_str());
+        touch("f0");
+        touch("f1");
+        for (usize d = 0; d < 3; ++d) {
+            const auto dir = std::format("d{}", d);
+            mkdir(dir);
+            touch(dir + "/f0");
+            touch(dir + "/f1");
+            mkdir(dir + "/skip");
+            touch(dir + "/skip/f0");
+        }
+    }
+
+    ~Tree() {
+        plat::fs::remove(root.as_str(), true);
+    }
+
+    str::String<> path(const std::string& rel) const {
+        return plat::fs::join(root.as_str(), str::StringView(rel.data(), rel.size()));
+    }
+
+    void mkdir(const std::string& rel) const {
+        plat::fs::mkdir(path(rel).as_str());
+    }
+
+    void touch(const std::string& rel) const {
+        auto p = path(rel);
+        auto file = fs::File::create(p.into_cstr().get());
+        file.write("x", 1);
+    }
+};
+
+/**
+ * @brief 以 root 为基准的相对路径，统一使用 '/'，并排序
+ */
+util::Vec<std::string> relative(const Tree& tree, const util::Vec<str::String<>>& paths) {
+    util::Vec<std::string> out;
+    for (const auto& p : paths) {
+        auto s = p.as_str().slice(tree.root.len() + 1).to_std_string();
+        std::replace(s.begin(), s.end(), '\\', '/');
+        out.push(std::move(s));
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+} // namespace
+
+void test_walk_all_entries() {
+    // Given
+    Tree tree;
+    async::ThreadPool pool(3);
+
+    // When
+    std::mutex mtx;
+    util::Vec<str::String<>> paths;
+    auto stats = fs::Walker(tree.root.as_str()).pool(pool).for_each([&](const fs::WalkEntry& entry) {
+        std::lock_guard<std::mutex> lock(mtx);
+        paths.push(str::String<>(entry.path));
+    });
+
+    // Then
+    auto rel = relative(tree, paths);
+    Assertions::assert_equals(17uz, rel.len());
+    Assertions::assert_equals(17ULL, stats.entries);
+    Assertions::assert_equals(7ULL, stats.dirs);
+    Assertions::assert_equals(0ULL, stats.errors);
+    Assertions::assert_true(rel.at(0) == "d0");
+    Assertions::assert_true(rel.at(3) == "d0/skip");
+    Assertions::assert_true(rel.at(4) == "d0/skip/f0");
+    Assertions::assert_true(rel.at(16) == "f1");
+
+    // Final
+    pool.wait();
+}
+
+void test_parallel_matches_serial() {
+    // Given
+    Tree tree;
+    async::ThreadPool pool(4);
+
+    // When
+    auto serial = relative(tree, fs::Walker(tree.root.as_str()).threads(1).collect());
+    auto parallel = relative(tree, fs::Walker(tree.root.as_str()).pool(pool).threads(5).collect());
+
+    // Then
+    Assertions::assert_equals(serial.len(), parallel.len());
+    Assertions::assert_true(std::equal(serial.begin(), serial.end(), parallel.begin()));
+
+    // Final
+    pool.wait();
+}
+
+void test_max_depth() {
+    // Given
+    Tree tree;
+
+    // When
+    auto top = relative(tree, fs::Walker(tree.root.as_str()).threads(1).max_depth(1).collect());
+    auto two = relative(tree, fs::Walker(tree.root.as_str()).threads(1).max_depth(2).collect());
+
+    // Then
+    Assertions::assert_equals(5uz, top.len());
+    Assertions::assert_equals(14uz, two.len());
+}
+
+void test_filter_and_prune() {
+    // Given
+    Tree tree;
+    std::atomic<usize> skip_visits{0};
+
+    // When
+    auto files = relative(tree, fs::Walker(tree.root.as_str())
+                                    .threads(2)
+                                    .filter([](const fs::WalkEntry& e) { return e.type == fs::FileType::File; })
+                                    .prune([&](const fs::WalkEntry& e) {
+                                        const bool skip = e.name == "skip"_sv;
+                                        skip_visits += skip;
+                                        return skip;
+                                    })
+                                    .collect());
+
+    // Then
+    Assertions::assert_equals(8uz, files.len());
+    Assertions::assert_equals(3uz, skip_visits.load());
+    Assertions::assert_true(std::none_of(files.begin(), files.end(), [](const std::string& s) {
+        return s.find("skip") != std::string::npos;
+    }));
+}
+
+void should_throw_when_root_missing() {
+    // Given
+    auto missing = repo_root().join(R"(tests\resources)").join("fs_walk_missing").as_cstr();
+
+    // When & Then
+    Assertions::assert_throws<Exception>(CString("Failed to list directory: ") + missing, [&]() {
+        fs::Walker(str::StringView(missing.data(), missing.length())).threads(1).collect();
+    });
+}
+
+void should_rethrow_visitor_exception() {
+    // Given
+    Tree tree;
+    async::ThreadPool pool(2);
+    std::atomic<usize> seen{0};
+
+    // When & Then
+    Assertions::assert_throws<Exception>(CString("stop walking"), [&]() {
+        fs::Walker(tree.root.as_str()).pool(pool).for_each([&](const fs::WalkEntry&) {
+            if (++seen == 3) {
+                throw runtime_exception("stop walking");
+            }
+        });
+    });
+
+    // Final
+    pool.wait();
+}
+
+GROUP_NAME("test_walk");
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_walk_all_entries),
+    UNIT_TEST_ITEM(test_parallel_matches_serial),
+    UNIT_TEST_ITEM(test_max_depth),
+    UNIT_TEST_ITEM(test_filter_and_prune),
+    UNIT_TEST_ITEM(should_throw_when_root_missing),
+    UNIT_TEST_ITEM(should_rethrow_visitor_exception));
+
+} // namespace my::test::test_walk
@@ -0,0 +1,15 @@
+#ifndef TEST_WALK_HPP
+#define TEST_WALK_HPP
+
+namespace my::test::test_walk {
+
+void test_walk_all_entries();
+void test_parallel_matches_serial();
+void test_max_depth();
+void test_filter_and_prune();
+void should_throw_when_root_missing();
+void should_rethrow_visitor_exception();
+
+} // namespace my::test::test_walk
+
+#endif // TEST_WALK_HPP
@@ -0,0 +1,206 @@
+#include "test_buf_io.hpp"
+#include "buf_io.hpp"
+#include "net/tcp.hpp"
+#include "ricky_test.hpp"
+
+#include <format>
+#include <string>
+#include <thread>
+
+namespace my::test::test_buf_io {
+
+namespace {
+
+/**
+ * @brief 每次最多返回 chunk 字节的内存字节源
+ */
+struct ChunkedSource {
+    std::string data;
+    usize chunk;
+    usize pos{0};
+    usize calls{0};
+
+    usize read_into(char* buf, const usize size) {
+        ++calls;
+        const usize n = std::min({size, chunk, data.size() - pos});
+        std::memcpy(buf, data.data() + pos, n);
+        pos += n;
+        return n;
+    }
+};
+
+/**
+ * @brief 每次最多接受 limit 字节的内存字节汇
+ */
+struct LimitedSink {
+    std::string data;
+    usize limit;
+    usize calls{0};
+
+    usize write_vectored(const plat::IoSlice* slices, const usize n) {
+        ++calls;
+        usize budget = limit;
+        for (usize i = 0; i < n && budget > 0; ++i) {
+            const usize k = std::min(budget, slices[i].size);
+            data.append(slices[i].data, k);
+            budget -= k;
+        }
+        return limit - budget;
+    }
+};
+
+std::string to_std(const str::StringView view) {
+    return view.to_std_string();
+}
+
+} // namespace
+
+void should_read_until_delimiter_across_chunks() {
+    // Given
+    ChunkedSource source{"GET / HTTP/1.1\r\nHost: a\r\n\r\ntail", 3};
+    char buf[32];
+    io::BufReader reader(source, buf);
+
+    // When & Then
+    Assertions::assertEquals(std::string{"GET / HTTP/1.1\r\n"}, to_std(reader.read_until('\n').unwrap()));
+    Assertions::assertEquals(std::string{"Host: a\r\n"}, to_std(reader.read_until('\n').unwrap()));
+    Assertions::assertEquals(std::string{"\r\n"}, to_std(reader.read_until('\n').unwrap()));
+    Assertions::assertEquals(std::string{"tail"}, to_std(reader.read_until('\n').unwrap()));
+    Assertions::assertTrue(reader.read_until('\n').is_none());
+}
+
+void should_peek_without_consuming() {
+    // Given
+    ChunkedSource source{"abcdefgh", 2};
+    char buf[8];
+    io::BufReader reader(source, buf);
+
+    // When
+    const auto first = to_std(reader.peek(5));
+    const auto again = to_std(reader.peek(3));
+    reader.consume(4);
+    const auto rest = to_std(reader.peek(8));
+
+    // Then
+    Assertions::assertEquals(std::string{"abcde"}, first);
+    Assertions::assertEquals(std::string{"abc"}, again);
+    Assertions::assertEquals(std::string{"efgh"}, rest);
+    Assertions::assertThrows("Peek size 9 exceeds buffer capacity 8", [&]() {
+        reader.peek(9);
+    });
+}
+
+void should_read_exact_and_fail_on_short_stream() {
+    // Given
+    ChunkedSource source{std::string(100, 'x') + "yz", 7};
+    char buf[16];
+    io::BufReader reader(source, buf);
+    char header[2];
+    char body[98];
+    char tail[4];
+
+    // When
+    reader.read_exact(header);
+    reader.read_exact(body); // 大于缓冲区，直接读入 body
+
+    // Then
+    Assertions::assertEquals('x', header[1]);
+    Assertions::assertEquals('x', body[97]);
+    Assertions::assertThrows("Unexpected end of stream: expected 4 bytes, got 2", [&]() {
+        reader.read_exact(tail);
+    });
+}
+
+void should_reject_line_longer_than_buffer() {
+    // Given
+    ChunkedSource source{std::string(20, 'a') + "\n", 4};
+    char buf[8];
+    io::BufReader reader(source, buf);
+
+    // When & Then
+    Assertions::assertThrows("Line exceeds buffer capacity 8", [&]() {
+        reader.read_until('\n');
+    });
+}
+
+void should_coalesce_small_writes() {
+    // Given
+    LimitedSink sink{"", 1024};
+    char buf[64];
+
+    // When
+    {
+        io::BufWriter writer(sink, buf);
+        for (i32 i = 0; i < 10; ++i) {
+            writer.write("ab", 2);
+        }
+        Assertions::assertEquals(usize{0}, sink.calls);
+        writer.write(std::string(100, 'c').data(), 100); // 放不下：缓冲区与新数据一次写出
+        Assertions::assertEquals(usize{1}, sink.calls);
+        writer.write("tail"_sv);
+    } // 析构时 flush
+
+    // Then
+    Assertions::assertEquals(usize{2}, sink.calls);
+    Assertions::assertEquals(usize{124}, sink.data.size());
+    Assertions::assertEquals(std::string{"tail"}, sink.data.substr(sink.data.size() - 4));
+}
+
+void should_handle_partial_vectored_writes() {
+    // Given
+    LimitedSink sink{"", 5};
+    char buf[8];
+    io::BufWriter writer(sink, buf);
+
+    // When
+    writer.write("0123456", 7);
+    writer.write("789abcdefghij", 13);
+    writer.flush();
+
+    // Then
+    Assertions::assertEquals(std::string{"0123456789abcdefghij"}, sink.data);
+    Assertions::assertEquals(usize{0}, writer.buffered());
+}
+
+void should_frame_lines_over_tcp() {
+    // Given
+    auto listener = net::TcpListener::bind("127.0.0.1"_sv, 0);
+    const u16 port = listener.local_port();
+    std::thread client([port]() {
+        auto stream = net::TcpStream::connect("127.0.0.1"_sv, port);
+        char out[256];
+        io::BufWriter writer(stream, out);
+        for (i32 i = 0; i < 100; ++i) {
+            const auto line = std::format("line-{}\n", i);
+            writer.write(line.data(), line.size());
+        }
+        writer.flush();
+        stream.close();
+    });
+    auto server = listener.accept();
+
+    // When
+    char in[64];
+    io::BufReader reader(*server, in);
+    i32 count = 0;
+    for (auto line = reader.read_until('\n'); line.is_some(); line = reader.read_until('\n')) {
+        Assertions::assertEquals(std::format("line-{}\n", count), to_std(line.unwrap()));
+        ++count;
+    }
+    client.join();
+
+    // Then
+    Assertions::assertEquals(100, count);
+}
+
+GROUP_NAME("test_buf_io")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_read_until_delimiter_across_chunks),
+    UNIT_TEST_ITEM(should_peek_without_consuming),
+    UNIT_TEST_ITEM(should_read_exact_and_fail_on_short_stream),
+    UNIT_TEST_ITEM(should_reject_line_longer_than_buffer),
+    UNIT_TEST_ITEM(should_coalesce_small_writes),
+    UNIT_TEST_ITEM(should_handle_partial_vectored_writes),
+    UNIT_TEST_ITEM(should_frame_lines_over_tcp))
+
+} // namespace my::test::test_buf_io
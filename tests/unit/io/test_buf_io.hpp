@@ -0,0 +1,16 @@
+#ifndef TEST_BUF_IO_HPP
+#define TEST_BUF_IO_HPP
+
+namespace my::test::test_buf_io {
+
+void should_read_until_delimiter_across_chunks();
+void should_peek_without_consuming();
+void should_read_exact_and_fail_on_short_stream();
+void should_reject_line_longer_than_buffer();
+void should_coalesce_small_writes();
+void should_handle_partial_vectored_writes();
+void should_frame_lines_over_tcp();
+
+} // namespace my::test::test_buf_io
+
+#endif
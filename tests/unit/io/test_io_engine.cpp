@@ -0,0 +1,202 @@
+#include "test_io_engine.hpp"
+#include "io_engine.hpp"
+#include "ricky_test.hpp"
+
+#include <cstring>
+#include <filesystem>
+
+namespace my::test::test_io_engine {
+
+namespace {
+
+util::Vec<io::IoBackend> backends() {
+    util::Vec<io::IoBackend> res;
+    res.push(io::IoBackend::Blocking);
+    if (io::IoEngine::io_uring_available()) {
+        res.push(io::IoBackend::IoUring);
+    }
+    return res;
+}
+
+CString temp_file(const char* leaf) {
+    return CString{(std::filesystem::temp_directory_path() / leaf).string().c_str()};
+}
+
+str::StringView sv(const CString& s) {
+    return str::StringView(s.data(), s.length());
+}
+
+struct Loopback {
+    plat::net::SocketHandle* listener;
+    u16 port{0};
+
+    Loopback() {
+        plat::net::startup();
+        listener = plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream);
+        plat::net::bind(listener, "127.0.0.1"_sv, 0);
+        str::String<> ip;
+        plat::net::get_local_addr(listener, ip, port);
+        plat::net::listen(listener, 64);
+    }
+
+    ~Loopback() {
+        plat::net::close(listener);
+    }
+
+    plat::net::SocketHandle* connect() const {
+        auto* client = plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream);
+        plat::net::connect(client, "127.0.0.1"_sv, port);
+        return client;
+    }
+};
+
+} // namespace
+
+void should_resolve_backend() {
+    // Given
+    io::IoEngine engine;
+
+    // When & Then
+    Assertions::assertTrue(engine.backend() != io::IoBackend::Auto);
+    Assertions::assertEquals(io::IoEngine::io_uring_available(), engine.backend() == io::IoBackend::IoUring);
+    if (!io::IoEngine::io_uring_available()) {
+        Assertions::assertThrows("io_uring is not available on this system", []() {
+            io::IoEngine forced(io::IoBackend::IoUring);
+        });
+    }
+}
+
+void should_echo_with_batched_socket_ops() {
+    for (const auto backend : backends()) {
+        // Given
+        constexpr usize n = 8;
+        io::IoEngine engine(backend, 16);
+        Loopback net;
+        util::Vec<plat::net::SocketHandle*> clients;
+        for (usize i = 0; i < n; ++i) {
+            clients.push(net.connect());
+        }
+
+        // When: 一批 accept
+        for (usize i = 0; i < n; ++i) {
+            engine.accept(net.listener, i);
+        }
+        util::Vec<io::Completion> done;
+        while (done.len() < n) {
+            engine.wait(done, n - done.len());
+        }
+        util::Vec<plat::net::SocketHandle*> servers;
+        for (const auto& c : done) {
+            Assertions::assertTrue(c.result >= 0 && c.socket != nullptr);
+            servers.push(c.socket);
+        }
+
+        // When: 客户端各发一条，服务端一批 recv 再一批 send 回去
+        for (usize i = 0; i < n; ++i) {
+            const char msg[] = {'m', static_cast<char>('0' + i)};
+            Assertions::assertEquals(usize{2}, plat::net::try_send(clients.at(i), msg, 2).unwrap());
+        }
+        util::Vec<char> bufs(n * 2, '\0');
+        for (usize i = 0; i < n; ++i) {
+            engine.recv(servers.at(i), bufs.data() + i * 2, 2, i);
+        }
+        done.clear();
+        while (done.len() < n) {
+            engine.wait(done, n - done.len());
+        }
+        for (const auto& c : done) {
+            Assertions::assertEquals(i64{2}, c.result);
+            engine.send(servers.at(c.token), bufs.data() + c.token * 2, 2, c.token);
+        }
+        done.clear();
+        while (done.len() < n) {
+            engine.wait(done, n - done.len());
+        }
+
+        // Then
+        Assertions::assertEquals(usize{0}, engine.in_flight());
+        for (usize i = 0; i < n; ++i) {
+            char reply[2];
+            Assertions::assertEquals(usize{2}, plat::net::try_recv(clients.at(i), reply, 2).unwrap());
+            Assertions::assertEquals('m', reply[0]);
+            Assertions::assertEquals(static_cast<char>('0' + i), reply[1]);
+            plat::net::close(clients.at(i));
+            plat::net::close(servers.at(i));
+        }
+    }
+}
+
+void should_read_and_write_file_at_offsets() {
+    for (const auto backend : backends()) {
+        // Given
+        io::IoEngine engine(backend);
+        const auto path = temp_file("ricky_io_engine.bin");
+        auto* out = plat::fs::open(sv(path), plat::fs::OpenMode::WriteBinary);
+
+        // When
+        engine.write(out, "world", 5, 6, 1);
+        engine.write(out, "hello ", 6, 0, 2);
+        util::Vec<io::Completion> done;
+        engine.wait(done, 2);
+        plat::fs::close(out);
+
+        char buf[11] = {};
+        auto* in = plat::fs::open(sv(path), plat::fs::OpenMode::ReadBinary);
+        engine.read(in, buf, 5, 6, 3);
+        engine.read(in, buf + 5, 100, 11, 4); // 文件末尾
+        done.clear();
+        engine.wait(done, 2);
+        plat::fs::close(in);
+        plat::fs::remove(sv(path));
+
+        // Then
+        Assertions::assertEquals(usize{2}, done.len());
+        for (const auto& c : done) {
+            Assertions::assertEquals(c.token == 3 ? i64{5} : i64{0}, c.result);
+        }
+        Assertions::assertTrue(std::memcmp(buf, "world", 5) == 0);
+    }
+}
+
+void should_use_registered_buffers() {
+    for (const auto backend : backends()) {
+        // Given
+        io::IoEngine engine(backend);
+        util::Vec<char> a(64, 'a'), b(64, '\0');
+        util::Vec<plat::uring::FixedBuffer> buffers;
+        buffers.push(plat::uring::FixedBuffer{a.data(), a.len()});
+        buffers.push(plat::uring::FixedBuffer{b.data(), b.len()});
+        engine.register_buffers(buffers);
+        const auto path = temp_file("ricky_io_engine_fixed.bin");
+
+        // When
+        auto* out = plat::fs::open(sv(path), plat::fs::OpenMode::WriteBinary);
+        engine.write_fixed(out, 0, 64, 0, 1);
+        util::Vec<io::Completion> done;
+        engine.wait(done);
+        plat::fs::close(out);
+
+        auto* in = plat::fs::open(sv(path), plat::fs::OpenMode::ReadBinary);
+        engine.read_fixed(in, 1, 64, 0, 2);
+        engine.wait(done);
+        plat::fs::close(in);
+        plat::fs::remove(sv(path));
+
+        // Then
+        Assertions::assertEquals(usize{2}, done.len());
+        Assertions::assertEquals(i64{64}, done.at(1).result);
+        Assertions::assertEquals('a', b.at(63));
+        Assertions::assertThrows("Fixed buffer 2 out of bounds [0..2)", [&]() {
+            engine.read_fixed(nullptr, 2, 1, 0, 3);
+        });
+    }
+}
+
+GROUP_NAME("test_io_engine")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_resolve_backend),
+    UNIT_TEST_ITEM(should_echo_with_batched_socket_ops),
+    UNIT_TEST_ITEM(should_read_and_write_file_at_offsets),
+    UNIT_TEST_ITEM(should_use_registered_buffers))
+
+} // namespace my::test::test_io_engine
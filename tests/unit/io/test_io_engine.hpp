@@ -0,0 +1,13 @@
+#ifndef TEST_IO_ENGINE_HPP
+#define TEST_IO_ENGINE_HPP
+
+namespace my::test::test_io_engine {
+
+void should_resolve_backend();
+void should_echo_with_batched_socket_ops();
+void should_read_and_write_file_at_offsets();
+void should_use_registered_buffers();
+
+} // namespace my::test::test_io_engine
+
+#endif
@@ -0,0 +1,254 @@
+#include "test_arena.hpp"
+#include "arena.hpp"
+#include "array.hpp"
+#include "btree_map.hpp"
+#include "hash_bucket.hpp"
+#include "hash_map.hpp"
+#include "link_list_queue.hpp"
+#include "linked_list.hpp"
+#include "rbtree_map.hpp"
+#include "ricky_test.hpp"
+#include "string.hpp"
+#include "vec.hpp"
+#include "vec_deque.hpp"
+#include "vec_stack.hpp"
+
+namespace my::test::test_arena {
+
+template <typename T>
+using Alloc = mem::ArenaAllocator<T>;
+
+void test_bump_allocation_and_alignment() {
+    // Given
+    mem::Arena arena(1024);
+
+    // When
+    auto* a = static_cast<char*>(arena.allocate(3, 1));
+    auto* b = static_cast<char*>(arena.allocate(3, 1));
+    void* c = arena.allocate(8, 64);
+    arena.deallocate(c, 8);
+    void* d = arena.allocate(8, 64);
+
+    // Then
+    Assertions::assert_equals(a + 3, b);
+    Assertions::assert_equals(0uz, reinterpret_cast<usize>(c) % 64);
+    Assertions::assert_equals(c, d);
+    Assertions::assert_equals(14uz, arena.used());
+    Assertions::assert_equals(1uz, arena.chunk_count());
+}
+
+void test_reset_reuses_chunks() {
+    // Given
+    mem::Arena arena(1024);
+    for (usize i = 0; i < 100; ++i) {
+        (void)arena.allocate(100, 8);
+    }
+    const usize chunks = arena.chunk_count();
+    const usize reserved = arena.reserved();
+
+    // When
+    arena.reset();
+    for (usize i = 0; i < 100; ++i) {
+        (void)arena.allocate(100, 8);
+    }
+
+    // Then
+    Assertions::assert_true(chunks > 1);
+    Assertions::assert_equals(chunks, arena.chunk_count());
+    Assertions::assert_equals(reserved, arena.reserved());
+    Assertions::assert_equals(10000uz, arena.used());
+
+    // When
+    arena.release();
+
+    // Then
+    Assertions::assert_equals(0uz, arena.chunk_count());
+    Assertions::assert_equals(0uz, arena.reserved());
+}
+
+void test_large_allocation() {
+    // Given
+    mem::Arena arena(1024);
+
+    // When
+    auto* big = static_cast<char*>(arena.allocate(100000, 16));
+    big[0] = big[99999] = 'x';
+    auto* small = static_cast<char*>(arena.allocate(16, 16));
+
+    // Then
+    Assertions::assert_equals(0uz, reinterpret_cast<usize>(big) % 16);
+    Assertions::assert_not_null(small);
+    Assertions::assert_true(arena.reserved() >= 100000);
+}
+
+void test_allocator_rebind_keeps_arena() {
+    // Given
+    mem::Arena arena;
+    Alloc<i32> ints(arena);
+
+    // When
+    Alloc<f64> doubles(ints);
+    typename Alloc<i32>::template rebind<char>::other chars(ints);
+    f64* p = doubles.allocate(4);
+
+    // Then
+    Assertions::assert_true(doubles.arena() == &arena);
+    Assertions::assert_true(chars.arena() == &arena);
+    Assertions::assert_true(ints == doubles);
+    Assertions::assert_false(ints == Alloc<i32>());
+    Assertions::assert_equals(0uz, reinterpret_cast<usize>(p) % alignof(f64));
+    Assertions::assert_equals(4 * sizeof(f64), arena.used());
+}
+
+void test_heap_fallback_without_scope() {
+    // Given
+    Alloc<i32> alloc;
+
+    // When
+    i32* p = alloc.allocate(16);
+    p[15] = 7;
+
+    // Then
+    Assertions::assert_null(alloc.arena());
+    Assertions::assert_equals(7, p[15]);
+
+    // Final
+    alloc.deallocate(p, 16);
+}
+
+void test_sequence_containers_on_arena() {
+    // Given
+    mem::Arena arena;
+    util::Vec<i32, Alloc<i32>> vec{Alloc<i32>(arena)};
+    util::VecDeque<i32, Alloc<i32>> deque{Alloc<i32>(arena)};
+
+    // When
+    for (i32 i = 0; i < 1000; ++i) {
+        vec.push(i);
+        deque.push_back(i);
+    }
+    util::Vec<i32, Alloc<i32>> copy = vec;
+    i32 sum = 0;
+    for (const i32 v : vec) {
+        sum += v;
+    }
+
+    // Then
+    Assertions::assert_equals(1000uz, vec.len());
+    Assertions::assert_equals(999, vec.at(999));
+    Assertions::assert_equals(499500, sum);
+    Assertions::assert_equals(999, copy[-1]);
+    Assertions::assert_true(copy == vec);
+    Assertions::assert_equals(1000uz, deque.len());
+    Assertions::assert_true(arena.used() >= 3000 * sizeof(i32));
+}
+
+void test_node_containers_on_arena() {
+    // Given
+    mem::Arena arena;
+    mem::ArenaScope scope(arena);
+    util::RBTreeMap<i32, i32, std::less<i32>, Alloc<util::RBTreeNode<i32, i32>>> tree;
+    util::BTreeMap<i32, i32, std::less<i32>, Alloc<util::BTreeNode<i32, i32>>> btree;
+    util::LinkedListImpl<util::LinkedListNode<i32>, Alloc<util::LinkedListNode<i32>>> list;
+    util::Queue<i32, Alloc<util::ChainNode<i32>>> queue;
+    util::Stack<i32, Alloc<i32>> stack;
+    util::Array<i32, Alloc<i32>> array(8, 3);
+
+    // When
+    for (i32 i = 0; i < 200; ++i) {
+        tree.insert(i, i * 2);
+        list.push_back(i);
+        queue.push(i);
+        stack.push(i);
+    }
+
+    // Then
+    Assertions::assert_equals(200uz, tree.size());
+    Assertions::assert_equals(198, tree.get(99));
+    Assertions::assert_equals(0uz, btree.len());
+    Assertions::assert_equals(200uz, list.size());
+    Assertions::assert_equals(0, queue.front());
+    Assertions::assert_equals(199, stack.peek());
+    Assertions::assert_equals(3, array.at(7));
+    Assertions::assert_true(arena.used() > 200 * sizeof(util::RBTreeNode<i32, i32>));
+}
+
+void test_hash_map_on_arena() {
+    // Given
+    mem::Arena arena;
+    util::HashMap<i32, i32, Alloc<i32>> map{Alloc<i32>(arena)};
+
+    // When
+    for (i32 i = 0; i < 1000; ++i) {
+        map.insert(i, i + 1);
+    }
+    util::HashMap<i32, i32, Alloc<i32>> copy = map;
+    const usize used = arena.used();
+    i32 sum = 0;
+    for (const auto& [k, v] : map) {
+        sum += v - k;
+    }
+
+    // Then
+    Assertions::assert_equals(1000uz, map.size());
+    Assertions::assert_equals(1000, sum);
+    Assertions::assert_equals(501, copy.get(500));
+    Assertions::assert_true(used > 1000 * 2 * sizeof(i32));
+}
+
+void test_bucket_clone_stays_on_source_arena() {
+    // Given
+    mem::Arena arena;
+    using Bucket = util::RobinHashBucket<i32, Alloc<util::RobinManager<i32>>>;
+    Bucket bucket(16, Alloc<util::RobinManager<i32>>(arena));
+    const usize before = arena.used();
+
+    // When
+    Bucket* clone = bucket.clone();
+
+    // Then
+    Assertions::assert_true(clone->get_allocator().arena() == &arena);
+    Assertions::assert_equals(16uz, clone->capacity());
+    Assertions::assert_true(arena.used() >= before + sizeof(Bucket) + 16 * sizeof(util::RobinManager<i32>));
+
+    // Final
+    Alloc<Bucket>(arena).destroy(clone);
+}
+
+void test_scope_binds_nested_allocators() {
+    // Given
+    mem::Arena arena;
+    using ArenaString = str::String<Alloc<u8>>;
+    usize used = 0;
+
+    // When
+    {
+        mem::ArenaScope scope(arena);
+        util::Vec<ArenaString, Alloc<ArenaString>> words;
+        for (usize i = 0; i < 100; ++i) {
+            words.push(ArenaString("a string that does not fit in the small buffer"_sv));
+        }
+        used = arena.used();
+        Assertions::assert_true(words.at(99).as_str() == "a string that does not fit in the small buffer"_sv);
+    }
+    const Alloc<i32> outside;
+
+    // Then
+    Assertions::assert_true(used > 100 * 40);
+    Assertions::assert_null(outside.arena());
+}
+
+GROUP_NAME("test_arena")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_bump_allocation_and_alignment),
+    UNIT_TEST_ITEM(test_reset_reuses_chunks),
+    UNIT_TEST_ITEM(test_large_allocation),
+    UNIT_TEST_ITEM(test_allocator_rebind_keeps_arena),
+    UNIT_TEST_ITEM(test_heap_fallback_without_scope),
+    UNIT_TEST_ITEM(test_sequence_containers_on_arena),
+    UNIT_TEST_ITEM(test_node_containers_on_arena),
+    UNIT_TEST_ITEM(test_hash_map_on_arena),
+    UNIT_TEST_ITEM(test_bucket_clone_stays_on_source_arena),
+    UNIT_TEST_ITEM(test_scope_binds_nested_allocators))
+
+} // namespace my::test::test_arena
@@ -0,0 +1,19 @@
+#ifndef TEST_ARENA_HPP
+#define TEST_ARENA_HPP
+
+namespace my::test::test_arena {
+
+void test_bump_allocation_and_alignment();
+void test_reset_reuses_chunks();
+void test_large_allocation();
+void test_allocator_rebind_keeps_arena();
+void test_heap_fallback_without_scope();
+void test_sequence_containers_on_arena();
+void test_node_containers_on_arena();
+void test_hash_map_on_arena();
+void test_bucket_clone_stays_on_source_arena();
+void test_scope_binds_nested_allocators();
+
+} // namespace my::test::test_arena
+
+#endif // TEST_ARENA_HPP
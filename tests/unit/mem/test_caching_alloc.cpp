@@ -0,0 +1,246 @@
+#include "test_caching_alloc.hpp"
+#include "caching_alloc.hpp"
+#include "hash_map.hpp"
+#include "linked_list.hpp"
+#include "rbtree_map.hpp"
+#include "ricky_test.hpp"
+#include "string.hpp"
+#include "vec.hpp"
+#include "vec_deque.hpp"
+
+#include <cstring>
+#include <thread>
+
+namespace my::test::test_caching_alloc {
+
+using Heap = mem::CachingHeap;
+
+template <typename T>
+using Alloc = mem::CachingAllocator<T>;
+
+void test_size_classes_cover_all_sizes() {
+    // Given
+    usize prev = 0;
+
+    // When
+    for (usize cls = 0; cls < Heap::CLASS_COUNT; ++cls) {
+        const usize size = Heap::class_size(cls);
+
+        // Then
+        Assertions::assert_true(size > prev);
+        Assertions::assert_equals(cls, Heap::size_class(size));
+        Assertions::assert_equals(cls, Heap::size_class(prev + 1));
+        Assertions::assert_true(size < 16 || size % Heap::ALIGNMENT == 0);
+        prev = size;
+    }
+    Assertions::assert_equals(Heap::MAX_SMALL_SIZE, prev);
+    Assertions::assert_equals(Heap::MAX_SMALL_SIZE + Heap::PAGE_SIZE, Heap::good_size(Heap::MAX_SMALL_SIZE + 1));
+}
+
+void test_small_allocation_reuse_and_alignment() {
+    // Given
+    void* a = Heap::allocate(100);
+    std::memset(a, 0xab, 100);
+
+    // When
+    Heap::deallocate(a, 100);
+    void* b = Heap::allocate(100);
+    void* c = Heap::allocate(3);
+
+    // Then
+    Assertions::assert_equals(a, b);
+    Assertions::assert_equals(0uz, reinterpret_cast<usize>(b) % Heap::ALIGNMENT);
+    Assertions::assert_equals(0uz, reinterpret_cast<usize>(c) % 8);
+    Assertions::assert_equals(112uz, Heap::good_size(100));
+
+    // Final
+    Heap::deallocate(b, 100);
+    Heap::deallocate(c, 3);
+}
+
+void test_large_allocation_returns_pages() {
+    // Given
+    const usize bytes = 3 * 1024 * 1024 + 5;
+    const usize before = Heap::page_heap_stats().large_spans;
+
+    // When
+    auto* p = static_cast<char*>(Heap::allocate(bytes));
+    p[0] = 1;
+    p[bytes - 1] = 2;
+    const auto during = Heap::page_heap_stats();
+    Heap::deallocate(p, bytes);
+    auto* q = static_cast<char*>(Heap::allocate(bytes));
+    const auto after = Heap::page_heap_stats();
+    Heap::deallocate(q, bytes);
+
+    // Then
+    Assertions::assert_equals(0uz, reinterpret_cast<usize>(p) % Heap::PAGE_SIZE);
+    Assertions::assert_equals(before + 1, during.large_spans);
+    Assertions::assert_true(during.system_bytes >= bytes);
+    Assertions::assert_equals(during.system_bytes, after.system_bytes);
+    Assertions::assert_equals(before, Heap::page_heap_stats().large_spans);
+}
+
+void test_unsized_deallocate() {
+    // Given
+    void* small = Heap::allocate(40);
+    void* large = Heap::allocate(Heap::MAX_SMALL_SIZE + 1);
+    const usize large_spans = Heap::page_heap_stats().large_spans;
+
+    // When
+    Heap::deallocate(small);
+    Heap::deallocate(large);
+    void* again = Heap::allocate(40);
+
+    // Then
+    Assertions::assert_equals(small, again);
+    Assertions::assert_equals(large_spans - 1, Heap::page_heap_stats().large_spans);
+
+    // Final
+    Heap::deallocate(again, 40);
+}
+
+void test_stats_track_objects() {
+    // Given
+    constexpr usize size = 96 * 1024; // 只有本用例使用这一级
+    const usize cls = Heap::size_class(size);
+    const auto before = Heap::stats().at(cls);
+    util::Vec<void*> blocks;
+
+    // When
+    for (usize i = 0; i < 10; ++i) {
+        blocks.push(Heap::allocate(size));
+    }
+    const auto during = Heap::stats().at(cls);
+    for (usize i = 0; i < blocks.len(); ++i) {
+        Heap::deallocate(blocks.at(i), size);
+    }
+    Heap::flush_thread_cache();
+    const auto after = Heap::stats().at(cls);
+
+    // Then
+    Assertions::assert_equals(Heap::class_size(cls), during.size);
+    Assertions::assert_equals(before.in_use() + 10, during.in_use());
+    Assertions::assert_equals(before.allocs + 10, during.allocs);
+    Assertions::assert_equals(before.frees + 10, after.frees);
+    Assertions::assert_equals(before.in_use(), after.in_use());
+    Assertions::assert_equals(0uz, after.thread_free);
+    Assertions::assert_true(during.spans * during.span_pages * Heap::PAGE_SIZE >= 10 * size);
+}
+
+void test_thread_cache_flushed_on_thread_exit() {
+    // Given
+    constexpr usize size = 48 * 1024;
+    const usize cls = Heap::size_class(size);
+    Heap::flush_thread_cache();
+    const auto before = Heap::stats().at(cls);
+    usize cached = 0;
+
+    // When
+    std::thread t([&] {
+        util::Vec<void*> blocks;
+        for (usize i = 0; i < 20; ++i) {
+            blocks.push(Heap::allocate(size));
+        }
+        for (usize i = 0; i < blocks.len(); ++i) {
+            Heap::deallocate(blocks.at(i), size);
+        }
+        cached = Heap::stats().at(cls).thread_free;
+    });
+    t.join();
+    const auto after = Heap::stats().at(cls);
+
+    // Then
+    Assertions::assert_true(cached > 0);
+    Assertions::assert_equals(0uz, after.thread_free);
+    Assertions::assert_equals(before.in_use(), after.in_use());
+    Assertions::assert_equals(before.allocs + 20, after.allocs);
+}
+
+void test_concurrent_alloc_and_cross_thread_free() {
+    // Given
+    constexpr usize threads = 4;
+    constexpr usize n = 5000;
+    util::Vec<util::Vec<char*>> produced(threads);
+    std::atomic<usize> corrupted{0};
+
+    // When
+    {
+        util::Vec<std::thread> workers;
+        for (usize t = 0; t < threads; ++t) {
+            workers.push([&, t] {
+                for (usize i = 0; i < n; ++i) {
+                    const usize size = 16 + (i * 37 + t * 101) % 4000;
+                    auto* p = static_cast<char*>(Heap::allocate(size));
+                    std::memset(p, static_cast<int>(t + 1), size);
+                    produced.at(t).push(p);
+                }
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+    }
+    {
+        // 每个线程释放另一个线程分配的对象
+        util::Vec<std::thread> workers;
+        for (usize t = 0; t < threads; ++t) {
+            workers.push([&, t] {
+                const usize owner = (t + 1) % threads;
+                auto& blocks = produced.at(owner);
+                for (usize i = 0; i < blocks.len(); ++i) {
+                    const usize size = 16 + (i * 37 + owner * 101) % 4000;
+                    if (blocks.at(i)[size - 1] != static_cast<char>(owner + 1)) {
+                        corrupted.fetch_add(1);
+                    }
+                    Heap::deallocate(blocks.at(i), size);
+                }
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+    }
+
+    // Then
+    Assertions::assert_equals(0uz, corrupted.load());
+}
+
+void test_containers_on_caching_allocator() {
+    // Given
+    using CachedString = str::String<Alloc<u8>>;
+    util::Vec<i32, Alloc<i32>> vec;
+    util::VecDeque<i32, Alloc<i32>> deque;
+    util::HashMap<i32, CachedString, Alloc<i32>> map;
+    util::RBTreeMap<i32, i32, std::less<i32>, Alloc<util::RBTreeNode<i32, i32>>> tree;
+    util::LinkedListImpl<util::LinkedListNode<i32>, Alloc<util::LinkedListNode<i32>>> list;
+
+    // When
+    for (i32 i = 0; i < 3000; ++i) {
+        vec.push(i);
+        deque.push_front(i);
+        map.insert(i, CachedString("a string that does not fit in the small buffer"_sv));
+        tree.insert(i, -i);
+        list.push_back(i);
+    }
+
+    // Then
+    Assertions::assert_equals(3000uz, vec.len());
+    Assertions::assert_equals(2999, deque.front());
+    Assertions::assert_true(map.get(1234).as_str() == "a string that does not fit in the small buffer"_sv);
+    Assertions::assert_equals(-2999, tree.get(2999));
+    Assertions::assert_equals(3000uz, list.size());
+}
+
+GROUP_NAME("test_caching_alloc")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_size_classes_cover_all_sizes),
+    UNIT_TEST_ITEM(test_small_allocation_reuse_and_alignment),
+    UNIT_TEST_ITEM(test_large_allocation_returns_pages),
+    UNIT_TEST_ITEM(test_unsized_deallocate),
+    UNIT_TEST_ITEM(test_stats_track_objects),
+    UNIT_TEST_ITEM(test_thread_cache_flushed_on_thread_exit),
+    UNIT_TEST_ITEM(test_concurrent_alloc_and_cross_thread_free),
+    UNIT_TEST_ITEM(test_containers_on_caching_allocator))
+
+} // namespace my::test::test_caching_alloc
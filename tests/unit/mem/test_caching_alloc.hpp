@@ -0,0 +1,17 @@
+#ifndef TEST_CACHING_ALLOC_HPP
+#define TEST_CACHING_ALLOC_HPP
+
+namespace my::test::test_caching_alloc {
+
+void test_size_classes_cover_all_sizes();
+void test_small_allocation_reuse_and_alignment();
+void test_large_allocation_returns_pages();
+void test_unsized_deallocate();
+void test_stats_track_objects();
+void test_thread_cache_flushed_on_thread_exit();
+void test_concurrent_alloc_and_cross_thread_free();
+void test_containers_on_caching_allocator();
+
+} // namespace my::test::test_caching_alloc
+
+#endif // TEST_CACHING_ALLOC_HPP
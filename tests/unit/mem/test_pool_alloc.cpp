@@ -0,0 +1,232 @@
+#include "test_pool_alloc.hpp"
+#include "btree_map.hpp"
+#include "link_list_queue.hpp"
+#include "linked_list.hpp"
+#include "pool_alloc.hpp"
+#include "rbtree_map.hpp"
+#include "ricky_test.hpp"
+#include "tree.hpp"
+
+#include <thread>
+
+namespace my::test::test_pool_alloc {
+
+template <typename T>
+using Alloc = mem::PoolAllocator<T>;
+
+/**
+ * @brief 独占一个级别的对象，避免与其他用例共享的缓存互相干扰
+ */
+struct alignas(16) Odd {
+    char data[1000];
+};
+
+static constexpr usize ODD_CLASS = mem::NodePool::size_class(sizeof(Odd));
+
+void test_size_class_slab_reuses_blocks() {
+    // Given
+    mem::SizeClassSlab pool(24);
+
+    // When
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    void* c = pool.allocate();
+    pool.deallocate(b);
+    void* d = pool.allocate();
+
+    // Then
+    Assertions::assert_equals(32uz, pool.block_size());
+    Assertions::assert_equals(static_cast<char*>(a) + 32, static_cast<char*>(b));
+    Assertions::assert_equals(b, d);
+    Assertions::assert_equals(3uz, pool.in_use());
+    Assertions::assert_equals(1uz, pool.slab_count());
+
+    // Final
+    pool.deallocate(a);
+    pool.deallocate(c);
+    pool.deallocate(d);
+}
+
+void test_size_class_slab_releases_empty_slabs() {
+    // Given
+    mem::SizeClassSlab pool(256);
+    util::Vec<void*> blocks;
+    for (usize i = 0; i < 1000; ++i) {
+        blocks.push(pool.allocate());
+    }
+    const usize slabs = pool.slab_count();
+
+    // When
+    for (usize i = 0; i < blocks.len(); ++i) {
+        pool.deallocate(blocks.at(i));
+    }
+    const usize kept = pool.slab_count();
+    const usize trimmed = pool.trim();
+
+    // Then
+    Assertions::assert_true(slabs >= 1000 * 256 / mem::SizeClassSlab::SLAB_SIZE);
+    Assertions::assert_equals(1uz, kept);
+    Assertions::assert_equals(1uz, trimmed);
+    Assertions::assert_equals(0uz, pool.slab_count());
+    Assertions::assert_equals(0uz, pool.in_use());
+}
+
+void test_size_class_slab_batch_transfer() {
+    // Given
+    mem::SizeClassSlab pool(16);
+
+    // When
+    void* head = pool.allocate_batch(10);
+    usize n = 0;
+    for (void* p = head; p != nullptr; p = *static_cast<void**>(p)) {
+        ++n;
+    }
+    const usize in_use = pool.in_use();
+    pool.deallocate_batch(head, 10);
+
+    // Then
+    Assertions::assert_equals(10uz, n);
+    Assertions::assert_equals(10uz, in_use);
+    Assertions::assert_equals(0uz, pool.in_use());
+}
+
+void test_size_class_and_heap_fallback() {
+    // Given
+    auto& pool = mem::NodePool::shared(mem::NodePool::size_class(48));
+    const usize before = pool.in_use();
+    Alloc<std::array<char, 48>> alloc;
+    mem::PoolAllocator<std::array<char, 48>, false> uncached;
+    Alloc<std::array<char, 2048>> big;
+
+    // When
+    auto* one = uncached.allocate(1);
+    auto* many = uncached.allocate(4);
+    const usize during = pool.in_use();
+    auto* large = big.allocate(1);
+    uncached.deallocate(one, 1);
+    uncached.deallocate(many, 4);
+    big.deallocate(large, 1);
+
+    // Then
+    Assertions::assert_equals(0uz, mem::NodePool::size_class(16));
+    Assertions::assert_equals(1uz, mem::NodePool::size_class(17));
+    Assertions::assert_equals(before + 1, during);
+    Assertions::assert_equals(before, pool.in_use());
+    Assertions::assert_true(alloc == Alloc<i32>{});
+}
+
+void test_thread_cache_flushed_on_thread_exit() {
+    // Given
+    auto& pool = mem::NodePool::shared(ODD_CLASS);
+    const usize before = pool.in_use();
+    usize during = 0;
+
+    // When
+    std::thread t([&] {
+        Alloc<Odd> alloc;
+        util::Vec<Odd*> blocks;
+        for (usize i = 0; i < 100; ++i) {
+            blocks.push(alloc.allocate(1));
+        }
+        for (usize i = 0; i < blocks.len(); ++i) {
+            alloc.deallocate(blocks.at(i), 1);
+        }
+        during = pool.in_use();
+    });
+    t.join();
+
+    // Then
+    Assertions::assert_true(during > before);
+    Assertions::assert_equals(before, pool.in_use());
+}
+
+void test_free_on_other_thread() {
+    // Given
+    Alloc<Odd> alloc;
+    auto& pool = mem::NodePool::shared(ODD_CLASS);
+    mem::NodePool::flush_thread_cache();
+    const usize before = pool.in_use();
+    util::Vec<Odd*> blocks;
+    for (usize i = 0; i < 100; ++i) {
+        blocks.push(alloc.allocate(1));
+        blocks.last()->data[0] = static_cast<char>(i);
+    }
+
+    // When
+    std::thread t([&] {
+        for (usize i = 0; i < blocks.len(); ++i) {
+            alloc.deallocate(blocks.at(i), 1);
+        }
+    });
+    t.join();
+    mem::NodePool::flush_thread_cache();
+
+    // Then
+    Assertions::assert_equals(before, pool.in_use());
+}
+
+void test_node_containers_on_pool() {
+    // Given
+    util::RBTreeMap<i32, i32, std::less<i32>, Alloc<util::RBTreeNode<i32, i32>>> tree;
+    util::LinkedListImpl<util::LinkedListNode<i32>, Alloc<util::LinkedListNode<i32>>> list;
+    util::Queue<i32, Alloc<util::ChainNode<i32>>> queue;
+    util::BTreeMap<i32, i32, std::less<i32>, Alloc<util::BTreeNode<i32, i32>>> btree;
+    util::Tree<i32, Alloc<util::TreeNode<i32>>> hierarchy;
+
+    // When
+    auto* root = hierarchy.set_root(0);
+    for (i32 i = 0; i < 5000; ++i) {
+        tree.insert(i, i * 2);
+        list.push_back(i);
+        queue.push(i);
+        if (i < 100) {
+            hierarchy.add_child(root, i);
+        }
+    }
+    for (i32 i = 0; i < 5000; i += 2) {
+        tree.remove(i);
+        queue.pop();
+    }
+
+    // Then
+    Assertions::assert_equals(2500uz, tree.size());
+    Assertions::assert_equals(2 * 4999, tree.get(4999));
+    Assertions::assert_equals(5000uz, list.size());
+    Assertions::assert_equals(2500, queue.front());
+    Assertions::assert_true(btree.empty());
+    Assertions::assert_equals(100uz, root->subs_.len());
+}
+
+void test_node_containers_without_thread_cache() {
+    // Given
+    using Node = util::RBTreeNode<i32, i32>;
+    auto& pool = mem::NodePool::shared(mem::NodePool::size_class(sizeof(Node)));
+    const usize before = pool.in_use();
+    usize during = 0;
+
+    // When
+    {
+        util::RBTreeMap<i32, i32, std::less<i32>, mem::PoolAllocator<Node, false>> tree;
+        for (i32 i = 0; i < 1000; ++i) {
+            tree.insert(i, i);
+        }
+        during = pool.in_use();
+    }
+
+    // Then
+    Assertions::assert_equals(before + 1001, during); // 另有一个哨兵节点
+    Assertions::assert_equals(before, pool.in_use());
+}
+
+GROUP_NAME("test_pool_alloc")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_size_class_slab_reuses_blocks),
+    UNIT_TEST_ITEM(test_size_class_slab_releases_empty_slabs),
+    UNIT_TEST_ITEM(test_size_class_slab_batch_transfer),
+    UNIT_TEST_ITEM(test_size_class_and_heap_fallback),
+    UNIT_TEST_ITEM(test_thread_cache_flushed_on_thread_exit),
+    UNIT_TEST_ITEM(test_free_on_other_thread),
+    UNIT_TEST_ITEM(test_node_containers_on_pool),
+    UNIT_TEST_ITEM(test_node_containers_without_thread_cache))
+
+} // namespace my::test::test_pool_alloc
@@ -0,0 +1,17 @@
+#ifndef TEST_POOL_ALLOC_HPP
+#define TEST_POOL_ALLOC_HPP
+
+namespace my::test::test_pool_alloc {
+
+void test_size_class_slab_reuses_blocks();
+void test_size_class_slab_releases_empty_slabs();
+void test_size_class_slab_batch_transfer();
+void test_size_class_and_heap_fallback();
+void test_thread_cache_flushed_on_thread_exit();
+void test_free_on_other_thread();
+void test_node_containers_on_pool();
+void test_node_containers_without_thread_cache();
+
+} // namespace my::test::test_pool_alloc
+
+#endif // TEST_POOL_ALLOC_HPP
@@ -0,0 +1,194 @@
+#include "test_stats_alloc.hpp"
+#include "arena.hpp"
+#include "hash_map.hpp"
+#include "pool_alloc.hpp"
+#include "rbtree_map.hpp"
+#include "ricky_test.hpp"
+#include "stats_alloc.hpp"
+#include "string.hpp"
+#include "vec.hpp"
+
+#include <thread>
+
+namespace my::test::test_stats_alloc {
+
+using mem::AllocStatistics;
+using mem::AllocStats;
+using mem::AllocTag;
+
+template <typename T, AllocTag Tag>
+using Alloc = mem::StatsAllocator<T, Tag>;
+
+void test_counts_and_bytes_per_tag() {
+    // Given
+    const auto before = AllocStatistics::snapshot(AllocTag::Vec);
+    const auto other_before = AllocStatistics::snapshot(AllocTag::HashMap);
+    AllocStats during{};
+
+    // When
+    {
+        util::Vec<i32, Alloc<i32, AllocTag::Vec>> vec;
+        for (i32 i = 0; i < 1000; ++i) {
+            vec.push(i);
+        }
+        during = AllocStatistics::snapshot(AllocTag::Vec) - before;
+        Assertions::assert_equals(static_cast<u64>(vec.capacity() * sizeof(i32)), during.live_bytes());
+    }
+    const auto after = AllocStatistics::snapshot(AllocTag::Vec) - before;
+
+    // Then
+    Assertions::assert_true(during.allocs > 1);
+    Assertions::assert_equals(1ull, during.live_allocs());
+    Assertions::assert_true(after.tag == AllocTag::Vec);
+    Assertions::assert_equals(after.allocs, after.frees);
+    Assertions::assert_equals(0ull, after.live_bytes());
+    Assertions::assert_equals(0ull, (AllocStatistics::snapshot(AllocTag::HashMap) - other_before).allocs);
+    Assertions::assert_equals(mem::ALLOC_TAG_COUNT, AllocStatistics::snapshot().len());
+}
+
+void test_size_histogram() {
+    // Given
+    Alloc<char, AllocTag::Other> alloc;
+    const auto before = AllocStatistics::snapshot(AllocTag::Other);
+
+    // When
+    char* a = alloc.allocate(1);
+    char* b = alloc.allocate(16);
+    char* c = alloc.allocate(17);
+    char* d = alloc.allocate(4096);
+    const auto delta = AllocStatistics::snapshot(AllocTag::Other) - before;
+
+    // Then
+    Assertions::assert_equals(0uz, AllocStats::size_bucket(1));
+    Assertions::assert_equals(4uz, AllocStats::size_bucket(16));
+    Assertions::assert_equals(5uz, AllocStats::size_bucket(17));
+    Assertions::assert_equals(12uz, AllocStats::size_bucket(4096));
+    Assertions::assert_equals(1ull, delta.sizes[0]);
+    Assertions::assert_equals(1ull, delta.sizes[4]);
+    Assertions::assert_equals(1ull, delta.sizes[5]);
+    Assertions::assert_equals(1ull, delta.sizes[12]);
+    Assertions::assert_equals(4130ull, delta.bytes_allocated);
+    Assertions::assert_equals(4130.0 / 4, delta.mean_size());
+
+    // Final
+    alloc.deallocate(a, 1);
+    alloc.deallocate(b, 16);
+    alloc.deallocate(c, 17);
+    alloc.deallocate(d, 4096);
+}
+
+void test_lifetime_recorded() {
+    // Given
+    Alloc<u64, AllocTag::Other> alloc;
+    const auto before = AllocStatistics::snapshot(AllocTag::Other);
+    u64* p = alloc.allocate(4);
+
+    // When
+    p[3] = 42;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    alloc.deallocate(p, 4);
+    const auto delta = AllocStatistics::snapshot(AllocTag::Other) - before;
+
+    // Then
+    Assertions::assert_equals(0uz, reinterpret_cast<usize>(p) % 16);
+    Assertions::assert_equals(1ull, delta.timed_frees);
+    Assertions::assert_true(delta.lifetime_ns >= 2'000'000);
+    Assertions::assert_true(delta.mean_lifetime_ns() >= 2e6);
+    u64 bucketed = 0;
+    for (usize i = AllocStats::lifetime_bucket(2'000'000); i < AllocStats::LIFETIME_BUCKETS; ++i) {
+        bucketed += delta.lifetimes[i];
+    }
+    Assertions::assert_equals(1ull, bucketed);
+}
+
+void test_counting_only_forwards_to_inner() {
+    // Given
+    mem::Arena arena;
+    mem::StatsAllocator<i64, AllocTag::Other, mem::ArenaAllocator<i64>, false> alloc{mem::ArenaAllocator<i64>(arena)};
+    const auto before = AllocStatistics::snapshot(AllocTag::Other);
+
+    // When
+    i64* p = alloc.allocate(10);
+    const auto [q, count] = alloc.allocate_at_least(3);
+    alloc.deallocate(p, 10);
+    const auto delta = AllocStatistics::snapshot(AllocTag::Other) - before;
+
+    // Then
+    Assertions::assert_equals(4uz, count);
+    Assertions::assert_equals(14 * sizeof(i64), arena.used());
+    Assertions::assert_equals(2ull, delta.allocs);
+    Assertions::assert_equals(1ull, delta.frees);
+    Assertions::assert_equals(14 * sizeof(i64), static_cast<usize>(delta.bytes_allocated));
+    Assertions::assert_equals(0ull, delta.timed_frees);
+    Assertions::assert_true(alloc == decltype(alloc){mem::ArenaAllocator<i64>(arena)});
+
+    // Final
+    alloc.deallocate(q, count);
+}
+
+void test_containers_keep_tag_after_rebind() {
+    // Given
+    using Node = util::RBTreeNode<i32, i32>;
+    const auto map_before = AllocStatistics::snapshot(AllocTag::HashMap);
+    const auto tree_before = AllocStatistics::snapshot(AllocTag::RBTreeMap);
+    const auto str_before = AllocStatistics::snapshot(AllocTag::String);
+
+    // When
+    {
+        util::HashMap<i32, i32, Alloc<i32, AllocTag::HashMap>> map;
+        util::RBTreeMap<i32, i32, std::less<i32>, mem::StatsAllocator<Node, AllocTag::RBTreeMap, mem::PoolAllocator<Node>>> tree;
+        str::String<Alloc<u8, AllocTag::String>> s;
+        for (i32 i = 0; i < 500; ++i) {
+            map.insert(i, i);
+            tree.insert(i, i);
+            s.push_str("a string piece"_sv);
+        }
+        Assertions::assert_equals(250, map.get(250));
+        Assertions::assert_equals(250, tree.get(250));
+        Assertions::assert_equals(500uz * 14, s.len());
+    }
+    const auto map = AllocStatistics::snapshot(AllocTag::HashMap) - map_before;
+    const auto tree = AllocStatistics::snapshot(AllocTag::RBTreeMap) - tree_before;
+    const auto str = AllocStatistics::snapshot(AllocTag::String) - str_before;
+
+    // Then
+    Assertions::assert_true(map.allocs > 0);
+    Assertions::assert_equals(0ull, map.live_allocs());
+    Assertions::assert_true(tree.allocs >= 500);
+    Assertions::assert_equals(0ull, tree.live_allocs());
+    Assertions::assert_true(str.allocs > 0);
+    Assertions::assert_equals(0ull, str.live_bytes());
+    Assertions::assert_true(tree.allocs_per_op(500) >= 1.0);
+}
+
+void test_exited_thread_counts_retained() {
+    // Given
+    const auto before = AllocStatistics::snapshot(AllocTag::VecDeque);
+
+    // When
+    std::thread worker([] {
+        Alloc<i32, AllocTag::VecDeque> alloc;
+        for (usize i = 0; i < 100; ++i) {
+            alloc.deallocate(alloc.allocate(8), 8);
+        }
+    });
+    worker.join();
+    const auto delta = AllocStatistics::snapshot(AllocTag::VecDeque) - before;
+
+    // Then
+    Assertions::assert_equals(100ull, delta.allocs);
+    Assertions::assert_equals(100ull, delta.frees);
+    Assertions::assert_equals(3200ull, delta.bytes_allocated);
+    Assertions::assert_equals(100ull, delta.timed_frees);
+}
+
+GROUP_NAME("test_stats_alloc")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_counts_and_bytes_per_tag),
+    UNIT_TEST_ITEM(test_size_histogram),
+    UNIT_TEST_ITEM(test_lifetime_recorded),
+    UNIT_TEST_ITEM(test_counting_only_forwards_to_inner),
+    UNIT_TEST_ITEM(test_containers_keep_tag_after_rebind),
+    UNIT_TEST_ITEM(test_exited_thread_counts_retained))
+
+} // namespace my::test::test_stats_alloc
@@ -0,0 +1,15 @@
+#ifndef TEST_STATS_ALLOC_HPP
+#define TEST_STATS_ALLOC_HPP
+
+namespace my::test::test_stats_alloc {
+
+void test_counts_and_bytes_per_tag();
+void test_size_histogram();
+void test_lifetime_recorded();
+void test_counting_only_forwards_to_inner();
+void test_containers_keep_tag_after_rebind();
+void test_exited_thread_counts_retained();
+
+} // namespace my::test::test_stats_alloc
+
+#endif // TEST_STATS_ALLOC_HPP
@@ -0,0 +1,209 @@
+#include "test_tracing_alloc.hpp"
+#include "ricky_test.hpp"
+#include "tracing_alloc.hpp"
+#include "vec.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace my::test::test_tracing_alloc {
+
+using Tracer = mem::MemoryTracer;
+
+template <typename T>
+using Alloc = mem::TracingAllocator<T>;
+
+/**
+ * @brief 追踪器是进程内单例，测试期间临时修改采样间隔，结束时恢复
+ */
+struct IntervalGuard {
+    usize prev;
+
+    explicit IntervalGuard(const usize interval) : prev(Tracer::instance().sample_interval()) {
+        Tracer::instance().set_sample_interval(interval);
+    }
+
+    ~IntervalGuard() {
+        Tracer::instance().set_sample_interval(prev);
+    }
+};
+
+void test_exact_mode_tracks_every_allocation() {
+    // Given
+    IntervalGuard guard(0);
+    Alloc<i64> alloc;
+    const auto before = Tracer::instance().stats();
+
+    // When
+    util::Vec<i64*> blocks;
+    usize bytes = 0;
+    for (usize i = 1; i <= 10; ++i) {
+        blocks.push(alloc.allocate(i));
+        bytes += i * sizeof(i64);
+    }
+    const auto during = Tracer::instance().stats();
+    for (usize i = 0; i < blocks.len(); ++i) {
+        alloc.deallocate(blocks.at(i), i + 1);
+    }
+    const auto after = Tracer::instance().stats();
+
+    // Then
+    Assertions::assert_equals(10uz, during.allocs - before.allocs);
+    Assertions::assert_equals(10uz, during.samples - before.samples);
+    Assertions::assert_equals(before.live_samples + 10, during.live_samples);
+    Assertions::assert_equals(before.current + bytes, during.current);
+    Assertions::assert_equals(before.live_estimate + bytes, during.live_estimate);
+    Assertions::assert_true(during.peak >= during.current);
+    Assertions::assert_equals(before.live_samples, after.live_samples);
+    Assertions::assert_equals(before.current, after.current);
+    Assertions::assert_equals(bytes, after.total_deallocated - before.total_deallocated);
+}
+
+void test_sampling_estimates_live_bytes() {
+    // Given
+    constexpr usize n = 20000;
+    constexpr usize size = 64;
+    IntervalGuard guard(4096);
+    Alloc<char> alloc;
+    const auto before = Tracer::instance().stats();
+
+    // When
+    util::Vec<char*> blocks;
+    for (usize i = 0; i < n; ++i) {
+        blocks.push(alloc.allocate(size));
+    }
+    const auto during = Tracer::instance().stats();
+    for (usize i = 0; i < n; ++i) {
+        alloc.deallocate(blocks.at(i), size);
+    }
+    const auto after = Tracer::instance().stats();
+
+    // Then
+    const usize sampled = during.samples - before.samples;
+    const auto estimate = static_cast<double>(during.live_estimate - before.live_estimate);
+    const auto actual = static_cast<double>(n * size);
+    Assertions::assert_true(sampled > 0 && sampled < n / 10);
+    Assertions::assert_true(estimate > actual * 0.75 && estimate < actual * 1.25);
+    Assertions::assert_equals(before.current + n * size, during.current);
+    Assertions::assert_equals(before.live_samples, after.live_samples);
+    Assertions::assert_equals(before.live_estimate, after.live_estimate);
+}
+
+void test_concurrent_tracing() {
+    // Given
+    constexpr usize threads = 4;
+    constexpr usize n = 20000;
+    IntervalGuard guard(1024);
+    const auto before = Tracer::instance().stats();
+
+    // When
+    util::Vec<std::thread> workers;
+    for (usize t = 0; t < threads; ++t) {
+        workers.push([t] {
+            Alloc<char> alloc;
+            util::Vec<char*> blocks;
+            for (usize i = 0; i < n; ++i) {
+                const usize size = 16 + (i * 31 + t * 7) % 512;
+                blocks.push(alloc.allocate(size));
+                if (i % 2 == 1) {
+                    // 释放上一个，交错保留一半
+                    alloc.deallocate(blocks.at(i - 1), 16 + ((i - 1) * 31 + t * 7) % 512);
+                }
+            }
+            for (usize i = 0; i < n; i += 2) {
+                alloc.deallocate(blocks.at(i + 1), 16 + ((i + 1) * 31 + t * 7) % 512);
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    const auto after = Tracer::instance().stats();
+
+    // Then
+    Assertions::assert_equals(threads * n, after.allocs - before.allocs);
+    Assertions::assert_true(after.samples > before.samples);
+    Assertions::assert_equals(before.current, after.current);
+    Assertions::assert_equals(before.live_samples, after.live_samples);
+    Assertions::assert_equals(before.live_estimate, after.live_estimate);
+}
+
+void test_pprof_profile_format() {
+    // Given
+    IntervalGuard guard(0);
+    Alloc<char> alloc;
+    char* p = alloc.allocate(1000);
+
+    // When
+    const std::string profile = Tracer::instance().heap_profile(mem::ProfileFormat::Pprof);
+
+    // Then
+    Assertions::assert_true(profile.starts_with("heap profile: "));
+    Assertions::assert_true(profile.find(" @ heap\n") != std::string::npos);
+    Assertions::assert_true(profile.find(" @ 0x") != std::string::npos);
+    Assertions::assert_true(profile.find("\nMAPPED_LIBRARIES:\n") != std::string::npos);
+
+    // Final
+    alloc.deallocate(p, 1000);
+}
+
+void test_folded_profile_format() {
+    // Given
+    IntervalGuard guard(0);
+    Alloc<char> alloc;
+    char* p = alloc.allocate(12345);
+
+    // When
+    const std::string profile = Tracer::instance().heap_profile(mem::ProfileFormat::Folded);
+
+    // Then
+    std::istringstream lines(profile);
+    std::string line;
+    bool found = false;
+    while (std::getline(lines, line)) {
+        const usize space = line.rfind(' ');
+        Assertions::assert_true(space != std::string::npos && space > 0);
+        const usize bytes = std::stoull(line.substr(space + 1));
+        found = found || bytes >= 12345;
+    }
+    Assertions::assert_true(found);
+
+    // Final
+    alloc.deallocate(p, 12345);
+}
+
+void test_dump_heap_profile() {
+    // Given
+    IntervalGuard guard(0);
+    Alloc<char> alloc;
+    char* p = alloc.allocate(100);
+    const char* path = "test_tracing_alloc.heap";
+
+    // When
+    const bool ok = Tracer::instance().dump_heap_profile(path);
+    std::ifstream file(path);
+    std::string first;
+    std::getline(file, first);
+    file.close();
+
+    // Then
+    Assertions::assert_true(ok);
+    Assertions::assert_true(first.starts_with("heap profile: "));
+
+    // Final
+    std::remove(path);
+    alloc.deallocate(p, 100);
+}
+
+GROUP_NAME("test_tracing_alloc")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(test_exact_mode_tracks_every_allocation),
+    UNIT_TEST_ITEM(test_sampling_estimates_live_bytes),
+    UNIT_TEST_ITEM(test_concurrent_tracing),
+    UNIT_TEST_ITEM(test_pprof_profile_format),
+    UNIT_TEST_ITEM(test_folded_profile_format),
+    UNIT_TEST_ITEM(test_dump_heap_profile))
+
+} // namespace my::test::test_tracing_alloc
@@ -0,0 +1,15 @@
+#ifndef TEST_TRACING_ALLOC_HPP
+#define TEST_TRACING_ALLOC_HPP
+
+namespace my::test::test_tracing_alloc {
+
+void test_exact_mode_tracks_every_allocation();
+void test_sampling_estimates_live_bytes();
+void test_concurrent_tracing();
+void test_pprof_profile_format();
+void test_folded_profile_format();
+void test_dump_heap_profile();
+
+} // namespace my::test::test_tracing_alloc
+
+#endif // TEST_TRACING_ALLOC_HPP
@@ -0,0 +1,183 @@
+#include "test_cidr_table.hpp"
+#include "net/cidr_table.hpp"
+#include "ricky_test.hpp"
+
+namespace my::test::test_cidr_table {
+
+namespace {
+
+net::Ipv4Addr v4(const char* s) {
+    return net::Ipv4Addr::from_str(str::StringView(s));
+}
+
+net::Ipv6Addr v6(const char* s) {
+    return net::Ipv6Addr::from_str(str::StringView(s));
+}
+
+i32 value_or(const i32* v, const i32 fallback) {
+    return v == nullptr ? fallback : *v;
+}
+
+/**
+ * @brief 可复现的伪随机数
+ */
+struct XorShift {
+    u64 state;
+
+    u64 next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+} // namespace
+
+void should_match_longest_ipv4_prefix() {
+    // Given
+    net::CidrTable<i32> table;
+    table.insert("0.0.0.0/0"_sv, 0)
+        .insert("10.0.0.0/8"_sv, 8)
+        .insert("10.1.0.0/16"_sv, 16)
+        .insert("10.1.2.0/24"_sv, 24)
+        .insert("10.1.2.3/32"_sv, 32)
+        .insert("10.1.2.128/25"_sv, 25)
+        .insert(v4("192.168.0.0"), 17, 17);
+
+    // When
+    table.build();
+
+    // Then
+    Assertions::assertEquals(0, *table.lookup(v4("8.8.8.8")));
+    Assertions::assertEquals(8, *table.lookup(v4("10.200.0.1")));
+    Assertions::assertEquals(16, *table.lookup(v4("10.1.200.1")));
+    Assertions::assertEquals(24, *table.lookup(v4("10.1.2.4")));
+    Assertions::assertEquals(32, *table.lookup(v4("10.1.2.3")));
+    Assertions::assertEquals(25, *table.lookup(v4("10.1.2.200")));
+    Assertions::assertEquals(17, *table.lookup(v4("192.168.127.255")));
+    Assertions::assertEquals(0, *table.lookup(v4("192.168.128.0")));
+    Assertions::assertEquals(7uz, table.len());
+}
+
+void should_match_longest_ipv6_prefix() {
+    // Given
+    net::CidrTable<i32> table;
+    table.insert("2001:db8::/32"_sv, 32)
+        .insert("2001:db8:1::/48"_sv, 48)
+        .insert("2001:db8:1:2:3::/80"_sv, 80)
+        .insert("2001:db8:1:2:3:4:5:6/128"_sv, 128)
+        .insert("10.0.0.0/8"_sv, 4);
+
+    // When
+    table.build();
+
+    // Then
+    Assertions::assertEquals(32, *table.lookup(v6("2001:db8:ffff::1")));
+    Assertions::assertEquals(48, *table.lookup(v6("2001:db8:1:ffff::1")));
+    Assertions::assertEquals(80, *table.lookup(v6("2001:db8:1:2:3:ffff::")));
+    Assertions::assertEquals(128, *table.lookup(v6("2001:db8:1:2:3:4:5:6")));
+    Assertions::assertEquals(80, *table.lookup(v6("2001:db8:1:2:3:4:5:7")));
+    Assertions::assertTrue(table.lookup(v6("2001:db9::1")) == nullptr);
+    // IPv4 与 IPv6 前缀互不影响
+    Assertions::assertTrue(table.lookup(v6("a00::1")) == nullptr);
+    Assertions::assertEquals(4, *table.lookup(net::IpAddr::from_str("10.9.9.9"_sv)));
+    Assertions::assertEquals(48, *table.lookup(net::IpAddr::from_str("2001:db8:1::9"_sv)));
+}
+
+void should_override_duplicate_prefix() {
+    // Given
+    net::CidrTable<i32> table;
+    table.insert("172.16.0.0/12"_sv, 1).insert("172.31.255.255/12"_sv, 2); // 主机位被忽略
+    table.build();
+    Assertions::assertEquals(2, *table.lookup(v4("172.20.0.1")));
+
+    // When
+    table.insert("172.16.0.0/12"_sv, 3);
+    Assertions::assertEquals(2, *table.lookup(v4("172.20.0.1"))); // build 之前不生效
+    table.build();
+
+    // Then
+    Assertions::assertEquals(3, *table.lookup(v4("172.20.0.1")));
+    Assertions::assertTrue(table.lookup(v4("172.32.0.0")) == nullptr);
+}
+
+void should_reject_malformed_cidr() {
+    // Given
+    net::CidrTable<i32> table;
+
+    // When & Then
+    Assertions::assertThrows("Missing prefix length in '10.0.0.0'", [&] { table.insert("10.0.0.0"_sv, 0); });
+    Assertions::assertThrows("Invalid prefix length in '10.0.0.0/x'", [&] { table.insert("10.0.0.0/x"_sv, 0); });
+    Assertions::assertThrows("IPv4 prefix length 33 exceeds 32", [&] { table.insert("10.0.0.0/33"_sv, 0); });
+    Assertions::assertThrows("IPv6 prefix length 129 exceeds 128", [&] { table.insert("::/129"_sv, 0); });
+    Assertions::assertThrows("Invalid IPv4 address '10.0.0'", [&] { table.insert("10.0.0/8"_sv, 0); });
+    Assertions::assertEquals(0uz, table.len());
+}
+
+void should_agree_with_linear_scan() {
+    // Given
+    struct Entry {
+        u32 addr;
+        u32 len;
+    };
+    XorShift rng{0x9e3779b97f4a7c15ull};
+    util::Vec<Entry> entries;
+    net::CidrTable<i32> table;
+    for (usize i = 0; i < 3000; ++i) {
+        // 长度集中在 8..32，并让一部分前缀落在同一个 /8 内以产生深层嵌套
+        const u64 r = rng.next();
+        const u32 len = static_cast<u32>(8 + r % 25);
+        u32 addr = static_cast<u32>(r >> 32);
+        if (i % 3 == 0) addr = (addr & 0x00ffffff) | 0x0a000000;
+        addr &= len == 0 ? 0 : ~0u << (32 - len);
+        entries.push(Entry{addr, len});
+        table.insert(net::Ipv4Addr::from_u32(addr), len, static_cast<i32>(i));
+    }
+    table.build();
+
+    util::Vec<net::Ipv4Addr> probes;
+    for (usize i = 0; i < 20000; ++i) {
+        const u64 r = rng.next();
+        u32 addr = static_cast<u32>(r);
+        if (i % 2 == 0) {
+            // 一半探测点取自某个前缀内部
+            const auto& e = entries.at((r >> 32) % entries.len());
+            addr = e.addr | (e.len == 32 ? 0 : static_cast<u32>(r) >> e.len);
+        }
+        probes.push(net::Ipv4Addr::from_u32(addr));
+    }
+
+    // When
+    util::Vec<const i32*> batch(probes.len());
+    table.lookup_batch(std::span<const net::Ipv4Addr>(probes.data(), probes.len()),
+                       std::span<const i32*>(batch.data(), batch.len()));
+
+    // Then
+    for (usize i = 0; i < probes.len(); ++i) {
+        const u32 addr = probes.at(i).to_u32();
+        i32 expected = -1;
+        u32 best_len = 0;
+        for (usize k = 0; k < entries.len(); ++k) {
+            const auto& e = entries.at(k);
+            const u32 mask = e.len == 0 ? 0 : ~0u << (32 - e.len);
+            // 同一前缀重复时后插入的生效
+            if ((addr & mask) == e.addr && (expected == -1 || e.len >= best_len)) {
+                expected = static_cast<i32>(k);
+                best_len = e.len;
+            }
+        }
+        Assertions::assertEquals(expected, value_or(table.lookup(probes.at(i)), -1));
+        Assertions::assertEquals(expected, value_or(batch.at(i), -1));
+    }
+}
+
+GROUP_NAME("test_cidr_table")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_match_longest_ipv4_prefix),
+    UNIT_TEST_ITEM(should_match_longest_ipv6_prefix),
+    UNIT_TEST_ITEM(should_override_duplicate_prefix),
+    UNIT_TEST_ITEM(should_reject_malformed_cidr),
+    UNIT_TEST_ITEM(should_agree_with_linear_scan))
+
+} // namespace my::test::test_cidr_table
@@ -0,0 +1,14 @@
+#ifndef TEST_NET_CIDR_TABLE_HPP
+#define TEST_NET_CIDR_TABLE_HPP
+
+namespace my::test::test_cidr_table {
+
+void should_match_longest_ipv4_prefix();
+void should_match_longest_ipv6_prefix();
+void should_override_duplicate_prefix();
+void should_reject_malformed_cidr();
+void should_agree_with_linear_scan();
+
+} // namespace my::test::test_cidr_table
+
+#endif
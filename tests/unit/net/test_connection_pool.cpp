@@ -0,0 +1,182 @@
+#include "test_connection_pool.hpp"
+#include "net/connection_pool.hpp"
+#include "net/sharded_listener.hpp"
+#include "ricky_test.hpp"
+
+#include <format>
+#include <thread>
+
+// 回显服务运行在事件循环上，事件循环目前只有 epoll 后端
+#if RICKY_LINUX
+
+namespace my::test::test_connection_pool {
+
+namespace {
+
+/**
+ * @brief 单分片回显服务，close_after_reply 为真时回显一次后关闭连接
+ */
+std::unique_ptr<net::ShardedTcpListener> echo_server(const bool close_after_reply = false) {
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).shards(1).build_sharded();
+    listener->start([close_after_reply](std::unique_ptr<net::AsyncTcpStream> stream) -> coro::Task<> {
+        loop {
+            auto data = co_await stream->read(1024);
+            if (data.len() == 0) break;
+            co_await stream->write(data.as_str());
+            if (close_after_reply) break;
+        }
+        stream->close();
+    });
+    return listener;
+}
+
+void ping(net::PooledStream& conn, const str::StringView msg) {
+    conn->write(msg);
+    Assertions::assertEquals(str::String<>(msg), conn->read(64));
+}
+
+} // namespace
+
+void should_reuse_returned_connection() {
+    // Given
+    auto server = echo_server();
+    net::ConnectionPool pool;
+    const u16 port = server->local_port();
+
+    // When
+    {
+        auto conn = pool.acquire("127.0.0.1"_sv, port);
+        Assertions::assertFalse(conn.is_reused());
+        ping(conn, "first"_sv);
+    }
+    Assertions::assertEquals(1uz, pool.idle_count());
+    auto conn = pool.acquire("127.0.0.1"_sv, port);
+
+    // Then
+    Assertions::assertTrue(conn.is_reused());
+    ping(conn, "second"_sv);
+    Assertions::assertEquals(1ull, pool.hits());
+    Assertions::assertEquals(1ull, pool.misses());
+    Assertions::assertEquals(0uz, pool.idle_count());
+    Assertions::assertEquals(1ull, server->total_accepted());
+    conn.discard();
+    server->stop();
+}
+
+void should_drop_connection_closed_by_peer() {
+    // Given
+    auto server = echo_server(true);
+    net::ConnectionPool pool;
+    const u16 port = server->local_port();
+    {
+        auto conn = pool.acquire("127.0.0.1"_sv, port);
+        ping(conn, "once"_sv);
+    }
+    // 服务端回显后即关闭，等待 FIN 到达
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // When
+    auto conn = pool.acquire("127.0.0.1"_sv, port);
+
+    // Then
+    Assertions::assertFalse(conn.is_reused());
+    Assertions::assertEquals(1ull, pool.stale());
+    ping(conn, "again"_sv);
+    server->stop();
+}
+
+void should_enforce_idle_and_total_limits() {
+    // Given
+    auto server = echo_server();
+    net::ConnectionPool pool(net::PoolConfig{.max_idle = 1, .max_total = 2});
+    const u16 port = server->local_port();
+
+    // When
+    {
+        auto a = pool.acquire("127.0.0.1"_sv, port);
+        auto b = pool.acquire("127.0.0.1"_sv, port);
+        const auto expected = std::format("Connection pool exhausted for 127.0.0.1:{} (2 connections)", port);
+        Assertions::assertThrows(expected.c_str(), [&] { (void)pool.acquire("127.0.0.1"_sv, port); });
+    }
+
+    // Then
+    // 只保留 max_idle 个空闲连接，关闭的一个释放了总数名额
+    Assertions::assertEquals(1uz, pool.idle_count());
+    auto a = pool.acquire("127.0.0.1"_sv, port);
+    auto b = pool.acquire("127.0.0.1"_sv, port);
+    Assertions::assertTrue(a.is_reused());
+    Assertions::assertFalse(b.is_reused());
+    a.discard();
+    b.discard();
+    server->stop();
+}
+
+void should_evict_expired_idle_connections() {
+    // Given
+    auto server = echo_server();
+    net::ConnectionPool pool(net::PoolConfig{.idle_timeout_ms = 20});
+    const u16 port = server->local_port();
+    {
+        auto a = pool.acquire("127.0.0.1"_sv, port);
+        auto b = pool.acquire("127.0.0.1"_sv, port);
+    }
+    Assertions::assertEquals(2uz, pool.idle_count());
+
+    // When
+    Assertions::assertEquals(0uz, pool.evict_idle());
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    const usize evicted = pool.evict_idle();
+
+    // Then
+    Assertions::assertEquals(2uz, evicted);
+    Assertions::assertEquals(0uz, pool.idle_count());
+    auto conn = pool.acquire("127.0.0.1"_sv, port);
+    Assertions::assertFalse(conn.is_reused());
+    conn.discard();
+    server->stop();
+}
+
+void should_share_pool_across_threads() {
+    // Given
+    constexpr usize threads = 4;
+    constexpr usize calls = 100;
+    auto server = echo_server();
+    net::ConnectionPool pool;
+    const u16 port = server->local_port();
+
+    // When
+    util::Vec<std::thread> workers;
+    for (usize t = 0; t < threads; ++t) {
+        workers.push(std::thread([&pool, port, t] {
+            for (usize i = 0; i < calls; ++i) {
+                auto conn = pool.acquire("127.0.0.1"_sv, port);
+                const auto msg = std::format("t{}-{}", t, i);
+                conn->write(str::StringView(msg.c_str()));
+                if (conn->read(64) != str::StringView(msg.c_str())) {
+                    conn.discard();
+                }
+            }
+        }));
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    // Then
+    Assertions::assertEquals(static_cast<u64>(threads * calls), pool.hits() + pool.misses());
+    Assertions::assertTrue(pool.misses() <= threads);
+    Assertions::assertEquals(pool.misses(), server->total_accepted());
+    server->stop();
+}
+
+GROUP_NAME("test_connection_pool")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_reuse_returned_connection),
+    UNIT_TEST_ITEM(should_drop_connection_closed_by_peer),
+    UNIT_TEST_ITEM(should_enforce_idle_and_total_limits),
+    UNIT_TEST_ITEM(should_evict_expired_idle_connections),
+    UNIT_TEST_ITEM(should_share_pool_across_threads))
+
+} // namespace my::test::test_connection_pool
+
+#endif // RICKY_LINUX
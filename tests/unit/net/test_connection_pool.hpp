@@ -0,0 +1,14 @@
+#ifndef TEST_NET_CONNECTION_POOL_HPP
+#define TEST_NET_CONNECTION_POOL_HPP
+
+namespace my::test::test_connection_pool {
+
+void should_reuse_returned_connection();
+void should_drop_connection_closed_by_peer();
+void should_enforce_idle_and_total_limits();
+void should_evict_expired_idle_connections();
+void should_share_pool_across_threads();
+
+} // namespace my::test::test_connection_pool
+
+#endif
@@ -0,0 +1,216 @@
+#include "test_event_loop.hpp"
+#include "net/async_tcp.hpp"
+#include "net/tcp.hpp"
+#include "when_all.hpp"
+#include "ricky_test.hpp"
+
+#include <format>
+#include <thread>
+
+// 事件循环目前只有 epoll 后端
+#if RICKY_LINUX
+
+namespace my::test::test_event_loop {
+
+static coro::Task<> echo_session(std::unique_ptr<net::AsyncTcpStream> stream) {
+    loop {
+        auto data = co_await stream->read(1024);
+        if (data.len() == 0) break;
+        co_await stream->write(data.as_str());
+    }
+}
+
+static coro::Task<> serve(net::EventLoop& event_loop, net::AsyncTcpListener& listener, const usize n) {
+    for (usize i = 0; i < n; ++i) {
+        event_loop.spawn(echo_session(co_await listener.accept()));
+    }
+}
+
+static coro::Task<str::String<>> ping(net::EventLoop& event_loop, const u16 port, str::String<> msg) {
+    auto client = net::AsyncTcpStream::connect(event_loop, "127.0.0.1"_sv, port);
+    co_await client->write(msg.as_str());
+    str::String<> reply;
+    while (reply.len() < msg.len()) {
+        auto data = co_await client->read(1024);
+        if (data.len() == 0) break;
+        reply.push_str(data.as_str());
+    }
+    co_return reply;
+}
+
+void should_fire_timers_in_deadline_order() {
+    // Given
+    net::EventLoop event_loop;
+    util::Vec<i32> fired;
+    event_loop.call_after(30, [&]() { fired.push(3); });
+    event_loop.call_after(0, [&]() { fired.push(1); });
+    event_loop.call_after(10, [&]() { fired.push(2); });
+
+    // When
+    while (event_loop.num_timers() > 0) {
+        event_loop.run_once();
+    }
+
+    // Then
+    Assertions::assertEquals(3, static_cast<i32>(fired.len()));
+    Assertions::assertEquals(1, fired.at(0));
+    Assertions::assertEquals(2, fired.at(1));
+    Assertions::assertEquals(3, fired.at(2));
+}
+
+void should_reset_and_cancel_timers() {
+    // Given
+    net::EventLoop event_loop;
+    util::Vec<i32> fired;
+    const auto a = event_loop.call_after(5, [&]() { fired.push(1); });
+    const auto b = event_loop.call_after(10, [&]() { fired.push(2); });
+    event_loop.call_after(20, [&]() { fired.push(3); });
+
+    // When
+    Assertions::assertTrue(event_loop.reset_timer(a, 40)); // 延期到最后
+    Assertions::assertTrue(event_loop.cancel_timer(b));
+    Assertions::assertFalse(event_loop.cancel_timer(b));
+    while (event_loop.num_timers() > 0) {
+        event_loop.run_once();
+    }
+
+    // Then
+    Assertions::assertEquals(2, static_cast<i32>(fired.len()));
+    Assertions::assertEquals(3, fired.at(0));
+    Assertions::assertEquals(1, fired.at(1));
+    Assertions::assertFalse(event_loop.reset_timer(a, 1));
+}
+
+void should_run_posted_task_from_other_thread() {
+    // Given
+    net::EventLoop event_loop;
+    std::thread::id ran_on;
+    std::thread poster([&]() {
+        event_loop.post([&]() {
+            ran_on = std::this_thread::get_id();
+            event_loop.stop();
+        });
+    });
+
+    // When
+    event_loop.run();
+    poster.join();
+
+    // Then
+    Assertions::assertTrue(ran_on == std::this_thread::get_id());
+}
+
+void should_invoke_readiness_callback() {
+    // Given
+    net::EventLoop event_loop;
+    auto* server = plat::net::create(plat::net::SocketFamily::Ipv4, plat::net::SocketType::Stream);
+    plat::net::bind(server, "127.0.0.1"_sv, 0);
+    str::String<> ip;
+    u16 port = 0;
+    plat::net::get_local_addr(server, ip, port);
+    plat::net::listen(server, 16);
+    auto client = net::TcpStream::connect("127.0.0.1"_sv, port);
+    auto* conn = plat::net::accept(server);
+
+    usize notified = 0;
+    bool readable = false;
+    auto* source = event_loop.watch(conn, [&](const net::Readiness ready) {
+        ++notified;
+        readable = ready.readable;
+    });
+
+    // When
+    client.write("x"_sv);
+    while (!readable) {
+        event_loop.run_once(100);
+    }
+
+    // Then
+    Assertions::assertTrue(notified >= 1);
+    char buf[8];
+    Assertions::assertEquals(usize{1}, plat::net::try_recv(conn, buf, sizeof(buf)).unwrap());
+    Assertions::assertTrue(plat::net::try_recv(conn, buf, sizeof(buf)).is_none());
+    event_loop.unwatch(source);
+    Assertions::assertEquals(usize{0}, event_loop.num_watched());
+    plat::net::close(conn);
+    plat::net::close(server);
+}
+
+void should_echo_over_loopback() {
+    // Given
+    net::EventLoop event_loop;
+    net::AsyncTcpListener listener(event_loop, "127.0.0.1"_sv, 0);
+    const u16 port = listener.local_port();
+    event_loop.spawn(serve(event_loop, listener, 3));
+
+    // When
+    util::Vec<coro::Task<str::String<>>> clients;
+    clients.push(ping(event_loop, port, str::String<>{"hello"}));
+    clients.push(ping(event_loop, port, str::String<>{"event"}));
+    clients.push(ping(event_loop, port, str::String<>{"loop"}));
+    auto replies = event_loop.block_on(coro::when_all(std::move(clients)));
+
+    // Then
+    Assertions::assertEquals(str::String<>{"hello"}, replies.at(0));
+    Assertions::assertEquals(str::String<>{"event"}, replies.at(1));
+    Assertions::assertEquals(str::String<>{"loop"}, replies.at(2));
+}
+
+void should_serve_many_connections_on_one_thread() {
+    // Given
+    constexpr usize n = 500;
+    net::EventLoop event_loop;
+    net::AsyncTcpListener listener(event_loop, "127.0.0.1"_sv, 0);
+    const u16 port = listener.local_port();
+    event_loop.spawn(serve(event_loop, listener, n));
+
+    // When
+    util::Vec<coro::Task<str::String<>>> clients;
+    for (usize i = 0; i < n; ++i) {
+        clients.push(ping(event_loop, port, str::String<>{std::format("msg-{}", i).c_str()}));
+    }
+    auto replies = event_loop.block_on(coro::when_all(std::move(clients)));
+
+    // Then
+    for (usize i = 0; i < n; ++i) {
+        Assertions::assertEquals(str::String<>{std::format("msg-{}", i).c_str()}, replies.at(i));
+    }
+}
+
+void should_time_out_idle_connection() {
+    // Given
+    net::EventLoop event_loop;
+    net::AsyncTcpListener listener(event_loop, "127.0.0.1"_sv, 0);
+    auto client = net::AsyncTcpStream::connect(event_loop, "127.0.0.1"_sv, listener.local_port());
+
+    auto body = [&]() -> coro::Task<CString> {
+        auto server = co_await listener.accept();
+        server->set_idle_timeout(20);
+        try {
+            co_await server->read(); // 客户端不发送数据
+        } catch (const Exception& e) {
+            co_return CString{e.what()};
+        }
+        co_return CString{"no timeout"};
+    };
+
+    // When
+    auto message = event_loop.block_on(body());
+
+    // Then
+    Assertions::assertTrue(message.find("Connection idle timeout") != npos);
+}
+
+GROUP_NAME("test_event_loop")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_fire_timers_in_deadline_order),
+    UNIT_TEST_ITEM(should_reset_and_cancel_timers),
+    UNIT_TEST_ITEM(should_run_posted_task_from_other_thread),
+    UNIT_TEST_ITEM(should_invoke_readiness_callback),
+    UNIT_TEST_ITEM(should_echo_over_loopback),
+    UNIT_TEST_ITEM(should_serve_many_connections_on_one_thread),
+    UNIT_TEST_ITEM(should_time_out_idle_connection))
+
+} // namespace my::test::test_event_loop
+
+#endif // RICKY_LINUX
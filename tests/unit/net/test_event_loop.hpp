@@ -0,0 +1,16 @@
+#ifndef TEST_NET_EVENT_LOOP_HPP
+#define TEST_NET_EVENT_LOOP_HPP
+
+namespace my::test::test_event_loop {
+
+void should_fire_timers_in_deadline_order();
+void should_reset_and_cancel_timers();
+void should_run_posted_task_from_other_thread();
+void should_invoke_readiness_callback();
+void should_echo_over_loopback();
+void should_serve_many_connections_on_one_thread();
+void should_time_out_idle_connection();
+
+} // namespace my::test::test_event_loop
+
+#endif
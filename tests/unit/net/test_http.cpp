@@ -0,0 +1,256 @@
+#include "test_http.hpp"
+#include "net/http_server.hpp"
+#include "ricky_test.hpp"
+
+namespace my::test::test_http {
+
+using namespace net::http;
+
+static str::StringView sv(const char* s) {
+    return str::StringView(s);
+}
+
+static str::String<> join(util::Vec<plat::IoSlice>& slices) {
+    str::String<> res;
+    for (const auto& s : slices) {
+        res.push_str(str::StringView(s.data, s.size));
+    }
+    return res;
+}
+
+void should_parse_request_with_headers_and_query() {
+    // Given
+    const auto raw = sv("GET /hello?name=Ricky&x=1 HTTP/1.1\r\nHost: localhost\r\nX-Trace:  abc \r\n\r\n");
+    RequestParser parser;
+    Request req;
+
+    // When
+    const auto status = parser.parse(raw, req);
+
+    // Then
+    Assertions::assertTrue(status == ParseStatus::Complete);
+    Assertions::assertEquals(raw.len(), parser.consumed());
+    Assertions::assertTrue(req.method == Method::Get);
+    Assertions::assertEquals(sv("/hello"), req.path);
+    Assertions::assertEquals(sv("name=Ricky&x=1"), req.query);
+    Assertions::assertEquals(sv("Ricky"), req.query_param(sv("name")).unwrap());
+    Assertions::assertTrue(req.query_param(sv("missing")).is_none());
+    Assertions::assertEquals(sv("localhost"), req.header(sv("host")).unwrap());
+    Assertions::assertEquals(sv("abc"), req.header(sv("X-TRACE")).unwrap());
+    Assertions::assertEquals(2uz, req.headers.len());
+    // 零拷贝：视图指向输入缓冲区
+    Assertions::assertTrue(req.path.as_bytes() == raw.as_bytes() + 4);
+}
+
+void should_parse_request_incrementally() {
+    // Given
+    const auto raw = sv("POST /submit HTTP/1.1\r\nContent-Length: 9\r\n\r\ntest data");
+    RequestParser parser;
+    Request req;
+
+    // When
+    usize incomplete = 0;
+    auto status = ParseStatus::Incomplete;
+    for (usize n = 1; n <= raw.len(); ++n) {
+        status = parser.parse(raw.slice(0, n), req);
+        if (status == ParseStatus::Incomplete) ++incomplete;
+    }
+
+    // Then
+    Assertions::assertTrue(status == ParseStatus::Complete);
+    Assertions::assertEquals(raw.len() - 1, incomplete);
+    Assertions::assertTrue(parser.head_complete());
+    Assertions::assertEquals(sv("test data"), req.body);
+}
+
+void should_parse_pipelined_requests_with_body() {
+    // Given
+    const auto raw = sv("POST /a HTTP/1.1\r\nContent-Length: 3\r\n\r\nabcGET /b HTTP/1.1\r\n\r\nGET /c HTTP/1.1\r\n");
+    RequestParser parser;
+    Request req;
+
+    // When
+    Assertions::assertTrue(parser.parse(raw, req) == ParseStatus::Complete);
+    const auto first = req.body;
+    usize offset = parser.consumed();
+    parser.reset();
+    Assertions::assertTrue(parser.parse(raw.slice(offset), req) == ParseStatus::Complete);
+    const auto second = req.path;
+    offset += parser.consumed();
+    parser.reset();
+    const auto third = parser.parse(raw.slice(offset), req);
+
+    // Then
+    Assertions::assertEquals(sv("abc"), first);
+    Assertions::assertEquals(sv("/b"), second);
+    Assertions::assertTrue(third == ParseStatus::Incomplete);
+}
+
+void should_decide_keep_alive_by_version_and_header() {
+    // Given
+    Request req;
+    const auto keep_alive = [&req](const char* raw) {
+        RequestParser parser;
+        Assertions::assertTrue(parser.parse(sv(raw), req) == ParseStatus::Complete);
+        return req.keep_alive;
+    };
+
+    // Then
+    Assertions::assertTrue(keep_alive("GET / HTTP/1.1\r\n\r\n"));
+    Assertions::assertFalse(keep_alive("GET / HTTP/1.1\r\nConnection: Close\r\n\r\n"));
+    Assertions::assertFalse(keep_alive("GET / HTTP/1.0\r\n\r\n"));
+    Assertions::assertTrue(keep_alive("GET / HTTP/1.0\r\nConnection: foo, keep-alive\r\n\r\n"));
+}
+
+void should_reject_malformed_requests() {
+    // Given
+    const auto status_of = [](const char* raw) -> u16 {
+        RequestParser parser(16);
+        Request req;
+        return parser.parse(sv(raw), req) == ParseStatus::Error ? parser.error_status() : 0;
+    };
+
+    // Then
+    Assertions::assertEquals(400, static_cast<i32>(status_of("GET /\r\n\r\n")));
+    Assertions::assertEquals(400, static_cast<i32>(status_of("GET / HTTP/1.1\r\nBad Header\r\n\r\n")));
+    Assertions::assertEquals(400, static_cast<i32>(status_of("GET / HTTP/1.1\r\nHost : x\r\n\r\n")));
+    Assertions::assertEquals(400, static_cast<i32>(status_of("GET / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n")));
+    Assertions::assertEquals(400, static_cast<i32>(status_of("GET / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 2\r\n\r\n")));
+    Assertions::assertEquals(413, static_cast<i32>(status_of("POST / HTTP/1.1\r\nContent-Length: 17\r\n\r\n")));
+    Assertions::assertEquals(501, static_cast<i32>(status_of("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n")));
+    Assertions::assertEquals(505, static_cast<i32>(status_of("GET / HTTP/2.0\r\n\r\n")));
+}
+
+void should_reject_bare_cr() {
+    // Given
+    const auto status_of = [](const char* raw) -> u16 {
+        RequestParser parser;
+        Request req;
+        return parser.parse(sv(raw), req) == ParseStatus::Error ? parser.error_status() : 0;
+    };
+
+    // Then
+    Assertions::assertEquals(400, static_cast<i32>(status_of("GET / HTTP/1.1\rX\r\n\r\n")));
+    Assertions::assertEquals(400, static_cast<i32>(status_of("POST / HTTP/1.1\r\nX: a\rZContent-Length: 5\r\n\r\nhello")));
+}
+
+void should_route_by_method_and_path() {
+    // Given
+    Router router;
+    router.get(sv("/"), [](const Request&, Response& res) { res.body(sv("root")); })
+        .get(sv("/static/*"), [](const Request& req, Response& res) { res.body(req.path); })
+        .post(sv("/submit"), [](const Request& req, Response& res) { res.status(201).body(req.body); })
+        .get(sv("/boom"), [](const Request&, Response&) { throw runtime_exception("boom"); });
+    const auto call = [&router](const char* raw) {
+        RequestParser parser;
+        Request req;
+        Response res;
+        parser.parse(sv(raw), req);
+        router.dispatch(req, res);
+        return res;
+    };
+
+    // Then
+    Assertions::assertEquals(sv("root"), call("GET / HTTP/1.1\r\n\r\n").body());
+    Assertions::assertEquals(sv("root"), call("HEAD / HTTP/1.1\r\n\r\n").body());
+    Assertions::assertEquals(sv("/static/a/b.css"), call("GET /static/a/b.css HTTP/1.1\r\n\r\n").body());
+    Assertions::assertEquals(201, static_cast<i32>(call("POST /submit HTTP/1.1\r\nContent-Length: 2\r\n\r\nhi").status()));
+    Assertions::assertEquals(405, static_cast<i32>(call("GET /submit HTTP/1.1\r\n\r\n").status()));
+    Assertions::assertEquals(404, static_cast<i32>(call("GET /missing HTTP/1.1\r\n\r\n").status()));
+    Assertions::assertEquals(500, static_cast<i32>(call("GET /boom HTTP/1.1\r\n\r\n").status()));
+}
+
+void should_serialize_pipelined_responses() {
+    // Given
+    ResponseWriter out;
+    Response res;
+    str::String<> big;
+    for (usize i = 0; i < ResponseWriter::COPY_THRESHOLD; ++i) {
+        big.push_str(sv("x"));
+    }
+
+    // When
+    res.content_type(sv("text/plain")).body(sv("hello"));
+    out.append(res, true, 1, false);
+    res.clear();
+    res.status(404).body(big.as_str());
+    out.append(res, true, 0, false);
+    res.clear();
+    res.body(sv("hidden"));
+    out.append(res, false, 1, true);
+    auto& slices = out.slices();
+
+    // Then
+    // 首部与小响应体合成一段，大响应体单独引用，其后的首部再成一段
+    Assertions::assertEquals(3uz, slices.len());
+    Assertions::assertTrue(slices.at(1).data == reinterpret_cast<const char*>(big.as_str().as_bytes()));
+    str::String<> expected(sv("HTTP/1.1 200 OK\r\nContent-Length: 5\r\nContent-Type: text/plain\r\n\r\nhello"
+                              "HTTP/1.1 404 Not Found\r\nContent-Length: 1024\r\nConnection: keep-alive\r\n\r\n"));
+    expected.push_str(big.as_str());
+    expected.push_str(sv("HTTP/1.1 200 OK\r\nContent-Length: 6\r\nConnection: close\r\n\r\n"));
+    Assertions::assertEquals(expected, join(slices));
+}
+
+#if RICKY_LINUX
+static coro::Task<str::String<>> exchange(net::EventLoop& event_loop, const u16 port, str::String<> requests) {
+    auto client = net::AsyncTcpStream::connect(event_loop, "127.0.0.1"_sv, port);
+    co_await client->write(requests.as_str());
+    str::String<> reply;
+    loop {
+        auto data = co_await client->read(4096);
+        if (data.len() == 0) break;
+        reply.push_str(data.as_str());
+    }
+    co_return reply;
+}
+#endif
+
+void should_serve_pipelined_requests_over_loopback() {
+#if RICKY_LINUX
+    // Given
+    Router router;
+    router.get(sv("/hello"), [](const Request& req, Response& res) {
+        res.body(str::String<>(req.query_param(sv("name")).unwrap_or(sv("world"))));
+    });
+    router.post(sv("/echo"), [](const Request& req, Response& res) { res.body(req.body); });
+    HttpServer server(router, ServerConfig{.read_buffer = 64});
+    net::EventLoop event_loop;
+    net::AsyncTcpListener listener(event_loop, "127.0.0.1"_sv, 0);
+    event_loop.spawn(server.serve(event_loop, listener));
+
+    // When
+    str::String<> body;
+    for (usize i = 0; i < 200; ++i) {
+        body.push_str(sv("0123456789"));
+    }
+    str::String<> requests(sv("GET /hello?name=Ricky HTTP/1.1\r\n\r\nPOST /echo HTTP/1.1\r\nContent-Length: 2000\r\n\r\n"));
+    requests.push_str(body.as_str());
+    requests.push_str(sv("GET /nope HTTP/1.1\r\nConnection: close\r\n\r\n"));
+    const auto reply = event_loop.block_on(exchange(event_loop, listener.local_port(), std::move(requests)));
+
+    // Then
+    str::String<> expected(sv("HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nRicky"
+                              "HTTP/1.1 200 OK\r\nContent-Length: 2000\r\n\r\n"));
+    expected.push_str(body.as_str());
+    expected.push_str(sv("HTTP/1.1 404 Not Found\r\nContent-Length: 9\r\nConnection: close\r\n\r\nNot Found"));
+    Assertions::assertEquals(expected, reply);
+    Assertions::assertEquals(3ull, server.requests_served());
+    listener.close();
+    event_loop.run_once(0);
+    Assertions::assertEquals(0uz, server.active_connections());
+#endif
+}
+
+GROUP_NAME("test_http")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_parse_request_with_headers_and_query),
+    UNIT_TEST_ITEM(should_parse_request_incrementally),
+    UNIT_TEST_ITEM(should_parse_pipelined_requests_with_body),
+    UNIT_TEST_ITEM(should_decide_keep_alive_by_version_and_header),
+    UNIT_TEST_ITEM(should_reject_malformed_requests),
+    UNIT_TEST_ITEM(should_reject_bare_cr),
+    UNIT_TEST_ITEM(should_route_by_method_and_path),
+    UNIT_TEST_ITEM(should_serialize_pipelined_responses),
+    UNIT_TEST_ITEM(should_serve_pipelined_requests_over_loopback))
+
+} // namespace my::test::test_http
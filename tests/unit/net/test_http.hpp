@@ -0,0 +1,18 @@
+#ifndef TEST_NET_HTTP_HPP
+#define TEST_NET_HTTP_HPP
+
+namespace my::test::test_http {
+
+void should_parse_request_with_headers_and_query();
+void should_parse_request_incrementally();
+void should_parse_pipelined_requests_with_body();
+void should_decide_keep_alive_by_version_and_header();
+void should_reject_malformed_requests();
+void should_reject_bare_cr();
+void should_route_by_method_and_path();
+void should_serialize_pipelined_responses();
+void should_serve_pipelined_requests_over_loopback();
+
+} // namespace my::test::test_http
+
+#endif
@@ -34,6 +34,21 @@ void should_parse_ipv4_from_str() {
     Assertions::assertEquals("192.168.1.100"_sv, ip.to_string().as_str());
 }
 
+void should_parse_ipv4_strictly() {
+    const char* valid[] = {"0.0.0.0", "255.255.255.255", "10.0.0.1", "1.22.133.4"};
+    for (const auto* s : valid) {
+        const auto ip = net::Ipv4Addr::parse(str::StringView(s));
+        Assertions::assertTrue(ip.is_some());
+        Assertions::assertEquals(str::StringView(s), ip.unwrap().to_string().as_str());
+    }
+    const char* invalid[] = {"", "1.2.3", "1.2.3.4.5", "256.0.0.1", "1..2.3", ".1.2.3", "1.2.3.", "01.2.3.4",
+                             "1.2.3.4 ", "a.b.c.d", "1.2.3.1000", "1234.1.1.1"};
+    for (const auto* s : invalid) {
+        Assertions::assertTrue(net::Ipv4Addr::parse(str::StringView(s)).is_none());
+    }
+    Assertions::assertThrows("Invalid IPv4 address '1.2.3'", [] { net::Ipv4Addr::from_str("1.2.3"_sv); });
+}
+
 void should_construct_ipv6() {
     auto ip = net::Ipv6Addr::from_str("::1"_sv);
     Assertions::assertEquals("0:0:0:0:0:0:0:1"_sv, ip.to_string().as_str());
@@ -85,6 +100,7 @@ REGISTER_UNIT_TESTS(
     UNIT_TEST_ITEM(should_ipv4_broadcast),
     UNIT_TEST_ITEM(should_ipv4_to_u32),
     UNIT_TEST_ITEM(should_parse_ipv4_from_str),
+    UNIT_TEST_ITEM(should_parse_ipv4_strictly),
     UNIT_TEST_ITEM(should_construct_ipv6),
     UNIT_TEST_ITEM(should_ipv6_any),
     UNIT_TEST_ITEM(should_ipv6_loopback),
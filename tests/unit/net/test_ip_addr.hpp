@@ -9,6 +9,7 @@ void should_ipv4_loopback();
 void should_ipv4_broadcast();
 void should_ipv4_to_u32();
 void should_parse_ipv4_from_str();
+void should_parse_ipv4_strictly();
 void should_construct_ipv6();
 void should_ipv6_any();
 void should_ipv6_loopback();
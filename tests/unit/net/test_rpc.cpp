@@ -0,0 +1,376 @@
+#include "test_rpc.hpp"
+#include "net/rpc.hpp"
+#include "net/tcp.hpp"
+#include "ricky_test.hpp"
+#include "when_all.hpp"
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace my::test::test_rpc {
+
+using namespace net::rpc;
+
+namespace {
+
+str::StringView sv(const char* s) {
+    return str::StringView(s);
+}
+
+str::String<> join(util::Vec<plat::IoSlice>& slices) {
+    str::String<> res;
+    for (const auto& s : slices) {
+        res.push_str(str::StringView(s.data, s.size));
+    }
+    return res;
+}
+
+/**
+ * @brief 把 bytes 追加进解码器，每次 chunk 字节
+ */
+void feed(net::FrameDecoder& decoder, const str::StringView bytes, const usize chunk) {
+    for (usize pos = 0; pos < bytes.len();) {
+        auto space = decoder.prepare();
+        const usize n = std::min({chunk, space.size(), bytes.len() - pos});
+        std::memcpy(space.data(), bytes.as_bytes() + pos, n);
+        decoder.commit(n);
+        pos += n;
+    }
+}
+
+str::String<> owned(const std::string& s) {
+    return str::String<>(str::StringView(s.data(), s.size()));
+}
+
+struct MemorySource {
+    std::string data;
+    usize pos{0};
+
+    usize read_into(char* buf, const usize size) {
+        const usize n = std::min(size, data.size() - pos);
+        std::memcpy(buf, data.data() + pos, n);
+        pos += n;
+        return n;
+    }
+};
+
+struct MemorySink {
+    std::string data;
+    usize calls{0};
+
+    usize write_vectored(const plat::IoSlice* slices, const usize n) {
+        ++calls;
+        usize total = 0;
+        for (usize i = 0; i < n; ++i) {
+            data.append(slices[i].data, slices[i].size);
+            total += slices[i].size;
+        }
+        return total;
+    }
+};
+
+} // namespace
+
+void should_round_trip_varints() {
+    // Given
+    const u64 values[] = {0, 1, 127, 128, 300, 16383, 16384, 1ull << 35, ~0ull};
+    const usize lengths[] = {1, 1, 1, 2, 2, 2, 3, 6, 10};
+
+    for (usize i = 0; i < std::size(values); ++i) {
+        // When
+        u8 buf[net::MAX_VARINT_LEN];
+        const usize n = net::encode_varint(values[i], buf);
+        u64 decoded = 0;
+        const usize consumed = net::decode_varint(buf, n, decoded);
+
+        // Then
+        Assertions::assertEquals(lengths[i], n);
+        Assertions::assertEquals(n, consumed);
+        Assertions::assertEquals(values[i], decoded);
+        // 截断的输入需要更多数据
+        Assertions::assertEquals(0uz, net::decode_varint(buf, n - 1, decoded));
+    }
+}
+
+void should_reject_overlong_varint() {
+    // Given
+    u8 overflow[net::MAX_VARINT_LEN];
+    std::memset(overflow, 0xff, sizeof(overflow));
+    overflow[net::MAX_VARINT_LEN - 1] = 0x02; // 第 64 位之后还有数据
+    u8 too_long[net::MAX_VARINT_LEN + 1];
+    std::memset(too_long, 0x80, sizeof(too_long));
+    u64 value = 0;
+
+    // When & Then
+    Assertions::assertThrows("Varint overflows 64 bits",
+                             [&] { net::decode_varint(overflow, sizeof(overflow), value); });
+    Assertions::assertThrows("Varint overflows 64 bits",
+                             [&] { net::decode_varint(too_long, sizeof(too_long), value); });
+}
+
+void should_decode_frames_fed_byte_by_byte() {
+    // Given
+    str::String<> body;
+    for (usize i = 0; i < 300; ++i) {
+        body.push_str(sv("x"));
+    }
+    net::FrameEncoder encoder;
+    encoder.push(sv("hello"));
+    encoder.push(str::StringView{});
+    encoder.push(sv("hd:"), body.as_str());
+    const auto bytes = join(encoder.slices());
+    net::FrameDecoder decoder(16);
+
+    // When
+    util::Vec<str::String<>> frames;
+    for (usize pos = 0; pos < bytes.len(); ++pos) {
+        feed(decoder, bytes.as_str().slice(pos, pos + 1), 1);
+        for (auto f = decoder.next(); f.is_some(); f = decoder.next()) {
+            frames.push(str::String<>(f.unwrap()));
+        }
+    }
+
+    // Then
+    str::String<> third(sv("hd:"));
+    third.push_str(body.as_str());
+    Assertions::assertEquals(3uz, frames.len());
+    Assertions::assertEquals(sv("hello"), frames.at(0).as_str());
+    Assertions::assertEquals(0uz, frames.at(1).len());
+    Assertions::assertEquals(third, frames.at(2));
+    Assertions::assertEquals(0uz, decoder.buffered());
+}
+
+void should_grow_decoder_for_large_frame_and_enforce_limit() {
+    // Given
+    str::String<> big;
+    for (usize i = 0; i < 10000; ++i) {
+        big.push_str(sv("0123456789"));
+    }
+    net::FrameEncoder encoder;
+    encoder.push(big.as_str());
+    encoder.push(sv("tail"));
+    const auto bytes = join(encoder.slices());
+    net::FrameDecoder decoder(64);
+    net::FrameDecoder limited(64, 1000);
+
+    // When
+    feed(decoder, bytes.as_str(), 4096);
+    const auto first = decoder.next();
+    Assertions::assertTrue(first.is_some());
+    const str::String<> copy(first.unwrap());
+    const auto second = decoder.next();
+    feed(limited, bytes.as_str().slice(0, 8), 8);
+
+    // Then
+    Assertions::assertEquals(big, copy);
+    Assertions::assertEquals(sv("tail"), second.unwrap());
+    Assertions::assertTrue(decoder.next().is_none());
+    Assertions::assertThrows("Frame of 100000 bytes exceeds limit 1000", [&] { limited.next(); });
+}
+
+void should_batch_frames_into_few_slices() {
+    // Given
+    str::String<> big;
+    for (usize i = 0; i < net::FrameEncoder::COPY_THRESHOLD; ++i) {
+        big.push_str(sv("b"));
+    }
+    net::FrameEncoder encoder;
+
+    // When
+    encoder.push(sv("a"));
+    encoder.push(sv("h"), big.as_str());
+    encoder.push(sv("c"));
+    encoder.push(sv("d"));
+    auto& slices = encoder.slices();
+
+    // Then
+    // 小帧与前缀合成一段，大负载单独引用，其后的小帧再成一段
+    Assertions::assertEquals(4uz, encoder.frames());
+    Assertions::assertEquals(3uz, slices.len());
+    Assertions::assertTrue(slices.at(1).data == reinterpret_cast<const char*>(big.as_str().as_bytes()));
+    str::String<> expected(sv("\x01"
+                              "a\x81\x08h"));
+    expected.push_str(big.as_str());
+    expected.push_str(sv("\x01"
+                         "c\x01"
+                         "d"));
+    Assertions::assertEquals(expected, join(slices));
+    encoder.clear();
+    Assertions::assertTrue(encoder.is_empty());
+}
+
+void should_read_and_write_frames_through_buffered_io() {
+    // Given
+    MemorySink sink;
+    char wbuf[256];
+    {
+        io::BufWriter writer(sink, wbuf);
+        for (usize i = 0; i < 20; ++i) {
+            net::write_frame(writer, sv("frame"));
+        }
+        writer.flush();
+    }
+    MemorySource source{sink.data};
+    char rbuf[64];
+    io::BufReader reader(source, rbuf);
+
+    // When
+    usize count = 0;
+    for (auto f = net::read_frame(reader); f.is_some(); f = net::read_frame(reader)) {
+        Assertions::assertEquals(sv("frame"), f.unwrap());
+        ++count;
+    }
+
+    // Then
+    Assertions::assertEquals(20uz, count);
+    Assertions::assertEquals(1uz, sink.calls);
+}
+
+void should_read_short_frames_over_live_tcp_stream() {
+    // Given
+    auto listener = net::TcpListener::bind("127.0.0.1"_sv, 0);
+    const u16 port = listener.local_port();
+    std::thread echo([&listener]() {
+        auto server = listener.accept();
+        char in[64];
+        char out[64];
+        io::BufReader reader(*server, in);
+        io::BufWriter writer(*server, out);
+        for (auto f = net::read_frame(reader); f.is_some(); f = net::read_frame(reader)) {
+            net::write_frame(writer, f.unwrap());
+            writer.flush();
+        }
+    });
+    auto client = net::TcpStream::connect("127.0.0.1"_sv, port);
+    char in[64];
+    char out[64];
+    io::BufReader reader(client, in);
+    io::BufWriter writer(client, out);
+    util::Vec<str::String<>> replies;
+
+    // When
+    for (const auto payload : {sv(""), sv("a"), sv("xy")}) {
+        // 对端收到一帧后等待应答，连接保持打开
+        net::write_frame(writer, payload);
+        writer.flush();
+        replies.push(str::String<>(net::read_frame(reader).unwrap()));
+    }
+    client.close();
+    echo.join();
+    listener.close();
+
+    // Then
+    Assertions::assertEquals(3uz, replies.len());
+    Assertions::assertEquals(sv(""), replies.at(0).as_str());
+    Assertions::assertEquals(sv("a"), replies.at(1).as_str());
+    Assertions::assertEquals(sv("xy"), replies.at(2).as_str());
+}
+
+#if RICKY_LINUX
+static coro::Task<util::Vec<str::String<>>> call_many(RpcClient& client, const usize n) {
+    util::Vec<coro::Task<str::String<>>> calls;
+    util::Vec<str::String<>> args;
+    for (usize i = 0; i < n; ++i) {
+        args.push(str::String<>(sv("n")));
+        for (usize k = 0; k < i % 5; ++k) {
+            args.last().push_str(sv("!"));
+        }
+    }
+    for (usize i = 0; i < n; ++i) {
+        calls.push(client.call(i % 2 == 0 ? 1 : 2, args.at(i).as_str()));
+    }
+    co_return co_await coro::when_all(std::move(calls));
+}
+#endif
+
+void should_multiplex_concurrent_calls_on_one_connection() {
+#if RICKY_LINUX
+    // Given
+    RpcServer server;
+    server.method(1, [](const str::StringView arg) {
+        str::String<> res(sv("echo:"));
+        res.push_str(arg);
+        return res;
+    });
+    server.method(2, [](const str::StringView arg) { return owned(std::format("len:{}", arg.len())); });
+    net::EventLoop event_loop;
+    net::AsyncTcpListener listener(event_loop, "127.0.0.1"_sv, 0);
+    event_loop.spawn(server.serve(event_loop, listener));
+    auto client = RpcClient::connect(event_loop, "127.0.0.1"_sv, listener.local_port());
+
+    // When
+    const auto results = event_loop.block_on(call_many(*client, 100));
+
+    // Then
+    Assertions::assertEquals(100uz, results.len());
+    for (usize i = 0; i < results.len(); ++i) {
+        if (i % 2 == 0) {
+            str::String<> expected(sv("echo:n"));
+            for (usize k = 0; k < i % 5; ++k) {
+                expected.push_str(sv("!"));
+            }
+            Assertions::assertEquals(expected, results.at(i));
+        } else {
+            Assertions::assertEquals(owned(std::format("len:{}", 1 + i % 5)), results.at(i));
+        }
+    }
+    Assertions::assertEquals(100ull, server.calls_served());
+    Assertions::assertEquals(0uz, client->in_flight());
+    Assertions::assertEquals(1uz, server.active_connections());
+    client.reset();
+    listener.close();
+    event_loop.run_once(0);
+    event_loop.run_once(0);
+    Assertions::assertEquals(0uz, server.active_connections());
+#endif
+}
+
+#if RICKY_LINUX
+static coro::Task<str::String<>> call_and_capture(RpcClient& client, const u32 method) {
+    try {
+        co_return co_await client.call(method, sv("arg"));
+    } catch (const Exception& e) {
+        co_return str::String<>(e.message());
+    }
+}
+#endif
+
+void should_report_remote_errors_and_closed_connection() {
+#if RICKY_LINUX
+    // Given
+    RpcServer server;
+    server.method(0, [](str::StringView) -> str::String<> { throw runtime_exception("boom"); });
+    net::EventLoop event_loop;
+    net::AsyncTcpListener listener(event_loop, "127.0.0.1"_sv, 0);
+    event_loop.spawn(server.serve(event_loop, listener));
+    auto client = RpcClient::connect(event_loop, "127.0.0.1"_sv, listener.local_port());
+
+    // When
+    const auto failed = event_loop.block_on(call_and_capture(*client, 0));
+    const auto unknown = event_loop.block_on(call_and_capture(*client, 7));
+    client->close();
+    const auto closed = event_loop.block_on(call_and_capture(*client, 0));
+
+    // Then
+    Assertions::assertEquals(sv("boom"), failed.as_str());
+    Assertions::assertEquals(sv("Unknown method 7"), unknown.as_str());
+    Assertions::assertEquals(sv("RPC connection is closed"), closed.as_str());
+    listener.close();
+    event_loop.run_once(0);
+#endif
+}
+
+GROUP_NAME("test_rpc")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_round_trip_varints),
+    UNIT_TEST_ITEM(should_reject_overlong_varint),
+    UNIT_TEST_ITEM(should_decode_frames_fed_byte_by_byte),
+    UNIT_TEST_ITEM(should_grow_decoder_for_large_frame_and_enforce_limit),
+    UNIT_TEST_ITEM(should_batch_frames_into_few_slices),
+    UNIT_TEST_ITEM(should_read_and_write_frames_through_buffered_io),
+    UNIT_TEST_ITEM(should_read_short_frames_over_live_tcp_stream),
+    UNIT_TEST_ITEM(should_multiplex_concurrent_calls_on_one_connection),
+    UNIT_TEST_ITEM(should_report_remote_errors_and_closed_connection))
+
+} // namespace my::test::test_rpc
@@ -0,0 +1,18 @@
+#ifndef TEST_NET_RPC_HPP
+#define TEST_NET_RPC_HPP
+
+namespace my::test::test_rpc {
+
+void should_round_trip_varints();
+void should_reject_overlong_varint();
+void should_decode_frames_fed_byte_by_byte();
+void should_grow_decoder_for_large_frame_and_enforce_limit();
+void should_batch_frames_into_few_slices();
+void should_read_and_write_frames_through_buffered_io();
+void should_read_short_frames_over_live_tcp_stream();
+void should_multiplex_concurrent_calls_on_one_connection();
+void should_report_remote_errors_and_closed_connection();
+
+} // namespace my::test::test_rpc
+
+#endif
@@ -0,0 +1,104 @@
+#include "test_sharded_listener.hpp"
+#include "net/sharded_listener.hpp"
+#include "ricky_test.hpp"
+
+#include <format>
+#include <thread>
+
+namespace my::test::test_sharded_listener {
+
+void should_build_configured_listener() {
+    // Given
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0)
+                        .backlog(16)
+                        .nodelay(true)
+                        .defer_accept(1)
+                        .recv_buffer(64 * 1024)
+                        .send_buffer(64 * 1024)
+                        .build();
+
+    // When
+    auto client = net::TcpStream::connect("127.0.0.1"_sv, listener.local_port());
+    client.write("ping"_sv); // TCP_DEFER_ACCEPT 下有数据到达后 accept 才返回
+    auto server = listener.accept();
+
+    // Then
+    Assertions::assertEquals(str::String<>{"ping"}, server->read(16));
+}
+
+void should_share_port_across_shards() {
+    // Given
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).shards(4).build_sharded();
+
+    // Then
+    Assertions::assertTrue(listener->local_port() != 0);
+    Assertions::assertTrue(listener->num_shards() == 4 || listener->num_shards() == 1);
+    Assertions::assertEquals(0ull, listener->total_accepted());
+}
+
+void should_echo_on_sharded_listener() {
+#if RICKY_LINUX
+    // Given
+    constexpr usize n = 64;
+    std::atomic<usize> finished{0};
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).shards(4).nodelay(true).build_sharded();
+    listener->start([&finished](std::unique_ptr<net::AsyncTcpStream> stream) -> coro::Task<> {
+        loop {
+            auto data = co_await stream->read(1024);
+            if (data.len() == 0) break;
+            co_await stream->write(data.as_str());
+        }
+        finished.fetch_add(1);
+    });
+
+    // When
+    for (usize i = 0; i < n; ++i) {
+        auto client = net::TcpStream::connect("127.0.0.1"_sv, listener->local_port());
+        const auto msg = std::format("msg-{}", i);
+        client.write(str::StringView(msg.c_str()));
+        Assertions::assertEquals(str::String<>{msg.c_str()}, client.read(64));
+    }
+    while (finished.load() < n) {
+        std::this_thread::yield();
+    }
+    listener->stop();
+
+    // Then
+    Assertions::assertEquals(static_cast<u64>(n), listener->total_accepted());
+    u64 sum = 0;
+    for (usize i = 0; i < listener->num_shards(); ++i) {
+        sum += listener->accepted(i);
+    }
+    Assertions::assertEquals(static_cast<u64>(n), sum);
+#endif
+}
+
+void should_reject_invalid_builder_usage() {
+#if RICKY_LINUX
+    // Given
+    auto listener = net::TcpListenerBuilder("127.0.0.1"_sv, 0).shards(2).build_sharded();
+    auto handler = [](std::unique_ptr<net::AsyncTcpStream>) -> coro::Task<> { co_return; };
+    listener->start(handler);
+
+    // Then
+    Assertions::assertThrows("Shard count must be positive", []() {
+        net::TcpListenerBuilder("127.0.0.1"_sv, 0).shards(0);
+    });
+    Assertions::assertThrows("ShardedTcpListener is already started", [&]() {
+        listener->start(handler);
+    });
+    Assertions::assertThrows("Shard 2 out of bounds [0..2)", [&]() {
+        (void)listener->accepted(2);
+    });
+    listener->stop();
+#endif
+}
+
+GROUP_NAME("test_sharded_listener")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(should_build_configured_listener),
+    UNIT_TEST_ITEM(should_share_port_across_shards),
+    UNIT_TEST_ITEM(should_echo_on_sharded_listener),
+    UNIT_TEST_ITEM(should_reject_invalid_builder_usage))
+
+} // namespace my::test::test_sharded_listener
@@ -0,0 +1,13 @@
+#ifndef TEST_NET_SHARDED_LISTENER_HPP
+#define TEST_NET_SHARDED_LISTENER_HPP
+
+namespace my::test::test_sharded_listener {
+
+void should_build_configured_listener();
+void should_share_port_across_shards();
+void should_echo_on_sharded_listener();
+void should_reject_invalid_builder_usage();
+
+} // namespace my::test::test_sharded_listener
+
+#endif
@@ -2,6 +2,9 @@
 #include "net/tcp.hpp"
 #include "ricky_test.hpp"
 
+#include <string>
+#include <thread>
+
 namespace my::test::test_tcp {
 
 void should_construct_tcp_listener() {
@@ -32,11 +35,56 @@ void should_tcp_listener_accept() {
     listener.close();
 }
 
+void should_send_file() {
+    // Given
+    const char* path = "test_tcp_send_file.tmp";
+    std::string data;
+    for (usize i = 0; i < 200000; ++i) {
+        data.push_back(static_cast<char>('0' + i % 10));
+    }
+    {
+        auto out = fs::File::create(path);
+        out.write(data.data(), data.size());
+    }
+    auto file = fs::File::open(path);
+    auto listener = net::TcpListener::bind(str::StringView("127.0.0.1"), 0);
+    auto client = net::TcpStream::connect(str::StringView("127.0.0.1"), listener.local_port());
+    auto server = listener.accept();
+
+    // When
+    constexpr u64 offset = 1000;
+    constexpr usize len = 150000;
+    usize sent = 0, past_end = 1;
+    std::thread sender([&]() {
+        sent = server->send_file(file, offset, len);
+        past_end = server->send_file(file, data.size(), 10);
+        server->close();
+    });
+    std::string received;
+    char buf[8192];
+    while (const usize n = client.read_into(buf, sizeof(buf))) {
+        received.append(buf, n);
+    }
+    sender.join();
+
+    // Then
+    Assertions::assertEquals(len, sent);
+    Assertions::assertEquals(0uz, past_end);
+    Assertions::assertTrue(received == data.substr(offset, len));
+
+    // Final
+    client.close();
+    listener.close();
+    file.close();
+    plat::fs::remove(str::StringView(path));
+}
+
 GROUP_NAME("test_tcp")
 REGISTER_UNIT_TESTS(
     UNIT_TEST_ITEM(should_construct_tcp_listener),
     UNIT_TEST_ITEM(should_construct_tcp_listener_by_port),
     UNIT_TEST_ITEM(should_tcp_listener_close),
-    UNIT_TEST_ITEM(should_tcp_listener_accept))
+    UNIT_TEST_ITEM(should_tcp_listener_accept),
+    UNIT_TEST_ITEM(should_send_file))
 
 } // namespace my::test::test_tcp
@@ -7,6 +7,7 @@ void should_construct_tcp_listener();
 void should_construct_tcp_listener_by_port();
 void should_tcp_listener_close();
 void should_tcp_listener_accept();
+void should_send_file();
 
 } // namespace my::test::test_tcp
 
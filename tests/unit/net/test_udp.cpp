@@ -32,11 +32,111 @@ void should_udp_send_to_and_recv_from() {
     client.close();
 }
 
+void should_udp_send_batch_and_recv_batch() {
+    // Given
+    auto server = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    auto client = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    server.set_read_timeout(2000);
+    const auto dst = server.local_addr();
+
+    constexpr usize N = 8;
+    char payloads[N][8];
+    plat::net::Datagram out[N];
+    for (usize i = 0; i < N; ++i) {
+        payloads[i][0] = static_cast<char>('a' + i);
+        out[i] = plat::net::Datagram{.data = payloads[i], .len = i + 1, .addr = dst};
+    }
+
+    // When
+    const usize sent = client.send_batch(out);
+    char bufs[N][64];
+    plat::net::Datagram in[N];
+    for (usize i = 0; i < N; ++i) {
+        in[i] = plat::net::Datagram{.data = bufs[i], .capacity = sizeof(bufs[i])};
+    }
+    usize got = 0;
+    while (got < N) {
+        got += server.recv_batch(std::span(in + got, N - got));
+    }
+
+    // Then
+    Assertions::assertEquals(N, sent);
+    for (usize i = 0; i < N; ++i) {
+        Assertions::assertEquals(i + 1, in[i].len);
+        Assertions::assertEquals(static_cast<char>('a' + i), bufs[i][0]);
+        Assertions::assertTrue(in[i].addr == client.local_addr());
+        Assertions::assertFalse(in[i].truncated);
+    }
+
+    server.close();
+    client.close();
+}
+
+void should_udp_report_truncated_datagram() {
+    // Given
+    auto server = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    auto client = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    server.set_read_timeout(2000);
+    client.send_to(str::StringView("127.0.0.1"), server.local_port(), str::StringView("0123456789"));
+
+    // When
+    char buf[4];
+    plat::net::Datagram in{.data = buf, .capacity = sizeof(buf)};
+    const usize got = server.recv_batch(std::span(&in, 1));
+
+    // Then
+    Assertions::assertEquals(1uz, got);
+    Assertions::assertTrue(in.truncated);
+
+    server.close();
+    client.close();
+}
+
+void should_udp_split_gso_send_into_segments() {
+    // Given
+    auto server = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    auto client = net::UdpSocket::bind(str::StringView("127.0.0.1"), 0);
+    server.set_read_timeout(2000);
+    if (!client.set_gso(100)) {
+        return; // 内核不支持 UDP_SEGMENT
+    }
+
+    // When
+    char payload[250];
+    for (usize i = 0; i < sizeof(payload); ++i) {
+        payload[i] = static_cast<char>(i);
+    }
+    const plat::net::Datagram out{.data = payload, .len = sizeof(payload), .addr = server.local_addr()};
+    client.send_batch(std::span(&out, 1));
+
+    char bufs[3][512];
+    plat::net::Datagram in[3];
+    for (usize i = 0; i < 3; ++i) {
+        in[i] = plat::net::Datagram{.data = bufs[i], .capacity = sizeof(bufs[i])};
+    }
+    usize got = 0;
+    while (got < 3) {
+        got += server.recv_batch(std::span(in + got, 3 - got));
+    }
+
+    // Then
+    Assertions::assertEquals(100uz, in[0].len);
+    Assertions::assertEquals(100uz, in[1].len);
+    Assertions::assertEquals(50uz, in[2].len);
+    Assertions::assertEquals(static_cast<char>(200), bufs[2][0]);
+
+    server.close();
+    client.close();
+}
+
 GROUP_NAME("test_udp")
 REGISTER_UNIT_TESTS(
     UNIT_TEST_ITEM(should_construct_udp_socket),
     UNIT_TEST_ITEM(should_construct_udp_socket_by_port),
     UNIT_TEST_ITEM(should_udp_socket_close),
-    UNIT_TEST_ITEM(should_udp_send_to_and_recv_from))
+    UNIT_TEST_ITEM(should_udp_send_to_and_recv_from),
+    UNIT_TEST_ITEM(should_udp_send_batch_and_recv_batch),
+    UNIT_TEST_ITEM(should_udp_report_truncated_datagram),
+    UNIT_TEST_ITEM(should_udp_split_gso_send_into_segments))
 
 } // namespace my::test::test_udp
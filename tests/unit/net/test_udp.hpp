@@ -7,6 +7,9 @@ void should_construct_udp_socket();
 void should_construct_udp_socket_by_port();
 void should_udp_socket_close();
 void should_udp_send_to_and_recv_from();
+void should_udp_send_batch_and_recv_batch();
+void should_udp_report_truncated_datagram();
+void should_udp_split_gso_send_into_segments();
 
 } // namespace my::test::test_udp
 
@@ -0,0 +1,110 @@
+#include "test_vec_deque.hpp"
+#include "vec_deque.hpp"
+#include "ricky_test.hpp"
+
+#include <memory>
+
+namespace my::test::test_vec_deque {
+
+void it_works() {
+    // Given
+    util::VecDeque<i32> dq;
+    Assertions::assertTrue(dq.is_empty());
+
+    // When
+    dq.push_back(2), dq.push_back(3), dq.push_front(1);
+
+    // Then
+    Assertions::assertEquals(3, dq.len());
+    Assertions::assertEquals(1, dq.front());
+    Assertions::assertEquals(3, dq.back());
+    Assertions::assertEquals(2, dq[1]);
+    Assertions::assertEquals(3, dq[-1]);
+    Assertions::assertEquals(CString{"[1,2,3]"}, dq.to_string());
+
+    Assertions::assertEquals(1, dq.pop_front().unwrap());
+    Assertions::assertEquals(3, dq.pop_back().unwrap());
+    Assertions::assertEquals(2, dq.pop_front().unwrap());
+    Assertions::assertTrue(dq.pop_front().is_none());
+    Assertions::assertTrue(dq.pop_back().is_none());
+}
+
+void should_wrap_around() {
+    // Given
+    util::VecDeque<i32> dq{8};
+
+    // When: 头尾交替推进，使缓冲区回绕但不扩容
+    for (i32 i = 0; i < 100; ++i) {
+        dq.push_back(i);
+        dq.push_back(i + 1);
+        Assertions::assertEquals(i, dq.pop_front().unwrap());
+        Assertions::assertEquals(i + 1, dq.pop_front().unwrap());
+    }
+
+    // Then
+    Assertions::assertTrue(dq.is_empty());
+    Assertions::assertEquals(8, dq.capacity());
+}
+
+void should_grow() {
+    // Given
+    util::VecDeque<i32> dq;
+    for (i32 i = 0; i < 5; ++i) {
+        dq.push_back(i);
+    }
+    dq.pop_front(), dq.pop_front();
+
+    // When: 在回绕状态下扩容
+    for (i32 i = 5; i < 100; ++i) {
+        dq.push_back(i);
+    }
+    dq.push_front(1);
+
+    // Then
+    Assertions::assertEquals(99, dq.len());
+    Assertions::assertEquals(1, dq.front());
+    i32 expect = 2;
+    for (usize i = 1; i < dq.len(); ++i) {
+        Assertions::assertEquals(expect++, dq.at(i));
+    }
+}
+
+void should_hold_move_only_values() {
+    // Given
+    util::VecDeque<std::unique_ptr<i32>> dq;
+
+    // When
+    for (i32 i = 0; i < 20; ++i) {
+        dq.push_back(std::make_unique<i32>(i));
+    }
+    auto moved = std::move(dq);
+
+    // Then
+    Assertions::assertTrue(dq.is_empty());
+    Assertions::assertEquals(20, moved.len());
+    Assertions::assertEquals(0, *moved.pop_front().unwrap());
+    Assertions::assertEquals(19, *moved.pop_back().unwrap());
+}
+
+void should_fail_to_get_front_if_empty() {
+    // Given
+    util::VecDeque<i32> dq;
+
+    // When & Then
+    Assertions::assertThrows("VecDeque is empty.", [&]() {
+        dq.front();
+    });
+    Assertions::assertThrows("VecDeque is empty.", [&]() {
+        dq.back();
+    });
+}
+
+GROUP_NAME("test_vec_deque")
+REGISTER_UNIT_TESTS(
+    UNIT_TEST_ITEM(it_works),
+    UNIT_TEST_ITEM(should_wrap_around),
+    UNIT_TEST_ITEM(should_grow),
+    UNIT_TEST_ITEM(should_hold_move_only_values),
+    UNIT_TEST_ITEM(should_fail_to_get_front_if_empty))
+
+} // namespace my::test::test_vec_deque
@@ -0,0 +1,14 @@
+#ifndef TEST_VEC_DEQUE_HPP
+#define TEST_VEC_DEQUE_HPP
+
+namespace my::test::test_vec_deque {
+
+void it_works();
+void should_wrap_around();
+void should_grow();
+void should_hold_move_only_values();
+void should_fail_to_get_front_if_empty();
+
+} // namespace my::test::test_vec_deque
+
+#endif // TEST_VEC_DEQUE_HPP